@@ -0,0 +1,47 @@
+#ifndef DETECTION_H
+#define DETECTION_H
+
+#include <cstdint>
+#include <vector>
+
+namespace camun
+{
+    namespace simulator
+    {
+        // Plain versions of the ssl-vision detection messages. They use the same
+        // coordinate system and units as ssl-vision (millimetres and radians), and can be
+        // handed to in-process consumers without building protobuf messages
+
+        struct DetectionBall
+        {
+            float x;
+            float y;
+            float z;
+            float area;
+            float confidence;
+        };
+
+        struct DetectionRobot
+        {
+            uint32_t id;
+            float x;
+            float y;
+            float orientation;
+            float confidence;
+        };
+
+        struct DetectionFrame
+        {
+            uint32_t cameraId;
+            uint32_t frameNumber;
+            // in seconds
+            double tCapture;
+            double tSent;
+            std::vector<DetectionBall> balls;
+            std::vector<DetectionRobot> robotsYellow;
+            std::vector<DetectionRobot> robotsBlue;
+        };
+    }  // namespace simulator
+}  // namespace camun
+
+#endif  // DETECTION_H
@@ -26,7 +26,7 @@
 #include "extlibs/er_force_sim/src/core/coordinates.h"
 #include "extlibs/er_force_sim/src/core/rng.h"
 #include "extlibs/er_force_sim/src/core/vector.h"
-#include "proto/ssl_vision_detection.pb.h"
+#include "detection.h"
 #include "simulator.h"
 
 using namespace camun::simulator;
@@ -319,7 +319,7 @@ static float positionOfVisiblePixels(btVector3 &p, const btVector3 &simulatorBal
     return static_cast<float>(cameraHitCounter) / static_cast<float>(maxHits);
 }
 
-bool SimBall::update(SSLProto::SSL_DetectionBall *ball, float stddev, float stddevArea,
+bool SimBall::update(DetectionBall &ball, float stddev, float stddevArea,
                      const btVector3 &cameraPosition, bool enableInvisibleBall,
                      float visibilityThreshold, btVector3 positionOffset)
 {
@@ -331,15 +331,13 @@ bool SimBall::update(SSLProto::SSL_DetectionBall *ball, float stddev, float stdd
                         enableInvisibleBall, visibilityThreshold, positionOffset);
 }
 
-bool SimBall::addDetection(SSLProto::SSL_DetectionBall *ball, btVector3 pos, float stddev,
+bool SimBall::addDetection(DetectionBall &ball, btVector3 pos, float stddev,
                            float stddevArea, const btVector3 &cameraPosition,
                            bool enableInvisibleBall, float visibilityThreshold,
                            btVector3 positionOffset)
 {
     // setup ssl-vision ball detection
-    ball->set_confidence(1.0);
-    ball->set_pixel_x(0);
-    ball->set_pixel_y(0);
+    ball.confidence = 1.0;
 
     btTransform transform;
     m_motionState->getWorldTransform(transform);
@@ -388,7 +386,7 @@ bool SimBall::addDetection(SSLProto::SSL_DetectionBall *ball, btVector3 pos, flo
         visibility *
         std::max(0.0f, (basePixelArea +
                         static_cast<float>(m_rng->normal(stddevArea)) / PIXEL_PER_AREA));
-    ball->set_area(area * PIXEL_PER_AREA);
+    ball.area = area * PIXEL_PER_AREA;
 
     // if (height > 0.1f) {
     //     qDebug() << "simball" << p.x() << p.y() << height << "ttt" << ball_x <<
@@ -399,9 +397,9 @@ bool SimBall::addDetection(SSLProto::SSL_DetectionBall *ball, btVector3 pos, flo
     // to convert from bullet coordinate system to ssl-vision rotate by 90 degree
     // ccw
     const ErForceVector noise = m_rng->normalVector(stddev);
-    coordinates::toVision(ErForceVector(modX, modY) + noise, *ball);
+    coordinates::toVision(ErForceVector(modX, modY) + noise, ball);
 
-    ball->set_z(modZ * 1000);  // modZ is in kilometres, need to convert to metres
+    ball.z = modZ * 1000;  // modZ is in kilometres, need to convert to metres
 
     return true;
 }
@@ -43,16 +43,13 @@ static constexpr float STATIONARY_BALL_SPEED              = 0.01;
 
 
 class RNG;
-namespace SSLProto
-{
-    class SSL_DetectionBall;
-}
 
 namespace camun
 {
     namespace simulator
     {
         class SimBall;
+        struct DetectionBall;
         enum class ErrorSource;
     }  // namespace simulator
 }  // namespace camun
@@ -76,7 +73,7 @@ class camun::simulator::SimBall : public QObject
      * tick
      */
     void begin(bool robot_collision);
-    bool update(SSLProto::SSL_DetectionBall *ball, float stddev, float stddevArea,
+    bool update(DetectionBall &ball, float stddev, float stddevArea,
                 const btVector3 &cameraPosition, bool enableInvisibleBall,
                 float visibilityThreshold, btVector3 positionOffset);
     void move(const sslsim::TeleportBall &ball);
@@ -93,10 +90,9 @@ class camun::simulator::SimBall : public QObject
     bool isInvalid() const;
 
     // can be used to add ball mis-detections
-    bool addDetection(SSLProto::SSL_DetectionBall *ball, btVector3 pos, float stddev,
-                      float stddevArea, const btVector3 &cameraPosition,
-                      bool enableInvisibleBall, float visibilityThreshold,
-                      btVector3 positionOffset);
+    bool addDetection(DetectionBall &ball, btVector3 pos, float stddev, float stddevArea,
+                      const btVector3 &cameraPosition, bool enableInvisibleBall,
+                      float visibilityThreshold, btVector3 positionOffset);
 
    private:
     RNG *m_rng;
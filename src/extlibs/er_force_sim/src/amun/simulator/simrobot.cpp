@@ -25,7 +25,7 @@
 #include "extlibs/er_force_sim/src/core/coordinates.h"
 #include "extlibs/er_force_sim/src/core/rng.h"
 #include "mesh.h"
-#include "proto/ssl_vision_detection.pb.h"
+#include "detection.h"
 #include "simball.h"
 #include "simulator.h"
 
@@ -219,17 +219,7 @@ void SimRobot::setDribbleMode(bool perfectDribbler)
 
 void SimRobot::begin(SimBall *ball, double time)
 {
-    m_commandTime += time;
-    m_inStandby = false;
-    // m_inStandby = m_command.standby();
-
-    // after 0.1s without new command reset to stop
-    if (m_commandTime > 0.1)
-    {
-        m_sslCommand.Clear();
-        // the real robot switches to standby after a short delay
-        m_inStandby = true;
-    }
+    ageCommand(time);
 
     // enable dribbler if necessary
     if (!m_inStandby && m_sslCommand.has_dribbler_speed() &&
@@ -393,21 +383,7 @@ void SimRobot::begin(SimBall *ball, double time)
     btTransform t = m_body->getWorldTransform();
     t.setOrigin(btVector3(0, 0, 0));
 
-    // charge kicker only if enabled
-    if (!m_inStandby && m_charge)
-    {
-        m_shootTime += time;
-        // recharge only after a short timeout, to prevent kick the ball twice
-        if (!m_isCharged && m_shootTime > 0.1)
-        {
-            m_isCharged = true;
-        }
-    }
-    else
-    {
-        m_isCharged = false;
-        m_shootTime = 0.0;
-    }
+    chargeKicker(time);
     // check if should kick and can do that
     if (m_isCharged && m_sslCommand.has_kick_speed() && m_sslCommand.kick_speed() > 0 &&
         canKickBall(ball))
@@ -599,6 +575,10 @@ robot::RadioResponse SimRobot::setCommand(const SSLSimulationProto::RobotCommand
     m_sslCommand  = command;
     m_commandTime = 0.0f;
     m_charge      = charge;
+    if (commandCanMove())
+    {
+        wakeUp();
+    }
 
     robot::RadioResponse response;
     response.set_generation(m_specs.generation());
@@ -626,26 +606,24 @@ robot::RadioResponse SimRobot::setCommand(const SSLSimulationProto::RobotCommand
     return response;
 }
 
-void SimRobot::update(SSLProto::SSL_DetectionRobot *robot, float stddev_p,
-                      float stddev_phi, qint64 time, btVector3 positionOffset)
+void SimRobot::update(DetectionRobot &robot, float stddev_p, float stddev_phi,
+                      qint64 time, btVector3 positionOffset)
 {
     // setup vision packet
-    robot->set_robot_id(m_specs.id());
-    robot->set_confidence(1.0);
-    robot->set_pixel_x(0);
-    robot->set_pixel_y(0);
+    robot.id         = m_specs.id();
+    robot.confidence = 1.0;
 
     // add noise
     btTransform transform;
     m_motionState->getWorldTransform(transform);
     const btVector3 p = transform.getOrigin() / SIMULATOR_SCALE + positionOffset;
     const ErForceVector p_noise = m_rng->normalVector(stddev_p);
-    robot->set_x((p.y() + p_noise.x) * 1000.0f);
-    robot->set_y(-(p.x() + p_noise.y) * 1000.0f);
+    robot.x = (p.y() + p_noise.x) * 1000.0f;
+    robot.y = -(p.x() + p_noise.y) * 1000.0f;
 
     const btQuaternion q = transform.getRotation();
     const btVector3 dir  = btMatrix3x3(q).getColumn(0);
-    robot->set_orientation(atan2(dir.y(), dir.x()) + m_rng->normal(stddev_phi));
+    robot.orientation    = atan2(dir.y(), dir.x()) + m_rng->normal(stddev_phi);
 
     m_lastSendTime = time;
 }
@@ -756,11 +734,13 @@ void SimRobot::restoreState(const world::SimRobot &robot)
     m_body->setLinearVelocity(velocity * SIMULATOR_SCALE);
     btVector3 angular(robot.r_x(), robot.r_y(), robot.r_z());
     m_body->setAngularVelocity(angular);
+    wakeUp();
 }
 
 void SimRobot::move(const sslsim::TeleportRobot &robot)
 {
     m_move = robot;
+    wakeUp();
 }
 
 bool SimRobot::isFlipped()
@@ -779,6 +759,108 @@ btVector3 SimRobot::position() const
     return btVector3(transform.getOrigin().x(), transform.getOrigin().y(), 0);
 }
 
+bool SimRobot::commandCanMove() const
+{
+    // commands time out after 0.1s, see begin
+    if (m_commandTime > 0.1)
+    {
+        return false;
+    }
+
+    if (m_sslCommand.has_move_command() &&
+        m_sslCommand.move_command().has_local_velocity())
+    {
+        const auto &velocity = m_sslCommand.move_command().local_velocity();
+        if (velocity.forward() != 0 || velocity.left() != 0 || velocity.angular() != 0)
+        {
+            return true;
+        }
+    }
+    return (m_sslCommand.has_kick_speed() && m_sslCommand.kick_speed() > 0) ||
+           (m_sslCommand.has_dribbler_speed() && m_sslCommand.dribbler_speed() > 0);
+}
+
+void SimRobot::wakeUp()
+{
+    m_body->activate();
+    m_dribblerBody->activate();
+}
+
+void SimRobot::sleepIfAtRest()
+{
+    // the robot body and the dribbler body are joined by a constraint, so bullet only
+    // keeps them asleep if both of them are put to sleep together
+    const float max_rest_speed         = 0.01f * SIMULATOR_SCALE;
+    const float max_rest_angular_speed = 0.05f;
+    if (isSleeping() || commandCanMove() || m_holdBallConstraint ||
+        m_move.has_x() || m_move.has_y() || m_move.has_v_x() || m_move.has_v_y() ||
+        m_move.has_v_angular() || m_move.by_force() ||
+        m_body->getLinearVelocity().length() > max_rest_speed ||
+        m_body->getAngularVelocity().length() > max_rest_angular_speed)
+    {
+        return;
+    }
+
+    for (btRigidBody *body : {m_body, m_dribblerBody})
+    {
+        body->setLinearVelocity(btVector3(0, 0, 0));
+        body->setAngularVelocity(btVector3(0, 0, 0));
+        body->setActivationState(ISLAND_SLEEPING);
+    }
+}
+
+bool SimRobot::isSleeping() const
+{
+    return m_body->getActivationState() == ISLAND_SLEEPING;
+}
+
+bool SimRobot::canSkipBegin() const
+{
+    // a new command that can move the robot wakes it up, and the forces for any other
+    // command are zero while the robot is at rest
+    return isSleeping() && !commandCanMove();
+}
+
+void SimRobot::skipBegin(double time)
+{
+    ageCommand(time);
+    chargeKicker(time);
+}
+
+void SimRobot::ageCommand(double time)
+{
+    m_commandTime += time;
+    m_inStandby = false;
+    // m_inStandby = m_command.standby();
+
+    // after 0.1s without new command reset to stop
+    if (m_commandTime > 0.1)
+    {
+        m_sslCommand.Clear();
+        // the real robot switches to standby after a short delay
+        m_inStandby = true;
+    }
+}
+
+void SimRobot::chargeKicker(double time)
+{
+    // charge kicker only if enabled
+    if (!m_inStandby && m_charge)
+    {
+        m_shootTime += time;
+        // recharge only after a short timeout, to prevent kick the ball twice
+        if (!m_isCharged && m_shootTime > 0.1)
+        {
+            m_isCharged = true;
+        }
+    }
+    else
+    {
+        m_isCharged = false;
+        m_shootTime = 0.0;
+    }
+}
+
 btVector3 SimRobot::dribblerCorner(bool left) const
 {
     const btVector3 sideOffset =
@@ -31,10 +31,6 @@
 #include "proto/ssl_simulation_robot_control.pb.h"
 
 class RNG;
-namespace SSLProto
-{
-    class SSL_DetectionRobot;
-}
 
 namespace camun
 {
@@ -42,6 +38,7 @@ namespace camun
     {
         class SimBall;
         class SimRobot;
+        struct DetectionRobot;
         enum class ErrorSource;
     }  // namespace simulator
 }  // namespace camun
@@ -66,8 +63,8 @@ class camun::simulator::SimRobot : public QObject
     robot::RadioResponse setCommand(const SSLSimulationProto::RobotCommand &command,
                                     SimBall *ball, bool charge, float rxLoss,
                                     float txLoss);
-    void update(SSLProto::SSL_DetectionRobot *robot, float stddev_p, float stddev_phi,
-                qint64 time, btVector3 positionOffset);
+    void update(DetectionRobot &robot, float stddev_p, float stddev_phi, qint64 time,
+                btVector3 positionOffset);
     void update(world::SimRobot *robot, SimBall *ball) const;
     void restoreState(const world::SimRobot &robot);
     void move(const sslsim::TeleportRobot &robot);
@@ -94,6 +91,31 @@ class camun::simulator::SimRobot : public QObject
      */
     bool touchesBall(SimBall *ball) const;
 
+    /**
+     * puts the robot to sleep if it is at rest and neither its current command nor a
+     * pending teleport can move it. Bullet skips sleeping bodies until they are woken
+     * up by a new command, a teleport or a collision
+     */
+    void sleepIfAtRest();
+
+    /**
+     * @return true if bullet is currently skipping this robot, false otherwise
+     */
+    bool isSleeping() const;
+
+    /**
+     * @return true if the robot is sleeping and has no new command that can move it,
+     * in which case begin has no forces to apply to it
+     */
+    bool canSkipBegin() const;
+
+    /**
+     * Used instead of begin for robots that can skip it. Only ages the current command
+     * and charges the kicker, so that both keep their timing while the robot sleeps
+     *
+     * @param time The time since the last tick in seconds
+     */
+    void skipBegin(double time);
 
    private:
     btVector3 relativeBallSpeed(SimBall *ball) const;
@@ -102,6 +124,10 @@ class camun::simulator::SimRobot : public QObject
     void calculateDribblerMove(const btVector3 pos, const btQuaternion rot,
                                const btVector3 linVel, float omega);
     void dribble(SimBall *ball, float speed);
+    bool commandCanMove() const;
+    void wakeUp();
+    void ageCommand(double time);
+    void chargeKicker(double time);
 
     RNG *m_rng;
     robot::Specs m_specs;
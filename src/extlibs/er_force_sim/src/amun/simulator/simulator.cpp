@@ -96,6 +96,7 @@ struct camun::simulator::SimulatorData
     float robotReplyPacketLoss;
     float missingBallDetections;
     bool dribblePerfect;
+    bool adaptiveStepping;
 };
 
 static void simulatorTickCallback(btDynamicsWorld *world, btScalar timeStep)
@@ -163,6 +164,7 @@ Simulator::Simulator(const amun::SimulatorSetup &setup)
     m_data->robotReplyPacketLoss     = 0;
     m_data->missingBallDetections    = 0;
     m_data->dribblePerfect           = false;
+    m_data->adaptiveStepping         = false;
 
     // no robots after initialisation
 }
@@ -301,8 +303,90 @@ void Simulator::resetFlipped(Simulator::RobotMap &robots, float side)
 
 void Simulator::stepSimulation(double time_s)
 {
-    m_data->dynamicsWorld->stepSimulation(time_s, 10, SUB_TIMESTEP);
+    float subTimestep = SUB_TIMESTEP;
+    if (m_data->adaptiveStepping)
+    {
+        sleepRobotsAtRest();
+        if (canUseAdaptiveSubTimestep())
+        {
+            subTimestep = ADAPTIVE_SUB_TIMESTEP;
+        }
+    }
+    m_data->dynamicsWorld->stepSimulation(time_s, 10, subTimestep);
     m_time += time_s * 1E9;
+    m_lastSubTimestep = subTimestep;
+}
+
+float Simulator::lastSubTimestep() const
+{
+    return m_lastSubTimestep;
+}
+
+int Simulator::numSleepingRobots() const
+{
+    auto is_sleeping = [](const auto &pair) { return pair.first->isSleeping(); };
+    return std::count_if(m_data->robotsBlue.begin(), m_data->robotsBlue.end(),
+                         is_sleeping) +
+           std::count_if(m_data->robotsYellow.begin(), m_data->robotsYellow.end(),
+                         is_sleeping);
+}
+
+void Simulator::sleepRobotsAtRest()
+{
+    for (const auto &pair : m_data->robotsBlue)
+    {
+        pair.first->sleepIfAtRest();
+    }
+    for (const auto &pair : m_data->robotsYellow)
+    {
+        pair.first->sleepIfAtRest();
+    }
+}
+
+bool Simulator::canUseAdaptiveSubTimestep() const
+{
+    // the ball is small enough to tunnel through the robots with larger sub timesteps,
+    // so it has to be slow and out of reach of the robots
+    const float maxBallSpeed     = 0.05f * SIMULATOR_SCALE;
+    const float minBallDistance  = 0.5f * SIMULATOR_SCALE;
+    const float minRobotDistance = 0.5f * SIMULATOR_SCALE;
+    const btVector3 ballPosition = m_data->ball->position();
+    if (m_data->ball->speed().length() > maxBallSpeed)
+    {
+        return false;
+    }
+
+    const RobotMap *teams[] = {&m_data->robotsBlue, &m_data->robotsYellow};
+    for (const RobotMap *team : teams)
+    {
+        for (const auto &pair : *team)
+        {
+            const SimRobot *robot = pair.first;
+            if (robot->position().distance(ballPosition) < minBallDistance)
+            {
+                return false;
+            }
+            if (robot->isSleeping())
+            {
+                continue;
+            }
+            // robots that are awake could collide with any robot close to them
+            for (const RobotMap *other_team : teams)
+            {
+                for (const auto &other_pair : *other_team)
+                {
+                    const SimRobot *other_robot = other_pair.first;
+                    if (other_robot != robot &&
+                        robot->position().distance(other_robot->position()) <
+                            minRobotDistance)
+                    {
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+    return true;
 }
 
 void Simulator::handleSimulatorTick(double time_s)
@@ -332,13 +416,24 @@ void Simulator::handleSimulatorTick(double time_s)
 
     // apply commands and forces to ball and robots
     m_data->ball->begin(ball_collision);
+    // sleeping robots without a command that can move them have no forces to apply
+    auto begin_robot = [this, time_s](SimRobot *robot) {
+        if (robot->canSkipBegin())
+        {
+            robot->skipBegin(time_s);
+        }
+        else
+        {
+            robot->begin(m_data->ball, time_s);
+        }
+    };
     for (const auto &pair : m_data->robotsBlue)
     {
-        pair.first->begin(m_data->ball, time_s);
+        begin_robot(pair.first);
     }
     for (const auto &pair : m_data->robotsYellow)
     {
-        pair.first->begin(m_data->ball, time_s);
+        begin_robot(pair.first);
     }
 
     // add gravity to all ACTIVE objects
@@ -346,33 +441,40 @@ void Simulator::handleSimulatorTick(double time_s)
     m_data->dynamicsWorld->applyGravity();
 }
 
-static bool checkCameraID(const int cameraId, const btVector3 &p,
-                          const QVector<btVector3> &cameraPositions, const float overlap)
+// Finds the ids of all cameras that can see the position p. Every position is seen by
+// the closest camera, and by all cameras that are at most 2 * overlap further away
+static void findCameraIDs(const btVector3 &p, const QVector<btVector3> &cameraPositions,
+                          const float overlap, std::vector<std::size_t> &cameraIds)
 {
+    // manhattan distance for rectangular camera regions (if the cameras are
+    // distributed normally)
+    auto cameraDistance = [&p](const btVector3 &cameraPosition) {
+        return std::abs(cameraPosition.x() - p.x()) +
+               std::abs(cameraPosition.y() - p.y());
+    };
+
     float minDistance = std::numeric_limits<float>::max();
-    float ownDistance = 0;
+    for (const auto &cameraPosition : cameraPositions)
+    {
+        minDistance = std::min(minDistance, cameraDistance(cameraPosition));
+    }
+
+    cameraIds.clear();
     for (int i = 0; i < cameraPositions.size(); i++)
     {
-        // manhattan distance for rectangular camera regions (if the cameras are
-        // distributed normally)
-        float distance = std::abs(cameraPositions[i].x() - p.x()) +
-                         std::abs(cameraPositions[i].y() - p.y());
-        minDistance = std::min(minDistance, distance);
-        if (i == cameraId)
+        if (cameraDistance(cameraPositions[i]) <= minDistance + 2 * overlap)
         {
-            ownDistance = distance;
+            cameraIds.push_back(i);
         }
     }
-    return ownDistance <= minDistance + 2 * overlap;
 }
 
-void Simulator::initializeDetection(SSLProto::SSL_DetectionFrame *detection,
-                                    std::size_t cameraId)
+void Simulator::initializeDetection(DetectionFrame &detection, std::size_t cameraId)
 {
-    detection->set_frame_number(m_lastFrameNumber[cameraId]++);
-    detection->set_camera_id(cameraId);
-    detection->set_t_capture((m_time + m_visionDelay - m_visionProcessingTime) * 1E-9);
-    detection->set_t_sent((m_time + m_visionDelay) * 1E-9);
+    detection.frameNumber = m_lastFrameNumber[cameraId]++;
+    detection.cameraId    = cameraId;
+    detection.tCapture    = (m_time + m_visionDelay - m_visionProcessingTime) * 1E-9;
+    detection.tSent       = (m_time + m_visionDelay) * 1E-9;
 }
 
 static btVector3 positionOffsetForCamera(float offsetStrength, btVector3 cameraPos)
@@ -391,16 +493,31 @@ static btVector3 positionOffsetForCamera(float offsetStrength, btVector3 cameraP
     return btVector3(cameraPos.x(), cameraPos.y(), 0).normalized() * offsetStrength;
 }
 
-std::vector<SSLProto::SSL_WrapperPacket> Simulator::getWrapperPackets()
+static void writeDetectionRobot(const DetectionRobot &from,
+                                SSLProto::SSL_DetectionRobot *to)
+{
+    to->set_robot_id(from.id);
+    to->set_confidence(from.confidence);
+    to->set_pixel_x(0);
+    to->set_pixel_y(0);
+    to->set_x(from.x);
+    to->set_y(from.y);
+    to->set_orientation(from.orientation);
+}
+
+std::vector<DetectionFrame> Simulator::getDetectionFrames()
 {
     const std::size_t numCameras = m_data->reportedCameraSetup.size();
 
-    std::vector<SSLProto::SSL_DetectionFrame> detections(numCameras);
+    std::vector<DetectionFrame> detections(numCameras);
     for (std::size_t i = 0; i < numCameras; i++)
     {
-        initializeDetection(&detections[i], i);
+        initializeDetection(detections[i], i);
     }
 
+    std::vector<std::size_t> cameraIds;
+    cameraIds.reserve(numCameras);
+
     bool missingBall = m_data->missingBallDetections > 0 &&
                        m_data->rng.uniformFloat(0, 1) <= m_data->missingBallDetections;
     const btVector3 ballPosition = m_data->ball->position() / SIMULATOR_SCALE;
@@ -408,26 +525,22 @@ std::vector<SSLProto::SSL_WrapperPacket> Simulator::getWrapperPackets()
     {
         m_lastBallSendTime = m_time;
 
-        for (std::size_t cameraId = 0; cameraId < numCameras; ++cameraId)
+        // at least one id is always valid
+        findCameraIDs(ballPosition, m_data->cameraPositions, m_data->cameraOverlap,
+                      cameraIds);
+        for (std::size_t cameraId : cameraIds)
         {
-            // at least one id is always valid
-            if (!checkCameraID(cameraId, ballPosition, m_data->cameraPositions,
-                               m_data->cameraOverlap))
-            {
-                continue;
-            }
-
             // get ball position
             const btVector3 positionOffset = positionOffsetForCamera(
                 m_data->objectPositionOffset, m_data->cameraPositions[cameraId]);
+            DetectionBall ball;
             bool visible = m_data->ball->update(
-                detections[cameraId].add_balls(), m_data->stddevBall,
-                m_data->stddevBallArea, m_data->cameraPositions[cameraId],
-                m_data->enableInvisibleBall, m_data->ballVisibilityThreshold,
-                positionOffset);
-            if (!visible)
+                ball, m_data->stddevBall, m_data->stddevBallArea,
+                m_data->cameraPositions[cameraId], m_data->enableInvisibleBall,
+                m_data->ballVisibilityThreshold, positionOffset);
+            if (visible)
             {
-                detections[cameraId].clear_balls();
+                detections[cameraId].balls.push_back(ball);
             }
         }
     }
@@ -446,28 +559,17 @@ std::vector<SSLProto::SSL_WrapperPacket> Simulator::getWrapperPackets()
                 const float timeDiff     = (m_time - robot->getLastSendTime()) * 1E-9;
                 const btVector3 robotPos = robot->position() / SIMULATOR_SCALE;
 
-                for (std::size_t cameraId = 0; cameraId < numCameras; ++cameraId)
+                findCameraIDs(robotPos, m_data->cameraPositions, m_data->cameraOverlap,
+                              cameraIds);
+                for (std::size_t cameraId : cameraIds)
                 {
-                    if (!checkCameraID(cameraId, robotPos, m_data->cameraPositions,
-                                       m_data->cameraOverlap))
-                    {
-                        continue;
-                    }
-
                     const btVector3 positionOffset = positionOffsetForCamera(
                         m_data->objectPositionOffset, m_data->cameraPositions[cameraId]);
-                    if (teamIsBlue)
-                    {
-                        robot->update(detections[cameraId].add_robots_blue(),
-                                      m_data->stddevRobot, m_data->stddevRobotPhi, m_time,
-                                      positionOffset);
-                    }
-                    else
-                    {
-                        robot->update(detections[cameraId].add_robots_yellow(),
-                                      m_data->stddevRobot, m_data->stddevRobotPhi, m_time,
-                                      positionOffset);
-                    }
+                    auto &robots = teamIsBlue ? detections[cameraId].robotsBlue
+                                              : detections[cameraId].robotsYellow;
+                    robots.emplace_back();
+                    robot->update(robots.back(), m_data->stddevRobot,
+                                  m_data->stddevRobotPhi, m_time, positionOffset);
 
                     // once in a while, add a ball mis-detection at a corner of the
                     // dribbler in real games, this happens because the ball detection
@@ -477,14 +579,13 @@ std::vector<SSLProto::SSL_WrapperPacket> Simulator::getWrapperPackets()
                         m_data->rng.uniformFloat(0, 1) < detectionProb)
                     {
                         // always on the right side of the dribbler for now
-                        if (!m_data->ball->addDetection(
-                                detections[cameraId].add_balls(),
-                                robot->dribblerCorner(false) / SIMULATOR_SCALE,
+                        DetectionBall ball;
+                        if (m_data->ball->addDetection(
+                                ball, robot->dribblerCorner(false) / SIMULATOR_SCALE,
                                 m_data->stddevRobot, 0, m_data->cameraPositions[cameraId],
                                 false, 0, positionOffset))
                         {
-                            detections[cameraId].mutable_balls()->DeleteSubrange(
-                                detections[cameraId].balls_size() - 1, 1);
+                            detections[cameraId].balls.push_back(ball);
                         }
                     }
                 }
@@ -492,25 +593,57 @@ std::vector<SSLProto::SSL_WrapperPacket> Simulator::getWrapperPackets()
         }
     }
 
+    // if multiple balls are reported, shuffle them randomly (the tracking might
+    // have systematic errors depending on the ball order)
+    for (auto &frame : detections)
+    {
+        if (frame.balls.size() > 1)
+        {
+            std::shuffle(frame.balls.begin(), frame.balls.end(), rand_shuffle_src);
+        }
+    }
+
+    return detections;
+}
+
+std::vector<SSLProto::SSL_WrapperPacket> Simulator::getWrapperPackets()
+{
+    const std::vector<DetectionFrame> detections = getDetectionFrames();
+
     std::vector<SSLProto::SSL_WrapperPacket> packets;
-    packets.reserve(numCameras);
+    packets.reserve(detections.size());
 
     // add a wrapper packet for all detections (also for empty ones).
     // The reason is that other teams might rely on the fact that these detections
     // are in regular intervals.
-    for (auto &frame : detections)
+    for (const auto &frame : detections)
     {
-        // if multiple balls are reported, shuffle them randomly (the tracking might
-        // have systematic errors depending on the ball order)
-        if (frame.balls_size() > 1)
+        SSLProto::SSL_WrapperPacket packet;
+        SSLProto::SSL_DetectionFrame *detection = packet.mutable_detection();
+        detection->set_frame_number(frame.frameNumber);
+        detection->set_camera_id(frame.cameraId);
+        detection->set_t_capture(frame.tCapture);
+        detection->set_t_sent(frame.tSent);
+        for (const auto &ball : frame.balls)
         {
-            std::shuffle(frame.mutable_balls()->begin(), frame.mutable_balls()->end(),
-                         rand_shuffle_src);
+            SSLProto::SSL_DetectionBall *detectionBall = detection->add_balls();
+            detectionBall->set_confidence(ball.confidence);
+            detectionBall->set_area(ball.area);
+            detectionBall->set_x(ball.x);
+            detectionBall->set_y(ball.y);
+            detectionBall->set_z(ball.z);
+            detectionBall->set_pixel_x(0);
+            detectionBall->set_pixel_y(0);
         }
-
-        SSLProto::SSL_WrapperPacket packet;
-        packet.mutable_detection()->CopyFrom(frame);
-        packets.push_back(packet);
+        for (const auto &robot : frame.robotsYellow)
+        {
+            writeDetectionRobot(robot, detection->add_robots_yellow());
+        }
+        for (const auto &robot : frame.robotsBlue)
+        {
+            writeDetectionRobot(robot, detection->add_robots_blue());
+        }
+        packets.push_back(std::move(packet));
     }
 
     // add field geometry
@@ -874,6 +1007,11 @@ void Simulator::handleSimulatorSetupCommand(const std::unique_ptr<amun::Command>
                 m_data->dribblePerfect      = !realism.simulate_dribbling();
                 teamOrPerfectDribbleChanged = true;
             }
+
+            if (realism.has_adaptive_stepping())
+            {
+                m_data->adaptiveStepping = realism.adaptive_stepping();
+            }
         }
 
         if (sim.has_ssl_control())
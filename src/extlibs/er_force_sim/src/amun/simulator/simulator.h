@@ -29,6 +29,7 @@
 #include <random>
 #include <tuple>
 
+#include "detection.h"
 #include "extlibs/er_force_sim/src/protobuf/command.h"
 #include "extlibs/er_force_sim/src/protobuf/sslsim.h"
 #include "proto/ssl_simulation_robot_control.pb.h"
@@ -38,6 +39,9 @@
 // higher values break the rolling friction of the ball
 const float SIMULATOR_SCALE  = 10.0f;
 const float SUB_TIMESTEP     = 1 / 200.f;
+// used instead of SUB_TIMESTEP in adaptive stepping mode while no fast-moving contacts
+// can happen
+const float ADAPTIVE_SUB_TIMESTEP = 1 / 100.f;
 const float COLLISION_MARGIN = 0.04f;
 const unsigned FOCAL_LENGTH  = 390;
 
@@ -116,6 +120,16 @@ class camun::simulator::Simulator : public QObject
      */
     void stepSimulation(double time_s);
 
+    /**
+     * @return the sub timestep that was used by the last step of the simulation
+     */
+    float lastSubTimestep() const;
+
+    /**
+     * @return the number of robots that bullet is currently skipping
+     */
+    int numSleepingRobots() const;
+
     /**
      * Handles a tick of the simulator
      * Note: this function is required for bullet simulator callback
@@ -131,6 +145,19 @@ class camun::simulator::Simulator : public QObject
      */
     std::vector<SSLProto::SSL_WrapperPacket> getWrapperPackets();
 
+    /**
+     * Generates the detections of every camera from the current state of the
+     * simulator. This uses the same noise, latency and camera model as
+     * getWrapperPackets, but does not build any protobuf messages, and should be used
+     * instead of it when the consumer lives in the same process
+     *
+     * Note: getWrapperPackets calls this function, so only one of them should be called
+     * per simulation step
+     *
+     * @return one detection frame per camera
+     */
+    std::vector<DetectionFrame> getDetectionFrames();
+
     /**
      * Gets the current simulator state of the simulator
      *
@@ -170,8 +197,22 @@ class camun::simulator::Simulator : public QObject
     void moveBall(const sslsim::TeleportBall &ball);
     void moveRobot(const sslsim::TeleportRobot &robot);
     void teleportRobotToFreePosition(SimRobot *robot);
-    void initializeDetection(SSLProto::SSL_DetectionFrame *detection,
-                             std::size_t cameraId);
+    void initializeDetection(DetectionFrame &detection, std::size_t cameraId);
+
+    /**
+     * Puts all robots that are at rest to sleep, so that bullet skips them until they
+     * receive a command or are hit by another object
+     */
+    void sleepRobotsAtRest();
+
+    /**
+     * Determines whether the next step can use ADAPTIVE_SUB_TIMESTEP without missing
+     * contacts. This is the case if the ball is slow and far away from all robots, and
+     * no robot that is awake is close to another robot
+     *
+     * @return true if ADAPTIVE_SUB_TIMESTEP can be used, false otherwise
+     */
+    bool canUseAdaptiveSubTimestep() const;
 
    private:
     typedef std::tuple<SSLSimRobotControl, qint64, bool> RadioCommand;
@@ -181,6 +222,7 @@ class camun::simulator::Simulator : public QObject
     QQueue<QTimer *> m_visionTimers;
     QTimer *m_trigger;
     qint64 m_time;
+    float m_lastSubTimestep = SUB_TIMESTEP;
     qint64 m_lastSentStatusTime;
     bool m_enabled;
     bool m_charge;
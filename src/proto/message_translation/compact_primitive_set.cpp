@@ -0,0 +1,715 @@
+#include "proto/message_translation/compact_primitive_set.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "software/logger/logger.h"
+
+namespace
+{
+// The types of primitives that a record can hold
+enum class RecordType : uint8_t
+{
+    NONE           = 0,
+    MOVE           = 1,
+    STOP           = 2,
+    DIRECT_CONTROL = 3
+};
+
+// The types of the commands that can be given to the chipper and kicker
+enum class ChickerType : uint8_t
+{
+    NONE     = 0,
+    KICK     = 1,
+    CHIP     = 2,
+    AUTOKICK = 3,
+    AUTOCHIP = 4
+};
+
+// The types of direct motor control
+enum class MotorControlType : uint8_t
+{
+    NONE      = 0,
+    PER_WHEEL = 1,
+    VELOCITY  = 2
+};
+
+constexpr double MILLIMETERS_PER_METER              = 1000.0;
+constexpr double MILLISECONDS_PER_SECOND            = 1000.0;
+constexpr double MILLIRADIANS_PER_RADIAN            = 1000.0;
+constexpr double TEN_THOUSANDTHS_PER_RADIAN         = 10000.0;
+constexpr uint8_t STAY_AWAY_FROM_BALL_FLAG          = 0x1;
+constexpr std::size_t RECORD_ROBOT_ID_OFFSET        = 0;
+constexpr std::size_t RECORD_TYPE_OFFSET            = 1;
+constexpr std::size_t RECORD_PRIMITIVE_OFFSET       = 2;
+constexpr std::size_t HEADER_NUM_RECORDS_OFFSET     = 3;
+constexpr std::size_t HEADER_SEQUENCE_NUMBER_OFFSET = 8;
+
+/**
+ * Writes little-endian values to a string, starting at an offset
+ */
+class ByteWriter
+{
+   public:
+    /**
+     * Creates a new ByteWriter
+     *
+     * @param data The string to write to, which must be large enough to hold all of
+     * the written values
+     * @param offset The offset to start writing at
+     */
+    explicit ByteWriter(std::string& data, std::size_t offset)
+        : data(data), offset(offset)
+    {
+    }
+
+    void writeUint8(uint8_t value)
+    {
+        data[offset++] = static_cast<char>(value);
+    }
+
+    void writeUint16(uint16_t value)
+    {
+        writeUint8(static_cast<uint8_t>(value));
+        writeUint8(static_cast<uint8_t>(value >> 8));
+    }
+
+    void writeUint32(uint32_t value)
+    {
+        writeUint16(static_cast<uint16_t>(value));
+        writeUint16(static_cast<uint16_t>(value >> 16));
+    }
+
+    void writeUint64(uint64_t value)
+    {
+        writeUint32(static_cast<uint32_t>(value));
+        writeUint32(static_cast<uint32_t>(value >> 32));
+    }
+
+    /**
+     * Writes the value multiplied by the given scale as an int16, saturating at the
+     * limits of an int16
+     *
+     * @param value The value to write
+     * @param scale The number of units of the int16 per unit of the value
+     */
+    void writeQuantized(double value, double scale)
+    {
+        long quantized =
+            std::clamp(std::lround(value * scale),
+                       static_cast<long>(std::numeric_limits<int16_t>::min()),
+                       static_cast<long>(std::numeric_limits<int16_t>::max()));
+        writeUint16(static_cast<uint16_t>(static_cast<int16_t>(quantized)));
+    }
+
+    /**
+     * Writes the value multiplied by the given scale as a uint16, saturating at the
+     * limits of a uint16
+     *
+     * @param value The value to write
+     * @param scale The number of units of the uint16 per unit of the value
+     */
+    void writeUnsignedQuantized(double value, double scale)
+    {
+        long quantized =
+            std::clamp(std::lround(value * scale), 0L,
+                       static_cast<long>(std::numeric_limits<uint16_t>::max()));
+        writeUint16(static_cast<uint16_t>(quantized));
+    }
+
+    void writePoint(const TbotsProto::Point& point)
+    {
+        writeQuantized(point.x_meters(), MILLIMETERS_PER_METER);
+        writeQuantized(point.y_meters(), MILLIMETERS_PER_METER);
+    }
+
+    void writeVector(const TbotsProto::Vector& vector)
+    {
+        writeQuantized(vector.x_component_meters(), MILLIMETERS_PER_METER);
+        writeQuantized(vector.y_component_meters(), MILLIMETERS_PER_METER);
+    }
+
+    void writeAngle(const TbotsProto::Angle& angle)
+    {
+        writeQuantized(std::remainder(angle.radians(), 2 * M_PI),
+                       TEN_THOUSANDTHS_PER_RADIAN);
+    }
+
+    void writeAngularVelocity(const TbotsProto::AngularVelocity& angular_velocity)
+    {
+        writeQuantized(angular_velocity.radians_per_second(), MILLIRADIANS_PER_RADIAN);
+    }
+
+    void skip(std::size_t num_bytes)
+    {
+        offset += num_bytes;
+    }
+
+   private:
+    std::string& data;
+    std::size_t offset;
+};
+
+/**
+ * Reads little-endian values from a string, starting at an offset
+ */
+class ByteReader
+{
+   public:
+    /**
+     * Creates a new ByteReader
+     *
+     * @param data The string to read from, which must hold all of the read values
+     * @param offset The offset to start reading at
+     */
+    explicit ByteReader(const std::string& data, std::size_t offset)
+        : data(data), offset(offset)
+    {
+    }
+
+    uint8_t readUint8()
+    {
+        return static_cast<uint8_t>(data[offset++]);
+    }
+
+    uint16_t readUint16()
+    {
+        uint16_t low = readUint8();
+        return static_cast<uint16_t>(low | (readUint8() << 8));
+    }
+
+    uint32_t readUint32()
+    {
+        uint32_t low = readUint16();
+        return low | (static_cast<uint32_t>(readUint16()) << 16);
+    }
+
+    uint64_t readUint64()
+    {
+        uint64_t low = readUint32();
+        return low | (static_cast<uint64_t>(readUint32()) << 32);
+    }
+
+    /**
+     * Reads a value written by ByteWriter::writeQuantized
+     *
+     * @param scale The number of units of the int16 per unit of the value
+     *
+     * @return the value
+     */
+    double readQuantized(double scale)
+    {
+        return static_cast<int16_t>(readUint16()) / scale;
+    }
+
+    /**
+     * Reads a value written by ByteWriter::writeUnsignedQuantized
+     *
+     * @param scale The number of units of the uint16 per unit of the value
+     *
+     * @return the value
+     */
+    double readUnsignedQuantized(double scale)
+    {
+        return readUint16() / scale;
+    }
+
+    void readPoint(TbotsProto::Point& point)
+    {
+        point.set_x_meters(readQuantized(MILLIMETERS_PER_METER));
+        point.set_y_meters(readQuantized(MILLIMETERS_PER_METER));
+    }
+
+    void readVector(TbotsProto::Vector& vector)
+    {
+        vector.set_x_component_meters(readQuantized(MILLIMETERS_PER_METER));
+        vector.set_y_component_meters(readQuantized(MILLIMETERS_PER_METER));
+    }
+
+    void readAngle(TbotsProto::Angle& angle)
+    {
+        angle.set_radians(readQuantized(TEN_THOUSANDTHS_PER_RADIAN));
+    }
+
+    void readAngularVelocity(TbotsProto::AngularVelocity& angular_velocity)
+    {
+        angular_velocity.set_radians_per_second(readQuantized(MILLIRADIANS_PER_RADIAN));
+    }
+
+    void skip(std::size_t num_bytes)
+    {
+        offset += num_bytes;
+    }
+
+   private:
+    const std::string& data;
+    std::size_t offset;
+};
+
+/**
+ * Writes the fields of a move primitive to a record
+ *
+ * @param writer The writer to write the fields with
+ * @param move The move primitive to write
+ */
+void writeMovePrimitive(ByteWriter& writer, const TbotsProto::MovePrimitive& move)
+{
+    const TbotsProto::TrajectoryPathParams2D& xy_traj_params = move.xy_traj_params();
+    writer.writePoint(xy_traj_params.start_position());
+    writer.writePoint(xy_traj_params.destination());
+    writer.writeVector(xy_traj_params.initial_velocity());
+    writer.writeUint8(static_cast<uint8_t>(xy_traj_params.max_speed_mode()));
+
+    auto num_sub_destinations =
+        static_cast<unsigned>(xy_traj_params.sub_destinations_size());
+    writer.writeUint8(static_cast<uint8_t>(num_sub_destinations));
+    for (unsigned i = 0; i < CompactPrimitiveSet::MAX_SUB_DESTINATIONS; i++)
+    {
+        if (i < num_sub_destinations)
+        {
+            const auto& sub_destination =
+                xy_traj_params.sub_destinations(static_cast<int>(i));
+            writer.writePoint(sub_destination.sub_destination());
+            writer.writeUnsignedQuantized(sub_destination.connection_time_s(),
+                                          MILLISECONDS_PER_SECOND);
+        }
+        else
+        {
+            writer.skip(3 * sizeof(uint16_t));
+        }
+    }
+
+    const TbotsProto::TrajectoryParamsAngular1D& w_traj_params = move.w_traj_params();
+    writer.writeAngle(w_traj_params.start_angle());
+    writer.writeAngle(w_traj_params.final_angle());
+    writer.writeAngularVelocity(w_traj_params.initial_velocity());
+
+    writer.writeUint8(static_cast<uint8_t>(move.dribbler_mode()));
+    switch (move.auto_chip_or_kick().auto_chip_or_kick_case())
+    {
+        case TbotsProto::AutoChipOrKick::kAutokickSpeedMPerS:
+            writer.writeUint8(static_cast<uint8_t>(ChickerType::AUTOKICK));
+            writer.writeUnsignedQuantized(
+                move.auto_chip_or_kick().autokick_speed_m_per_s(), MILLIMETERS_PER_METER);
+            break;
+        case TbotsProto::AutoChipOrKick::kAutochipDistanceMeters:
+            writer.writeUint8(static_cast<uint8_t>(ChickerType::AUTOCHIP));
+            writer.writeUnsignedQuantized(
+                move.auto_chip_or_kick().autochip_distance_meters(),
+                MILLIMETERS_PER_METER);
+            break;
+        default:
+            writer.writeUint8(static_cast<uint8_t>(ChickerType::NONE));
+            writer.writeUint16(0);
+            break;
+    }
+}
+
+/**
+ * Reads the fields of a move primitive from a record
+ *
+ * @param reader The reader to read the fields with
+ * @param move The move primitive to read into
+ */
+void readMovePrimitive(ByteReader& reader, TbotsProto::MovePrimitive& move)
+{
+    TbotsProto::TrajectoryPathParams2D& xy_traj_params = *move.mutable_xy_traj_params();
+    reader.readPoint(*xy_traj_params.mutable_start_position());
+    reader.readPoint(*xy_traj_params.mutable_destination());
+    reader.readVector(*xy_traj_params.mutable_initial_velocity());
+    xy_traj_params.set_max_speed_mode(
+        static_cast<TbotsProto::MaxAllowedSpeedMode>(reader.readUint8()));
+
+    unsigned num_sub_destinations = std::min<unsigned>(
+        reader.readUint8(), CompactPrimitiveSet::MAX_SUB_DESTINATIONS);
+    for (unsigned i = 0; i < CompactPrimitiveSet::MAX_SUB_DESTINATIONS; i++)
+    {
+        if (i < num_sub_destinations)
+        {
+            auto sub_destination = xy_traj_params.add_sub_destinations();
+            reader.readPoint(*sub_destination->mutable_sub_destination());
+            sub_destination->set_connection_time_s(static_cast<float>(
+                reader.readUnsignedQuantized(MILLISECONDS_PER_SECOND)));
+        }
+        else
+        {
+            reader.skip(3 * sizeof(uint16_t));
+        }
+    }
+
+    TbotsProto::TrajectoryParamsAngular1D& w_traj_params = *move.mutable_w_traj_params();
+    reader.readAngle(*w_traj_params.mutable_start_angle());
+    reader.readAngle(*w_traj_params.mutable_final_angle());
+    reader.readAngularVelocity(*w_traj_params.mutable_initial_velocity());
+
+    move.set_dribbler_mode(static_cast<TbotsProto::DribblerMode>(reader.readUint8()));
+    auto chicker_type = static_cast<ChickerType>(reader.readUint8());
+    auto chicker_value =
+        static_cast<float>(reader.readUnsignedQuantized(MILLIMETERS_PER_METER));
+    if (chicker_type == ChickerType::AUTOKICK)
+    {
+        move.mutable_auto_chip_or_kick()->set_autokick_speed_m_per_s(chicker_value);
+    }
+    else if (chicker_type == ChickerType::AUTOCHIP)
+    {
+        move.mutable_auto_chip_or_kick()->set_autochip_distance_meters(chicker_value);
+    }
+}
+
+/**
+ * Writes the fields of a direct control primitive to a record
+ *
+ * @param writer The writer to write the fields with
+ * @param direct_control The direct control primitive to write
+ */
+void writeDirectControlPrimitive(ByteWriter& writer,
+                                 const TbotsProto::DirectControlPrimitive& direct_control)
+{
+    const TbotsProto::MotorControl& motor_control = direct_control.motor_control();
+    switch (motor_control.drive_control_case())
+    {
+        case TbotsProto::MotorControl::kDirectPerWheelControl:
+        {
+            const auto& per_wheel_control = motor_control.direct_per_wheel_control();
+            writer.writeUint8(static_cast<uint8_t>(MotorControlType::PER_WHEEL));
+            writer.writeQuantized(per_wheel_control.front_left_wheel_velocity(),
+                                  MILLIMETERS_PER_METER);
+            writer.writeQuantized(per_wheel_control.back_left_wheel_velocity(),
+                                  MILLIMETERS_PER_METER);
+            writer.writeQuantized(per_wheel_control.front_right_wheel_velocity(),
+                                  MILLIMETERS_PER_METER);
+            writer.writeQuantized(per_wheel_control.back_right_wheel_velocity(),
+                                  MILLIMETERS_PER_METER);
+            break;
+        }
+        case TbotsProto::MotorControl::kDirectVelocityControl:
+        {
+            const auto& velocity_control = motor_control.direct_velocity_control();
+            writer.writeUint8(static_cast<uint8_t>(MotorControlType::VELOCITY));
+            writer.writeVector(velocity_control.velocity());
+            writer.writeAngularVelocity(velocity_control.angular_velocity());
+            writer.skip(sizeof(uint16_t));
+            break;
+        }
+        default:
+            writer.writeUint8(static_cast<uint8_t>(MotorControlType::NONE));
+            writer.skip(4 * sizeof(uint16_t));
+            break;
+    }
+    writer.writeUint32(static_cast<uint32_t>(motor_control.dribbler_speed_rpm()));
+
+    const TbotsProto::PowerControl::ChickerControl& chicker =
+        direct_control.power_control().chicker();
+    switch (chicker.chicker_command_case())
+    {
+        case TbotsProto::PowerControl::ChickerControl::kKickSpeedMPerS:
+            writer.writeUint8(static_cast<uint8_t>(ChickerType::KICK));
+            writer.writeUnsignedQuantized(chicker.kick_speed_m_per_s(),
+                                          MILLIMETERS_PER_METER);
+            break;
+        case TbotsProto::PowerControl::ChickerControl::kChipDistanceMeters:
+            writer.writeUint8(static_cast<uint8_t>(ChickerType::CHIP));
+            writer.writeUnsignedQuantized(chicker.chip_distance_meters(),
+                                          MILLIMETERS_PER_METER);
+            break;
+        case TbotsProto::PowerControl::ChickerControl::kAutoChipOrKick:
+            if (chicker.auto_chip_or_kick().has_autokick_speed_m_per_s())
+            {
+                writer.writeUint8(static_cast<uint8_t>(ChickerType::AUTOKICK));
+                writer.writeUnsignedQuantized(
+                    chicker.auto_chip_or_kick().autokick_speed_m_per_s(),
+                    MILLIMETERS_PER_METER);
+            }
+            else
+            {
+                writer.writeUint8(static_cast<uint8_t>(ChickerType::AUTOCHIP));
+                writer.writeUnsignedQuantized(
+                    chicker.auto_chip_or_kick().autochip_distance_meters(),
+                    MILLIMETERS_PER_METER);
+            }
+            break;
+        default:
+            writer.writeUint8(static_cast<uint8_t>(ChickerType::NONE));
+            writer.writeUint16(0);
+            break;
+    }
+    writer.writeUint8(static_cast<uint8_t>(direct_control.power_control().geneva_slot()));
+}
+
+/**
+ * Reads the fields of a direct control primitive from a record
+ *
+ * @param reader The reader to read the fields with
+ * @param direct_control The direct control primitive to read into
+ */
+void readDirectControlPrimitive(ByteReader& reader,
+                                TbotsProto::DirectControlPrimitive& direct_control)
+{
+    TbotsProto::MotorControl& motor_control = *direct_control.mutable_motor_control();
+    switch (static_cast<MotorControlType>(reader.readUint8()))
+    {
+        case MotorControlType::PER_WHEEL:
+        {
+            auto& per_wheel_control = *motor_control.mutable_direct_per_wheel_control();
+            per_wheel_control.set_front_left_wheel_velocity(
+                static_cast<float>(reader.readQuantized(MILLIMETERS_PER_METER)));
+            per_wheel_control.set_back_left_wheel_velocity(
+                static_cast<float>(reader.readQuantized(MILLIMETERS_PER_METER)));
+            per_wheel_control.set_front_right_wheel_velocity(
+                static_cast<float>(reader.readQuantized(MILLIMETERS_PER_METER)));
+            per_wheel_control.set_back_right_wheel_velocity(
+                static_cast<float>(reader.readQuantized(MILLIMETERS_PER_METER)));
+            break;
+        }
+        case MotorControlType::VELOCITY:
+        {
+            auto& velocity_control = *motor_control.mutable_direct_velocity_control();
+            reader.readVector(*velocity_control.mutable_velocity());
+            reader.readAngularVelocity(*velocity_control.mutable_angular_velocity());
+            reader.skip(sizeof(uint16_t));
+            break;
+        }
+        default:
+            reader.skip(4 * sizeof(uint16_t));
+            break;
+    }
+    motor_control.set_dribbler_speed_rpm(static_cast<int32_t>(reader.readUint32()));
+
+    TbotsProto::PowerControl& power_control = *direct_control.mutable_power_control();
+    auto chicker_type = static_cast<ChickerType>(reader.readUint8());
+    auto chicker_value =
+        static_cast<float>(reader.readUnsignedQuantized(MILLIMETERS_PER_METER));
+    switch (chicker_type)
+    {
+        case ChickerType::KICK:
+            power_control.mutable_chicker()->set_kick_speed_m_per_s(chicker_value);
+            break;
+        case ChickerType::CHIP:
+            power_control.mutable_chicker()->set_chip_distance_meters(chicker_value);
+            break;
+        case ChickerType::AUTOKICK:
+            power_control.mutable_chicker()
+                ->mutable_auto_chip_or_kick()
+                ->set_autokick_speed_m_per_s(chicker_value);
+            break;
+        case ChickerType::AUTOCHIP:
+            power_control.mutable_chicker()
+                ->mutable_auto_chip_or_kick()
+                ->set_autochip_distance_meters(chicker_value);
+            break;
+        default:
+            break;
+    }
+    power_control.set_geneva_slot(
+        static_cast<TbotsProto::Geneva::Slot>(reader.readUint8()));
+}
+
+/**
+ * Decodes the record at the given offset
+ *
+ * @param data The encoded set
+ * @param offset The offset of the record
+ *
+ * @return the primitive in the record
+ */
+TbotsProto::Primitive readRecord(const std::string& data, std::size_t offset)
+{
+    TbotsProto::Primitive primitive;
+    ByteReader reader(data, offset + RECORD_PRIMITIVE_OFFSET);
+    switch (
+        static_cast<RecordType>(static_cast<uint8_t>(data[offset + RECORD_TYPE_OFFSET])))
+    {
+        case RecordType::MOVE:
+            readMovePrimitive(reader, *primitive.mutable_move());
+            break;
+        case RecordType::STOP:
+            primitive.mutable_stop();
+            break;
+        case RecordType::DIRECT_CONTROL:
+            readDirectControlPrimitive(reader, *primitive.mutable_direct_control());
+            break;
+        default:
+            break;
+    }
+    return primitive;
+}
+}  // namespace
+
+CompactPrimitiveSet::CompactPrimitiveSet(const TbotsProto::PrimitiveSet& primitive_set)
+{
+    std::size_t max_num_records = std::min<std::size_t>(
+        primitive_set.robot_primitives().size(), std::numeric_limits<uint8_t>::max());
+    data.assign(HEADER_SIZE + max_num_records * RECORD_SIZE, '\0');
+
+    std::size_t num_records = 0;
+    for (const auto& [robot_id, primitive] : primitive_set.robot_primitives())
+    {
+        if (robot_id > std::numeric_limits<uint8_t>::max() ||
+            num_records == max_num_records)
+        {
+            LOG(WARNING) << "Can not encode the primitive of robot " << robot_id
+                         << " in a compact primitive set";
+            continue;
+        }
+
+        std::size_t offset = HEADER_SIZE + num_records * RECORD_SIZE;
+        ByteWriter writer(data, offset + RECORD_PRIMITIVE_OFFSET);
+        RecordType type = RecordType::NONE;
+        switch (primitive.primitive_case())
+        {
+            case TbotsProto::Primitive::kMove:
+                if (static_cast<unsigned>(
+                        primitive.move().xy_traj_params().sub_destinations_size()) >
+                    MAX_SUB_DESTINATIONS)
+                {
+                    LOG(WARNING) << "The move primitive of robot " << robot_id
+                                 << " has too many sub destinations to be encoded in a "
+                                 << "compact primitive set, so a stop primitive is sent";
+                    type = RecordType::STOP;
+                }
+                else
+                {
+                    writeMovePrimitive(writer, primitive.move());
+                    type = RecordType::MOVE;
+                }
+                break;
+            case TbotsProto::Primitive::kStop:
+                type = RecordType::STOP;
+                break;
+            case TbotsProto::Primitive::kDirectControl:
+                writeDirectControlPrimitive(writer, primitive.direct_control());
+                type = RecordType::DIRECT_CONTROL;
+                break;
+            default:
+                break;
+        }
+        data[offset + RECORD_ROBOT_ID_OFFSET] = static_cast<char>(robot_id);
+        data[offset + RECORD_TYPE_OFFSET]     = static_cast<char>(type);
+        num_records++;
+    }
+    data.resize(HEADER_SIZE + num_records * RECORD_SIZE);
+
+    uint64_t time_sent_bits;
+    double time_sent = primitive_set.time_sent().epoch_timestamp_seconds();
+    std::memcpy(&time_sent_bits, &time_sent, sizeof(time_sent_bits));
+
+    ByteWriter writer(data, 0);
+    writer.writeUint16(MAGIC_NUMBER);
+    writer.writeUint8(VERSION);
+    writer.writeUint8(static_cast<uint8_t>(num_records));
+    writer.writeUint8(primitive_set.stay_away_from_ball() ? STAY_AWAY_FROM_BALL_FLAG : 0);
+    writer.skip(3);
+    writer.writeUint64(primitive_set.sequence_number());
+    writer.writeUint64(time_sent_bits);
+}
+
+bool CompactPrimitiveSet::SerializeToString(std::string* output) const
+{
+    *output = data;
+    return isValid();
+}
+
+bool CompactPrimitiveSet::ParseFromArray(const void* data, int size)
+{
+    this->data.clear();
+    if (size < static_cast<int>(HEADER_SIZE))
+    {
+        return false;
+    }
+
+    std::string parsed_data(static_cast<const char*>(data),
+                            static_cast<std::size_t>(size));
+    ByteReader reader(parsed_data, 0);
+    uint16_t magic_number = reader.readUint16();
+    uint8_t version       = reader.readUint8();
+    uint8_t num_records   = reader.readUint8();
+    if (magic_number != MAGIC_NUMBER || version != VERSION ||
+        parsed_data.size() != HEADER_SIZE + num_records * RECORD_SIZE)
+    {
+        return false;
+    }
+
+    this->data = std::move(parsed_data);
+    return true;
+}
+
+bool CompactPrimitiveSet::isValid() const
+{
+    return !data.empty();
+}
+
+std::size_t CompactPrimitiveSet::size() const
+{
+    return data.size();
+}
+
+uint64_t CompactPrimitiveSet::getSequenceNumber() const
+{
+    if (!isValid())
+    {
+        return 0;
+    }
+    return ByteReader(data, HEADER_SEQUENCE_NUMBER_OFFSET).readUint64();
+}
+
+std::optional<TbotsProto::Primitive> CompactPrimitiveSet::getRobotPrimitive(
+    unsigned int robot_id) const
+{
+    std::optional<std::size_t> offset = findRecord(robot_id);
+    if (!offset)
+    {
+        return std::nullopt;
+    }
+    return readRecord(data, *offset);
+}
+
+TbotsProto::PrimitiveSet CompactPrimitiveSet::toPrimitiveSet() const
+{
+    TbotsProto::PrimitiveSet primitive_set;
+    if (!isValid())
+    {
+        return primitive_set;
+    }
+
+    ByteReader reader(data, HEADER_NUM_RECORDS_OFFSET);
+    uint8_t num_records = reader.readUint8();
+    uint8_t flags       = reader.readUint8();
+    reader.skip(3);
+    uint64_t sequence_number = reader.readUint64();
+    uint64_t time_sent_bits  = reader.readUint64();
+
+    double time_sent;
+    std::memcpy(&time_sent, &time_sent_bits, sizeof(time_sent));
+
+    primitive_set.mutable_time_sent()->set_epoch_timestamp_seconds(time_sent);
+    primitive_set.set_stay_away_from_ball(flags & STAY_AWAY_FROM_BALL_FLAG);
+    primitive_set.set_sequence_number(sequence_number);
+    for (std::size_t i = 0; i < num_records; i++)
+    {
+        std::size_t offset = HEADER_SIZE + i * RECORD_SIZE;
+        auto robot_id = static_cast<uint8_t>(data[offset + RECORD_ROBOT_ID_OFFSET]);
+        (*primitive_set.mutable_robot_primitives())[robot_id] = readRecord(data, offset);
+    }
+    return primitive_set;
+}
+
+std::optional<std::size_t> CompactPrimitiveSet::findRecord(unsigned int robot_id) const
+{
+    if (!isValid())
+    {
+        return std::nullopt;
+    }
+
+    auto num_records = static_cast<uint8_t>(data[HEADER_NUM_RECORDS_OFFSET]);
+    for (std::size_t i = 0; i < num_records; i++)
+    {
+        std::size_t offset = HEADER_SIZE + i * RECORD_SIZE;
+        if (static_cast<uint8_t>(data[offset + RECORD_ROBOT_ID_OFFSET]) == robot_id)
+        {
+            return offset;
+        }
+    }
+    return std::nullopt;
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "proto/primitive.pb.h"
+#include "proto/tbots_software_msgs.pb.h"
+
+/**
+ * A PrimitiveSet in a compact, fixed-layout binary wire format, which is much smaller
+ * than the protobuf encoding and lets each robot decode only its own primitive.
+ *
+ * All values are little-endian. The set starts with a header:
+ *  - magic number (uint16) and format version (uint8)
+ *  - number of robot records (uint8)
+ *  - flags (uint8), where bit 0 is stay_away_from_ball, and 3 bytes of padding
+ *  - sequence number (uint64)
+ *  - time sent, as the bits of a double of seconds since the epoch (uint64)
+ *
+ * This is followed by one record of RECORD_SIZE bytes per robot, which starts with the
+ * robot id (uint8) and the primitive type (uint8) so that a robot can find its record
+ * without decoding any other. The rest of the record holds the fields of the primitive
+ * in a fixed order, quantized to:
+ *  - positions in millimeters and linear velocities in millimeters per second (int16)
+ *  - angles in ten-thousandths of a radian, after being clamped to [-pi, pi] (int16)
+ *  - angular velocities in milliradians per second (int16)
+ *  - times in milliseconds, and kick speeds and chip distances in millimeters (uint16)
+ *
+ * The sender and receiver must use the same version of the format, and sets of a
+ * different version are rejected when parsed.
+ */
+class CompactPrimitiveSet
+{
+   public:
+    static constexpr uint16_t MAGIC_NUMBER         = 0x5442;
+    static constexpr uint8_t VERSION               = 1;
+    static constexpr std::size_t HEADER_SIZE       = 24;
+    static constexpr std::size_t RECORD_SIZE       = 38;
+    static constexpr unsigned MAX_SUB_DESTINATIONS = 2;
+
+    /**
+     * Creates an empty CompactPrimitiveSet, which is not valid until it is parsed
+     */
+    explicit CompactPrimitiveSet() = default;
+
+    /**
+     * Encodes the given PrimitiveSet. Primitives that can not be represented in the
+     * compact format (ex. with more than MAX_SUB_DESTINATIONS sub destinations) are
+     * replaced with stop primitives
+     *
+     * @param primitive_set The PrimitiveSet to encode
+     */
+    explicit CompactPrimitiveSet(const TbotsProto::PrimitiveSet& primitive_set);
+
+    /**
+     * Writes the encoded set to the given string. This matches the function of a
+     * protobuf message so that the set can be sent by the proto senders
+     *
+     * @param output The string to write the encoded set to
+     *
+     * @return whether the set is valid
+     */
+    bool SerializeToString(std::string* output) const;
+
+    /**
+     * Parses an encoded set, checking that its header and size are valid. This
+     * matches the function of a protobuf message so that the set can be received by
+     * the proto listeners
+     *
+     * @param data The encoded set
+     * @param size The size of the encoded set in bytes
+     *
+     * @return whether the encoded set is valid
+     */
+    bool ParseFromArray(const void* data, int size);
+
+    /**
+     * Checks if this set was encoded from a PrimitiveSet or parsed successfully
+     *
+     * @return whether this set is valid
+     */
+    bool isValid() const;
+
+    /**
+     * Gets the size of the encoded set
+     *
+     * @return the size of the encoded set in bytes
+     */
+    std::size_t size() const;
+
+    /**
+     * Gets the sequence number of the set
+     *
+     * @return the sequence number of the set
+     */
+    uint64_t getSequenceNumber() const;
+
+    /**
+     * Decodes the primitive of the given robot, without decoding any other record
+     *
+     * @param robot_id The id of the robot to get the primitive of
+     *
+     * @return the primitive of the robot, or std::nullopt if the set has no primitive
+     * for the robot
+     */
+    std::optional<TbotsProto::Primitive> getRobotPrimitive(unsigned int robot_id) const;
+
+    /**
+     * Decodes the whole set
+     *
+     * @return the decoded PrimitiveSet
+     */
+    TbotsProto::PrimitiveSet toPrimitiveSet() const;
+
+   private:
+    /**
+     * Finds the record of the given robot
+     *
+     * @param robot_id The id of the robot
+     *
+     * @return the offset of the robot's record, or std::nullopt if there is no record
+     * for the robot
+     */
+    std::optional<std::size_t> findRecord(unsigned int robot_id) const;
+
+    std::string data;
+};
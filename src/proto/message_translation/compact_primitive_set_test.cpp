@@ -0,0 +1,247 @@
+#include "proto/message_translation/compact_primitive_set.h"
+
+#include <google/protobuf/util/message_differencer.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+
+class CompactPrimitiveSetTest : public testing::Test
+{
+   protected:
+    /**
+     * Creates a move primitive with values that are exactly representable in the
+     * compact format
+     *
+     * @param offset An offset added to the positions, so that each robot gets a
+     * different primitive
+     *
+     * @return the move primitive
+     */
+    static TbotsProto::Primitive createMovePrimitive(double offset)
+    {
+        TbotsProto::Primitive primitive;
+        auto xy_traj_params = primitive.mutable_move()->mutable_xy_traj_params();
+        xy_traj_params->mutable_start_position()->set_x_meters(-1.25 + offset);
+        xy_traj_params->mutable_start_position()->set_y_meters(2.5);
+        xy_traj_params->mutable_destination()->set_x_meters(3.125 + offset);
+        xy_traj_params->mutable_destination()->set_y_meters(-0.5);
+        xy_traj_params->mutable_initial_velocity()->set_x_component_meters(1.5);
+        xy_traj_params->mutable_initial_velocity()->set_y_component_meters(-2.25);
+        xy_traj_params->set_max_speed_mode(TbotsProto::MaxAllowedSpeedMode::STOP_COMMAND);
+
+        auto sub_destination = xy_traj_params->add_sub_destinations();
+        sub_destination->mutable_sub_destination()->set_x_meters(0.5 + offset);
+        sub_destination->mutable_sub_destination()->set_y_meters(1.0);
+        sub_destination->set_connection_time_s(0.25f);
+
+        auto w_traj_params = primitive.mutable_move()->mutable_w_traj_params();
+        w_traj_params->mutable_start_angle()->set_radians(0.5);
+        w_traj_params->mutable_final_angle()->set_radians(-3);
+        w_traj_params->mutable_initial_velocity()->set_radians_per_second(1.25);
+
+        primitive.mutable_move()->set_dribbler_mode(TbotsProto::DribblerMode::INDEFINITE);
+        primitive.mutable_move()->mutable_auto_chip_or_kick()->set_autokick_speed_m_per_s(
+            4.5f);
+        return primitive;
+    }
+
+    /**
+     * Creates a PrimitiveSet with a primitive of every type
+     *
+     * @return the PrimitiveSet
+     */
+    static TbotsProto::PrimitiveSet createPrimitiveSet()
+    {
+        TbotsProto::PrimitiveSet primitive_set;
+        primitive_set.mutable_time_sent()->set_epoch_timestamp_seconds(1700000000.123456);
+        primitive_set.set_stay_away_from_ball(true);
+        primitive_set.set_sequence_number(123456789012);
+
+        auto& robot_primitives = *primitive_set.mutable_robot_primitives();
+        robot_primitives[0]    = createMovePrimitive(0);
+        robot_primitives[3]    = createMovePrimitive(1);
+        robot_primitives[5].mutable_stop();
+
+        TbotsProto::Primitive direct_control_primitive;
+        auto direct_control = direct_control_primitive.mutable_direct_control();
+        auto velocity_control =
+            direct_control->mutable_motor_control()->mutable_direct_velocity_control();
+        velocity_control->mutable_velocity()->set_x_component_meters(0.75);
+        velocity_control->mutable_velocity()->set_y_component_meters(-1);
+        velocity_control->mutable_angular_velocity()->set_radians_per_second(2);
+        direct_control->mutable_motor_control()->set_dribbler_speed_rpm(-12000);
+        direct_control->mutable_power_control()
+            ->mutable_chicker()
+            ->set_chip_distance_meters(1.5f);
+        direct_control->mutable_power_control()->set_geneva_slot(
+            TbotsProto::Geneva::Slot::CENTRE_RIGHT);
+        robot_primitives[7] = direct_control_primitive;
+
+        return primitive_set;
+    }
+
+    static bool equal(const google::protobuf::Message& first,
+                      const google::protobuf::Message& second)
+    {
+        return google::protobuf::util::MessageDifferencer::Equivalent(first, second);
+    }
+};
+
+TEST_F(CompactPrimitiveSetTest, default_constructed_set_is_invalid)
+{
+    CompactPrimitiveSet compact_primitive_set;
+
+    EXPECT_FALSE(compact_primitive_set.isValid());
+    EXPECT_EQ(std::nullopt, compact_primitive_set.getRobotPrimitive(0));
+}
+
+TEST_F(CompactPrimitiveSetTest, encoded_set_has_fixed_size_records)
+{
+    CompactPrimitiveSet compact_primitive_set(createPrimitiveSet());
+
+    EXPECT_TRUE(compact_primitive_set.isValid());
+    EXPECT_EQ(CompactPrimitiveSet::HEADER_SIZE + 4 * CompactPrimitiveSet::RECORD_SIZE,
+              compact_primitive_set.size());
+}
+
+TEST_F(CompactPrimitiveSetTest, round_trip_whole_set)
+{
+    TbotsProto::PrimitiveSet primitive_set = createPrimitiveSet();
+
+    std::string encoded;
+    ASSERT_TRUE(CompactPrimitiveSet(primitive_set).SerializeToString(&encoded));
+
+    CompactPrimitiveSet compact_primitive_set;
+    ASSERT_TRUE(compact_primitive_set.ParseFromArray(encoded.data(),
+                                                     static_cast<int>(encoded.size())));
+    EXPECT_EQ(primitive_set.sequence_number(), compact_primitive_set.getSequenceNumber());
+    EXPECT_TRUE(equal(primitive_set, compact_primitive_set.toPrimitiveSet()));
+}
+
+TEST_F(CompactPrimitiveSetTest, get_robot_primitive)
+{
+    TbotsProto::PrimitiveSet primitive_set = createPrimitiveSet();
+    CompactPrimitiveSet compact_primitive_set(primitive_set);
+
+    for (const auto& [robot_id, primitive] : primitive_set.robot_primitives())
+    {
+        std::optional<TbotsProto::Primitive> decoded_primitive =
+            compact_primitive_set.getRobotPrimitive(robot_id);
+        ASSERT_TRUE(decoded_primitive.has_value());
+        EXPECT_TRUE(equal(primitive, *decoded_primitive)) << robot_id;
+    }
+    EXPECT_EQ(std::nullopt, compact_primitive_set.getRobotPrimitive(1));
+}
+
+TEST_F(CompactPrimitiveSetTest, values_are_quantized)
+{
+    TbotsProto::PrimitiveSet primitive_set;
+    TbotsProto::Primitive primitive = createMovePrimitive(0);
+    auto xy_traj_params = primitive.mutable_move()->mutable_xy_traj_params();
+    xy_traj_params->mutable_destination()->set_x_meters(1.23456);
+    // Too far away to be represented, so it saturates
+    xy_traj_params->mutable_destination()->set_y_meters(-100);
+    // Angles are clamped to [-pi, pi]
+    primitive.mutable_move()->mutable_w_traj_params()->mutable_final_angle()->set_radians(
+        2 * M_PI + 1);
+    (*primitive_set.mutable_robot_primitives())[2] = primitive;
+
+    std::optional<TbotsProto::Primitive> decoded_primitive =
+        CompactPrimitiveSet(primitive_set).getRobotPrimitive(2);
+    ASSERT_TRUE(decoded_primitive.has_value());
+
+    const auto& decoded_move = decoded_primitive->move();
+    EXPECT_DOUBLE_EQ(1.235, decoded_move.xy_traj_params().destination().x_meters());
+    EXPECT_DOUBLE_EQ(-32.768, decoded_move.xy_traj_params().destination().y_meters());
+    EXPECT_DOUBLE_EQ(1, decoded_move.w_traj_params().final_angle().radians());
+}
+
+TEST_F(CompactPrimitiveSetTest, too_many_sub_destinations_sends_stop)
+{
+    TbotsProto::PrimitiveSet primitive_set;
+    TbotsProto::Primitive primitive = createMovePrimitive(0);
+    for (unsigned i = 0; i < CompactPrimitiveSet::MAX_SUB_DESTINATIONS; i++)
+    {
+        primitive.mutable_move()->mutable_xy_traj_params()->add_sub_destinations();
+    }
+    (*primitive_set.mutable_robot_primitives())[2] = primitive;
+
+    std::optional<TbotsProto::Primitive> decoded_primitive =
+        CompactPrimitiveSet(primitive_set).getRobotPrimitive(2);
+    ASSERT_TRUE(decoded_primitive.has_value());
+    EXPECT_TRUE(decoded_primitive->has_stop());
+}
+
+TEST_F(CompactPrimitiveSetTest, parse_rejects_invalid_sets)
+{
+    std::string encoded;
+    CompactPrimitiveSet(createPrimitiveSet()).SerializeToString(&encoded);
+
+    CompactPrimitiveSet compact_primitive_set;
+
+    // Truncated
+    EXPECT_FALSE(compact_primitive_set.ParseFromArray(
+        encoded.data(), static_cast<int>(encoded.size() - 1)));
+    EXPECT_FALSE(compact_primitive_set.isValid());
+
+    // Different version
+    std::string different_version = encoded;
+    different_version[2]          = static_cast<char>(CompactPrimitiveSet::VERSION + 1);
+    EXPECT_FALSE(compact_primitive_set.ParseFromArray(
+        different_version.data(), static_cast<int>(different_version.size())));
+
+    // A serialized protobuf
+    std::string serialized_proto = createPrimitiveSet().SerializeAsString();
+    EXPECT_FALSE(compact_primitive_set.ParseFromArray(
+        serialized_proto.data(), static_cast<int>(serialized_proto.size())));
+}
+
+TEST_F(CompactPrimitiveSetTest, DISABLED_compact_vs_protobuf_speed_test)
+{
+    const unsigned int num_iterations = 100000;
+
+    TbotsProto::PrimitiveSet primitive_set;
+    for (unsigned int robot_id = 0; robot_id < 6; robot_id++)
+    {
+        (*primitive_set.mutable_robot_primitives())[robot_id] =
+            createMovePrimitive(robot_id);
+    }
+
+    // Encode the set and then decode the primitive of one robot, as the AI and a robot
+    // would
+    std::string encoded;
+    TbotsProto::PrimitiveSet decoded_primitive_set;
+    TbotsProto::Primitive decoded_primitive;
+    auto start_time = std::chrono::system_clock::now();
+    for (unsigned int i = 0; i < num_iterations; i++)
+    {
+        primitive_set.SerializeToString(&encoded);
+        decoded_primitive_set.ParseFromString(encoded);
+        decoded_primitive = decoded_primitive_set.robot_primitives().at(3);
+    }
+    double protobuf_time_us = std::chrono::duration<double, std::micro>(
+                                  std::chrono::system_clock::now() - start_time)
+                                  .count() /
+                              num_iterations;
+    std::size_t protobuf_size = encoded.size();
+
+    CompactPrimitiveSet compact_primitive_set;
+    start_time = std::chrono::system_clock::now();
+    for (unsigned int i = 0; i < num_iterations; i++)
+    {
+        CompactPrimitiveSet(primitive_set).SerializeToString(&encoded);
+        compact_primitive_set.ParseFromArray(encoded.data(),
+                                             static_cast<int>(encoded.size()));
+        decoded_primitive = *compact_primitive_set.getRobotPrimitive(3);
+    }
+    double compact_time_us = std::chrono::duration<double, std::micro>(
+                                 std::chrono::system_clock::now() - start_time)
+                                 .count() /
+                             num_iterations;
+
+    std::cout << "Protobuf: " << protobuf_size << " bytes, " << protobuf_time_us
+              << "us to encode and decode" << std::endl;
+    std::cout << "Compact: " << encoded.size() << " bytes, " << compact_time_us
+              << "us to encode and decode" << std::endl;
+}
@@ -6,6 +6,7 @@
 
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -33,16 +34,15 @@ extern "C"
 
 
 /**
- * Serialize nanopb into its byte representation
+ * Gets the nanopb fields and max encoded size of a power msg
  *
- * @param data nanopb msg to be serialized
- * @return vector of bytes representation of provided nanopb
+ * @tparam T the type of the nanopb msg
+ * @param fields set to the nanopb fields of the msg
+ * @param size set to the max encoded size of the msg
  */
 template <typename T>
-std::vector<uint8_t> serializeToVector(const T& data)
+void getNanoPbFieldsAndSize(const pb_field_t*& fields, size_t& size)
 {
-    const pb_field_t* fields;
-    int size;
     if (std::is_same<T, TbotsProto_PowerFrame>::value)
     {
         fields = TbotsProto_PowerFrame_fields;
@@ -62,15 +62,48 @@ std::vector<uint8_t> serializeToVector(const T& data)
     {
         throw std::runtime_error("Unexpected type as argument");
     }
+}
 
-    std::vector<uint8_t> buffer(size);
-    pb_ostream_t stream =
-        pb_ostream_from_buffer(static_cast<uint8_t*>(buffer.data()), buffer.size());
+/**
+ * Serialize nanopb into its byte representation in the given buffer, padded with
+ * zeros to the max encoded size of the msg
+ *
+ * @param data nanopb msg to be serialized
+ * @param buffer buffer to serialize into, at least as big as the max encoded size
+ * @return the number of bytes written to the buffer
+ */
+template <typename T>
+size_t serializeToBuffer(const T& data, uint8_t* buffer)
+{
+    const pb_field_t* fields;
+    size_t size;
+    getNanoPbFieldsAndSize<T>(fields, size);
+
+    memset(buffer, 0, size);
+    pb_ostream_t stream = pb_ostream_from_buffer(buffer, size);
     if (!pb_encode(&stream, fields, &data))
     {
         throw std::runtime_error(
-            "Failed to encode PowerFrame msg to vector when converting nanopb to vector");
+            "Failed to encode PowerFrame msg when converting nanopb to bytes");
     }
+    return size;
+}
+
+/**
+ * Serialize nanopb into its byte representation
+ *
+ * @param data nanopb msg to be serialized
+ * @return vector of bytes representation of provided nanopb
+ */
+template <typename T>
+std::vector<uint8_t> serializeToVector(const T& data)
+{
+    const pb_field_t* fields;
+    size_t size;
+    getNanoPbFieldsAndSize<T>(fields, size);
+
+    std::vector<uint8_t> buffer(size);
+    serializeToBuffer(data, buffer.data());
     return buffer;
 }
 
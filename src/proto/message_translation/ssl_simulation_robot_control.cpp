@@ -10,9 +10,14 @@ float rpm_to_m_per_s(float rpm, float wheel_radius_meters)
     return (2 * (float)M_PI * rpm * wheel_radius_meters) / 60.0f;
 }
 
-std::unique_ptr<SSLSimulationProto::RobotMoveCommand> createRobotMoveCommand(
-    const TbotsProto::DirectControlPrimitive& direct_control, float front_wheel_angle_deg,
-    float back_wheel_angle_deg, float wheel_radius_meters)
+/**
+ * Sets the local velocity of the given RobotMoveCommand from a DirectControlPrimitive
+ *
+ * @param direct_control The DirectControlPrimitive to set the move command from
+ * @param move_command The RobotMoveCommand to set
+ */
+static void setRobotMoveCommand(const TbotsProto::DirectControlPrimitive& direct_control,
+                                SSLSimulationProto::RobotMoveCommand& move_command)
 {
     switch (direct_control.motor_control().drive_control_case())
     {
@@ -23,113 +28,122 @@ std::unique_ptr<SSLSimulationProto::RobotMoveCommand> createRobotMoveCommand(
 
         case TbotsProto::MotorControl::kDirectVelocityControl:
         {
-            auto move_local_velocity = SSLSimulationProto::MoveLocalVelocity();
-            move_local_velocity.set_forward(
-                static_cast<float>(direct_control.motor_control()
-                                       .direct_velocity_control()
-                                       .velocity()
-                                       .x_component_meters()));
-            move_local_velocity.set_left(static_cast<float>(direct_control.motor_control()
-                                                                .direct_velocity_control()
-                                                                .velocity()
-                                                                .y_component_meters()));
-            move_local_velocity.set_angular(
-                static_cast<float>(direct_control.motor_control()
-                                       .direct_velocity_control()
-                                       .angular_velocity()
-                                       .radians_per_second()));
-
-            auto move_command = std::make_unique<SSLSimulationProto::RobotMoveCommand>();
-            *(move_command->mutable_local_velocity()) = move_local_velocity;
-            return move_command;
+            const auto& direct_velocity_control =
+                direct_control.motor_control().direct_velocity_control();
+            auto move_local_velocity = move_command.mutable_local_velocity();
+            move_local_velocity->set_forward(static_cast<float>(
+                direct_velocity_control.velocity().x_component_meters()));
+            move_local_velocity->set_left(static_cast<float>(
+                direct_velocity_control.velocity().y_component_meters()));
+            move_local_velocity->set_angular(static_cast<float>(
+                direct_velocity_control.angular_velocity().radians_per_second()));
+            break;
         }
+        default:
+            break;
     }
-    return std::make_unique<SSLSimulationProto::RobotMoveCommand>();
 }
 
-std::unique_ptr<SSLSimulationProto::RobotCommand> getRobotCommandFromDirectControl(
-    unsigned int robot_id,
-    std::unique_ptr<TbotsProto::DirectControlPrimitive> direct_control,
-    RobotConstants_t& robot_constants)
+/**
+ * Sets the kick and dribbler fields of the given RobotCommand
+ *
+ * @param robot_id The id the RobotCommand is for
+ * @param kick_speed The speed to kick at [m/s]
+ * @param kick_angle The angle to chip at [degree]
+ * @param dribbler_speed The speed to dribble at [rpm]
+ * @param robot_command The RobotCommand to set
+ */
+static void setRobotCommand(unsigned int robot_id, std::optional<double> kick_speed,
+                            std::optional<double> kick_angle,
+                            std::optional<double> dribbler_speed,
+                            SSLSimulationProto::RobotCommand& robot_command)
+{
+    robot_command.set_id(robot_id);
+
+    if (kick_speed.has_value())
+    {
+        robot_command.set_kick_speed(static_cast<float>(kick_speed.value()));
+    }
+    if (kick_angle.has_value())
+    {
+        robot_command.set_kick_angle(static_cast<float>(kick_angle.value()));
+    }
+    if (dribbler_speed.has_value())
+    {
+        // NOTE: our dribbler speed for the robots is negative RPM to dribble, but
+        // the RobotCommand expects positive RPM to dribble. So we invert the sign
+        robot_command.set_dribbler_speed(-1.0f *
+                                         static_cast<float>(dribbler_speed.value()));
+    }
+}
+
+/**
+ * Calculates the speed a robot has to chip at to chip the ball the given distance
+ *
+ * @param chip_distance_meters The distance to chip the ball
+ *
+ * @return the speed to chip at [m/s]
+ */
+static float getChipSpeed(float chip_distance_meters)
+{
+    Angle chip_angle = Angle::fromDegrees(ROBOT_CHIP_ANGLE_DEGREES);
+    // Use the formula for the Range of a parabolic projectile
+    // Rearrange to solve for the initial velocity.
+    // https://courses.lumenlearning.com/boundless-physics/chapter/projectile-motion/
+    float numerator =
+        chip_distance_meters *
+        static_cast<float>(ACCELERATION_DUE_TO_GRAVITY_METERS_PER_SECOND_SQUARED);
+    float denominator = static_cast<float>(2.0f * (chip_angle * 2.0f).sin());
+    return static_cast<float>(std::sqrt(numerator / denominator));
+}
+
+/**
+ * Sets the given RobotCommand from a Direct Control Primitive
+ *
+ * @param robot_id The id the RobotCommand is for
+ * @param direct_control The Direct Control Primitive to set the RobotCommand from
+ * @param robot_command The RobotCommand to set
+ */
+static void setRobotCommandFromDirectControl(
+    unsigned int robot_id, const TbotsProto::DirectControlPrimitive& direct_control,
+    SSLSimulationProto::RobotCommand& robot_command)
 {
-    auto move_command = createRobotMoveCommand(
-        *direct_control, robot_constants.front_wheel_angle_deg,
-        robot_constants.back_wheel_angle_deg, robot_constants.wheel_radius_meters);
     // Values for robot command
-    std::optional<float> kick_speed;       // [m/s]
-    std::optional<float> kick_angle;       // [degree]
-    std::optional<double> dribbler_speed;  // [rpm]
+    std::optional<float> kick_speed;  // [m/s]
+    std::optional<float> kick_angle;  // [degree]
 
-    switch (direct_control->power_control().chicker().chicker_command_case())
+    const auto& chicker = direct_control.power_control().chicker();
+    switch (chicker.chicker_command_case())
     {
         case TbotsProto::PowerControl::ChickerControl::kKickSpeedMPerS:
         {
-            kick_speed = direct_control->power_control().chicker().kick_speed_m_per_s();
-            kick_angle = std::nullopt;
+            kick_speed = chicker.kick_speed_m_per_s();
             break;
         }
         case TbotsProto::PowerControl::ChickerControl::kChipDistanceMeters:
         {
-            Angle chip_angle = Angle::fromDegrees(ROBOT_CHIP_ANGLE_DEGREES);
-            // Use the formula for the Range of a parabolic projectile
-            // Rearrange to solve for the initial velocity.
-            // https://courses.lumenlearning.com/boundless-physics/chapter/projectile-motion/
-            float range =
-                direct_control->power_control().chicker().chip_distance_meters();
-            float numerator =
-                range *
-                static_cast<float>(ACCELERATION_DUE_TO_GRAVITY_METERS_PER_SECOND_SQUARED);
-            float denominator = static_cast<float>(2.0f * (chip_angle * 2.0f).sin());
-            float chip_speed  = static_cast<float>(std::sqrt(numerator / denominator));
-
-            kick_speed = chip_speed;
-            kick_angle = chip_angle.toDegrees();
+            kick_speed = getChipSpeed(chicker.chip_distance_meters());
+            kick_angle = Angle::fromDegrees(ROBOT_CHIP_ANGLE_DEGREES).toDegrees();
             break;
         }
         case TbotsProto::PowerControl::ChickerControl::kAutoChipOrKick:
         {
-            switch (direct_control->power_control()
-                        .chicker()
-                        .auto_chip_or_kick()
-                        .auto_chip_or_kick_case())
+            switch (chicker.auto_chip_or_kick().auto_chip_or_kick_case())
             {
                 case TbotsProto::AutoChipOrKick::kAutokickSpeedMPerS:
                 {
-                    kick_speed = direct_control->power_control()
-                                     .chicker()
-                                     .auto_chip_or_kick()
-                                     .autokick_speed_m_per_s();
-                    kick_angle = std::nullopt;
+                    kick_speed = chicker.auto_chip_or_kick().autokick_speed_m_per_s();
                     break;
                 }
                 case TbotsProto::AutoChipOrKick::kAutochipDistanceMeters:
                 {
-                    Angle chip_angle = Angle::fromDegrees(ROBOT_CHIP_ANGLE_DEGREES);
-                    // Use the formula for the Range of a parabolic projectile
-                    // Rearrange to solve for the initial velocity.
-                    // https://courses.lumenlearning.com/boundless-physics/chapter/projectile-motion/
-                    float range = direct_control->power_control()
-                                      .chicker()
-                                      .auto_chip_or_kick()
-                                      .autochip_distance_meters();
-                    float numerator =
-                        range *
-                        static_cast<float>(
-                            ACCELERATION_DUE_TO_GRAVITY_METERS_PER_SECOND_SQUARED);
-                    float denominator =
-                        static_cast<float>(2.0f * (chip_angle * 2.0f).sin());
-                    float chip_speed =
-                        static_cast<float>(std::sqrt(numerator / denominator));
-
-                    kick_speed = chip_speed;
-                    kick_angle = chip_angle.toDegrees();
+                    kick_speed = getChipSpeed(
+                        chicker.auto_chip_or_kick().autochip_distance_meters());
+                    kick_angle = Angle::fromDegrees(ROBOT_CHIP_ANGLE_DEGREES).toDegrees();
                     break;
                 }
                 case TbotsProto::AutoChipOrKick::AUTO_CHIP_OR_KICK_NOT_SET:
                 {
-                    direct_control->mutable_power_control()
-                        ->mutable_chicker()
-                        ->clear_chicker_command();
                     break;
                 }
             }
@@ -137,15 +151,42 @@ std::unique_ptr<SSLSimulationProto::RobotCommand> getRobotCommandFromDirectContr
         }
         case TbotsProto::PowerControl::ChickerControl::CHICKER_COMMAND_NOT_SET:
         {
-            direct_control->mutable_power_control()
-                ->mutable_chicker()
-                ->clear_chicker_command();
             break;
         }
     }
 
-    return createRobotCommand(robot_id, std::move(move_command), kick_speed, kick_angle,
-                              direct_control->motor_control().dribbler_speed_rpm());
+    setRobotCommand(robot_id, kick_speed, kick_angle,
+                    direct_control.motor_control().dribbler_speed_rpm(), robot_command);
+    setRobotMoveCommand(direct_control, *robot_command.mutable_move_command());
+}
+
+std::unique_ptr<SSLSimulationProto::RobotMoveCommand> createRobotMoveCommand(
+    const TbotsProto::DirectControlPrimitive& direct_control, float front_wheel_angle_deg,
+    float back_wheel_angle_deg, float wheel_radius_meters)
+{
+    auto move_command = std::make_unique<SSLSimulationProto::RobotMoveCommand>();
+    setRobotMoveCommand(direct_control, *move_command);
+    return move_command;
+}
+
+std::unique_ptr<SSLSimulationProto::RobotCommand> getRobotCommandFromDirectControl(
+    unsigned int robot_id,
+    std::unique_ptr<TbotsProto::DirectControlPrimitive> direct_control,
+    RobotConstants_t& robot_constants)
+{
+    auto robot_command = std::make_unique<SSLSimulationProto::RobotCommand>();
+    setRobotCommandFromDirectControl(robot_id, *direct_control, *robot_command);
+    return robot_command;
+}
+
+SSLSimulationProto::RobotCommand* createRobotCommandFromDirectControl(
+    unsigned int robot_id, const TbotsProto::DirectControlPrimitive& direct_control,
+    google::protobuf::Arena* arena)
+{
+    auto robot_command =
+        google::protobuf::Arena::CreateMessage<SSLSimulationProto::RobotCommand>(arena);
+    setRobotCommandFromDirectControl(robot_id, direct_control, *robot_command);
+    return robot_command;
 }
 
 std::unique_ptr<SSLSimulationProto::RobotCommand> createRobotCommand(
@@ -155,27 +196,8 @@ std::unique_ptr<SSLSimulationProto::RobotCommand> createRobotCommand(
     std::optional<double> dribbler_speed)
 {
     auto robot_command = std::make_unique<SSLSimulationProto::RobotCommand>();
-
-    robot_command->set_id(robot_id);
-
-    if (kick_speed.has_value())
-    {
-        robot_command->set_kick_speed(static_cast<float>(kick_speed.value()));
-    }
-    if (kick_angle.has_value())
-    {
-        robot_command->set_kick_angle(static_cast<float>(kick_angle.value()));
-    }
-    if (dribbler_speed.has_value())
-    {
-        // NOTE: our dribbler speed for the robots is negative RPM to dribble, but
-        // the RobotCommand expects positive RPM to dribble. So we invert the sign
-        robot_command->set_dribbler_speed(-1.0f *
-                                          static_cast<float>(dribbler_speed.value()));
-    }
-
+    setRobotCommand(robot_id, kick_speed, kick_angle, dribbler_speed, *robot_command);
     *(robot_command->mutable_move_command()) = *move_command;
-
     return robot_command;
 }
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <google/protobuf/arena.h>
+
 #include <optional>
 
 #include "proto/ssl_simulation_robot_control.pb.h"
@@ -36,6 +38,20 @@ std::unique_ptr<SSLSimulationProto::RobotCommand> getRobotCommandFromDirectContr
     std::unique_ptr<TbotsProto::DirectControlPrimitive> direct_control,
     RobotConstants_t& robot_constants);
 
+/**
+ * Creates a RobotCommand proto from Direct Control Primitive in the given arena, so that
+ * it is freed together with everything else in the arena
+ *
+ * @param robot_id The id this RobotCommand is for
+ * @param direct_control The Direct Control Primitive to create this RobotCommand from
+ * @param arena The arena to create the RobotCommand in
+ *
+ * @return RobotCommand proto, owned by the arena
+ */
+SSLSimulationProto::RobotCommand* createRobotCommandFromDirectControl(
+    unsigned int robot_id, const TbotsProto::DirectControlPrimitive& direct_control,
+    google::protobuf::Arena* arena);
+
 /**
  * Creates a RobotCommand proto
  *
@@ -34,3 +34,35 @@ TEST_F(SSLSimulationProtoTest, test_create_robot_move_command_forward_from_primi
     EXPECT_EQ(move_command->local_velocity().forward(), 10);
     EXPECT_EQ(move_command->local_velocity().angular(), 2);
 }
+
+TEST_F(SSLSimulationProtoTest, test_create_robot_command_in_arena_matches_heap_command)
+{
+    TbotsProto::DirectControlPrimitive test;
+    test.mutable_motor_control()
+        ->mutable_direct_velocity_control()
+        ->mutable_velocity()
+        ->set_x_component_meters(1);
+    test.mutable_motor_control()->set_dribbler_speed_rpm(-1000);
+
+    TbotsProto::DirectControlPrimitive test_kick = test;
+    test_kick.mutable_power_control()->mutable_chicker()->set_kick_speed_m_per_s(3);
+    TbotsProto::DirectControlPrimitive test_chip = test;
+    test_chip.mutable_power_control()->mutable_chicker()->set_chip_distance_meters(2);
+    TbotsProto::DirectControlPrimitive test_autochip = test;
+    test_autochip.mutable_power_control()
+        ->mutable_chicker()
+        ->mutable_auto_chip_or_kick()
+        ->set_autochip_distance_meters(2);
+
+    google::protobuf::Arena arena;
+    for (const auto& direct_control : {test, test_kick, test_chip, test_autochip})
+    {
+        auto heap_command = getRobotCommandFromDirectControl(
+            3, std::make_unique<TbotsProto::DirectControlPrimitive>(direct_control),
+            robot_constants);
+        auto arena_command = createRobotCommandFromDirectControl(3, direct_control, &arena);
+
+        EXPECT_EQ(&arena, arena_command->GetArena());
+        EXPECT_EQ(heap_command->SerializeAsString(), arena_command->SerializeAsString());
+    }
+}
@@ -6,6 +6,7 @@
 #include "proto/visualization.pb.h"
 #include "proto/world.pb.h"
 #include "software/ai/navigator/trajectory/bang_bang_trajectory_1d_angular.h"
+#include "software/ai/navigator/trajectory/bang_bang_trajectory_path.h"
 #include "software/ai/navigator/trajectory/trajectory_path.h"
 #include "software/ai/passing/pass_with_rating.h"
 #include "software/world/world.h"
@@ -223,6 +224,22 @@ std::optional<TrajectoryPath> createTrajectoryPathFromParams(
     const TbotsProto::TrajectoryPathParams2D& params, const Vector& initial_velocity,
     const RobotConstants& robot_constants);
 
+/**
+ * Generate a 2D Trajectory Path given 2D trajectory parameters into an existing
+ * BangBangTrajectoryPath, reusing its storage instead of allocating a new path
+ *
+ * @param params 2D Trajectory Path
+ * @param initial_velocity Initial velocity to use for the trajectory
+ * @param robot_constants Constants to use for the trajectory
+ * @param trajectory_path The trajectory path to generate into
+ * @return true if the trajectory path was generated, false if it could not be
+ * generated from the given parameters, in which case trajectory_path is invalid
+ */
+bool generateTrajectoryPathFromParams(const TbotsProto::TrajectoryPathParams2D& params,
+                                      const Vector& initial_velocity,
+                                      const RobotConstants& robot_constants,
+                                      BangBangTrajectoryPath& trajectory_path);
+
 /**
  * Generate an angular trajectory Path given angular trajectory proto parameters
  *
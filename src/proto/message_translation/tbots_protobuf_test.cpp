@@ -211,6 +211,24 @@ TEST_P(TrajectoryParamConversionTest, trajectory_params_msg_test)
     TrajectoryPath converted_trajectory_path = converted_trajectory_path_opt.value();
     TbotsProtobufTest::assertTrajectoryPathsAreSame(trajectory_path,
                                                     converted_trajectory_path);
+
+    BangBangTrajectoryPath generated_trajectory_path;
+    ASSERT_TRUE(generateTrajectoryPathFromParams(params, initial_velocity,
+                                                 robot_constants,
+                                                 generated_trajectory_path));
+    ASSERT_EQ(converted_trajectory_path.getTrajectoryPathNodes().size(),
+              generated_trajectory_path.getNumTrajectories());
+    EXPECT_DOUBLE_EQ(converted_trajectory_path.getTotalTime(),
+                     generated_trajectory_path.getTotalTime());
+    for (double t = 0; t < converted_trajectory_path.getTotalTime(); t += 0.1)
+    {
+        EXPECT_EQ(converted_trajectory_path.getPosition(t),
+                  generated_trajectory_path.getPosition(t))
+            << " Position at t=" << t << " is not equal";
+        EXPECT_EQ(converted_trajectory_path.getVelocity(t),
+                  generated_trajectory_path.getVelocity(t))
+            << " Velocity at t=" << t << " is not equal";
+    }
 }
 
 INSTANTIATE_TEST_CASE_P(
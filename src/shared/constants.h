@@ -33,8 +33,10 @@ static const short unsigned int PLOTJUGGLER_GUI_DEFAULT_PORT = 9870;
 static const char REDIS_DEFAULT_HOST[REDIS_HOST_LENGTH] = "127.0.0.1";
 static const short unsigned int REDIS_DEFAULT_PORT      = 6379;
 
-// the UDP port robots are listening to for primitives
-static const short unsigned int PRIMITIVE_PORT = 42070;
+// the UDP ports robots are listening to for primitives, as protobufs and in the
+// compact wire format
+static const short unsigned int PRIMITIVE_PORT         = 42070;
+static const short unsigned int COMPACT_PRIMITIVE_PORT = 42073;
 
 // the port the AI receives msgs from the robot
 static const short unsigned int ROBOT_STATUS_PORT = 42071;
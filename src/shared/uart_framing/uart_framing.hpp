@@ -17,6 +17,19 @@ extern "C"
 
 const uint8_t START_END_FLAG_BYTE = 0x00;
 
+// The max sizes of a serialized power_msg and TbotsProto_PowerFrame, and of a
+// TbotsProto_PowerFrame once it is encoded with COBS, which adds an overhead byte for
+// every block of up to 254 bytes and the start and end flags. These are known at
+// compile time so that frames can be marshalled into fixed buffers
+const size_t MAX_POWER_MSG_SIZE =
+    TbotsProto_PowerPulseControl_size > TbotsProto_PowerStatus_size
+        ? TbotsProto_PowerPulseControl_size
+        : TbotsProto_PowerStatus_size;
+const size_t MAX_POWER_FRAME_SIZE =
+    MAX_POWER_MSG_SIZE + 2 * sizeof(uint32_t) + sizeof(uint16_t);
+const size_t MAX_MARSHALLED_POWER_FRAME_SIZE =
+    MAX_POWER_FRAME_SIZE + MAX_POWER_FRAME_SIZE / 254 + 3;
+
 namespace
 {
     /**
@@ -26,7 +39,7 @@ namespace
      * @param length the length of the data
      * @return CRC-16 for given data and length
      */
-    uint16_t crc16(const std::vector<uint8_t>& data, uint16_t length)
+    uint16_t crc16(const uint8_t* data, uint16_t length)
     {
         uint8_t x;
         uint16_t crc = 0xFFFF;
@@ -52,63 +65,88 @@ namespace
     bool verifyLengthAndCrc(const TbotsProto_PowerFrame& frame)
     {
         uint16_t expected_length;
-        std::vector<uint8_t> bytes;
+        uint8_t bytes[MAX_POWER_MSG_SIZE];
         switch (frame.which_power_msg)
         {
             case TbotsProto_PowerFrame_power_control_tag:
                 expected_length = TbotsProto_PowerPulseControl_size;
-                bytes           = serializeToVector(frame.power_msg.power_control);
+                serializeToBuffer(frame.power_msg.power_control, bytes);
                 break;
             case TbotsProto_PowerFrame_power_status_tag:
                 expected_length = TbotsProto_PowerStatus_size;
-                bytes           = serializeToVector(frame.power_msg.power_status);
+                serializeToBuffer(frame.power_msg.power_status, bytes);
                 break;
             default:
                 return false;
         }
-        uint16_t expected_crc = crc16(bytes, static_cast<uint16_t>(frame.length));
-        return frame.crc == expected_crc && frame.length == expected_length;
+        if (frame.length != expected_length)
+        {
+            return false;
+        }
+        return frame.crc == crc16(bytes, expected_length);
     }
 
     /**
      * Implementation of modified Consistent Overhead Byte Stuffing(COBS) encoding
      * https://en.wikipedia.org/wiki/Consistent_Overhead_Byte_Stuffing
      *
-     * Uses a Delimiter byte at both the beginning(different) and end(normal)
+     * Uses a Delimiter byte at both the beginning(different) and end(normal).
+     * Each overhead byte is written in place once its block is complete, so the
+     * encoding is done in a single pass without moving any bytes
      *
-     * @param to_encode the vector of bytes to encode
-     * @return a vector of bytes encoded with COBS
+     * @param to_encode the bytes to encode
+     * @param length the number of bytes to encode
+     * @param encoded the buffer to encode to, which must fit
+     * length + length / 254 + 3 bytes
+     * @return the number of bytes in the encoding
      */
-    std::vector<uint8_t> cobsEncoding(const std::vector<uint8_t>& to_encode)
+    size_t cobsEncode(const uint8_t* to_encode, size_t length, uint8_t* encoded)
     {
-        auto encoded = std::vector<uint8_t>();
-        encoded.emplace_back(START_END_FLAG_BYTE);
+        encoded[0] = START_END_FLAG_BYTE;
 
         size_t overhead_location = 1;
+        size_t encoded_length    = 2;
         uint8_t overhead         = 0x01;
 
-        for (auto byte : to_encode)
+        for (size_t i = 0; i < length; i++)
         {
-            if (byte == START_END_FLAG_BYTE)
+            if (to_encode[i] == START_END_FLAG_BYTE)
             {
-                encoded.insert(encoded.begin() + overhead_location, overhead);
-                overhead_location = encoded.size();
-                overhead          = 0x01;
+                encoded[overhead_location] = overhead;
+                overhead_location          = encoded_length++;
+                overhead                   = 0x01;
             }
             else
             {
-                encoded.emplace_back(byte);
+                encoded[encoded_length++] = to_encode[i];
                 if (++overhead == 0xFF)
                 {
-                    encoded.insert(encoded.begin() + overhead_location, overhead);
-                    overhead_location = encoded.size();
-                    overhead          = 0x01;
+                    encoded[overhead_location] = overhead;
+                    overhead_location          = encoded_length++;
+                    overhead                   = 0x01;
                 }
             }
         }
-        encoded.insert(encoded.begin() + overhead_location, overhead);
-        encoded.emplace_back(START_END_FLAG_BYTE);
+        encoded[overhead_location] = overhead;
+        encoded[encoded_length++]  = START_END_FLAG_BYTE;
+
+        return encoded_length;
+    }
 
+    /**
+     * Implementation of modified Consistent Overhead Byte Stuffing(COBS) encoding
+     * https://en.wikipedia.org/wiki/Consistent_Overhead_Byte_Stuffing
+     *
+     * Uses a Delimiter byte at both the beginning(different) and end(normal)
+     *
+     * @param to_encode the vector of bytes to encode
+     * @return a vector of bytes encoded with COBS
+     */
+    std::vector<uint8_t> cobsEncoding(const std::vector<uint8_t>& to_encode)
+    {
+        auto encoded =
+            std::vector<uint8_t>(to_encode.size() + to_encode.size() / 254 + 3);
+        encoded.resize(cobsEncode(to_encode.data(), to_encode.size(), encoded.data()));
         return encoded;
     }
 
@@ -119,45 +157,74 @@ namespace
      * Uses a Delimiter byte at both the beginning and end instead of a single
      * delimiter byte at the end as in the wikipedia example.
      *
-     * @param to_decode the vector of bytes to decode
-     * @param decoded the vector that bytes are decoded to
+     * Decodes in place: the decoded bytes are written to the start of the given bytes,
+     * which is safe since every decoded byte is written before the byte it was read
+     * from. The end flag is never overwritten
+     *
+     * @param data the bytes to decode, which are overwritten with the decoded bytes
+     * @param length the number of bytes to decode
+     * @param decoded_length set to the number of decoded bytes
      * @return whether the decode was successful
      */
-    bool cobsDecoding(const std::vector<uint8_t>& to_decode,
-                      std::vector<uint8_t>& decoded)
+    bool cobsDecodeInPlace(uint8_t* data, size_t length, size_t& decoded_length)
     {
-        if (to_decode.front() != START_END_FLAG_BYTE ||
-            to_decode.back() != START_END_FLAG_BYTE)
+        if (length == 0 || data[0] != START_END_FLAG_BYTE ||
+            data[length - 1] != START_END_FLAG_BYTE)
         {
             return false;
         }
 
-        uint16_t i = 1;
-        while (i < to_decode.size())
+        size_t i             = 1;
+        size_t decoded_index = 0;
+        while (i < length)
         {
-            uint8_t overhead = to_decode[i++];
-            // Check that overhead does not point to past the end of the vector
-            if (overhead + i > to_decode.size())
+            uint8_t overhead = data[i++];
+            // Check that overhead does not point to past the end of the data
+            if (overhead + i > length)
             {
                 return false;
             }
             // Check that instances of the START_END_FLAG_BYTE are not in the middle of
-            // the vector
-            if (overhead == START_END_FLAG_BYTE && i != to_decode.size())
+            // the data
+            if (overhead == START_END_FLAG_BYTE && i != length)
             {
                 return false;
             }
-            for (uint16_t j = 1; i < to_decode.size() && j < overhead; j++)
+            for (uint16_t j = 1; i < length && j < overhead; j++)
             {
-                decoded.emplace_back(to_decode[i++]);
+                data[decoded_index++] = data[i++];
             }
-            if (overhead < 0xFF && i != to_decode.size() - 1 &&
-                overhead != START_END_FLAG_BYTE)
+            if (overhead < 0xFF && i != length - 1 && overhead != START_END_FLAG_BYTE)
             {
-                decoded.emplace_back(START_END_FLAG_BYTE);
+                data[decoded_index++] = START_END_FLAG_BYTE;
             }
         }
 
+        decoded_length = decoded_index;
+        return true;
+    }
+
+    /**
+     * Implementation of modified Consistent Overhead Byte Stuffing(COBS) decoding
+     * https://en.wikipedia.org/wiki/Consistent_Overhead_Byte_Stuffing
+     *
+     * Uses a Delimiter byte at both the beginning and end instead of a single
+     * delimiter byte at the end as in the wikipedia example.
+     *
+     * @param to_decode the vector of bytes to decode
+     * @param decoded the vector that bytes are decoded to
+     * @return whether the decode was successful
+     */
+    bool cobsDecoding(const std::vector<uint8_t>& to_decode,
+                      std::vector<uint8_t>& decoded)
+    {
+        std::vector<uint8_t> buffer = to_decode;
+        size_t decoded_length;
+        if (!cobsDecodeInPlace(buffer.data(), buffer.size(), decoded_length))
+        {
+            return false;
+        }
+        decoded.insert(decoded.end(), buffer.begin(), buffer.begin() + decoded_length);
         return true;
     }
 }  // anonymous namespace
@@ -174,13 +241,29 @@ template <typename T>
 TbotsProto_PowerFrame createUartFrame(const T& power_msg)
 {
     TbotsProto_PowerFrame frame = TbotsProto_PowerFrame_init_default;
-    auto buffer                 = serializeToVector(power_msg);
-    frame.length                = static_cast<uint32_t>(buffer.size());
-    frame.crc                   = crc16(buffer, static_cast<uint16_t>(frame.length));
+    uint8_t buffer[MAX_POWER_MSG_SIZE];
+    frame.length = static_cast<uint32_t>(serializeToBuffer(power_msg, buffer));
+    frame.crc    = crc16(buffer, static_cast<uint16_t>(frame.length));
     setPowerMsg(frame, power_msg);
     return frame;
 }
 
+/**
+ * Prepares a struct for being sent over uart, without allocating.
+ * Performs both the framing and encoding.
+ *
+ * @param frame frame being marshalled
+ * @param packet buffer of at least MAX_MARSHALLED_POWER_FRAME_SIZE bytes that the
+ * bytes to be sent over uart are written to
+ * @return the number of bytes to be sent over uart
+ */
+size_t inline marshallUartPacket(const TbotsProto_PowerFrame& frame, uint8_t* packet)
+{
+    uint8_t bytes[MAX_POWER_FRAME_SIZE];
+    size_t length = serializeToBuffer(frame, bytes);
+    return cobsEncode(bytes, length, packet);
+}
+
 /**
  * Prepares a struct for being sent over uart.
  * Performs both the framing and encoding.
@@ -194,6 +277,36 @@ std::vector<uint8_t> inline marshallUartPacket(const TbotsProto_PowerFrame& fram
     return cobsEncoding(bytes);
 }
 
+/**
+ * Converts bytes received over uart to their corresponding TbotsProto_PowerFrame,
+ * without allocating. The bytes are decoded in place, so they are overwritten.
+ *
+ * @param packet bytes to unmarshal, from the start flag to the end flag
+ * @param length the number of bytes to unmarshal
+ * @param frame frame to unmarshal to
+ * @return whether the unmarshal was successful
+ */
+bool inline unmarshalUartPacket(uint8_t* packet, size_t length,
+                                TbotsProto_PowerFrame& frame)
+{
+    size_t decoded_length;
+    if (!cobsDecodeInPlace(packet, length, decoded_length))
+    {
+        return false;
+    }
+    if (decoded_length != TbotsProto_PowerFrame_size)
+    {
+        return false;
+    }
+    frame               = TbotsProto_PowerFrame_init_default;
+    pb_istream_t stream = pb_istream_from_buffer(packet, decoded_length);
+    if (!pb_decode(&stream, TbotsProto_PowerFrame_fields, &frame))
+    {
+        return false;
+    }
+    return verifyLengthAndCrc(frame);
+}
+
 /**
  * Converts a vector of bytes to its corresponding TbotsProto_PowerFrame.
  *
@@ -223,6 +336,7 @@ bool inline unmarshalUartPacket(const std::vector<uint8_t>& data,
     }
     return verifyLengthAndCrc(frame);
 }
+
 /**
  * Finds the expected size of a TbotsProto_PowerStatus/TbotsProto_PowerControl msg once
  * its encoded with cobs
@@ -234,7 +348,6 @@ bool inline unmarshalUartPacket(const std::vector<uint8_t>& data,
 template <typename T>
 size_t getMarshalledSize(const T& power_msg)
 {
-    auto frame  = createUartFrame(power_msg);
-    auto buffer = serializeToVector(frame);
-    return cobsEncoding(buffer).size();
+    uint8_t packet[MAX_MARSHALLED_POWER_FRAME_SIZE];
+    return marshallUartPacket(createUartFrame(power_msg), packet);
 }
@@ -52,6 +52,22 @@ TEST_P(CobsEncodingTest, encode_decode_test)
     EXPECT_EQ(decoded, std::get<0>(GetParam()));
 }
 
+TEST_P(CobsEncodingTest, encode_decode_in_place_test)
+{
+    const std::vector<uint8_t>& to_encode = std::get<0>(GetParam());
+    std::vector<uint8_t> buffer(to_encode.size() + to_encode.size() / 254 + 3);
+
+    // Check that cobs encodes to the expected value in the buffer
+    size_t encoded_length = cobsEncode(to_encode.data(), to_encode.size(), buffer.data());
+    EXPECT_EQ(std::vector<uint8_t>(buffer.begin(), buffer.begin() + encoded_length),
+              std::get<1>(GetParam()));
+    // Check that cobs decodes to the expected value over the encoded bytes
+    size_t decoded_length;
+    EXPECT_TRUE(cobsDecodeInPlace(buffer.data(), encoded_length, decoded_length));
+    EXPECT_EQ(std::vector<uint8_t>(buffer.begin(), buffer.begin() + decoded_length),
+              to_encode);
+}
+
 INSTANTIATE_TEST_CASE_P(
     encode_decode_test, CobsEncodingTest,
     ::testing::Values(
@@ -79,6 +95,10 @@ TEST_P(CobsDecodingErrorTest, decode_error_tests)
 {
     auto decoded = std::vector<uint8_t>();
     EXPECT_FALSE(cobsDecoding(GetParam(), decoded));
+
+    std::vector<uint8_t> buffer = GetParam();
+    size_t decoded_length;
+    EXPECT_FALSE(cobsDecodeInPlace(buffer.data(), buffer.size(), decoded_length));
 }
 
 INSTANTIATE_TEST_CASE_P(
@@ -149,3 +169,23 @@ TEST_F(UartFramingTest, marshalling_test)
     EXPECT_EQ(test_frame_unmarshalled.power_msg.power_control, test_message);
     EXPECT_TRUE(verifyLengthAndCrc(test_frame_unmarshalled));
 }
+
+TEST_F(UartFramingTest, marshalling_into_buffer_test)
+{
+    auto test_frame = createUartFrame(test_message);
+    uint8_t packet[MAX_MARSHALLED_POWER_FRAME_SIZE];
+    size_t length = marshallUartPacket(test_frame, packet);
+    // Check that the bytes match the ones marshalled into a vector
+    EXPECT_EQ(std::vector<uint8_t>(packet, packet + length),
+              marshallUartPacket(test_frame));
+    EXPECT_EQ(length, getMarshalledSize(test_message));
+
+    TbotsProto_PowerFrame test_frame_unmarshalled = TbotsProto_PowerFrame_init_default;
+    EXPECT_TRUE(unmarshalUartPacket(packet, length, test_frame_unmarshalled));
+    EXPECT_EQ(test_frame_unmarshalled.length, TbotsProto_PowerPulseControl_size);
+    EXPECT_EQ(test_frame_unmarshalled.crc, TEST_MESSAGE_CRC);
+    EXPECT_EQ(test_frame_unmarshalled.power_msg.power_control, test_message);
+
+    // The packet was decoded in place, so it can't be unmarshalled again
+    EXPECT_FALSE(unmarshalUartPacket(packet, length, test_frame_unmarshalled));
+}
@@ -1,9 +1,12 @@
 #include "software/ai/ai.h"
 
 #include <Tracy.hpp>
+#include <chrono>
 
+#include "proto/message_translation/tbots_protobuf.h"
 #include "software/ai/hl/stp/play/halt_play.h"
 #include "software/ai/hl/stp/play/play_factory.h"
+#include "software/logger/logger.h"
 #include "software/tracy/tracy_constants.h"
 
 
@@ -11,7 +14,7 @@ Ai::Ai(const TbotsProto::AiConfig& ai_config)
     : ai_config_(ai_config),
       fsm(std::make_unique<FSM<PlaySelectionFSM>>(PlaySelectionFSM{ai_config})),
       override_play(nullptr),
-      current_play(std::make_unique<HaltPlay>(ai_config)),
+      current_play(std::make_shared<HaltPlay>(ai_config)),
       ai_config_changed(false)
 {
     auto current_override = ai_config_.ai_control_config().override_ai_play();
@@ -68,11 +71,16 @@ void Ai::checkAiConfig()
 std::unique_ptr<TbotsProto::PrimitiveSet> Ai::getPrimitives(const WorldPtr& world_ptr)
 {
     FrameMarkStart(TracyConstants::AI_FRAME_MARKER);
+    auto tick_start_time = std::chrono::steady_clock::now();
 
     checkAiConfig();
 
+    bool play_changed = false;
     fsm->process_event(PlaySelectionFSM::Update(
-        [this](std::unique_ptr<Play> play) { current_play = std::move(play); },
+        [this, &play_changed](std::shared_ptr<Play> play) {
+            current_play = std::move(play);
+            play_changed = true;
+        },
         world_ptr->gameState(), ai_config_));
 
     std::unique_ptr<TbotsProto::PrimitiveSet> primitive_set;
@@ -91,6 +99,18 @@ std::unique_ptr<TbotsProto::PrimitiveSet> Ai::getPrimitives(const WorldPtr& worl
                                           });
     }
 
+    if (play_changed)
+    {
+        // The tick that switches plays is the first one the robots react to the new
+        // game state in, so it should be no slower than any other tick
+        double tick_duration_ms = std::chrono::duration<double, std::milli>(
+                                      std::chrono::steady_clock::now() - tick_start_time)
+                                      .count();
+        LOG(PLOTJUGGLER) << *createPlotJugglerValue({
+            {"play_switch_tick_duration_ms", tick_duration_ms},
+        });
+    }
+
     FrameMarkEnd(TracyConstants::AI_FRAME_MARKER);
 
     return primitive_set;
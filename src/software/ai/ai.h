@@ -68,7 +68,7 @@ class Ai final
     TbotsProto::AiConfig ai_config_;
     std::unique_ptr<FSM<PlaySelectionFSM>> fsm;
     std::unique_ptr<Play> override_play;
-    std::unique_ptr<Play> current_play;
+    std::shared_ptr<Play> current_play;
     TbotsProto::Play current_override_play_proto;
     bool ai_config_changed;
 
@@ -1,72 +1,207 @@
 #include "software/ai/evaluation/calc_best_shot.h"
 
+#include <algorithm>
+#include <cmath>
+
+#include "software/geom/geom_constants.h"
+
 std::optional<Shot> calcBestShotOnGoal(const Segment &goal_post, const Point &shot_origin,
                                        const std::vector<Robot> &robot_obstacles,
                                        TeamType goal, double radius)
 {
-    size_t max_num_obstacles = robot_obstacles.size();
+    return BestShotCalculator(goal_post, robot_obstacles, goal, radius)
+        .calcBestShot(shot_origin);
+}
+
+std::vector<std::optional<Shot>> calcBestShotsOnGoal(
+    const Segment &goal_post, const std::vector<Point> &shot_origins,
+    const std::vector<Robot> &robot_obstacles, TeamType goal, double radius)
+{
+    std::vector<std::optional<Shot>> best_shots;
+    BestShotCalculator(goal_post, robot_obstacles, goal, radius)
+        .calcBestShots(shot_origins, best_shots);
+    return best_shots;
+}
+
+BestShotCalculator::BestShotCalculator(const Segment &goal_post,
+                                       const std::vector<Robot> &robot_obstacles,
+                                       TeamType goal, double radius)
+    : goal_post(goal_post), goal(goal), radius(radius)
+{
+    size_t num_obstacles = robot_obstacles.size();
+    obstacle_xs.reserve(num_obstacles);
+    obstacle_ys.reserve(num_obstacles);
+    for (const Robot &robot_obstacle : robot_obstacles)
+    {
+        obstacle_xs.emplace_back(robot_obstacle.position().x());
+        obstacle_ys.emplace_back(robot_obstacle.position().y());
+    }
 
+    top_vec_xs.resize(num_obstacles);
+    top_vec_ys.resize(num_obstacles);
+    bottom_vec_xs.resize(num_obstacles);
+    bottom_vec_ys.resize(num_obstacles);
+    blocked_intervals.reserve(num_obstacles);
+}
+
+void BestShotCalculator::calcBestShots(const std::vector<Point> &shot_origins,
+                                       std::vector<std::optional<Shot>> &best_shots)
+{
+    best_shots.clear();
+    best_shots.reserve(shot_origins.size());
+    for (const Point &shot_origin : shot_origins)
+    {
+        best_shots.emplace_back(calcBestShot(shot_origin));
+    }
+}
+
+std::optional<Shot> BestShotCalculator::calcBestShot(const Point &shot_origin)
+{
     Angle pos_post_angle = (goal_post.getStart() - shot_origin).orientation();
     Angle neg_post_angle = (goal_post.getEnd() - shot_origin).orientation();
 
-    std::vector<AngleSegment> obstacles;
-    obstacles.reserve(max_num_obstacles);
-
+    // Shots on the friendly goal are taken towards the negative x direction, where the
+    // angles wrap around. All the angles are rotated by half a turn so they are
+    // continuous around the goal
     if (goal == TeamType::FRIENDLY)
     {
         auto tmp       = pos_post_angle;
         pos_post_angle = (neg_post_angle + Angle::half()).clamp();
         neg_post_angle = (tmp + Angle::half()).clamp();
     }
-    AngleMap angle_map(pos_post_angle, neg_post_angle, max_num_obstacles);
+    const double goal_top    = pos_post_angle.toRadians();
+    const double goal_bottom = neg_post_angle.toRadians();
 
-    for (const Robot &robot_obstacle : robot_obstacles)
+    // Compute the vectors from the shot origin to the edges of every obstacle,
+    // perpendicular to the line from the shot origin to the obstacle. This loop only
+    // does arithmetic on the coordinate arrays, so the compiler can vectorize it
+    const double origin_x = shot_origin.x();
+    const double origin_y = shot_origin.y();
+    size_t num_obstacles  = obstacle_xs.size();
+    const double *xs      = obstacle_xs.data();
+    const double *ys      = obstacle_ys.data();
+    double *top_xs        = top_vec_xs.data();
+    double *top_ys        = top_vec_ys.data();
+    double *bottom_xs     = bottom_vec_xs.data();
+    double *bottom_ys     = bottom_vec_ys.data();
+    for (size_t i = 0; i < num_obstacles; i++)
     {
-        Point enemy_robot_pos    = robot_obstacle.position();
-        Vector perpendicular_vec = (enemy_robot_pos - shot_origin).perpendicular();
+        double dx       = xs[i] - origin_x;
+        double dy       = ys[i] - origin_y;
+        double length   = std::sqrt(dx * dx + dy * dy);
+        double scale    = length < 2 * FIXED_EPSILON ? 0.0 : radius / length;
+        double offset_x = -dy * scale;
+        double offset_y = dx * scale;
 
-        Vector one_end_vec = perpendicular_vec.normalize(radius);
+        top_xs[i]    = (xs[i] + offset_x) - origin_x;
+        top_ys[i]    = (ys[i] + offset_y) - origin_y;
+        bottom_xs[i] = (xs[i] - offset_x) - origin_x;
+        bottom_ys[i] = (ys[i] - offset_y) - origin_y;
+    }
 
-        Point one_end   = enemy_robot_pos + one_end_vec;
-        Point other_end = enemy_robot_pos - one_end_vec;
+    // When the shot origin is in front of the goal, every angle between the goal posts
+    // is within a quarter turn of the direction of the goal, so obstacles entirely
+    // behind the shot origin can't block the shot and their angles aren't needed
+    const double forward = goal == TeamType::ENEMY ? 1.0 : -1.0;
+    const bool origin_in_front_of_goal =
+        forward * (goal_post.getStart().x() - origin_x) > 0 &&
+        forward * (goal_post.getEnd().x() - origin_x) > 0;
 
-        Vector top_vec    = one_end - shot_origin;
-        Vector bottom_vec = other_end - shot_origin;
+    blocked_intervals.clear();
+    for (size_t i = 0; i < num_obstacles; i++)
+    {
+        if (origin_in_front_of_goal && forward * (xs[i] - origin_x) < -radius)
+        {
+            continue;
+        }
 
-        Angle top_angle    = top_vec.orientation();
-        Angle bottom_angle = bottom_vec.orientation();
+        double top    = std::atan2(top_ys[i], top_xs[i]);
+        double bottom = std::atan2(bottom_ys[i], bottom_xs[i]);
         if (goal == TeamType::FRIENDLY)
         {
-            top_angle    = (top_vec.orientation() + Angle::half()).clamp();
-            bottom_angle = (bottom_vec.orientation() + Angle::half()).clamp();
+            top    = (Angle::fromRadians(top) + Angle::half()).clamp().toRadians();
+            bottom = (Angle::fromRadians(bottom) + Angle::half()).clamp().toRadians();
         }
 
-        if (bottom_angle > angle_map.getAngleSegment().getAngleTop() ||
-            top_angle < angle_map.getAngleSegment().getAngleBottom())
+        if (bottom > goal_top || top < goal_bottom)
         {
             continue;
         }
-
-        AngleSegment non_viable_angle_seg = AngleSegment(top_angle, bottom_angle);
-        obstacles.emplace_back(non_viable_angle_seg);
+        blocked_intervals.emplace_back(BlockedInterval{.top = top, .bottom = bottom});
     }
 
-    std::sort(obstacles.begin(), obstacles.end(),
-              [](AngleSegment &a, AngleSegment &b) -> bool { return a > b; });
+    std::sort(blocked_intervals.begin(), blocked_intervals.end(),
+              [](const BlockedInterval &a, const BlockedInterval &b) -> bool {
+                  return a.top > b.top;
+              });
 
-    for (AngleSegment &obstacle_angle_seg : obstacles)
+    // Merge overlapping intervals in place. The merged intervals are stored at the
+    // front of blocked_intervals, which is never ahead of the interval being merged
+    size_t num_merged = 0;
+    for (size_t i = 0; i < blocked_intervals.size(); i++)
     {
-        angle_map.addNonViableAngleSegment(obstacle_angle_seg);
+        const BlockedInterval interval = blocked_intervals[i];
+        bool overlaps_merged_interval  = false;
+        for (size_t j = 0; j < num_merged; j++)
+        {
+            BlockedInterval &merged_interval = blocked_intervals[j];
+            if (!(interval.bottom > merged_interval.top ||
+                  interval.top < merged_interval.bottom))
+            {
+                merged_interval.top = std::max(merged_interval.top, interval.top);
+                merged_interval.bottom =
+                    std::min(merged_interval.bottom, interval.bottom);
+                overlaps_merged_interval = true;
+                break;
+            }
+        }
+
+        if (!overlaps_merged_interval)
+        {
+            blocked_intervals[num_merged++] = interval;
+        }
+    }
+
+    // Find the biggest open interval between the goal posts and the blocked intervals
+    double best_top             = 0;
+    double best_bottom          = 0;
+    auto consider_open_interval = [&best_top, &best_bottom](double top, double bottom) {
+        if (std::abs(bottom - top) > std::abs(best_bottom - best_top))
+        {
+            best_top    = top;
+            best_bottom = bottom;
+        }
+    };
+    if (num_merged == 0)
+    {
+        consider_open_interval(goal_top, goal_bottom);
+    }
+    else
+    {
+        if (blocked_intervals.front().top < goal_top)
+        {
+            consider_open_interval(goal_top, blocked_intervals.front().top);
+        }
+        if (blocked_intervals[num_merged - 1].bottom > goal_bottom)
+        {
+            consider_open_interval(blocked_intervals[num_merged - 1].bottom,
+                                   goal_bottom);
+        }
+        for (size_t i = 0; i + 1 < num_merged; i++)
+        {
+            consider_open_interval(blocked_intervals[i].bottom,
+                                   blocked_intervals[i + 1].top);
+        }
     }
 
-    AngleSegment biggest_angle_seg = angle_map.getBiggestViableAngleSegment();
-    if (biggest_angle_seg.getDeltaInDegrees() == 0)
+    double open_angle_radians = std::abs(best_bottom - best_top);
+    if (open_angle_radians == 0)
     {
         return std::nullopt;
     }
 
-    Angle top_angle    = biggest_angle_seg.getAngleTop();
-    Angle bottom_angle = biggest_angle_seg.getAngleBottom();
+    Angle top_angle    = Angle::fromRadians(best_top);
+    Angle bottom_angle = Angle::fromRadians(best_bottom);
 
     if (goal == TeamType::FRIENDLY)
     {
@@ -85,8 +220,7 @@ std::optional<Shot> calcBestShotOnGoal(const Segment &goal_post, const Point &sh
 
     Point shot_point = (top_point - bottom_point) / 2 + bottom_point;
 
-    return std::make_optional(
-        Shot(shot_point, Angle::fromDegrees(biggest_angle_seg.getDeltaInDegrees())));
+    return std::make_optional(Shot(shot_point, Angle::fromRadians(open_angle_radians)));
 }
 
 std::optional<Shot> calcBestShotOnGoal(const Field &field, const Team &friendly_team,
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "shared/constants.h"
 #include "software/ai/evaluation/shot.h"
 #include "software/geom/angle_map.h"
@@ -33,6 +35,101 @@ std::optional<Shot> calcBestShotOnGoal(const Segment &goal_post, const Point &sh
                                        const std::vector<Robot> &robot_obstacles,
                                        TeamType goal,
                                        double radius = ROBOT_MAX_RADIUS_METERS);
+
+/**
+ * Finds the best shot on the given goal from each of the given shot origins. This is
+ * equivalent to calling calcBestShotOnGoal for each shot origin, but reuses the same
+ * obstacles and scratch buffers for every origin, so it is much cheaper when rating
+ * many shot origins against the same robots.
+ *
+ * @param goal_post The goal post of the net by the y-coordinate
+ * @param shot_origins The points that the shots will be taken from
+ * @param robot_obstacles The locations of any robots on the field that may obstruct
+ * the shots. These are treated as circular obstacles
+ * @param goal The goal to shoot at
+ * @param radius The radius for the robot obstacles
+ *
+ * @return the best shot from each shot origin, in the same order as the shot origins.
+ * The best shot is `std::nullopt` for shot origins with no possible shot
+ */
+std::vector<std::optional<Shot>> calcBestShotsOnGoal(
+    const Segment &goal_post, const std::vector<Point> &shot_origins,
+    const std::vector<Robot> &robot_obstacles, TeamType goal,
+    double radius = ROBOT_MAX_RADIUS_METERS);
+
+/**
+ * Finds the best shots on a goal from many shot origins against one set of robot
+ * obstacles.
+ *
+ * The obstacle positions are stored as separate arrays of coordinates, and the edges
+ * of each obstacle are computed in a tight loop over these arrays that the compiler can
+ * vectorize. Angles are only computed for obstacles that aren't behind the shot origin.
+ * All the buffers are kept between shot origins and between calls, so once they have
+ * grown to the number of obstacles no memory is allocated.
+ */
+class BestShotCalculator
+{
+   public:
+    /**
+     * Creates a new BestShotCalculator
+     *
+     * @param goal_post The goal post of the net by the y-coordinate
+     * @param robot_obstacles The locations of any robots on the field that may
+     * obstruct the shots. These are treated as circular obstacles
+     * @param goal The goal to shoot at
+     * @param radius The radius for the robot obstacles
+     */
+    explicit BestShotCalculator(const Segment &goal_post,
+                                const std::vector<Robot> &robot_obstacles,
+                                TeamType goal, double radius = ROBOT_MAX_RADIUS_METERS);
+
+    /**
+     * Finds the best shot on the goal from the given shot origin
+     *
+     * @param shot_origin The point that the shot will be taken from
+     *
+     * @return the best target to shoot at and the largest open angle interval for the
+     * shot. If no shot is possible, returns `std::nullopt`
+     */
+    std::optional<Shot> calcBestShot(const Point &shot_origin);
+
+    /**
+     * Finds the best shot on the goal from each of the given shot origins
+     *
+     * @param shot_origins The points that the shots will be taken from
+     * @param best_shots The vector to store the best shot from each shot origin in, in
+     * the same order as the shot origins. Any existing contents are replaced
+     */
+    void calcBestShots(const std::vector<Point> &shot_origins,
+                       std::vector<std::optional<Shot>> &best_shots);
+
+   private:
+    // An interval of angles blocked by an obstacle, in radians
+    struct BlockedInterval
+    {
+        double top;
+        double bottom;
+    };
+
+    Segment goal_post;
+    TeamType goal;
+    double radius;
+
+    // The coordinates of the robot obstacles
+    std::vector<double> obstacle_xs;
+    std::vector<double> obstacle_ys;
+
+    // Scratch buffers for the vectors from the current shot origin to the edges of
+    // each obstacle
+    std::vector<double> top_vec_xs;
+    std::vector<double> top_vec_ys;
+    std::vector<double> bottom_vec_xs;
+    std::vector<double> bottom_vec_ys;
+    // Scratch buffer for the angles blocked by the obstacles from the current shot
+    // origin
+    std::vector<BlockedInterval> blocked_intervals;
+};
+
 /**
  * Finds the best shot on the specified goal, and returns the best target to shoot at
  * and the largest open angle interval for the shot (this is the total angle between
@@ -2,6 +2,8 @@
 
 #include <gtest/gtest.h>
 
+#include <random>
+
 #include "shared/constants.h"
 #include "software/test_util/test_util.h"
 
@@ -571,3 +573,122 @@ TEST(CalcBestShotTest, calc_best_shot_out_of_field_bounds)
     // We should not be able to find a shot
     ASSERT_FALSE(result);
 }
+
+TEST(CalcBestShotTest, calc_best_shots_matches_calc_best_shot_from_each_origin)
+{
+    std::shared_ptr<World> world = ::TestUtil::createBlankTestingWorld();
+    const Field &field           = world->field();
+    std::vector<Robot> robot_obstacles;
+    for (const Point &position : {Point(1, 0), Point(2, 0.3), Point(3.5, -0.4),
+                                  Point(-1, 0.2), Point(-3.8, 0), Point(0, 0.1)})
+    {
+        robot_obstacles.emplace_back(robot_obstacles.size(), position, Vector(0, 0),
+                                     Angle::zero(), AngularVelocity::zero(),
+                                     Timestamp::fromSeconds(0));
+    }
+
+    std::vector<Point> shot_origins;
+    for (double x = -4; x <= 4; x += 0.5)
+    {
+        for (double y = -2.5; y <= 2.5; y += 0.5)
+        {
+            shot_origins.emplace_back(Point(x, y));
+        }
+    }
+
+    for (TeamType goal : {TeamType::ENEMY, TeamType::FRIENDLY})
+    {
+        Segment goal_post =
+            goal == TeamType::ENEMY
+                ? Segment(field.enemyGoalpostPos(), field.enemyGoalpostNeg())
+                : Segment(field.friendlyGoalpostPos(), field.friendlyGoalpostNeg());
+
+        std::vector<std::optional<Shot>> best_shots =
+            calcBestShotsOnGoal(goal_post, shot_origins, robot_obstacles, goal);
+
+        ASSERT_EQ(shot_origins.size(), best_shots.size());
+        for (size_t i = 0; i < shot_origins.size(); i++)
+        {
+            auto expected_shot =
+                calcBestShotOnGoal(goal_post, shot_origins[i], robot_obstacles, goal);
+            ASSERT_EQ(expected_shot.has_value(), best_shots[i].has_value());
+            if (expected_shot)
+            {
+                EXPECT_EQ(expected_shot->getPointToShootAt(),
+                          best_shots[i]->getPointToShootAt());
+                EXPECT_EQ(expected_shot->getOpenAngle(), best_shots[i]->getOpenAngle());
+            }
+        }
+    }
+}
+
+TEST(CalcBestShotTest, best_shot_calculator_reuse_with_fewer_shot_origins)
+{
+    std::shared_ptr<World> world = ::TestUtil::createBlankTestingWorld();
+    Segment goal_post(world->field().enemyGoalpostPos(),
+                      world->field().enemyGoalpostNeg());
+    BestShotCalculator calculator(goal_post, {}, TeamType::ENEMY);
+
+    std::vector<std::optional<Shot>> best_shots;
+    calculator.calcBestShots({Point(0, 0), Point(1, 1), Point(2, -1)}, best_shots);
+    EXPECT_EQ(3, best_shots.size());
+
+    calculator.calcBestShots({Point(0, 0)}, best_shots);
+    ASSERT_EQ(1, best_shots.size());
+    ASSERT_TRUE(best_shots[0]);
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(
+        best_shots[0]->getPointToShootAt(), world->field().enemyGoalCenter(), 0.05));
+}
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST(CalcBestShotTest, DISABLED_calc_best_shots_speed_test)
+{
+    // This test does not assert anything. Rather, it can be used to gauge how fast the
+    // best shots from many shot origins are found
+
+    const int num_shot_origins = 500;
+
+    std::shared_ptr<World> world = ::TestUtil::createBlankTestingWorld();
+    std::uniform_real_distribution x_distribution(-world->field().xLength() / 2,
+                                                  world->field().xLength() / 2);
+    std::uniform_real_distribution y_distribution(-world->field().yLength() / 2,
+                                                  world->field().yLength() / 2);
+    std::mt19937 random_num_gen;
+
+    std::vector<Robot> robot_obstacles;
+    for (unsigned int id = 0; id < 11; id++)
+    {
+        robot_obstacles.emplace_back(
+            id, Point(x_distribution(random_num_gen), y_distribution(random_num_gen)),
+            Vector(0, 0), Angle::zero(), AngularVelocity::zero(),
+            Timestamp::fromSeconds(0));
+    }
+
+    std::vector<Point> shot_origins;
+    for (int i = 0; i < num_shot_origins; i++)
+    {
+        shot_origins.emplace_back(
+            Point(x_distribution(random_num_gen), y_distribution(random_num_gen)));
+    }
+
+    Segment goal_post(world->field().enemyGoalpostPos(),
+                      world->field().enemyGoalpostNeg());
+    BestShotCalculator calculator(goal_post, robot_obstacles, TeamType::ENEMY);
+    std::vector<std::optional<Shot>> best_shots;
+
+    auto start_time = std::chrono::system_clock::now();
+    calculator.calcBestShots(shot_origins, best_shots);
+    double batch_duration_ms = ::TestUtil::millisecondsSince(start_time);
+
+    start_time = std::chrono::system_clock::now();
+    for (const Point &shot_origin : shot_origins)
+    {
+        calcBestShotOnGoal(goal_post, shot_origin, robot_obstacles, TeamType::ENEMY);
+    }
+    double single_duration_ms = ::TestUtil::millisecondsSince(start_time);
+
+    std::cout << "Took " << batch_duration_ms << "ms to find the best shots from "
+              << num_shot_origins << " shot origins in a batch, and "
+              << single_duration_ms << "ms one at a time" << std::endl;
+}
@@ -1,17 +1,25 @@
 #include "software/ai/evaluation/find_open_areas.h"
 
 #include "proto/parameters.pb.h"
-#include "software/geom/algorithms/find_open_circles.h"
 
 std::vector<Circle> findGoodChipTargets(const World& world, const Rectangle& target_area)
 {
+    // The open circles around the enemy robots are shared by everything looking for
+    // chip targets (ex. the goalie and ShootOrChipPlay) through the World, which gets
+    // a finder that keeps its triangulation between frames from SensorFusion
+    if (world.enemyOpenCircleFinder())
+    {
+        return world.enemyOpenCircleFinder()->findOpenCircles(target_area);
+    }
+
     std::vector<Point> enemy_locations;
-    for (Robot robot : world.enemyTeam().getAllRobots())
+    for (const Robot& robot : world.enemyTeam().getAllRobots())
     {
         enemy_locations.emplace_back(robot.position());
     }
-
-    return findOpenCircles(target_area, enemy_locations);
+    OpenCircleFinder open_circle_finder;
+    open_circle_finder.update(enemy_locations);
+    return open_circle_finder.findOpenCircles(target_area);
 }
 
 std::vector<Circle> findGoodChipTargets(const World& world)
@@ -1,88 +1,453 @@
 #include "software/ai/evaluation/intercept.h"
 
-#include "shared/constants.h"
-#include "software/ai/evaluation/time_to_travel.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 #include "software/geom/algorithms/contains.h"
-#include "software/optimization/gradient_descent_optimizer.hpp"
 
-std::optional<std::pair<Point, Duration>> findBestInterceptForBall(const Ball &ball,
-                                                                   const Field &field,
-                                                                   const Robot &robot)
+namespace
+{
+// The time between the samples of the ball path that are checked for an intercept, in
+// seconds. An intercept that is only possible for less time than this can fall between
+// two samples, so the samples around the ones where the robot only just misses the
+// ball are searched more finely (see NEAR_MISS_TIME_AFTER_BALL)
+constexpr double INTERCEPT_SAMPLE_PERIOD = 0.02;
+
+// How late the robot can reach the ball at a sample, in seconds, for the time around
+// that sample to be searched for a short intercept. This is more than the time after
+// the ball can change by over a sample period for any ball and robot speed we see in
+// practice, so short intercepts are only missed if they are shorter than
+// INTERCEPT_TIME_TOLERANCE
+constexpr double NEAR_MISS_TIME_AFTER_BALL = 0.1;
+
+// How far into the future to look for an intercept, in seconds, for balls that neither
+// stop nor leave the field before then
+constexpr double MAX_INTERCEPT_SEARCH_TIME = 10.0;
+
+// How close the earliest intercept time is found once it has been bracketed, in
+// seconds
+constexpr double INTERCEPT_TIME_TOLERANCE = 1e-4;
+constexpr unsigned int MAX_ROOT_SEARCH_ITERATIONS = 50;
+
+/**
+ * The path of a ball rolling under its current acceleration, which is sampled lazily
+ * and can be shared between all the robots trying to intercept the ball.
+ *
+ * If the acceleration opposes the velocity of the ball (ie. it is rolling friction),
+ * the ball stops once it has slowed down to rest instead of rolling backwards
+ */
+class BallPath
 {
-    static const double gradient_approx_step_size = 0.000001;
-
-    // We use this to take a smooth absolute value in our objective function
-    static const double smooth_abs_eps = 1000 * gradient_approx_step_size;
-
-    // This is the objective function that we want to minimize, finding the
-    // shortest duration in the future at which we can feasibly intercept the
-    // ball
-    auto objective_function = [&](std::array<double, 1> x) {
-        // We take the absolute value here because a negative time makes no sense
-        double duration = std::abs(x.at(0));
-
-        // If the ball timestamp is less then the robot timestamp, add the difference
-        // here so that we're optimizing to a duration that is after the robot
-        // timestamp
-        if (ball.timestamp() < robot.timestamp())
+   public:
+    /**
+     * Creates a new BallPath
+     *
+     * @param ball The ball to follow
+     * @param field The field the ball is on
+     */
+    explicit BallPath(const Ball &ball, const Field &field)
+        : field_lines(field.fieldLines()),
+          timestamp(ball.timestamp()),
+          position(ball.position()),
+          velocity(ball.velocity()),
+          acceleration(ball.acceleration()),
+          stop_time(std::numeric_limits<double>::infinity()),
+          first_sample_on_field(std::numeric_limits<std::size_t>::max()),
+          left_field(false),
+          ended(false)
+    {
+        double velocity_dot_acceleration = velocity.dot(acceleration);
+        if (velocity.length() == 0)
+        {
+            stop_time = 0;
+        }
+        else if (velocity_dot_acceleration < 0)
+        {
+            // The time at which the velocity of the ball no longer points along its
+            // initial velocity
+            stop_time = -velocity.lengthSquared() / velocity_dot_acceleration;
+        }
+    }
+
+    /**
+     * Gets the position of the ball at the given time
+     *
+     * @param time The time since the timestamp of the ball, in seconds
+     *
+     * @return the position of the ball at the given time
+     */
+    Point getPosition(double time) const
+    {
+        time = std::min(time, stop_time);
+        return position + velocity * time + acceleration * (0.5 * time * time);
+    }
+
+    /**
+     * Samples the path up to the given sample, if the ball is still rolling and has
+     * not left the field by that sample. The ball may not be on the field yet
+     *
+     * @param index The index of the sample, taken at index * INTERCEPT_SAMPLE_PERIOD
+     * seconds after the timestamp of the ball
+     *
+     * @return the position of the ball at the sample, or std::nullopt if the ball
+     * has stopped or left the field by then
+     */
+    std::optional<Point> getSample(std::size_t index)
+    {
+        while (samples.size() <= index && !ended)
+        {
+            double time = static_cast<double>(samples.size()) * INTERCEPT_SAMPLE_PERIOD;
+            if (time >= stop_time || time > MAX_INTERCEPT_SEARCH_TIME)
+            {
+                ended = true;
+                break;
+            }
+
+            Point sample = getPosition(time);
+            if (contains(field_lines, sample))
+            {
+                first_sample_on_field = std::min(first_sample_on_field, samples.size());
+            }
+            else if (samples.size() > first_sample_on_field)
+            {
+                left_field = ended = true;
+                break;
+            }
+            samples.emplace_back(sample);
+        }
+
+        if (index < samples.size())
         {
-            duration += (robot.timestamp() - ball.timestamp()).toSeconds();
+            return samples[index];
         }
+        return std::nullopt;
+    }
+
+    /**
+     * Checks if the ball is on the field at the given sample, which must have been
+     * taken already
+     *
+     * @param index The index of the sample
+     *
+     * @return whether the ball is on the field at the sample
+     */
+    bool isSampleOnField(std::size_t index) const
+    {
+        return index >= first_sample_on_field;
+    }
+
+    /**
+     * Checks if the ball comes to a stop on the field within the search time. This is
+     * only known once every sample has been taken
+     *
+     * @return whether the ball comes to a stop on the field
+     */
+    bool stopsOnField() const
+    {
+        return ended && !left_field && stop_time <= MAX_INTERCEPT_SEARCH_TIME &&
+               contains(field_lines, getPosition(stop_time));
+    }
+
+    /**
+     * Gets the time at which the ball stops
+     *
+     * @return the time at which the ball stops, in seconds since the timestamp of the
+     * ball, or infinity if the ball never stops
+     */
+    double getStopTime() const
+    {
+        return stop_time;
+    }
+
+    /**
+     * Gets the timestamp the path starts at
+     *
+     * @return the timestamp of the ball
+     */
+    const Timestamp &getTimestamp() const
+    {
+        return timestamp;
+    }
 
-        // Estimate the ball position
-        Point new_ball_pos =
-            ball.estimateFutureState(Duration::fromSeconds(duration)).position();
+   private:
+    Rectangle field_lines;
+    Timestamp timestamp;
+    Point position;
+    Vector velocity;
+    Vector acceleration;
+    double stop_time;
 
-        // Figure out how long it will take the robot to get to the new ball position
-        Duration time_to_ball_pos = robot.getTimeToPosition(new_ball_pos);
+    // The positions of the ball at every sample taken so far
+    std::vector<Point> samples;
+    // The first sample at which the ball is on the field, since it may start off the
+    // field and roll onto it
+    std::size_t first_sample_on_field;
+    // Whether the ball left the field after the last sample
+    bool left_field;
+    // Whether there are no more samples to take
+    bool ended;
+};
 
-        // Figure out when the robot will reach the new ball position relative to the
-        // time that the ball will get there (ie. will we get there in time?)
-        double ball_robot_time_diff = duration - time_to_ball_pos.toSeconds();
+/**
+ * Finds the earliest time in the given bracket at which the robot can reach the ball,
+ * using false position with the Illinois modification, which falls back to halving
+ * the bracket whenever one end of it stops moving
+ *
+ * @param time_after_ball The time the robot reaches the ball after the ball gets to
+ * the same point, as a function of the time since the timestamp of the ball
+ * @param early_time A time at which the robot reaches the ball after it
+ * @param early_time_after_ball The value of time_after_ball at early_time, which must
+ * be positive
+ * @param late_time A time at which the robot reaches the ball before it
+ * @param late_time_after_ball The value of time_after_ball at late_time, which must
+ * not be positive
+ *
+ * @return a time at which the robot reaches the ball no later than the ball, within
+ * INTERCEPT_TIME_TOLERANCE after the earliest such time in the bracket
+ */
+template <typename TimeAfterBallFunction>
+double findEarliestInterceptTime(const TimeAfterBallFunction &time_after_ball,
+                                 double early_time, double early_time_after_ball,
+                                 double late_time, double late_time_after_ball)
+{
+    // Which end of the bracket moved last: -1 for the early end and 1 for the late end
+    int last_moved_end = 0;
+    for (unsigned int i = 0; i < MAX_ROOT_SEARCH_ITERATIONS &&
+                             late_time - early_time > INTERCEPT_TIME_TOLERANCE;
+         i++)
+    {
+        double time = late_time - late_time_after_ball * (late_time - early_time) /
+                                      (late_time_after_ball - early_time_after_ball);
+        if (!(time > early_time && time < late_time))
+        {
+            time = (early_time + late_time) / 2;
+        }
 
-        // We want to get to the ball at the earliest opportunity possible, so
-        // aim for a time diff of zero. We use a smooth approximation of
-        // the maximum here
-        return std::sqrt(std::pow(ball_robot_time_diff, 2) + smooth_abs_eps);
+        double time_after_ball_at_time = time_after_ball(time);
+        if (time_after_ball_at_time <= 0)
+        {
+            late_time            = time;
+            late_time_after_ball = time_after_ball_at_time;
+            if (last_moved_end == 1)
+            {
+                early_time_after_ball /= 2;
+            }
+            last_moved_end = 1;
+        }
+        else
+        {
+            early_time            = time;
+            early_time_after_ball = time_after_ball_at_time;
+            if (last_moved_end == -1)
+            {
+                late_time_after_ball /= 2;
+            }
+            last_moved_end = -1;
+        }
+    }
+    return late_time;
+}
+
+/**
+ * Finds the time in the given interval at which the robot reaches the ball the
+ * earliest relative to the ball, using a golden section search. This assumes there is
+ * a single such time in the interval, which holds when the interval is short
+ *
+ * @param time_after_ball The time the robot reaches the ball after the ball gets to
+ * the same point, as a function of the time since the timestamp of the ball
+ * @param start_time The start of the interval
+ * @param end_time The end of the interval
+ *
+ * @return the time within INTERCEPT_TIME_TOLERANCE of the one where time_after_ball is
+ * the smallest, and the value of time_after_ball at that time
+ */
+template <typename TimeAfterBallFunction>
+std::pair<double, double> findClosestApproach(
+    const TimeAfterBallFunction &time_after_ball, double start_time, double end_time)
+{
+    const double inverse_golden_ratio = (std::sqrt(5.0) - 1) / 2;
+
+    double step                 = inverse_golden_ratio * (end_time - start_time);
+    double low_time             = end_time - step;
+    double high_time            = start_time + step;
+    double low_time_after_ball  = time_after_ball(low_time);
+    double high_time_after_ball = time_after_ball(high_time);
+    for (unsigned int i = 0; i < MAX_ROOT_SEARCH_ITERATIONS &&
+                             end_time - start_time > INTERCEPT_TIME_TOLERANCE;
+         i++)
+    {
+        // Keep the part of the interval around the smaller of the two inner times. The
+        // interval shrinks by the golden ratio, so the other inner time can be reused
+        step *= inverse_golden_ratio;
+        if (low_time_after_ball <= high_time_after_ball)
+        {
+            end_time             = high_time;
+            high_time            = low_time;
+            high_time_after_ball = low_time_after_ball;
+            low_time             = end_time - step;
+            low_time_after_ball  = time_after_ball(low_time);
+        }
+        else
+        {
+            start_time           = low_time;
+            low_time             = high_time;
+            low_time_after_ball  = high_time_after_ball;
+            high_time            = start_time + step;
+            high_time_after_ball = time_after_ball(high_time);
+        }
+    }
+
+    if (low_time_after_ball <= high_time_after_ball)
+    {
+        return std::make_pair(low_time, low_time_after_ball);
+    }
+    return std::make_pair(high_time, high_time_after_ball);
+}
+
+/**
+ * Finds the best place for the given robot to intercept the ball following the given
+ * path
+ *
+ * @param ball_path The path of the ball to intercept
+ * @param field The field on which we want the intercept to occur
+ * @param robot The robot that will hopefully intercept the ball
+ *
+ * @return the best intercept, as returned by findBestInterceptForBall
+ */
+std::optional<std::pair<Point, Duration>> findBestInterceptForBallPath(
+    BallPath &ball_path, const Field &field, const Robot &robot)
+{
+    // Intercepts can only happen after the timestamp of the robot
+    double start_time =
+        std::max(0.0, (robot.timestamp() - ball_path.getTimestamp()).toSeconds());
+
+    auto time_after_ball_at_position = [&](double time, const Point &ball_position) {
+        return robot.getTimeToPosition(ball_position).toSeconds() - (time - start_time);
+    };
+    auto time_after_ball = [&](double time) {
+        return time_after_ball_at_position(time, ball_path.getPosition(time));
+    };
+    auto make_intercept =
+        [&](double time) -> std::optional<std::pair<Point, Duration>> {
+        Point intercept_position = ball_path.getPosition(time);
+        if (!contains(field.fieldLines(), intercept_position))
+        {
+            return std::nullopt;
+        }
+        return std::make_pair(intercept_position,
+                              robot.getTimeToPosition(intercept_position));
     };
 
-    // Figure out when/where to intercept the ball. We do this by optimizing over
-    // the ball position as a function of it's travel time
-    // We make the weight here an inverse of the ball speed, so that the gradient
-    // descent takes smaller steps when the ball is moving faster
-    double descent_weight = 1 / (std::exp(ball.currentState().velocity().length() * 0.5));
-    GradientDescentOptimizer<1> optimizer({descent_weight}, gradient_approx_step_size);
-    Duration best_ball_travel_duration = Duration::fromSeconds(
-        std::abs(optimizer.minimize(objective_function, {0}, 50).at(0)));
-
-    // In the objective function above, if the robot timestamp > ball timestamp, we
-    // add on the difference so we get a intercept time after the robot timestamp, so
-    // we need to do the same here to get the duration we actually optimized on
-    if (robot.timestamp() > ball.timestamp())
+    double early_time            = start_time;
+    double early_time_after_ball = time_after_ball(start_time);
+    if (early_time_after_ball <= 0)
     {
-        best_ball_travel_duration =
-            best_ball_travel_duration + (robot.timestamp() - ball.timestamp());
+        return make_intercept(start_time);
     }
 
-    Point best_ball_intercept_pos =
-        ball.estimateFutureState(best_ball_travel_duration).position();
+    // The sample before early_time, to search around early_time if the robot only
+    // just misses the ball there
+    double before_early_time            = early_time;
+    double before_early_time_after_ball = early_time_after_ball;
 
-    // Check that we can get to the best position in time
-    Duration time_to_ball_pos     = robot.getTimeToPosition(best_ball_intercept_pos);
-    Duration ball_robot_time_diff = time_to_ball_pos - best_ball_travel_duration;
-    // NOTE: if ball velocity is 0 then ball travel duration is infinite, so this
-    // check isn't relevant in that case
-    if (ball.currentState().velocity().length() != 0 &&
-        std::abs(ball_robot_time_diff.toSeconds()) > descent_weight)
+    // Step along the samples of the path until the robot can reach the ball in time,
+    // then search between the last two samples for the earliest time it can
+    auto first_sample =
+        static_cast<std::size_t>(std::floor(start_time / INTERCEPT_SAMPLE_PERIOD)) + 1;
+    for (std::size_t i = first_sample;; i++)
     {
-        return std::nullopt;
+        std::optional<Point> sample = ball_path.getSample(i);
+        if (!sample)
+        {
+            break;
+        }
+
+        double time                   = static_cast<double>(i) * INTERCEPT_SAMPLE_PERIOD;
+        double time_after_ball_sample = time_after_ball_at_position(time, *sample);
+        if (time_after_ball_sample <= 0 && ball_path.isSampleOnField(i))
+        {
+            double intercept_time = findEarliestInterceptTime(
+                time_after_ball, early_time, early_time_after_ball, time,
+                time_after_ball_sample);
+
+            // If the ball has just rolled onto the field, the earliest time may be
+            // before it did
+            if (!contains(field.fieldLines(), ball_path.getPosition(intercept_time)))
+            {
+                intercept_time = time;
+            }
+            return make_intercept(intercept_time);
+        }
+
+        // The robot may be able to reach the ball between the samples around the
+        // sample where it came closest to reaching it
+        if (early_time_after_ball < before_early_time_after_ball &&
+            early_time_after_ball < time_after_ball_sample &&
+            early_time_after_ball < NEAR_MISS_TIME_AFTER_BALL)
+        {
+            auto [closest_time, closest_time_after_ball] =
+                findClosestApproach(time_after_ball, before_early_time, time);
+            if (closest_time_after_ball <= 0 &&
+                contains(field.fieldLines(), ball_path.getPosition(closest_time)))
+            {
+                double intercept_time = findEarliestInterceptTime(
+                    time_after_ball, before_early_time, before_early_time_after_ball,
+                    closest_time, closest_time_after_ball);
+                if (!contains(field.fieldLines(), ball_path.getPosition(intercept_time)))
+                {
+                    intercept_time = closest_time;
+                }
+                return make_intercept(intercept_time);
+            }
+        }
+
+        before_early_time            = early_time;
+        before_early_time_after_ball = early_time_after_ball;
+        early_time                   = time;
+        early_time_after_ball        = time_after_ball_sample;
     }
 
-    // Check that the best intercept position is actually on the field
-    if (!contains(field.fieldLines(), best_ball_intercept_pos))
+    if (!ball_path.stopsOnField())
     {
         return std::nullopt;
     }
 
-    return std::make_pair(best_ball_intercept_pos, time_to_ball_pos);
+    // The ball may stop between the last sample and the next one
+    double stop_time = ball_path.getStopTime();
+    if (stop_time > early_time)
+    {
+        double time_after_ball_at_stop = time_after_ball(stop_time);
+        if (time_after_ball_at_stop <= 0)
+        {
+            return make_intercept(findEarliestInterceptTime(
+                time_after_ball, early_time, early_time_after_ball, stop_time,
+                time_after_ball_at_stop));
+        }
+    }
+
+    // Otherwise the robot reaches the ball after it has stopped
+    return make_intercept(stop_time);
+}
+}  // namespace
+
+std::optional<std::pair<Point, Duration>> findBestInterceptForBall(const Ball &ball,
+                                                                   const Field &field,
+                                                                   const Robot &robot)
+{
+    BallPath ball_path(ball, field);
+    return findBestInterceptForBallPath(ball_path, field, robot);
+}
+
+std::vector<std::optional<std::pair<Point, Duration>>> findBestInterceptsForBall(
+    const Ball &ball, const Field &field, const std::vector<Robot> &robots)
+{
+    BallPath ball_path(ball, field);
+    std::vector<std::optional<std::pair<Point, Duration>>> intercepts;
+    intercepts.reserve(robots.size());
+    for (const Robot &robot : robots)
+    {
+        intercepts.emplace_back(findBestInterceptForBallPath(ball_path, field, robot));
+    }
+    return intercepts;
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <optional>
+#include <vector>
 
 #include "software/geom/point.h"
 #include "software/world/ball.h"
@@ -10,6 +11,12 @@
 /**
  * Finds the best place for the given robot to intercept the given ball
  *
+ * The best place is the earliest point along the path of the ball that the robot can
+ * reach no later than the ball. The ball is assumed to roll along its current velocity
+ * under its current acceleration, and to stop once the acceleration has slowed it
+ * down to rest. The robot is assumed to move to the point as quickly as possible, as
+ * estimated by Robot::getTimeToPosition
+ *
  * @param ball The ball to intercept
  * @param field The field on which we want the intercept to occur
  * @param robot The robot that will hopefully intercept the ball
@@ -22,3 +29,18 @@
 std::optional<std::pair<Point, Duration>> findBestInterceptForBall(const Ball &ball,
                                                                    const Field &field,
                                                                    const Robot &robot);
+
+/**
+ * Finds the best place for each of the given robots to intercept the given ball. This
+ * is equivalent to calling findBestInterceptForBall for each robot, but the path of the
+ * ball is only sampled once and shared between all the robots
+ *
+ * @param ball The ball to intercept
+ * @param field The field on which we want the intercepts to occur
+ * @param robots The robots that will hopefully intercept the ball
+ *
+ * @return The best intercept for each robot, in the same order as the robots, as
+ * returned by findBestInterceptForBall
+ */
+std::vector<std::optional<std::pair<Point, Duration>>> findBestInterceptsForBall(
+    const Ball &ball, const Field &field, const std::vector<Robot> &robots);
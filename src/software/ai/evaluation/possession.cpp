@@ -13,18 +13,20 @@ std::optional<Robot> getRobotWithEffectiveBallPossession(const Team &team,
         return std::nullopt;
     }
 
-    auto best_intercept =
-        findBestInterceptForBall(ball, field, team.getAllRobots().at(0));
-    auto baller_robot = team.getAllRobots().at(0);
+    std::vector<Robot> robots = team.getAllRobots();
+    std::vector<std::optional<std::pair<Point, Duration>>> intercepts =
+        findBestInterceptsForBall(ball, field, robots);
 
     // Find the robot that can intercept the ball the quickest
-    for (const auto &robot : team.getAllRobots())
+    std::optional<std::pair<Point, Duration>> best_intercept = std::nullopt;
+    Robot baller_robot                                       = robots.at(0);
+    for (std::size_t i = 0; i < robots.size(); i++)
     {
-        auto intercept = findBestInterceptForBall(ball, field, robot);
-        if (!best_intercept || (intercept && intercept->second < best_intercept->second))
+        if (intercepts[i] &&
+            (!best_intercept || intercepts[i]->second < best_intercept->second))
         {
-            best_intercept = intercept;
-            baller_robot   = robot;
+            best_intercept = intercepts[i];
+            baller_robot   = robots[i];
         }
     }
 
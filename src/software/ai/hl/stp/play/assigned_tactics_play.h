@@ -11,8 +11,6 @@ class AssignedTacticsPlay : public Play
    public:
     AssignedTacticsPlay(TbotsProto::AiConfig config);
 
-    void getNextTactics(TacticCoroutine::push_type &yield,
-                        const WorldPtr &world_ptr) override;
     void updateTactics(const PlayUpdate &play_update) override;
 
     /**
@@ -4,26 +4,30 @@
 
 
 BallPlacementPlay::BallPlacementPlay(TbotsProto::AiConfig config)
-    : Play(config, true), fsm{BallPlacementPlayFSM{config}}, control_params{}
+    : Play(config, true),
+      initial_fsm(config),
+      fsm(std::in_place, initial_fsm),
+      control_params{}
 {
 }
 
-void BallPlacementPlay::getNextTactics(TacticCoroutine::push_type &yield,
-                                       const WorldPtr &world_ptr)
+void BallPlacementPlay::updateTactics(const PlayUpdate &play_update)
 {
-    // This function doesn't get called so it does nothing, will be removed once
-    // coroutines are phased out
+    fsm->process_event(BallPlacementPlayFSM::Update(control_params, play_update));
 }
 
-void BallPlacementPlay::updateTactics(const PlayUpdate &play_update)
+void BallPlacementPlay::reset()
 {
-    fsm.process_event(BallPlacementPlayFSM::Update(control_params, play_update));
+    Play::reset();
+    resetTactics(initial_fsm.getTactics());
+    fsm.emplace(initial_fsm);
+    control_params = {};
 }
 
 std::vector<std::string> BallPlacementPlay::getState()
 {
     std::vector<std::string> state;
-    state.emplace_back(objectTypeName(*this) + " - " + getCurrentFullStateName(fsm));
+    state.emplace_back(objectTypeName(*this) + " - " + getCurrentFullStateName(*fsm));
     return state;
 }
 
@@ -13,12 +13,12 @@ class BallPlacementPlay : public Play
    public:
     BallPlacementPlay(TbotsProto::AiConfig config);
 
-    void getNextTactics(TacticCoroutine::push_type &yield,
-                        const WorldPtr &world_ptr) override;
     void updateTactics(const PlayUpdate &play_update) override;
+    void reset() override;
     std::vector<std::string> getState() override;
 
    private:
-    FSM<BallPlacementPlayFSM> fsm;
+    BallPlacementPlayFSM initial_fsm;
+    std::optional<FSM<BallPlacementPlayFSM>> fsm;
     BallPlacementPlayFSM::ControlParams control_params;
 };
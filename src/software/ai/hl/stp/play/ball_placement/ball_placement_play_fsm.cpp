@@ -10,6 +10,11 @@ BallPlacementPlayFSM::BallPlacementPlayFSM(TbotsProto::AiConfig ai_config)
 {
 }
 
+TacticVector BallPlacementPlayFSM::getTactics() const
+{
+    return {pivot_kick_tactic, place_ball_tactic, align_placement_tactic, retreat_tactic};
+}
+
 void BallPlacementPlayFSM::kickOffWall(const Update &event)
 {
     PriorityTacticVector tactics_to_run = {{}};
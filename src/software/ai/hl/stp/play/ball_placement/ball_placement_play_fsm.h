@@ -35,6 +35,14 @@ struct BallPlacementPlayFSM
      */
     explicit BallPlacementPlayFSM(TbotsProto::AiConfig ai_config);
 
+    /**
+     * Gets the tactics this FSM creates when it is constructed. Copies of the FSM share
+     * these tactics
+     *
+     * @return the tactics
+     */
+    TacticVector getTactics() const;
+
     /**
      * Action that has the placing robot kick the ball off the wall to give more space to
      * dribble
@@ -13,10 +13,26 @@
 #include "software/util/generic_factory/generic_factory.h"
 #include "software/world/ball.h"
 
-CornerKickPlay::CornerKickPlay(TbotsProto::AiConfig config) : Play(config, true) {}
+CornerKickPlay::CornerKickPlay(TbotsProto::AiConfig config)
+    : Play(config, true),
+      stage(Stage::ALIGN_TO_BALL),
+      pass_generator(std::nullopt),
+      zones_to_cherry_pick(),
+      commit_stage_start_time(),
+      pass(std::nullopt),
+      align_to_ball_tactic(std::make_shared<MoveTactic>()),
+      cherry_pick_tactics({
+          std::make_shared<MoveTactic>(),
+          std::make_shared<MoveTactic>(),
+          std::make_shared<MoveTactic>(),
+          std::make_shared<MoveTactic>(),
+      }),
+      attacker(std::make_shared<AttackerTactic>(config)),
+      receiver(std::make_shared<ReceiverTactic>())
+{
+}
 
-void CornerKickPlay::getNextTactics(TacticCoroutine::push_type &yield,
-                                    const WorldPtr &world_ptr)
+void CornerKickPlay::updateTactics(const PlayUpdate &play_update)
 {
     /**
      * There are three main stages to this Play:
@@ -35,133 +51,121 @@ void CornerKickPlay::getNextTactics(TacticCoroutine::push_type &yield,
      *    forced to at least accept one
      *  - During this time we continue to run the cherry pick and bait robots
      * 3. Execute the pass:
-     *  - Once we've decided on a pass, we simply yield a passer/receiver and execute
+     *  - Once we've decided on a pass, we simply run a passer/receiver and execute
      *    the pass
      *
      */
 
-    Pass pass = setupPass(yield, world_ptr);
+    const WorldPtr &world_ptr = play_update.world_ptr;
 
-    // Perform the pass and wait until the receiver is finished
-    auto attacker = std::make_shared<AttackerTactic>(ai_config);
-    auto receiver = std::make_shared<ReceiverTactic>();
+    if (stage == Stage::PERFORM_PASS && receiver->done())
+    {
+        LOG(DEBUG) << "Finished";
+        restart();
+    }
+
+    if (!pass_generator)
+    {
+        auto pitch_division =
+            std::make_shared<const EighteenZonePitchDivision>(world_ptr->field());
+        pass_generator.emplace(pitch_division, ai_config.passing_config());
+    }
+
+    if (stage == Stage::ALIGN_TO_BALL && align_to_ball_tactic->done())
+    {
+        LOG(DEBUG) << "Finished aligning to ball";
+        stage                   = Stage::FIND_PASS;
+        commit_stage_start_time = world_ptr->getMostRecentTimestamp();
+    }
 
-    do
+    if (stage != Stage::PERFORM_PASS)
     {
-        attacker->updateControlParams(pass, true);
-        receiver->updateControlParams(pass);
+        // The same evaluation is used to look for a pass to commit to and to position
+        // the cherry pickers
+        auto pass_eval = pass_generator->generatePassEvaluation(*world_ptr);
 
-        if (!attacker->done())
+        if (zones_to_cherry_pick.empty())
         {
-            yield({{attacker, receiver}});
+            zones_to_cherry_pick =
+                pass_eval.rankZonesForReceiving(*world_ptr, world_ptr->ball().position());
         }
-        else
+
+        if (stage == Stage::FIND_PASS)
         {
-            yield({{receiver}});
+            // To get the best pass possible we start by aiming for a perfect one and
+            // then decrease the minimum score over time
+            PassWithRating best_pass_and_score_so_far = pass_eval.getBestPassOnField();
+
+            LOG(DEBUG) << "Best pass found so far is: "
+                       << best_pass_and_score_so_far.pass;
+            LOG(DEBUG) << "    with score: " << best_pass_and_score_so_far.rating;
+
+            Duration time_since_commit_stage_start =
+                world_ptr->getMostRecentTimestamp() - commit_stage_start_time;
+            double min_score =
+                1 - std::min(time_since_commit_stage_start.toSeconds() /
+                                 ai_config.corner_kick_play_config()
+                                     .max_time_commit_to_pass_seconds(),
+                             1.0);
+
+            if (best_pass_and_score_so_far.rating >= min_score)
+            {
+                // Commit to a pass
+                pass  = best_pass_and_score_so_far.pass;
+                stage = Stage::PERFORM_PASS;
+
+                LOG(DEBUG) << "Committing to pass: " << best_pass_and_score_so_far.pass;
+                LOG(DEBUG) << "Score of pass we committed to: "
+                           << best_pass_and_score_so_far.rating;
+            }
         }
-    } while (!receiver->done());
 
-    LOG(DEBUG) << "Finished";
-}
+        if (stage != Stage::PERFORM_PASS)
+        {
+            updateAlignToBallTactic(world_ptr);
+            updateCherryPickers(pass_eval);
+
+            // set the Tactics this Play wants to run, in order of priority
+            play_update.set_tactics({{align_to_ball_tactic, cherry_pick_tactics[0],
+                                      cherry_pick_tactics[1], cherry_pick_tactics[2],
+                                      cherry_pick_tactics[3]}});
+            return;
+        }
+    }
 
-Pass CornerKickPlay::setupPass(TacticCoroutine::push_type &yield,
-                               const WorldPtr &world_ptr)
-{
-    auto pitch_division =
-        std::make_shared<const EighteenZonePitchDivision>(world_ptr->field());
-
-    PassGenerator<EighteenZoneId> pass_generator(pitch_division,
-                                                 ai_config.passing_config());
-
-    auto pass_eval = pass_generator.generatePassEvaluation(*world_ptr);
-    PassWithRating best_pass_and_score_so_far = pass_eval.getBestPassOnField();
-
-    // This tactic will move a robot into position to initially take the free-kick
-    auto align_to_ball_tactic = std::make_shared<MoveTactic>();
-
-    auto zones_to_cherry_pick =
-        pass_eval.rankZonesForReceiving(*world_ptr, world_ptr->ball().position());
-
-    // These tactics will set robots to roam around the field, trying to put
-    // themselves into a good position to receive a pass
-    auto cherry_pick_tactic_1 = std::make_shared<MoveTactic>();
-    auto cherry_pick_tactic_2 = std::make_shared<MoveTactic>();
-    auto cherry_pick_tactic_3 = std::make_shared<MoveTactic>();
-    auto cherry_pick_tactic_4 = std::make_shared<MoveTactic>();
-
-    auto update_cherry_pickers = [&](PassEvaluation<EighteenZoneId> pass_eval) {
-        auto pass1 = pass_eval.getBestPassInZones({zones_to_cherry_pick[0]}).pass;
-        auto pass2 = pass_eval.getBestPassInZones({zones_to_cherry_pick[1]}).pass;
-        auto pass3 = pass_eval.getBestPassInZones({zones_to_cherry_pick[2]}).pass;
-        auto pass4 = pass_eval.getBestPassInZones({zones_to_cherry_pick[3]}).pass;
-
-        cherry_pick_tactic_1->updateControlParams(
-            pass1.receiverPoint(), pass1.receiverOrientation(), 0.0,
-            TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT);
-        cherry_pick_tactic_2->updateControlParams(
-            pass2.receiverPoint(), pass2.receiverOrientation(), 0.0,
-            TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT);
-        cherry_pick_tactic_3->updateControlParams(
-            pass3.receiverPoint(), pass3.receiverOrientation(), 0.0,
-            TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT);
-        cherry_pick_tactic_4->updateControlParams(
-            pass4.receiverPoint(), pass4.receiverOrientation(), 0.0,
-            TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT);
-    };
-
-    // Put the robot in roughly the right position to perform the kick
-    LOG(DEBUG) << "Aligning to ball";
-    do
-    {
-        updateAlignToBallTactic(align_to_ball_tactic, world_ptr);
-        update_cherry_pickers(pass_generator.generatePassEvaluation(*world_ptr));
+    // Perform the pass and wait until the receiver is finished
+    attacker->updateControlParams(*pass, true);
+    receiver->updateControlParams(*pass);
 
-        yield({{align_to_ball_tactic, cherry_pick_tactic_1, cherry_pick_tactic_2,
-                cherry_pick_tactic_3, cherry_pick_tactic_4}});
+    // set the Tactics this Play wants to run, in order of priority
+    if (!attacker->done())
+    {
+        play_update.set_tactics({{attacker, receiver}});
+    }
+    else
+    {
+        play_update.set_tactics({{receiver}});
+    }
+}
 
-    } while (!align_to_ball_tactic->done());
+void CornerKickPlay::reset()
+{
+    Play::reset();
+    restart();
+}
 
-    LOG(DEBUG) << "Finished aligning to ball";
+void CornerKickPlay::restart()
+{
+    LOG(DEBUG) << "Aligning to ball";
+    stage = Stage::ALIGN_TO_BALL;
+    zones_to_cherry_pick.clear();
+    pass = std::nullopt;
 
-    // Align the kicker to take the corner kick and wait for a good pass
-    // To get the best pass possible we start by aiming for a perfect one and then
-    // decrease the minimum score over time
-    double min_score                  = 1.0;
-    Timestamp commit_stage_start_time = world_ptr->getMostRecentTimestamp();
-    do
-    {
-        updateAlignToBallTactic(align_to_ball_tactic, world_ptr);
-        update_cherry_pickers(pass_generator.generatePassEvaluation(*world_ptr));
-
-        yield({{align_to_ball_tactic, cherry_pick_tactic_1, cherry_pick_tactic_2,
-                cherry_pick_tactic_3, cherry_pick_tactic_4}});
-
-        best_pass_and_score_so_far =
-            pass_generator.generatePassEvaluation(*world_ptr).getBestPassOnField();
-
-        LOG(DEBUG) << "Best pass found so far is: " << best_pass_and_score_so_far.pass;
-        LOG(DEBUG) << "    with score: " << best_pass_and_score_so_far.rating;
-
-        Duration time_since_commit_stage_start =
-            world_ptr->getMostRecentTimestamp() - commit_stage_start_time;
-        min_score =
-            1 -
-            std::min(
-                time_since_commit_stage_start.toSeconds() /
-                    ai_config.corner_kick_play_config().max_time_commit_to_pass_seconds(),
-                1.0);
-    } while (best_pass_and_score_so_far.rating < min_score);
-
-    // Commit to a pass
-    Pass pass = best_pass_and_score_so_far.pass;
-
-    LOG(DEBUG) << "Committing to pass: " << best_pass_and_score_so_far.pass;
-    LOG(DEBUG) << "Score of pass we committed to: " << best_pass_and_score_so_far.rating;
-    return pass;
+    resetTactics({align_to_ball_tactic, attacker, receiver});
+    resetTactics(TacticVector(cherry_pick_tactics.begin(), cherry_pick_tactics.end()));
 }
 
-void CornerKickPlay::updateAlignToBallTactic(
-    std::shared_ptr<MoveTactic> align_to_ball_tactic, const WorldPtr &world_ptr)
+void CornerKickPlay::updateAlignToBallTactic(const WorldPtr &world_ptr)
 {
     Vector ball_to_center_vec = Vector(0, 0) - world_ptr->ball().position().toVector();
     // We want the kicker to get into position behind the ball facing the center
@@ -172,5 +176,17 @@ void CornerKickPlay::updateAlignToBallTactic(
         ball_to_center_vec.orientation(), 0);
 }
 
+void CornerKickPlay::updateCherryPickers(const PassEvaluation<EighteenZoneId> &pass_eval)
+{
+    for (unsigned i = 0; i < cherry_pick_tactics.size(); i++)
+    {
+        Pass cherry_pick_pass =
+            pass_eval.getBestPassInZones({zones_to_cherry_pick[i]}).pass;
+        cherry_pick_tactics[i]->updateControlParams(
+            cherry_pick_pass.receiverPoint(), cherry_pick_pass.receiverOrientation(),
+            0.0, TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT);
+    }
+}
+
 // Register this play in the genericFactory
 static TGenericFactory<std::string, Play, CornerKickPlay, TbotsProto::AiConfig> factory;
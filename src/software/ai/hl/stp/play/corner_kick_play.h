@@ -2,8 +2,12 @@
 
 #include "proto/parameters.pb.h"
 #include "software/ai/hl/stp/play/play.h"
+#include "software/ai/hl/stp/tactic/attacker/attacker_tactic.h"
 #include "software/ai/hl/stp/tactic/move/move_tactic.h"
+#include "software/ai/hl/stp/tactic/receiver/receiver_tactic.h"
+#include "software/ai/passing/eighteen_zone_pitch_division.h"
 #include "software/ai/passing/pass.h"
+#include "software/ai/passing/pass_generator.hpp"
 
 /**
  * A Play for Corner Kicks
@@ -13,31 +17,54 @@ class CornerKickPlay : public Play
    public:
     CornerKickPlay(TbotsProto::AiConfig config);
 
-    void getNextTactics(TacticCoroutine::push_type &yield,
-                        const WorldPtr &world_ptr) override;
+    void updateTactics(const PlayUpdate &play_update) override;
+    void reset() override;
 
     // The maximum distance from the corner that the ball can be for it to be
     // considered a corner kick
     static constexpr double BALL_IN_CORNER_RADIUS = 0.5;
 
    private:
+    // The stages of the corner kick, in the order they are run
+    enum class Stage
+    {
+        ALIGN_TO_BALL,
+        FIND_PASS,
+        PERFORM_PASS
+    };
+
     /**
      * Update the tactic that aligns the robot to the ball in preparation to pass
      *
-     * @param align_to_ball_tactic
      * @param world The current state of the world
      */
-    void updateAlignToBallTactic(std::shared_ptr<MoveTactic> align_to_ball_tactic,
-                                 const WorldPtr &world_ptr);
+    void updateAlignToBallTactic(const WorldPtr &world_ptr);
 
     /**
-     * Sets up the pass for the corner kick: aligns the passer and positions the cherry
-     * pickers
-     *
-     * @param yield The coroutine to yield
-     * @param world The current state of the world
+     * Moves each cherry picker to the best receiving point in its zone
      *
-     * @return the pass that was committed to
+     * @param pass_eval The pass evaluation to find the receiving points with
+     */
+    void updateCherryPickers(const PassEvaluation<EighteenZoneId> &pass_eval);
+
+    /**
+     * Starts the corner kick over from aligning to the ball with reset tactics, which
+     * happens once the pass has been received
      */
-    Pass setupPass(TacticCoroutine::push_type &yield, const WorldPtr &world_ptr);
+    void restart();
+
+    Stage stage;
+    // Created from the field of the first world this play is run with
+    std::optional<PassGenerator<EighteenZoneId>> pass_generator;
+    std::vector<EighteenZoneId> zones_to_cherry_pick;
+    Timestamp commit_stage_start_time;
+    std::optional<Pass> pass;
+
+    // This tactic will move a robot into position to initially take the free-kick
+    std::shared_ptr<MoveTactic> align_to_ball_tactic;
+    // These tactics will set robots to roam around the field, trying to put
+    // themselves into a good position to receive a pass
+    std::array<std::shared_ptr<MoveTactic>, 4> cherry_pick_tactics;
+    std::shared_ptr<AttackerTactic> attacker;
+    std::shared_ptr<ReceiverTactic> receiver;
 };
@@ -7,23 +7,14 @@
 
 CreaseDefensePlay::CreaseDefensePlay(TbotsProto::AiConfig config)
     : Play(config, true),
-      fsm{CreaseDefensePlayFSM{config}},
+      initial_fsm(config),
+      fsm(std::in_place, initial_fsm),
       control_params{
           .enemy_threat_origin    = Point(),
           .max_allowed_speed_mode = TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT}
 {
 }
 
-void CreaseDefensePlay::getNextTactics(TacticCoroutine::push_type &yield,
-                                       const WorldPtr &world_ptr)
-{
-    // This function doesn't get called so it does nothing
-    while (true)
-    {
-        yield({{}});
-    }
-}
-
 void CreaseDefensePlay::updateControlParams(
     const Point &enemy_threat_origin,
     TbotsProto::MaxAllowedSpeedMode max_allowed_speed_mode)
@@ -34,7 +25,16 @@ void CreaseDefensePlay::updateControlParams(
 
 void CreaseDefensePlay::updateTactics(const PlayUpdate &play_update)
 {
-    fsm.process_event(CreaseDefensePlayFSM::Update(control_params, play_update));
+    fsm->process_event(CreaseDefensePlayFSM::Update(control_params, play_update));
+}
+
+void CreaseDefensePlay::reset()
+{
+    Play::reset();
+    fsm.emplace(initial_fsm);
+    control_params = {
+        .enemy_threat_origin    = Point(),
+        .max_allowed_speed_mode = TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT};
 }
 
 // Register this play in the genericFactory
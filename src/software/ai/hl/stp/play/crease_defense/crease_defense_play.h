@@ -12,9 +12,8 @@ class CreaseDefensePlay : public Play
    public:
     CreaseDefensePlay(TbotsProto::AiConfig config);
 
-    void getNextTactics(TacticCoroutine::push_type &yield,
-                        const WorldPtr &world_ptr) override;
     void updateTactics(const PlayUpdate &play_update) override;
+    void reset() override;
 
     /**
      * Update control params for this play
@@ -27,6 +26,7 @@ class CreaseDefensePlay : public Play
                                  TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT);
 
    private:
-    FSM<CreaseDefensePlayFSM> fsm;
+    CreaseDefensePlayFSM initial_fsm;
+    std::optional<FSM<CreaseDefensePlayFSM>> fsm;
     CreaseDefensePlayFSM::ControlParams control_params;
 };
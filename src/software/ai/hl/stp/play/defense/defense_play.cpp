@@ -7,22 +7,13 @@
 
 DefensePlay::DefensePlay(const TbotsProto::AiConfig &config)
     : Play(config, true),
-      fsm{DefensePlayFSM{config}},
+      initial_fsm(config),
+      fsm(std::in_place, initial_fsm),
       control_params{.max_allowed_speed_mode =
                          TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT}
 {
 }
 
-void DefensePlay::getNextTactics(TacticCoroutine::push_type &yield,
-                                 const WorldPtr &world_ptr)
-{
-    // This function doesn't get called so it does nothing
-    while (true)
-    {
-        yield({{}});
-    }
-}
-
 void DefensePlay::updateControlParams(
     TbotsProto::MaxAllowedSpeedMode max_allowed_speed_mode)
 {
@@ -31,7 +22,15 @@ void DefensePlay::updateControlParams(
 
 void DefensePlay::updateTactics(const PlayUpdate &play_update)
 {
-    fsm.process_event(DefensePlayFSM::Update(control_params, play_update));
+    fsm->process_event(DefensePlayFSM::Update(control_params, play_update));
+}
+
+void DefensePlay::reset()
+{
+    Play::reset();
+    fsm.emplace(initial_fsm);
+    control_params = {.max_allowed_speed_mode =
+                          TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT};
 }
 
 // Register this play in the genericFactory
@@ -13,9 +13,8 @@ class DefensePlay : public Play
    public:
     DefensePlay(const TbotsProto::AiConfig &config);
 
-    void getNextTactics(TacticCoroutine::push_type &yield,
-                        const WorldPtr &world_ptr) override;
     void updateTactics(const PlayUpdate &play_update) override;
+    void reset() override;
 
     /**
      * Update control params for this play
@@ -26,6 +25,7 @@ class DefensePlay : public Play
                                  TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT);
 
    private:
-    FSM<DefensePlayFSM> fsm;
+    DefensePlayFSM initial_fsm;
+    std::optional<FSM<DefensePlayFSM>> fsm;
     DefensePlayFSM::ControlParams control_params;
 };
@@ -9,15 +9,40 @@
 #include "software/world/game_state.h"
 
 EnemyBallPlacementPlay::EnemyBallPlacementPlay(TbotsProto::AiConfig config)
-    : Play(config, true)
+    : Play(config, true),
+      crease_defenders({
+          std::make_shared<CreaseDefenderTactic>(
+              config.robot_navigation_obstacle_config()),
+          std::make_shared<CreaseDefenderTactic>(
+              config.robot_navigation_obstacle_config()),
+          std::make_shared<CreaseDefenderTactic>(
+              config.robot_navigation_obstacle_config()),
+      }),
+      move_tactics({
+          std::make_shared<MoveTactic>(),
+          std::make_shared<MoveTactic>(),
+      }),
+      shadow_enemy(std::make_shared<ShadowEnemyTactic>()),
+      placement_point(std::nullopt),
+      enemy_at_ball(false)
 {
 }
 
-void EnemyBallPlacementPlay::ballPlacementWithShadow(
-    TacticCoroutine::push_type &yield, const WorldPtr &world_ptr,
-    std::array<std::shared_ptr<CreaseDefenderTactic>, 3> crease_defenders,
-    std::array<std::shared_ptr<MoveTactic>, 2> move_tactics, Point placement_point)
+void EnemyBallPlacementPlay::updateTactics(const PlayUpdate &play_update)
 {
+    const WorldPtr &world_ptr = play_update.world_ptr;
+
+    // The placement point is only decided on the first update, if there is no
+    // placement point then the ball position is used
+    if (!placement_point.has_value())
+    {
+        placement_point = world_ptr->gameState().getBallPlacementPoint();
+        if (!placement_point.has_value())
+        {
+            placement_point = world_ptr->ball().position();
+        }
+    }
+
     /*
      * Set up 3 crease defenders to sit by crease, and put two robots behind the ball
      * placement point
@@ -35,130 +60,101 @@ void EnemyBallPlacementPlay::ballPlacementWithShadow(
      *        goalie         o
      *                    +-----+
      */
-    auto shadow_enemy = std::make_shared<ShadowEnemyTactic>();
-
-    bool enemy_at_ball = false;
-
-    do
+    auto enemy_threats =
+        getAllEnemyThreats(world_ptr->field(), world_ptr->friendlyTeam(),
+                           world_ptr->enemyTeam(), world_ptr->ball(), false);
+
+    // Create tactic vector (starting with Goalie)
+    PriorityTacticVector tactics_to_run = {{}};
+
+    crease_defenders[0]->updateControlParams(placement_point.value(),
+                                             TbotsProto::CreaseDefenderAlignment::LEFT);
+    crease_defenders[1]->updateControlParams(placement_point.value(),
+                                             TbotsProto::CreaseDefenderAlignment::RIGHT);
+    crease_defenders[2]->updateControlParams(placement_point.value(),
+                                             TbotsProto::CreaseDefenderAlignment::CENTRE);
+
+    tactics_to_run[0].emplace_back(crease_defenders[0]);
+    tactics_to_run[0].emplace_back(crease_defenders[1]);
+    tactics_to_run[0].emplace_back(crease_defenders[2]);
+
+    Vector ball_to_net =
+        (world_ptr->ball().position() - world_ptr->field().friendlyGoalCenter())
+            .normalize(-0.75 - ROBOT_MAX_RADIUS_METERS);
+
+    Vector placement_to_net =
+        (placement_point.value() - world_ptr->field().friendlyGoalCenter())
+            .normalize(-0.75 - ROBOT_MAX_RADIUS_METERS);
+
+    // Check to see if the enemy has the ball. Once they do, we change our shadowing
+    // behaviour
+    for (const auto &enemy_robot : world_ptr->enemyTeam().getAllRobotsExceptGoalie())
     {
-        auto enemy_threats =
-            getAllEnemyThreats(world_ptr->field(), world_ptr->friendlyTeam(),
-                               world_ptr->enemyTeam(), world_ptr->ball(), false);
-
-        // Create tactic vector (starting with Goalie)
-        PriorityTacticVector tactics_to_run = {{}};
-
-        crease_defenders[0]->updateControlParams(
-            placement_point, TbotsProto::CreaseDefenderAlignment::LEFT);
-        crease_defenders[1]->updateControlParams(
-            placement_point, TbotsProto::CreaseDefenderAlignment::RIGHT);
-        crease_defenders[2]->updateControlParams(
-            placement_point, TbotsProto::CreaseDefenderAlignment::CENTRE);
-
-        tactics_to_run[0].emplace_back(crease_defenders[0]);
-        tactics_to_run[0].emplace_back(crease_defenders[1]);
-        tactics_to_run[0].emplace_back(crease_defenders[2]);
-
-        Vector ball_to_net =
-            (world_ptr->ball().position() - world_ptr->field().friendlyGoalCenter())
-                .normalize(-0.75 - ROBOT_MAX_RADIUS_METERS);
-
-        Vector placement_to_net =
-            (placement_point - world_ptr->field().friendlyGoalCenter())
-                .normalize(-0.75 - ROBOT_MAX_RADIUS_METERS);
-
-        // Check to see if the enemy has the ball. Once they do, we change our shadowing
-        // behaviour
-        for (const auto &enemy_robot : world_ptr->enemyTeam().getAllRobotsExceptGoalie())
-        {
-            if ((enemy_robot.position() - world_ptr->ball().position()).length() < 0.25)
-            {
-                enemy_at_ball = true;
-            }
-        }
-
-        // If the enemy hasn't reached the ball yet, we use this flag to avoid shadowing
-        // so that we don't interfere with the enemy robots going to pick up the ball
-        if (!enemy_at_ball)
-        {
-            move_tactics[0]->updateControlParams(
-                world_ptr->ball().position() + ball_to_net +
-                    ball_to_net.perpendicular().normalize(1.25 * ROBOT_MAX_RADIUS_METERS),
-                ball_to_net.orientation() + Angle::half(), 0);
-            move_tactics[1]->updateControlParams(
-                world_ptr->ball().position() + ball_to_net -
-                    ball_to_net.perpendicular().normalize(1.25 * ROBOT_MAX_RADIUS_METERS),
-                ball_to_net.orientation() + Angle::half(), 0);
-            tactics_to_run[0].emplace_back(move_tactics[0]);
-            tactics_to_run[0].emplace_back(move_tactics[1]);
-        }
-        // if no threats, send two robots near placement point
-        else if (enemy_threats.size() == 0)
+        if ((enemy_robot.position() - world_ptr->ball().position()).length() < 0.25)
         {
-            move_tactics[0]->updateControlParams(
-                placement_point + placement_to_net +
-                    placement_to_net.perpendicular().normalize(1.25 *
-                                                               ROBOT_MAX_RADIUS_METERS),
-                placement_to_net.orientation() + Angle::half(), 0);
-            move_tactics[1]->updateControlParams(
-                placement_point + placement_to_net -
-                    placement_to_net.perpendicular().normalize(1.25 *
-                                                               ROBOT_MAX_RADIUS_METERS),
-                placement_to_net.orientation() + Angle::half(), 0);
-            tactics_to_run[0].emplace_back(move_tactics[0]);
-            tactics_to_run[0].emplace_back(move_tactics[1]);
+            enemy_at_ball = true;
         }
-        // if there are threats, send one robot to placement point, and one shadows
-        else
-        {
-            move_tactics[0]->updateControlParams(
-                placement_point + placement_to_net,
-                placement_to_net.orientation() + Angle::half(), 0);
-            // We need a big shadow distance to avoid "bullying" the robot ball placing.
-            // Otherwise, we get a penalty
-            shadow_enemy->updateControlParams(
-                enemy_threats.at(0),
-                ROBOT_MAX_RADIUS_METERS * 4);  // Leave 2 robot widths distance (~36cm)
-
-            tactics_to_run[0].emplace_back(move_tactics[0]);
-            tactics_to_run[0].emplace_back(shadow_enemy);
-        }
-
-        // yield the Tactics this Play wants to run, in order of priority
-        yield(tactics_to_run);
-    } while (true);
-}
+    }
 
-void EnemyBallPlacementPlay::getNextTactics(TacticCoroutine::push_type &yield,
-                                            const WorldPtr &world_ptr)
-{
-    std::optional<Point> placement_point = world_ptr->gameState().getBallPlacementPoint();
-
-    std::array<std::shared_ptr<CreaseDefenderTactic>, 3> crease_defenders = {
-        // TODO-AKHIL: Remove this hard-coded value
-        std::make_shared<CreaseDefenderTactic>(
-            ai_config.robot_navigation_obstacle_config()),
-        std::make_shared<CreaseDefenderTactic>(
-            ai_config.robot_navigation_obstacle_config()),
-        std::make_shared<CreaseDefenderTactic>(
-            ai_config.robot_navigation_obstacle_config())};
-
-    std::array<std::shared_ptr<MoveTactic>, 2> move_tactics = {
-        std::make_shared<MoveTactic>(),
-        std::make_shared<MoveTactic>(),
-    };
-
-    if (placement_point.has_value())
+    // If the enemy hasn't reached the ball yet, we use this flag to avoid shadowing
+    // so that we don't interfere with the enemy robots going to pick up the ball
+    if (!enemy_at_ball)
     {
-        ballPlacementWithShadow(yield, world_ptr, crease_defenders, move_tactics,
-                                placement_point.value());
+        move_tactics[0]->updateControlParams(
+            world_ptr->ball().position() + ball_to_net +
+                ball_to_net.perpendicular().normalize(1.25 * ROBOT_MAX_RADIUS_METERS),
+            ball_to_net.orientation() + Angle::half(), 0);
+        move_tactics[1]->updateControlParams(
+            world_ptr->ball().position() + ball_to_net -
+                ball_to_net.perpendicular().normalize(1.25 * ROBOT_MAX_RADIUS_METERS),
+            ball_to_net.orientation() + Angle::half(), 0);
+        tactics_to_run[0].emplace_back(move_tactics[0]);
+        tactics_to_run[0].emplace_back(move_tactics[1]);
     }
-    // if there is no placement_point, use the ball position
+    // if no threats, send two robots near placement point
+    else if (enemy_threats.size() == 0)
+    {
+        move_tactics[0]->updateControlParams(
+            placement_point.value() + placement_to_net +
+                placement_to_net.perpendicular().normalize(1.25 *
+                                                           ROBOT_MAX_RADIUS_METERS),
+            placement_to_net.orientation() + Angle::half(), 0);
+        move_tactics[1]->updateControlParams(
+            placement_point.value() + placement_to_net -
+                placement_to_net.perpendicular().normalize(1.25 *
+                                                           ROBOT_MAX_RADIUS_METERS),
+            placement_to_net.orientation() + Angle::half(), 0);
+        tactics_to_run[0].emplace_back(move_tactics[0]);
+        tactics_to_run[0].emplace_back(move_tactics[1]);
+    }
+    // if there are threats, send one robot to placement point, and one shadows
     else
     {
-        ballPlacementWithShadow(yield, world_ptr, crease_defenders, move_tactics,
-                                world_ptr->ball().position());
+        move_tactics[0]->updateControlParams(
+            placement_point.value() + placement_to_net,
+            placement_to_net.orientation() + Angle::half(), 0);
+        // We need a big shadow distance to avoid "bullying" the robot ball placing.
+        // Otherwise, we get a penalty
+        shadow_enemy->updateControlParams(
+            enemy_threats.at(0),
+            ROBOT_MAX_RADIUS_METERS * 4);  // Leave 2 robot widths distance (~36cm)
+
+        tactics_to_run[0].emplace_back(move_tactics[0]);
+        tactics_to_run[0].emplace_back(shadow_enemy);
     }
+
+    // set the Tactics this Play wants to run, in order of priority
+    play_update.set_tactics(tactics_to_run);
+}
+
+void EnemyBallPlacementPlay::reset()
+{
+    Play::reset();
+    resetTactics(TacticVector(crease_defenders.begin(), crease_defenders.end()));
+    resetTactics(TacticVector(move_tactics.begin(), move_tactics.end()));
+    resetTactics({shadow_enemy});
+    placement_point = std::nullopt;
+    enemy_at_ball   = false;
 }
 
 static TGenericFactory<std::string, Play, EnemyBallPlacementPlay, TbotsProto::AiConfig>
@@ -3,6 +3,8 @@
 #include "proto/parameters.pb.h"
 #include "software/ai/hl/stp/play/play.h"
 #include "software/ai/hl/stp/tactic/crease_defender/crease_defender_tactic.h"
+#include "software/ai/hl/stp/tactic/move/move_tactic.h"
+#include "software/ai/hl/stp/tactic/shadow_enemy/shadow_enemy_tactic.h"
 
 /**
  * A play to set up robots during enemy ball placement
@@ -12,22 +14,17 @@ class EnemyBallPlacementPlay : public Play
    public:
     EnemyBallPlacementPlay(TbotsProto::AiConfig config);
 
-    void getNextTactics(TacticCoroutine::push_type &yield,
-                        const WorldPtr &world_ptr) override;
+    void updateTactics(const PlayUpdate &play_update) override;
+    void reset() override;
 
    private:
-    /**
-     * Ball Placement tactic shadowing the defense enemy.
-     *
-     *
-     * @param world world
-     * @param yield yield
-     * @param crease_defenders list of crease defenders
-     * @param move_tactics list of move tactics
-     * @param placement_point ball placement point
-     */
-    void ballPlacementWithShadow(
-        TacticCoroutine::push_type &yield, const WorldPtr &world_ptr,
-        std::array<std::shared_ptr<CreaseDefenderTactic>, 3> crease_defenders,
-        std::array<std::shared_ptr<MoveTactic>, 2> move_tactics, Point placement_point);
+    std::array<std::shared_ptr<CreaseDefenderTactic>, 3> crease_defenders;
+    std::array<std::shared_ptr<MoveTactic>, 2> move_tactics;
+    std::shared_ptr<ShadowEnemyTactic> shadow_enemy;
+
+    // The ball placement point, decided when the play starts
+    std::optional<Point> placement_point;
+
+    // Whether an enemy robot has reached the ball since the play started
+    bool enemy_at_ball;
 };
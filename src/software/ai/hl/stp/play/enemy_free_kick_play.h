@@ -2,6 +2,9 @@
 
 #include "proto/parameters.pb.h"
 #include "software/ai/hl/stp/play/play.h"
+#include "software/ai/hl/stp/tactic/crease_defender/crease_defender_tactic.h"
+#include "software/ai/hl/stp/tactic/move/move_tactic.h"
+#include "software/ai/hl/stp/tactic/shadow_enemy/shadow_enemy_tactic.h"
 
 /**
  * Play for defending against enemy free kicks
@@ -11,6 +14,20 @@ class EnemyFreekickPlay : public Play
    public:
     EnemyFreekickPlay(TbotsProto::AiConfig config);
 
-    void getNextTactics(TacticCoroutine::push_type &yield,
-                        const WorldPtr &world_ptr) override;
+    void updateTactics(const PlayUpdate &play_update) override;
+    void reset() override;
+
+   private:
+    std::shared_ptr<CreaseDefenderTactic> crease_defender_tactic;
+
+    // These robots will both block the enemy robot taking a free kick
+    std::array<std::shared_ptr<ShadowEnemyTactic>, 2> shadow_free_kicker;
+
+    // Shadow Enemy Tactics for extra robots
+    std::array<std::shared_ptr<ShadowEnemyTactic>, 2> shadow_potential_receivers;
+
+    // Move Tactics for extra robots (These will be used if there are no robots to
+    // shadow)
+    std::shared_ptr<MoveTactic> move_tactic_main;
+    std::shared_ptr<MoveTactic> move_tactic_secondary;
 };
@@ -2,6 +2,7 @@
 
 #include "proto/parameters.pb.h"
 #include "software/ai/hl/stp/play/play.h"
+#include "software/ai/hl/stp/tactic/move/move_tactic.h"
 
 /**
  * An example Play that moves the robots in a circle around the ball
@@ -11,6 +12,9 @@ class ExamplePlay : public Play
    public:
     explicit ExamplePlay(TbotsProto::AiConfig config);
 
-    void getNextTactics(TacticCoroutine::push_type &yield,
-                        const WorldPtr &world_ptr) override;
+    void updateTactics(const PlayUpdate &play_update) override;
+    void reset() override;
+
+   private:
+    std::vector<std::shared_ptr<MoveTactic>> move_tactics;
 };
@@ -14,12 +14,30 @@
 #include "software/world/ball.h"
 
 FreeKickPlay::FreeKickPlay(TbotsProto::AiConfig config)
-    : Play(config, true), MAX_TIME_TO_COMMIT_TO_PASS(Duration::fromSeconds(3))
+    : Play(config, true),
+      MAX_TIME_TO_COMMIT_TO_PASS(Duration::fromSeconds(3)),
+      stage(Stage::ALIGN_TO_BALL),
+      pass_generator(std::nullopt),
+      cherry_pick_regions(std::nullopt),
+      commit_stage_start_time(),
+      best_pass_and_score_so_far(std::nullopt),
+      crease_defender_tactics({
+          std::make_shared<CreaseDefenderTactic>(
+              config.robot_navigation_obstacle_config()),
+          std::make_shared<CreaseDefenderTactic>(
+              config.robot_navigation_obstacle_config()),
+      }),
+      cherry_pick_tactics(
+          {std::make_shared<MoveTactic>(), std::make_shared<MoveTactic>()}),
+      align_to_ball_tactic(std::make_shared<MoveTactic>()),
+      shoot_tactic(std::make_shared<AttackerTactic>(config)),
+      passer(std::make_shared<AttackerTactic>(config)),
+      receiver(std::make_shared<ReceiverTactic>()),
+      chip_tactic(std::make_shared<ChipTactic>())
 {
 }
 
-void FreeKickPlay::getNextTactics(TacticCoroutine::push_type &yield,
-                                  const WorldPtr &world_ptr)
+void FreeKickPlay::updateTactics(const PlayUpdate &play_update)
 {
     /**
      * This play is basically:
@@ -30,42 +48,98 @@ void FreeKickPlay::getNextTactics(TacticCoroutine::push_type &yield,
      * - One robot is goalie
      */
 
-    // Setup crease defenders to help the goalie
-    std::array<std::shared_ptr<CreaseDefenderTactic>, 2> crease_defender_tactics = {
-        std::make_shared<CreaseDefenderTactic>(
-            ai_config.robot_navigation_obstacle_config()),
-        std::make_shared<CreaseDefenderTactic>(
-            ai_config.robot_navigation_obstacle_config())};
+    const WorldPtr &world_ptr = play_update.world_ptr;
 
-    auto attacker = std::make_shared<AttackerTactic>(ai_config);
-
-    PassWithRating best_pass_and_score_so_far =
-        shootOrFindPassStage(yield, attacker, crease_defender_tactics, world_ptr);
+    if ((stage == Stage::PERFORM_PASS && receiver->done()) ||
+        (stage == Stage::CHIP_AT_GOAL && chip_tactic->done()))
+    {
+        LOG(DEBUG) << "Finished";
+        restart();
+    }
 
-    if (attacker->done())
+    if (!pass_generator)
     {
-        LOG(DEBUG) << "Took shot";
+        auto pitch_division =
+            std::make_shared<const EighteenZonePitchDivision>(world_ptr->field());
+        pass_generator.emplace(pitch_division, ai_config.passing_config());
     }
-    else if (best_pass_and_score_so_far.rating > MIN_ACCEPTABLE_PASS_SCORE)
+
+    if (stage == Stage::ALIGN_TO_BALL && align_to_ball_tactic->done())
     {
-        performPassStage(yield, crease_defender_tactics, best_pass_and_score_so_far,
-                         world_ptr);
+        LOG(DEBUG) << "Finished aligning to ball";
+        stage                   = Stage::SHOOT_OR_FIND_PASS;
+        commit_stage_start_time = world_ptr->getMostRecentTimestamp();
     }
-    else
+
+    updateCreaseDefenders(world_ptr);
+
+    if (stage == Stage::ALIGN_TO_BALL || stage == Stage::SHOOT_OR_FIND_PASS)
     {
-        LOG(DEBUG) << "Pass had score of " << best_pass_and_score_so_far.rating
-                   << " which is below our threshold of" << MIN_ACCEPTABLE_PASS_SCORE
-                   << ", so chipping at enemy net";
+        // The same evaluation is used to look for a pass to commit to and to position
+        // the cherry pickers
+        auto pass_eval = pass_generator->generatePassEvaluation(*world_ptr);
+
+        if (stage == Stage::SHOOT_OR_FIND_PASS)
+        {
+            findPass(world_ptr, pass_eval);
+        }
+
+        if (stage == Stage::ALIGN_TO_BALL || stage == Stage::SHOOT_OR_FIND_PASS)
+        {
+            if (!cherry_pick_regions)
+            {
+                auto ranked_zones = pass_eval.rankZonesForReceiving(
+                    *world_ptr, pass_eval.getBestPassOnField().pass.receiverPoint());
+                cherry_pick_regions = {{{ranked_zones[0]}, {ranked_zones[1]}}};
+            }
+
+            updateAlignToBallTactic(world_ptr);
+            updateCherryPickers(pass_eval);
+        }
+    }
 
-        chipAtGoalStage(yield, crease_defender_tactics, world_ptr);
+    // set the Tactics this Play wants to run, in order of priority
+    switch (stage)
+    {
+        case Stage::ALIGN_TO_BALL:
+            play_update.set_tactics({{align_to_ball_tactic, cherry_pick_tactics[0],
+                                      cherry_pick_tactics[1], crease_defender_tactics[0],
+                                      crease_defender_tactics[1]}});
+            break;
+        case Stage::SHOOT_OR_FIND_PASS:
+            play_update.set_tactics(
+                {{align_to_ball_tactic, shoot_tactic, cherry_pick_tactics[0],
+                  cherry_pick_tactics[1], crease_defender_tactics[0],
+                  crease_defender_tactics[1]}});
+            break;
+        case Stage::PERFORM_PASS:
+            play_update.set_tactics(performPassStage());
+            break;
+        case Stage::CHIP_AT_GOAL:
+            play_update.set_tactics(chipAtGoalStage(world_ptr));
+            break;
     }
+}
 
+void FreeKickPlay::reset()
+{
+    Play::reset();
+    restart();
+}
 
-    LOG(DEBUG) << "Finished";
+void FreeKickPlay::restart()
+{
+    LOG(DEBUG) << "Aligning to ball";
+    stage                      = Stage::ALIGN_TO_BALL;
+    cherry_pick_regions        = std::nullopt;
+    best_pass_and_score_so_far = std::nullopt;
+
+    resetTactics({crease_defender_tactics[0], crease_defender_tactics[1],
+                  cherry_pick_tactics[0], cherry_pick_tactics[1], align_to_ball_tactic,
+                  shoot_tactic, passer, receiver, chip_tactic});
 }
 
-void FreeKickPlay::updateAlignToBallTactic(
-    std::shared_ptr<MoveTactic> align_to_ball_tactic, const WorldPtr &world_ptr)
+void FreeKickPlay::updateAlignToBallTactic(const WorldPtr &world_ptr)
 {
     Vector ball_to_center_vec = Vector(0, 0) - world_ptr->ball().position().toVector();
     // We want the kicker to get into position behind the ball facing the center
@@ -76,170 +150,95 @@ void FreeKickPlay::updateAlignToBallTactic(
         ball_to_center_vec.orientation(), 0);
 }
 
-void FreeKickPlay::chipAtGoalStage(
-    TacticCoroutine::push_type &yield,
-    std::array<std::shared_ptr<CreaseDefenderTactic>, 2> crease_defender_tactics,
-    const WorldPtr &world_ptr)
+void FreeKickPlay::updateCherryPickers(const PassEvaluation<EighteenZoneId> &pass_eval)
 {
-    auto chip_tactic = std::make_shared<ChipTactic>();
+    for (unsigned i = 0; i < cherry_pick_tactics.size(); i++)
+    {
+        Pass cherry_pick_pass =
+            pass_eval.getBestPassInZones((*cherry_pick_regions)[i]).pass;
+        cherry_pick_tactics[i]->updateControlParams(
+            cherry_pick_pass.receiverPoint(), cherry_pick_pass.receiverOrientation(),
+            0.0, TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT);
+    }
+}
+
+void FreeKickPlay::updateCreaseDefenders(const WorldPtr &world_ptr)
+{
+    std::get<0>(crease_defender_tactics)
+        ->updateControlParams(world_ptr->ball().position(),
+                              TbotsProto::CreaseDefenderAlignment::LEFT);
+    std::get<1>(crease_defender_tactics)
+        ->updateControlParams(world_ptr->ball().position(),
+                              TbotsProto::CreaseDefenderAlignment::RIGHT);
+}
 
+PriorityTacticVector FreeKickPlay::chipAtGoalStage(const WorldPtr &world_ptr)
+{
     // Figure out where the fallback chip target is
     // This is exerimentally determined to be a reasonable value
     double fallback_chip_target_x_offset = 1.5;
     Point chip_target =
         world_ptr->field().enemyGoalCenter() - Vector(fallback_chip_target_x_offset, 0);
 
-    do
-    {
-        chip_tactic->updateControlParams(world_ptr->ball().position(), chip_target);
-        std::get<0>(crease_defender_tactics)
-            ->updateControlParams(world_ptr->ball().position(),
-                                  TbotsProto::CreaseDefenderAlignment::LEFT);
-        std::get<1>(crease_defender_tactics)
-            ->updateControlParams(world_ptr->ball().position(),
-                                  TbotsProto::CreaseDefenderAlignment::RIGHT);
-
-        yield({{chip_tactic, std::get<0>(crease_defender_tactics),
-                std::get<1>(crease_defender_tactics)}});
-
-    } while (!chip_tactic->done());
+    chip_tactic->updateControlParams(world_ptr->ball().position(), chip_target);
+
+    return {{chip_tactic, std::get<0>(crease_defender_tactics),
+             std::get<1>(crease_defender_tactics)}};
 }
 
-void FreeKickPlay::performPassStage(
-    TacticCoroutine::push_type &yield,
-    std::array<std::shared_ptr<CreaseDefenderTactic>, 2> crease_defender_tactics,
-    PassWithRating best_pass_and_score_so_far, const WorldPtr &world_ptr)
+PriorityTacticVector FreeKickPlay::performPassStage()
 {
-    // Commit to a pass
-    Pass pass = best_pass_and_score_so_far.pass;
-
-    LOG(DEBUG) << "Committing to pass: " << best_pass_and_score_so_far.pass;
-    LOG(DEBUG) << "Score of pass we committed to: " << best_pass_and_score_so_far.rating;
-
     // Perform the pass and wait until the receiver is finished
-    auto attacker = std::make_shared<AttackerTactic>(ai_config);
-    auto receiver = std::make_shared<ReceiverTactic>();
-    do
-    {
-        attacker->updateControlParams(pass, true);
-        receiver->updateControlParams(pass);
-
-        std::get<0>(crease_defender_tactics)
-            ->updateControlParams(world_ptr->ball().position(),
-                                  TbotsProto::CreaseDefenderAlignment::LEFT);
-        std::get<1>(crease_defender_tactics)
-            ->updateControlParams(world_ptr->ball().position(),
-                                  TbotsProto::CreaseDefenderAlignment::RIGHT);
-        yield({{attacker, receiver, std::get<0>(crease_defender_tactics),
-                std::get<1>(crease_defender_tactics)}});
-    } while (!receiver->done());
+    const Pass &pass = best_pass_and_score_so_far->pass;
+    passer->updateControlParams(pass, true);
+    receiver->updateControlParams(pass);
+
+    return {{passer, receiver, std::get<0>(crease_defender_tactics),
+             std::get<1>(crease_defender_tactics)}};
 }
 
-PassWithRating FreeKickPlay::shootOrFindPassStage(
-    TacticCoroutine::push_type &yield, std::shared_ptr<AttackerTactic> shoot_tactic,
-    std::array<std::shared_ptr<CreaseDefenderTactic>, 2> crease_defender_tactics,
-    const WorldPtr &world_ptr)
+void FreeKickPlay::findPass(const WorldPtr &world_ptr,
+                            const PassEvaluation<EighteenZoneId> &pass_eval)
 {
-    auto pitch_division =
-        std::make_shared<const EighteenZonePitchDivision>(world_ptr->field());
-
-    PassGenerator<EighteenZoneId> pass_generator(pitch_division,
-                                                 ai_config.passing_config());
-
-    using Zones = std::unordered_set<EighteenZoneId>;
-
-    auto pass_eval = pass_generator.generatePassEvaluation(*world_ptr);
-    PassWithRating best_pass_and_score_so_far = pass_eval.getBestPassOnField();
-
-    auto ranked_zones = pass_eval.rankZonesForReceiving(
-        *world_ptr, best_pass_and_score_so_far.pass.receiverPoint());
-    Zones cherry_pick_region_1 = {ranked_zones[0]};
-    Zones cherry_pick_region_2 = {ranked_zones[1]};
-
-    // These two tactics will set robots to roam around the field, trying to put
-    // themselves into a good position to receive a pass
-    auto cherry_pick_tactic_1 = std::make_shared<MoveTactic>();
-    auto cherry_pick_tactic_2 = std::make_shared<MoveTactic>();
-
-    // This tactic will move a robot into position to initially take the free-kick
-    auto align_to_ball_tactic = std::make_shared<MoveTactic>();
-
-    // Put the robot in roughly the right position to perform the kick
-    LOG(DEBUG) << "Aligning to ball";
-    do
-    {
-        updateAlignToBallTactic(align_to_ball_tactic, world_ptr);
-
-        auto pass_eval = pass_generator.generatePassEvaluation(*world_ptr);
-
-        auto pass1 = pass_eval.getBestPassInZones(cherry_pick_region_1).pass;
-        auto pass2 = pass_eval.getBestPassInZones(cherry_pick_region_2).pass;
-
-        cherry_pick_tactic_1->updateControlParams(
-            pass1.receiverPoint(), pass1.receiverOrientation(), 0.0,
-            TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT);
-        cherry_pick_tactic_2->updateControlParams(
-            pass2.receiverPoint(), pass2.receiverOrientation(), 0.0,
-            TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT);
-
-        std::get<0>(crease_defender_tactics)
-            ->updateControlParams(world_ptr->ball().position(),
-                                  TbotsProto::CreaseDefenderAlignment::LEFT);
-        std::get<1>(crease_defender_tactics)
-            ->updateControlParams(world_ptr->ball().position(),
-                                  TbotsProto::CreaseDefenderAlignment::RIGHT);
-        yield({{align_to_ball_tactic, cherry_pick_tactic_1, cherry_pick_tactic_2,
-                std::get<0>(crease_defender_tactics),
-                std::get<1>(crease_defender_tactics)}});
-    } while (!align_to_ball_tactic->done());
-
-    LOG(DEBUG) << "Finished aligning to ball";
-
-    best_pass_and_score_so_far =
-        pass_generator.generatePassEvaluation(*world_ptr).getBestPassOnField();
-    // Align the kicker to pass and wait for a good pass
     // To get the best pass possible we start by aiming for a perfect one and then
     // decrease the minimum score over time
-    double min_score                  = 1.0;
-    Timestamp commit_stage_start_time = world_ptr->getMostRecentTimestamp();
-    do
+    best_pass_and_score_so_far = pass_eval.getBestPassOnField();
+    LOG(DEBUG) << "Best pass found so far is: " << best_pass_and_score_so_far->pass;
+    LOG(DEBUG) << "    with score: " << best_pass_and_score_so_far->rating;
+
+    Duration time_since_commit_stage_start =
+        world_ptr->getMostRecentTimestamp() - commit_stage_start_time;
+    double min_score = 1 - std::min(time_since_commit_stage_start.toSeconds() /
+                                        MAX_TIME_TO_COMMIT_TO_PASS.toSeconds(),
+                                    1.0);
+    if (best_pass_and_score_so_far->rating < min_score)
+    {
+        return;
+    }
+
+    // The shooter keeps running while we look for a pass, and only once we would
+    // commit to a pass do we check whether it already took its shot
+    if (shoot_tactic->done())
+    {
+        LOG(DEBUG) << "Took shot";
+        LOG(DEBUG) << "Finished";
+        restart();
+    }
+    else if (best_pass_and_score_so_far->rating > MIN_ACCEPTABLE_PASS_SCORE)
     {
-        updateAlignToBallTactic(align_to_ball_tactic, world_ptr);
-
-        auto pass_eval = pass_generator.generatePassEvaluation(*world_ptr);
-
-        auto pass1 = pass_eval.getBestPassInZones(cherry_pick_region_1).pass;
-        auto pass2 = pass_eval.getBestPassInZones(cherry_pick_region_2).pass;
-
-        cherry_pick_tactic_1->updateControlParams(
-            pass1.receiverPoint(), pass1.receiverOrientation(), 0.0,
-            TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT);
-        cherry_pick_tactic_2->updateControlParams(
-            pass2.receiverPoint(), pass2.receiverOrientation(), 0.0,
-            TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT);
-
-        std::get<0>(crease_defender_tactics)
-            ->updateControlParams(world_ptr->ball().position(),
-                                  TbotsProto::CreaseDefenderAlignment::LEFT);
-        std::get<1>(crease_defender_tactics)
-            ->updateControlParams(world_ptr->ball().position(),
-                                  TbotsProto::CreaseDefenderAlignment::RIGHT);
-        yield({{align_to_ball_tactic, shoot_tactic, cherry_pick_tactic_1,
-                cherry_pick_tactic_2, std::get<0>(crease_defender_tactics),
-                std::get<1>(crease_defender_tactics)}});
-
-        best_pass_and_score_so_far =
-            pass_generator.generatePassEvaluation(*world_ptr).getBestPassOnField();
-        LOG(DEBUG) << "Best pass found so far is: " << best_pass_and_score_so_far.pass;
-        LOG(DEBUG) << "    with score: " << best_pass_and_score_so_far.rating;
-
-        Duration time_since_commit_stage_start =
-            world_ptr->getMostRecentTimestamp() - commit_stage_start_time;
-        min_score = 1 - std::min(time_since_commit_stage_start.toSeconds() /
-                                     MAX_TIME_TO_COMMIT_TO_PASS.toSeconds(),
-                                 1.0);
-    } while (best_pass_and_score_so_far.rating < min_score);
-    return best_pass_and_score_so_far;
+        // Commit to a pass
+        LOG(DEBUG) << "Committing to pass: " << best_pass_and_score_so_far->pass;
+        LOG(DEBUG) << "Score of pass we committed to: "
+                   << best_pass_and_score_so_far->rating;
+        stage = Stage::PERFORM_PASS;
+    }
+    else
+    {
+        LOG(DEBUG) << "Pass had score of " << best_pass_and_score_so_far->rating
+                   << " which is below our threshold of" << MIN_ACCEPTABLE_PASS_SCORE
+                   << ", so chipping at enemy net";
+        stage = Stage::CHIP_AT_GOAL;
+    }
 }
 
 // Register this play in the genericFactory
@@ -2,8 +2,12 @@
 
 #include "proto/parameters.pb.h"
 #include "software/ai/hl/stp/play/play.h"
+#include "software/ai/hl/stp/tactic/attacker/attacker_tactic.h"
+#include "software/ai/hl/stp/tactic/chip/chip_tactic.h"
 #include "software/ai/hl/stp/tactic/crease_defender/crease_defender_tactic.h"
 #include "software/ai/hl/stp/tactic/move/move_tactic.h"
+#include "software/ai/hl/stp/tactic/receiver/receiver_tactic.h"
+#include "software/ai/passing/eighteen_zone_pitch_division.h"
 #include "software/ai/passing/pass_generator.hpp"
 
 /**
@@ -14,10 +18,20 @@ class FreeKickPlay : public Play
    public:
     FreeKickPlay(TbotsProto::AiConfig config);
 
-    void getNextTactics(TacticCoroutine::push_type &yield,
-                        const WorldPtr &world_ptr) override;
+    void updateTactics(const PlayUpdate &play_update) override;
+    void reset() override;
 
    private:
+    // The stages of the free kick. The play shoots or looks for a pass after aligning
+    // to the ball, and then either passes or chips at the goal
+    enum class Stage
+    {
+        ALIGN_TO_BALL,
+        SHOOT_OR_FIND_PASS,
+        PERFORM_PASS,
+        CHIP_AT_GOAL
+    };
+
     // The maximum time that we will wait before committing to a pass
     const Duration MAX_TIME_TO_COMMIT_TO_PASS;
 
@@ -27,51 +41,75 @@ class FreeKickPlay : public Play
     /**
      * Finds a place to chip the ball near the net and chips there.
      *
-     * @param yield The coroutine to yield to
-     * @param crease_defender_tactics The crease defender tactics to use
      * @param world The current state of the world
+     *
+     * @return the tactics to run
      */
-    void chipAtGoalStage(
-        TacticCoroutine::push_type &yield,
-        std::array<std::shared_ptr<CreaseDefenderTactic>, 2> crease_defender_tactics,
-        const WorldPtr &world_ptr);
+    PriorityTacticVector chipAtGoalStage(const WorldPtr &world_ptr);
 
     /**
-     * Given a pass, coordinates and executes the pass with a Passer and Receiver
+     * Coordinates and executes the committed pass with a Passer and Receiver
      *
-     * @param yield The coroutine to yield
-     * @param crease_defender_tactics The crease defender tactics to use
-     * @param best_pass_and_score_so_far The Pass to execute
-     * @param world The current state of the world
+     * @return the tactics to run
      */
-    void performPassStage(
-        TacticCoroutine::push_type &yield,
-        std::array<std::shared_ptr<CreaseDefenderTactic>, 2> crease_defender_tactics,
-        PassWithRating best_pass_and_score_so_far, const WorldPtr &world_ptr);
+    PriorityTacticVector performPassStage();
 
     /**
      * Tries to find a good pass on the field. This function starts with a high threshold
      * for what it considers a good pass, and slowly reduces this threshold over time if
-     * we aren't finding passes that are good enough.
+     * we aren't finding passes that are good enough. Once the threshold is met, it
+     * starts the play over if the shooter has taken its shot, and otherwise moves on to
+     * passing or chipping
      *
-     * @param yield The coroutine to yield to
-     * @param crease_defender_tactics The crease defender tactics
-     * @param shoot_tactic The AttackerTactic to shoot with
      * @param world The current state of the world
+     * @param pass_eval The pass evaluation of the current world
+     */
+    void findPass(const WorldPtr &world_ptr,
+                  const PassEvaluation<EighteenZoneId> &pass_eval);
+
+    /**
+     * Moves the cherry pickers to the best receiving points in their regions
+     *
+     * @param pass_eval The pass evaluation to find the receiving points with
+     */
+    void updateCherryPickers(const PassEvaluation<EighteenZoneId> &pass_eval);
+
+    /**
+     * Update the crease defenders to defend against the ball
      *
-     * @return the pass that was found
+     * @param world The current state of the world
      */
-    PassWithRating shootOrFindPassStage(
-        TacticCoroutine::push_type &yield, std::shared_ptr<AttackerTactic> shoot_tactic,
-        std::array<std::shared_ptr<CreaseDefenderTactic>, 2> crease_defender_tactics,
-        const WorldPtr &world_ptr);
+    void updateCreaseDefenders(const WorldPtr &world_ptr);
 
     /**
      * Update the tactic that aligns the robot to the ball in preparation to pass
      *
-     * @param align_to_ball_tactic
      * @param world The current state of the world
      */
-    void updateAlignToBallTactic(std::shared_ptr<MoveTactic> align_to_ball_tactic,
-                                 const WorldPtr &world_ptr);
+    void updateAlignToBallTactic(const WorldPtr &world_ptr);
+
+    /**
+     * Starts the free kick over from aligning to the ball with reset tactics, which
+     * happens once the shot, pass or chip has been taken
+     */
+    void restart();
+
+    Stage stage;
+    // Created from the field of the first world this play is run with
+    std::optional<PassGenerator<EighteenZoneId>> pass_generator;
+    std::optional<std::array<std::unordered_set<EighteenZoneId>, 2>> cherry_pick_regions;
+    Timestamp commit_stage_start_time;
+    std::optional<PassWithRating> best_pass_and_score_so_far;
+
+    // Setup crease defenders to help the goalie
+    std::array<std::shared_ptr<CreaseDefenderTactic>, 2> crease_defender_tactics;
+    // These two tactics will set robots to roam around the field, trying to put
+    // themselves into a good position to receive a pass
+    std::array<std::shared_ptr<MoveTactic>, 2> cherry_pick_tactics;
+    // This tactic will move a robot into position to initially take the free-kick
+    std::shared_ptr<MoveTactic> align_to_ball_tactic;
+    std::shared_ptr<AttackerTactic> shoot_tactic;
+    std::shared_ptr<AttackerTactic> passer;
+    std::shared_ptr<ReceiverTactic> receiver;
+    std::shared_ptr<ChipTactic> chip_tactic;
 };
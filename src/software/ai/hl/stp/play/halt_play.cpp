@@ -3,24 +3,24 @@
 #include "software/ai/hl/stp/tactic/stop/stop_tactic.h"
 #include "software/util/generic_factory/generic_factory.h"
 
-HaltPlay::HaltPlay(TbotsProto::AiConfig config) : Play(config, false) {}
+HaltPlay::HaltPlay(TbotsProto::AiConfig config)
+    : Play(config, false),
+      halt_tactics({std::make_shared<StopTactic>(), std::make_shared<StopTactic>(),
+                    std::make_shared<StopTactic>(), std::make_shared<StopTactic>(),
+                    std::make_shared<StopTactic>(), std::make_shared<StopTactic>()})
+{
+}
 
-void HaltPlay::getNextTactics(TacticCoroutine::push_type &yield,
-                              const WorldPtr &world_ptr)
+void HaltPlay::updateTactics(const PlayUpdate &play_update)
 {
-    auto stop_tactic_1 = std::make_shared<StopTactic>();
-    auto stop_tactic_2 = std::make_shared<StopTactic>();
-    auto stop_tactic_3 = std::make_shared<StopTactic>();
-    auto stop_tactic_4 = std::make_shared<StopTactic>();
-    auto stop_tactic_5 = std::make_shared<StopTactic>();
-    auto stop_tactic_6 = std::make_shared<StopTactic>();
+    // set the Tactics this Play wants to run, in order of priority
+    play_update.set_tactics({halt_tactics});
+}
 
-    do
-    {
-        // yield the Tactics this Play wants to run, in order of priority
-        yield({{stop_tactic_1, stop_tactic_2, stop_tactic_3, stop_tactic_4, stop_tactic_5,
-                stop_tactic_6}});
-    } while (true);
+void HaltPlay::reset()
+{
+    Play::reset();
+    resetTactics(halt_tactics);
 }
 
 // Register this play in the genericFactory
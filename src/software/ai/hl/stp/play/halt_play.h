@@ -12,6 +12,9 @@ class HaltPlay : public Play
    public:
     HaltPlay(TbotsProto::AiConfig config);
 
-    void getNextTactics(TacticCoroutine::push_type &yield,
-                        const WorldPtr &world_ptr) override;
+    void updateTactics(const PlayUpdate &play_update) override;
+    void reset() override;
+
+   private:
+    TacticVector halt_tactics;
 };
@@ -7,34 +7,34 @@
 
 ScoringFromContestedPossessionPlay::ScoringFromContestedPossessionPlay(
     TbotsProto::AiConfig config)
-    : Play(config, false)
+    : Play(config, false),
+      dribble_tactic(std::make_shared<DribbleTactic>(config)),
+      move_tactic(std::make_shared<MoveTactic>())
 {
+    dribble_tactic->updateControlParams(std::nullopt, std::nullopt, true);
 }
 
-void ScoringFromContestedPossessionPlay::getNextTactics(TacticCoroutine::push_type &yield,
-                                                        const WorldPtr &world_ptr)
+void ScoringFromContestedPossessionPlay::updateTactics(const PlayUpdate &play_update)
 {
-    std::shared_ptr<DribbleTactic> dribble_tactic =
-        std::make_shared<DribbleTactic>(ai_config);
-    dribble_tactic->updateControlParams(std::nullopt, std::nullopt, true);
-    std::shared_ptr<MoveTactic> move_tactic = std::make_shared<MoveTactic>();
-
-    do
+    TacticVector result = {};
+    if (play_update.world_ptr->gameState().isPlaying())
+    {
+        // TODO (#2107): implement contested scoring
+        result.emplace_back(dribble_tactic);
+    }
+    else
     {
-        TacticVector result = {};
-        if (world_ptr->gameState().isPlaying())
-        {
-            // TODO (#2107): implement contested scoring
-            result.emplace_back(dribble_tactic);
-        }
-        else
-        {
-            // TODO (#2107): implement face ball opposite attacker 0.3m away
-            move_tactic->updateControlParams(Point(0, 0), Angle::zero(), 0.0);
-            result.emplace_back(move_tactic);
-        }
-        yield({result});
-    } while (true);
+        // TODO (#2107): implement face ball opposite attacker 0.3m away
+        move_tactic->updateControlParams(Point(0, 0), Angle::zero(), 0.0);
+        result.emplace_back(move_tactic);
+    }
+    play_update.set_tactics({result});
+}
+
+void ScoringFromContestedPossessionPlay::reset()
+{
+    Play::reset();
+    resetTactics({dribble_tactic, move_tactic});
 }
 
 // Register this play in the genericFactory
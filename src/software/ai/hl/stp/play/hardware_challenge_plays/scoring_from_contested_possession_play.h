@@ -2,6 +2,8 @@
 
 #include "proto/parameters.pb.h"
 #include "software/ai/hl/stp/play/play.h"
+#include "software/ai/hl/stp/tactic/dribble/dribble_tactic.h"
+#include "software/ai/hl/stp/tactic/move/move_tactic.h"
 
 /**
  * Play for the scoring from contested possession hardware challenge
@@ -12,6 +14,10 @@ class ScoringFromContestedPossessionPlay : public Play
    public:
     ScoringFromContestedPossessionPlay(TbotsProto::AiConfig config);
 
-    void getNextTactics(TacticCoroutine::push_type &yield,
-                        const WorldPtr &world_ptr) override;
+    void updateTactics(const PlayUpdate &play_update) override;
+    void reset() override;
+
+   private:
+    std::shared_ptr<DribbleTactic> dribble_tactic;
+    std::shared_ptr<MoveTactic> move_tactic;
 };
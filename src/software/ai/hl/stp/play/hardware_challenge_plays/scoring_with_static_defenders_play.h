@@ -2,6 +2,7 @@
 
 #include "proto/parameters.pb.h"
 #include "software/ai/hl/stp/play/play.h"
+#include "software/ai/hl/stp/tactic/move/move_tactic.h"
 
 /**
  * Play for scoring with static defenders play hardware challenge
@@ -12,10 +13,12 @@ class ScoringWithStaticDefendersPlay : public Play
    public:
     ScoringWithStaticDefendersPlay(TbotsProto::AiConfig config);
 
-    void getNextTactics(TacticCoroutine::push_type &yield,
-                        const WorldPtr &world_ptr) override;
+    void updateTactics(const PlayUpdate &play_update) override;
+    void reset() override;
 
    private:
     // 3 robots for this hardware challenge
     const unsigned int NUM_ROBOTS = 3;
+
+    std::vector<std::shared_ptr<MoveTactic>> move_tactics;
 };
@@ -9,15 +9,19 @@
 #include "software/geom/algorithms/calculate_block_cone.h"
 #include "software/util/generic_factory/generic_factory.h"
 
-KickoffEnemyPlay::KickoffEnemyPlay(TbotsProto::AiConfig config) : Play(config, true) {}
+KickoffEnemyPlay::KickoffEnemyPlay(TbotsProto::AiConfig config)
+    : Play(config, true),
+      shadow_enemy_tactics({std::make_shared<ShadowEnemyTactic>(),
+                            std::make_shared<ShadowEnemyTactic>()}),
+      move_tactics({std::make_shared<MoveTactic>(), std::make_shared<MoveTactic>(),
+                    std::make_shared<MoveTactic>(), std::make_shared<MoveTactic>(),
+                    std::make_shared<MoveTactic>()})
+{
+}
 
-void KickoffEnemyPlay::getNextTactics(TacticCoroutine::push_type &yield,
-                                      const WorldPtr &world_ptr)
+void KickoffEnemyPlay::updateTactics(const PlayUpdate &play_update)
 {
-    // 3 robots assigned to shadow enemies. Other robots will be assigned positions
-    // on the field to be evenly spread out
-    std::vector<std::shared_ptr<ShadowEnemyTactic>> shadow_enemy_tactics = {
-        std::make_shared<ShadowEnemyTactic>(), std::make_shared<ShadowEnemyTactic>()};
+    const WorldPtr &world_ptr = play_update.world_ptr;
 
     // these positions are picked according to the following slide
     // https://images.slideplayer.com/32/9922349/slides/slide_2.jpg
@@ -61,89 +65,73 @@ void KickoffEnemyPlay::getNextTactics(TacticCoroutine::push_type &yield,
         Point(-(world_ptr->field().centerCircleRadius() + 2 * ROBOT_MAX_RADIUS_METERS),
               -world_ptr->field().defenseAreaYLength() / 2.0),
     };
-    // these move tactics will be used to go to those positions
-    std::vector<std::shared_ptr<MoveTactic>> move_tactics = {
-        std::make_shared<MoveTactic>(), std::make_shared<MoveTactic>(),
-        std::make_shared<MoveTactic>(), std::make_shared<MoveTactic>(),
-        std::make_shared<MoveTactic>()};
 
-    // created an enemy_team for mutation
-    Team enemy_team = world_ptr->enemyTeam();
+    // TODO: (Mathew): Minor instability with defenders and goalie when the ball and
+    // attacker are in the middle of the net
 
-    do
+    if (world_ptr->enemyTeam().numRobots() == 0)
     {
-        // TODO: (Mathew): Minor instability with defenders and goalie when the ball and
-        // attacker are in the middle of the net
+        LOG(WARNING) << "No Robot on the Field!";
+    }
+
+    auto enemy_threats =
+        getAllEnemyThreats(world_ptr->field(), world_ptr->friendlyTeam(),
+                           world_ptr->enemyTeam(), world_ptr->ball(), false);
+
+    PriorityTacticVector result = {{}};
 
-        // We find the nearest enemy robot closest to (0,0) then ignore it from the enemy
-        // team. Since the center circle is a motion constraint during enemy kickoff, the
-        // shadowing robot will navigate to the closest point that it can to shadow, which
-        // might not be ideal. (i.e robot won't block a straight shot on net)
-        auto robot = Team::getNearestRobot(world_ptr->enemyTeam().getAllRobots(),
-                                           world_ptr->field().centerPoint());
-        if (robot.has_value())
+    // keeps track of the next defense position to assign
+    int defense_position_index = 0;
+    for (unsigned i = 0; i < defense_positions.size() - 1; ++i)
+    {
+        if (i < 2 && i < enemy_threats.size())
         {
-            int robot_id = robot.value().id();
-            enemy_team.removeRobotWithId(robot_id);
+            // Assign the first 2 robots to shadow enemies, if the enemies exist
+            auto enemy_threat = enemy_threats.at(i);
+            // Shadow with a distance slightly more than the distance from the enemy
+            // robot to the center line, so we are always just on our side of the
+            // center line
+            double shadow_dist = std::fabs(enemy_threat.robot.position().x()) +
+                                 2 * ROBOT_MAX_RADIUS_METERS;
+            // We shadow assuming the robots do not pass so we do not try block passes
+            // while shadowing, since we can't go on the enemy side to block the pass
+            // anyway
+            shadow_enemy_tactics.at(i)->updateControlParams(enemy_threat, shadow_dist);
+
+            result[0].emplace_back(shadow_enemy_tactics.at(i));
         }
         else
         {
-            LOG(WARNING) << "No Robot on the Field!";
+            // Once we are out of enemies to shadow, or are already shadowing 2
+            // enemies, we move the rest of the robots to the defense positions
+            // listed above
+            move_tactics.at(defense_position_index)
+                ->updateControlParams(defense_positions.at(defense_position_index),
+                                      Angle::zero(), 0);
+            result[0].emplace_back(move_tactics.at(defense_position_index));
+            defense_position_index++;
         }
+    }
 
-        auto enemy_threats =
-            getAllEnemyThreats(world_ptr->field(), world_ptr->friendlyTeam(),
-                               world_ptr->enemyTeam(), world_ptr->ball(), false);
-
-        PriorityTacticVector result = {{}};
+    // update robot 3 to be directly between the ball and the friendly net
+    move_tactics.at(defense_position_index)
+        ->updateControlParams(
+            calculateBlockCone(world_ptr->field().friendlyGoalpostPos(),
+                               world_ptr->field().friendlyGoalpostNeg(),
+                               world_ptr->field().centerPoint(),
+                               ROBOT_MAX_RADIUS_METERS),
+            Angle::zero(), 0, TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT);
+    result[0].emplace_back(move_tactics.at(defense_position_index));
 
-        // keeps track of the next defense position to assign
-        int defense_position_index = 0;
-        for (unsigned i = 0; i < defense_positions.size() - 1; ++i)
-        {
-            if (i < 2 && i < enemy_threats.size())
-            {
-                // Assign the first 2 robots to shadow enemies, if the enemies exist
-                auto enemy_threat = enemy_threats.at(i);
-                // Shadow with a distance slightly more than the distance from the enemy
-                // robot to the center line, so we are always just on our side of the
-                // center line
-                double shadow_dist = std::fabs(enemy_threat.robot.position().x()) +
-                                     2 * ROBOT_MAX_RADIUS_METERS;
-                // We shadow assuming the robots do not pass so we do not try block passes
-                // while shadowing, since we can't go on the enemy side to block the pass
-                // anyway
-                shadow_enemy_tactics.at(i)->updateControlParams(enemy_threat,
-                                                                shadow_dist);
-
-                result[0].emplace_back(shadow_enemy_tactics.at(i));
-            }
-            else
-            {
-                // Once we are out of enemies to shadow, or are already shadowing 2
-                // enemies, we move the rest of the robots to the defense positions
-                // listed above
-                move_tactics.at(defense_position_index)
-                    ->updateControlParams(defense_positions.at(defense_position_index),
-                                          Angle::zero(), 0);
-                result[0].emplace_back(move_tactics.at(defense_position_index));
-                defense_position_index++;
-            }
-        }
-
-        // update robot 3 to be directly between the ball and the friendly net
-        move_tactics.at(defense_position_index)
-            ->updateControlParams(
-                calculateBlockCone(world_ptr->field().friendlyGoalpostPos(),
-                                   world_ptr->field().friendlyGoalpostNeg(),
-                                   world_ptr->field().centerPoint(),
-                                   ROBOT_MAX_RADIUS_METERS),
-                Angle::zero(), 0, TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT);
-        result[0].emplace_back(move_tactics.at(defense_position_index));
+    // set the Tactics this Play wants to run, in order of priority
+    play_update.set_tactics(result);
+}
 
-        // yield the Tactics this Play wants to run, in order of priority
-        yield(result);
-    } while (true);
+void KickoffEnemyPlay::reset()
+{
+    Play::reset();
+    resetTactics(TacticVector(shadow_enemy_tactics.begin(), shadow_enemy_tactics.end()));
+    resetTactics(TacticVector(move_tactics.begin(), move_tactics.end()));
 }
 
 // Register this play in the genericFactory
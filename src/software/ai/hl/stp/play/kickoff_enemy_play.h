@@ -2,6 +2,8 @@
 
 #include "proto/parameters.pb.h"
 #include "software/ai/hl/stp/play/play.h"
+#include "software/ai/hl/stp/tactic/move/move_tactic.h"
+#include "software/ai/hl/stp/tactic/shadow_enemy/shadow_enemy_tactic.h"
 
 /**
  * A play that runs when its currently the enemies kick off,
@@ -14,6 +16,13 @@ class KickoffEnemyPlay : public Play
    public:
     KickoffEnemyPlay(TbotsProto::AiConfig config);
 
-    void getNextTactics(TacticCoroutine::push_type &yield,
-                        const WorldPtr &world_ptr) override;
+    void updateTactics(const PlayUpdate &play_update) override;
+    void reset() override;
+
+   private:
+    // 2 robots assigned to shadow enemies. Other robots will be assigned positions
+    // on the field to be evenly spread out
+    std::vector<std::shared_ptr<ShadowEnemyTactic>> shadow_enemy_tactics;
+    // these move tactics will be used to go to the defense positions
+    std::vector<std::shared_ptr<MoveTactic>> move_tactics;
 };
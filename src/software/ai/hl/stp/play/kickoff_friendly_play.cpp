@@ -1,18 +1,26 @@
 #include "software/ai/hl/stp/play/kickoff_friendly_play.h"
 
 #include "shared/constants.h"
-#include "software/ai/evaluation/enemy_threat.h"
 #include "software/ai/hl/stp/tactic/chip/chip_tactic.h"
 #include "software/ai/hl/stp/tactic/move/move_tactic.h"
 #include "software/util/generic_factory/generic_factory.h"
 
-KickoffFriendlyPlay::KickoffFriendlyPlay(TbotsProto::AiConfig config) : Play(config, true)
+KickoffFriendlyPlay::KickoffFriendlyPlay(TbotsProto::AiConfig config)
+    : Play(config, true),
+      move_tactics({std::make_shared<PrepareKickoffMoveTactic>(),
+                    std::make_shared<MoveTactic>(), std::make_shared<MoveTactic>(),
+                    std::make_shared<MoveTactic>(), std::make_shared<MoveTactic>()}),
+      kickoff_chip_tactic(std::make_shared<KickoffChipTactic>())
 {
+    // set the requirement that Robot 1 must be able to kick and chip
+    move_tactics.at(0)->mutableRobotCapabilityRequirements() = {RobotCapability::Kick,
+                                                                RobotCapability::Chip};
 }
 
-void KickoffFriendlyPlay::getNextTactics(TacticCoroutine::push_type &yield,
-                                         const WorldPtr &world_ptr)
+void KickoffFriendlyPlay::updateTactics(const PlayUpdate &play_update)
 {
+    const WorldPtr &world_ptr = play_update.world_ptr;
+
     // Since we only have 6 robots at the maximum, the number one priority
     // is the robot doing the kickoff up front. The goalie is the second most
     // important, followed by 3 and 4 setup for offense. 5 and 6 will stay
@@ -67,28 +75,11 @@ void KickoffFriendlyPlay::getNextTactics(TacticCoroutine::push_type &yield,
               world_ptr->field().friendlyGoalpostNeg().y()),
     };
 
-    // move tactics to use to move to positions defined above
-    std::vector<std::shared_ptr<MoveTactic>> move_tactics = {
-        std::make_shared<PrepareKickoffMoveTactic>(), std::make_shared<MoveTactic>(),
-        std::make_shared<MoveTactic>(), std::make_shared<MoveTactic>(),
-        std::make_shared<MoveTactic>()};
-
-    // specific tactics
-    auto kickoff_chip_tactic = std::make_shared<KickoffChipTactic>();
+    PriorityTacticVector result = {{}};
 
-    // Part 1: setup state (move to key positions)
-    while (world_ptr->gameState().isSetupState())
+    if (world_ptr->gameState().isSetupState())
     {
-        auto enemy_threats =
-            getAllEnemyThreats(world_ptr->field(), world_ptr->friendlyTeam(),
-                               world_ptr->enemyTeam(), world_ptr->ball(), false);
-
-        PriorityTacticVector result = {{}};
-
-        // set the requirement that Robot 1 must be able to kick and chip
-        move_tactics.at(0)->mutableRobotCapabilityRequirements() = {
-            RobotCapability::Kick, RobotCapability::Chip};
-
+        // Part 1: setup state (move to key positions)
         // setup 5 kickoff positions in order of priority
         for (unsigned i = 0; i < kickoff_setup_positions.size(); i++)
         {
@@ -96,20 +87,10 @@ void KickoffFriendlyPlay::getNextTactics(TacticCoroutine::push_type &yield,
                                                     Angle::zero(), 0);
             result[0].emplace_back(move_tactics.at(i));
         }
-
-        // yield the Tactics this Play wants to run, in order of priority
-        yield(result);
     }
-
-    // Part 2: not normal play, currently ready state (chip the ball)
-    while (!world_ptr->gameState().isPlaying())
+    else if (!world_ptr->gameState().isPlaying())
     {
-        auto enemy_threats =
-            getAllEnemyThreats(world_ptr->field(), world_ptr->friendlyTeam(),
-                               world_ptr->enemyTeam(), world_ptr->ball(), false);
-
-        PriorityTacticVector result = {{}};
-
+        // Part 2: not normal play, currently ready state (chip the ball)
         // TODO (#2612): This needs to be adjusted post field testing, ball needs to land
         // exactly in the middle of the enemy field
         kickoff_chip_tactic->updateControlParams(
@@ -126,10 +107,17 @@ void KickoffFriendlyPlay::getNextTactics(TacticCoroutine::push_type &yield,
                                                     Angle::zero(), 0);
             result[0].emplace_back(move_tactics.at(i));
         }
-
-        // yield the Tactics this Play wants to run, in order of priority
-        yield(result);
     }
+
+    // set the Tactics this Play wants to run, in order of priority
+    play_update.set_tactics(result);
+}
+
+void KickoffFriendlyPlay::reset()
+{
+    Play::reset();
+    resetTactics(TacticVector(move_tactics.begin(), move_tactics.end()));
+    resetTactics({kickoff_chip_tactic});
 }
 
 
@@ -2,6 +2,8 @@
 
 #include "proto/parameters.pb.h"
 #include "software/ai/hl/stp/play/play.h"
+#include "software/ai/hl/stp/tactic/chip/chip_tactic.h"
+#include "software/ai/hl/stp/tactic/move/move_tactic.h"
 
 /**
  * A play that runs when its currently the friendly kick off,
@@ -12,6 +14,11 @@ class KickoffFriendlyPlay : public Play
    public:
     KickoffFriendlyPlay(TbotsProto::AiConfig config);
 
-    void getNextTactics(TacticCoroutine::push_type &yield,
-                        const WorldPtr &world_ptr) override;
+    void updateTactics(const PlayUpdate &play_update) override;
+    void reset() override;
+
+   private:
+    // move tactics to use to move to the kickoff setup positions
+    std::vector<std::shared_ptr<MoveTactic>> move_tactics;
+    std::shared_ptr<KickoffChipTactic> kickoff_chip_tactic;
 };
@@ -5,24 +5,27 @@
 #include "software/util/generic_factory/generic_factory.h"
 
 OffensePlay::OffensePlay(TbotsProto::AiConfig config)
-    : Play(config, true), fsm{OffensePlayFSM{config}}, control_params{}
+    : Play(config, true),
+      shoot_or_pass_play(std::make_shared<ShootOrPassPlay>(config)),
+      defense_play(std::make_shared<DefensePlay>(config)),
+      initial_fsm(config, shoot_or_pass_play, defense_play),
+      fsm(std::in_place, initial_fsm),
+      control_params{}
 {
 }
 
-void OffensePlay::getNextTactics(TacticCoroutine::push_type &yield,
-                                 const WorldPtr &world_ptr)
+void OffensePlay::updateTactics(const PlayUpdate &play_update)
 {
-    // This function doesn't get called, it should be removed once coroutines
-    // are phased out
-    while (true)
-    {
-        yield({{}});
-    }
+    fsm->process_event(OffensePlayFSM::Update(control_params, play_update));
 }
 
-void OffensePlay::updateTactics(const PlayUpdate &play_update)
+void OffensePlay::reset()
 {
-    fsm.process_event(OffensePlayFSM::Update(control_params, play_update));
+    Play::reset();
+    shoot_or_pass_play->reset();
+    defense_play->reset();
+    fsm.emplace(initial_fsm);
+    control_params = {};
 }
 
 // Register this play in the genericFactory
@@ -13,11 +13,14 @@ class OffensePlay : public Play
    public:
     OffensePlay(TbotsProto::AiConfig config);
 
-    void getNextTactics(TacticCoroutine::push_type &yield,
-                        const WorldPtr &world_ptr) override;
     void updateTactics(const PlayUpdate &play_update) override;
+    void reset() override;
 
    private:
-    FSM<OffensePlayFSM> fsm;
+    // Kept between resets of the play, since creating them is slow
+    std::shared_ptr<ShootOrPassPlay> shoot_or_pass_play;
+    std::shared_ptr<DefensePlay> defense_play;
+    OffensePlayFSM initial_fsm;
+    std::optional<FSM<OffensePlayFSM>> fsm;
     OffensePlayFSM::ControlParams control_params;
 };
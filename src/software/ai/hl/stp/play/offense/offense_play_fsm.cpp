@@ -1,9 +1,11 @@
 #include "software/ai/hl/stp/play/offense/offense_play_fsm.h"
 
-OffensePlayFSM::OffensePlayFSM(TbotsProto::AiConfig ai_config)
+OffensePlayFSM::OffensePlayFSM(TbotsProto::AiConfig ai_config,
+                               std::shared_ptr<ShootOrPassPlay> shoot_or_pass_play,
+                               std::shared_ptr<DefensePlay> defense_play)
     : ai_config(ai_config),
-      shoot_or_pass_play(std::make_shared<ShootOrPassPlay>(ai_config)),
-      defense_play(std::make_shared<DefensePlay>(ai_config))
+      shoot_or_pass_play(shoot_or_pass_play),
+      defense_play(defense_play)
 {
 }
 
@@ -20,11 +20,16 @@ struct OffensePlayFSM
     DEFINE_PLAY_UPDATE_STRUCT_WITH_CONTROL_AND_COMMON_PARAMS
 
     /**
-     * Creates an offense play FSM
+     * Creates an offense play FSM that runs the given plays, so that the plays can be
+     * kept when the FSM is recreated
      *
      * @param ai_config the play config for this play FSM
+     * @param shoot_or_pass_play the play to run with the attackers
+     * @param defense_play the play to run with the defenders
      */
-    explicit OffensePlayFSM(TbotsProto::AiConfig ai_config);
+    explicit OffensePlayFSM(TbotsProto::AiConfig ai_config,
+                            std::shared_ptr<ShootOrPassPlay> shoot_or_pass_play,
+                            std::shared_ptr<DefensePlay> defense_play);
 
     /**
      * Guard to check whether the enemy team has possession of the ball
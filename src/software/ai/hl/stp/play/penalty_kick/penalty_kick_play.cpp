@@ -5,26 +5,30 @@
 #include "software/util/generic_factory/generic_factory.h"
 
 PenaltyKickPlay::PenaltyKickPlay(TbotsProto::AiConfig config)
-    : Play(config, true), fsm{PenaltyKickPlayFSM{config}}, control_params{}
+    : Play(config, true),
+      initial_fsm(config),
+      fsm(std::in_place, initial_fsm),
+      control_params{}
 {
 }
 
-void PenaltyKickPlay::getNextTactics(TacticCoroutine::push_type &yield,
-                                     const WorldPtr &world_ptr)
+void PenaltyKickPlay::updateTactics(const PlayUpdate &play_update)
 {
-    // This function doesn't get called, it should be removed once coroutines are phased
-    // out
+    fsm->process_event(PenaltyKickPlayFSM::Update(control_params, play_update));
 }
 
-void PenaltyKickPlay::updateTactics(const PlayUpdate &play_update)
+void PenaltyKickPlay::reset()
 {
-    fsm.process_event(PenaltyKickPlayFSM::Update(control_params, play_update));
+    Play::reset();
+    resetTactics(initial_fsm.getTactics());
+    fsm.emplace(initial_fsm);
+    control_params = {};
 }
 
 std::vector<std::string> PenaltyKickPlay::getState()
 {
     std::vector<std::string> state;
-    state.emplace_back(objectTypeName(*this) + " - " + getCurrentFullStateName(fsm));
+    state.emplace_back(objectTypeName(*this) + " - " + getCurrentFullStateName(*fsm));
     return state;
 }
 
@@ -12,12 +12,12 @@ class PenaltyKickPlay : public Play
    public:
     PenaltyKickPlay(TbotsProto::AiConfig config);
 
-    void getNextTactics(TacticCoroutine::push_type &yield,
-                        const WorldPtr &world_ptr) override;
     void updateTactics(const PlayUpdate &play_update) override;
+    void reset() override;
     std::vector<std::string> getState() override;
 
    private:
-    FSM<PenaltyKickPlayFSM> fsm;
+    PenaltyKickPlayFSM initial_fsm;
+    std::optional<FSM<PenaltyKickPlayFSM>> fsm;
     PenaltyKickPlayFSM::ControlParams control_params;
 };
@@ -7,6 +7,11 @@ PenaltyKickPlayFSM::PenaltyKickPlayFSM(TbotsProto::AiConfig ai_config)
 {
 }
 
+TacticVector PenaltyKickPlayFSM::getTactics() const
+{
+    return {penalty_kick_tactic};
+}
+
 void PenaltyKickPlayFSM::performKick(const Update &event)
 {
     PriorityTacticVector tactics_to_run = {{}};
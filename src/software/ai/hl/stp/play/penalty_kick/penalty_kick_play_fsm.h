@@ -27,6 +27,14 @@ struct PenaltyKickPlayFSM
      */
     explicit PenaltyKickPlayFSM(TbotsProto::AiConfig ai_config);
 
+    /**
+     * Gets the tactics this FSM creates when it is constructed. Copies of the FSM share
+     * these tactics
+     *
+     * @return the tactics
+     */
+    TacticVector getTactics() const;
+
     /**
      * Action to set up the robots in position to start the penalty kick
      *
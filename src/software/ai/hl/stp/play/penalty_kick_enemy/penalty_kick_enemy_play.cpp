@@ -5,27 +5,28 @@
 
 PenaltyKickEnemyPlay::PenaltyKickEnemyPlay(TbotsProto::AiConfig config)
     : Play(config, true),
-      fsm{PenaltyKickEnemyPlayFSM{config}},
+      initial_fsm(config),
+      fsm(std::in_place, initial_fsm),
       control_params{.goalie_tactic = goalie_tactic}
 {
 }
 
-void PenaltyKickEnemyPlay::getNextTactics(TacticCoroutine::push_type &yield,
-                                          const WorldPtr &world_ptr)
+void PenaltyKickEnemyPlay::updateTactics(const PlayUpdate &play_update)
 {
-    // This function doesn't get called, it should be removed once coroutines
-    // are phased out
+    fsm->process_event(PenaltyKickEnemyPlayFSM::Update(control_params, play_update));
 }
 
-void PenaltyKickEnemyPlay::updateTactics(const PlayUpdate &play_update)
+void PenaltyKickEnemyPlay::reset()
 {
-    fsm.process_event(PenaltyKickEnemyPlayFSM::Update(control_params, play_update));
+    Play::reset();
+    fsm.emplace(initial_fsm);
+    control_params = {.goalie_tactic = goalie_tactic};
 }
 
 std::vector<std::string> PenaltyKickEnemyPlay::getState()
 {
     std::vector<std::string> state;
-    state.emplace_back(objectTypeName(*this) + " - " + getCurrentFullStateName(fsm));
+    state.emplace_back(objectTypeName(*this) + " - " + getCurrentFullStateName(*fsm));
     return state;
 }
 
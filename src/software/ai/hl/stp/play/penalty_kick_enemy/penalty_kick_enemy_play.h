@@ -12,12 +12,12 @@ class PenaltyKickEnemyPlay : public Play
    public:
     PenaltyKickEnemyPlay(TbotsProto::AiConfig config);
 
-    void getNextTactics(TacticCoroutine::push_type &yield,
-                        const WorldPtr &world_ptr) override;
     void updateTactics(const PlayUpdate &play_update) override;
+    void reset() override;
     std::vector<std::string> getState() override;
 
    private:
-    FSM<PenaltyKickEnemyPlayFSM> fsm;
+    PenaltyKickEnemyPlayFSM initial_fsm;
+    std::optional<FSM<PenaltyKickEnemyPlayFSM>> fsm;
     PenaltyKickEnemyPlayFSM::ControlParams control_params;
 };
@@ -1,7 +1,5 @@
 #pragma once
 
-#include <boost/bind.hpp>
-#include <boost/coroutine2/all.hpp>
 #include <vector>
 
 #include "proto/parameters.pb.h"
@@ -10,9 +8,6 @@
 #include "software/ai/hl/stp/tactic/tactic.h"
 #include "software/ai/navigator/trajectory/trajectory_planner.h"
 
-// This coroutine returns a list of list of shared_ptrs to Tactic objects
-using TacticCoroutine = boost::coroutines2::coroutine<PriorityTacticVector>;
-
 /**
  * In the STP framework, a Play is a collection of tactics that represent some
  * "team-wide" goal. It can be thought of like a traditional play in soccer.
@@ -72,6 +67,17 @@ class Play
      */
     virtual std::vector<std::string> getState();
 
+    /**
+     * Resets the Play to the state it was in when it was created, so that it can be run
+     * again from the start without creating a new Play. Plays must override this to
+     * reset their own state (ex. their FSM or stage) and tactics as well.
+     *
+     * Tactics are reset in place with resetTactics rather than created again. Plays with
+     * an FSM keep the FSM struct they were created with and reset their FSM to a copy of
+     * it, which shares its tactics
+     */
+    virtual void reset();
+
    protected:
     // The Play configuration
     TbotsProto::AiConfig ai_config;
@@ -86,14 +92,21 @@ class Play
     TbotsProto::ObstacleList obstacle_list;
     TbotsProto::PathVisualization path_visualization;
 
-    // TODO (#2359): make pure virtual once all plays are not coroutines
     /**
      * Updates the priority tactic vector with new tactics
      *
      * @param play_update The PlayUpdate struct that contains all the information for
      * updating the tactics
      */
-    virtual void updateTactics(const PlayUpdate& play_update);
+    virtual void updateTactics(const PlayUpdate& play_update) = 0;
+
+    /**
+     * Resets the given tactics so that their FSMs start over the next time they are
+     * run, just like newly created tactics
+     *
+     * @param tactics The tactics to reset
+     */
+    static void resetTactics(const TacticVector& tactics);
 
    private:
     /**
@@ -112,78 +125,12 @@ class Play
     assignTactics(const WorldPtr& world_ptr, TacticVector tactic_vector,
                   const std::vector<Robot>& robots_to_assign);
 
-    /**
-     * Returns a list of shared_ptrs to the Tactics the Play wants to run at this time, in
-     * order of priority. The Tactic at the beginning of the vector has the highest
-     * priority, and the Tactic at the end has the lowest priority.
-     *
-     * shared_ptrs are used so that the Play can own the objects (and have control over
-     * updating the Tactic parameters, etc), but callers of this function can still
-     * access their updated state. Using unique_ptrs wouldn't allow the Play to maintain
-     * the Tactic's state because the objects would have to be constructed and moved every
-     * time the function is called.
-     *
-     * TODO (#2359): delete once all plays are not coroutines
-     *
-     * @param world The current state of the world
-     * @return A list of shared_ptrs to the Tactics the Play wants to run at this time, in
-     * order of priority
-     */
-    PriorityTacticVector getTactics(const WorldPtr& world_ptr);
-
-    /**
-     * A wrapper function for the getNextTactics function.
-     *
-     * This function exists because when the coroutine (tactic_sequence) is first
-     * constructed the coroutine is called/entered. This would normally cause the
-     * getNextTactics to be run once and potentially return incorrect results
-     * due to default constructed values.
-     *
-     * This wrapper function will yield an empty vector the first time it's called and
-     * otherwise use the getNextTactics function. This first "empty" value will never
-     * be seen/used by the rest of the system since this will be during construction,
-     * and the coroutine will be called again with valid parameters before any values are
-     * returned. This effectively "shields" the logic from any errors caused by default
-     * values during construction.
-     *
-     * This function yields a list of shared_ptrs to the Tactics the Play wants to run at
-     * this time, in order of priority. This yield happens in place of a return.
-     *
-     * TODO (#2359): delete once all plays are not coroutines
-     *
-     * @param yield The coroutine push_type for the Play
-     */
-    void getNextTacticsWrapper(TacticCoroutine::push_type& yield);
-
-    /**
-     * This function yields a list of shared_ptrs to the Tactics the Play wants to run at
-     * this time, in order of priority. This yield happens in place of a return.
-     *
-     * TODO (#2359): delete once all plays are not coroutines
-     *
-     * @param yield The coroutine push_type for the Play
-     * @param world The current state of the world
-     */
-    virtual void getNextTactics(TacticCoroutine::push_type& yield,
-                                const WorldPtr& world_ptr) = 0;
-
     // Stop tactic common to all plays for robots that don't have tactics assigned
     TacticVector stop_tactics;
 
     // Whether this play requires a goalie
     const bool requires_goalie;
 
-    // TODO (#2359): remove this
-    // The coroutine that sequentially returns the Tactics the Play wants to run
-    TacticCoroutine::pull_type tactic_sequence;
-
-    // TODO (#2359): remove this
-    // The Play's knowledge of the most up-to-date World
-    std::optional<WorldPtr> world_ptr_;
-
-    // TODO (#2359): remove this
-    PriorityTacticVector priority_tactics;
-
     uint64_t sequence_number = 0;
 
     RobotNavigationObstacleFactory obstacle_factory;
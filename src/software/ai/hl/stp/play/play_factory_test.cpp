@@ -2,6 +2,9 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+
+#include "software/test_util/test_util.h"
 #include "software/util/typename/typename.h"
 
 class PlayFactoryTest : public testing::Test
@@ -17,3 +20,46 @@ TEST_F(PlayFactoryTest, test_shoot_or_pass_play)
     std::unique_ptr<Play> play = createPlay(play_proto, ai_config);
     EXPECT_EQ(objectTypeName(*play), "ShootOrPassPlay");
 }
+
+TEST_F(PlayFactoryTest, DISABLED_per_tick_play_overhead_speed_test)
+{
+    const unsigned int num_ticks = 1000;
+
+    std::shared_ptr<World> world = TestUtil::createBlankTestingWorld();
+    TestUtil::setFriendlyRobotPositions(
+        world,
+        {Point(-4, 0), Point(-3, 1), Point(-3, -1), Point(-1, 2), Point(-1, -2),
+         Point(1, 0)},
+        Timestamp::fromSeconds(0));
+    TestUtil::setEnemyRobotPositions(
+        world,
+        {Point(4, 0), Point(3, 1), Point(3, -1), Point(1, 2), Point(1, -2),
+         Point(0.5, 0.5)},
+        Timestamp::fromSeconds(0));
+
+    for (int i = TbotsProto::PlayName_MIN; i <= TbotsProto::PlayName_MAX; i++)
+    {
+        if (!TbotsProto::PlayName_IsValid(i) ||
+            i == TbotsProto::PlayName::UseAiSelection)
+        {
+            continue;
+        }
+
+        TbotsProto::Play play_proto = TbotsProto::Play();
+        play_proto.set_name(static_cast<TbotsProto::PlayName>(i));
+        std::unique_ptr<Play> play = createPlay(play_proto, ai_config);
+
+        auto start_time = std::chrono::system_clock::now();
+        for (unsigned int tick = 0; tick < num_ticks; tick++)
+        {
+            play->get(world, InterPlayCommunication{}, [](InterPlayCommunication) {});
+        }
+        double time_per_tick_ms = std::chrono::duration<double, std::milli>(
+                                      std::chrono::system_clock::now() - start_time)
+                                      .count() /
+                                  num_ticks;
+
+        std::cout << TbotsProto::PlayName_Name(play_proto.name()) << " took "
+                  << time_per_tick_ms << "ms per tick" << std::endl;
+    }
+}
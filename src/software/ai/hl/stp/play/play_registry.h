@@ -0,0 +1,82 @@
+#pragma once
+
+#include <memory>
+#include <typeindex>
+#include <unordered_map>
+
+#include "proto/parameters.pb.h"
+#include "software/ai/hl/stp/play/play.h"
+
+/**
+ * Keeps one instance of each type of play, so that switching to a play only has to
+ * reset it instead of creating it.
+ *
+ * Creating a play creates all of its tactics (ex. a StopTactic for every robot id and
+ * a GoalieTactic), which makes the tick on which the AI switches plays, such as at a
+ * kickoff or free kick, noticeably slower than the others. The plays are created ahead
+ * of time with prepare(), when the registry is created for a new config
+ */
+class PlayRegistry
+{
+   public:
+    /**
+     * Creates a new PlayRegistry with no plays
+     *
+     * @param ai_config The AI config to create the plays with
+     */
+    explicit PlayRegistry(const TbotsProto::AiConfig &ai_config) : ai_config(ai_config)
+    {
+    }
+
+    /**
+     * Creates the play of the given type, if it has not been created already
+     *
+     * @tparam PlayType The type of the play
+     */
+    template <class PlayType>
+    void prepare()
+    {
+        getPlay<PlayType>();
+    }
+
+    /**
+     * Resets the play of the given type to its initial state, creating it if it was
+     * never prepared
+     *
+     * NOTE: The play must not be running when it is activated, since resetting it
+     * restarts it
+     *
+     * @tparam PlayType The type of the play
+     *
+     * @return the reset play
+     */
+    template <class PlayType>
+    std::shared_ptr<Play> activate()
+    {
+        std::shared_ptr<Play> &play = getPlay<PlayType>();
+        play->reset();
+        return play;
+    }
+
+   private:
+    /**
+     * Gets the play of the given type, creating it if it has not been created already
+     *
+     * @tparam PlayType The type of the play
+     *
+     * @return the play of the given type
+     */
+    template <class PlayType>
+    std::shared_ptr<Play> &getPlay()
+    {
+        std::shared_ptr<Play> &play = plays[std::type_index(typeid(PlayType))];
+        if (!play)
+        {
+            play = std::make_shared<PlayType>(ai_config);
+        }
+        return play;
+    }
+
+    TbotsProto::AiConfig ai_config;
+    std::unordered_map<std::type_index, std::shared_ptr<Play>> plays;
+};
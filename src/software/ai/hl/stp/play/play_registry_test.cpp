@@ -0,0 +1,36 @@
+#include "software/ai/hl/stp/play/play_registry.h"
+
+#include <gtest/gtest.h>
+
+#include "software/ai/hl/stp/play/ball_placement/ball_placement_play.h"
+#include "software/ai/hl/stp/play/halt_play.h"
+#include "software/test_util/test_util.h"
+
+TEST(PlayRegistryTest, activating_play_again_resets_its_fsm)
+{
+    std::shared_ptr<World> world = ::TestUtil::createBlankTestingWorld();
+    ::TestUtil::setFriendlyRobotPositions(
+        world, {Point(-4, 0), Point(-3, 1), Point(-3, -1), Point(-1, 2)},
+        Timestamp::fromSeconds(0));
+    // ball starts within the field lines, away from the ball placement point
+    world->updateBall(Ball(Point(2, 2), Vector(0, 0), Timestamp::fromSeconds(0)));
+    GameState game_state;
+    game_state.updateRefereeCommand(RefereeCommand::STOP);
+    game_state.setBallPlacementPoint(Point(0, 0));
+    world->updateGameState(game_state);
+
+    PlayRegistry play_registry(TbotsProto::AiConfig{});
+    std::shared_ptr<Play> ball_placement_play =
+        play_registry.activate<BallPlacementPlay>();
+    const std::vector<std::string> initial_state = ball_placement_play->getState();
+
+    ball_placement_play->get(world, InterPlayCommunication{},
+                             [](InterPlayCommunication) {});
+    EXPECT_NE(initial_state, ball_placement_play->getState());
+
+    play_registry.activate<HaltPlay>()->get(world, InterPlayCommunication{},
+                                            [](InterPlayCommunication) {});
+
+    EXPECT_EQ(ball_placement_play, play_registry.activate<BallPlacementPlay>());
+    EXPECT_EQ(initial_state, ball_placement_play->getState());
+}
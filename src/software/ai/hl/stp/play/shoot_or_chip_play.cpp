@@ -14,10 +14,21 @@
 #include "software/util/generic_factory/generic_factory.h"
 #include "software/world/game_state.h"
 
-ShootOrChipPlay::ShootOrChipPlay(TbotsProto::AiConfig config) : Play(config, true) {}
+ShootOrChipPlay::ShootOrChipPlay(TbotsProto::AiConfig config)
+    : Play(config, true),
+      crease_defender_tactics({
+          std::make_shared<CreaseDefenderTactic>(
+              config.robot_navigation_obstacle_config()),
+          std::make_shared<CreaseDefenderTactic>(
+              config.robot_navigation_obstacle_config()),
+      }),
+      move_to_open_area_tactics(
+          {std::make_shared<MoveTactic>(), std::make_shared<MoveTactic>()}),
+      attacker(std::make_shared<AttackerTactic>(config))
+{
+}
 
-void ShootOrChipPlay::getNextTactics(TacticCoroutine::push_type &yield,
-                                     const WorldPtr &world_ptr)
+void ShootOrChipPlay::updateTactics(const PlayUpdate &play_update)
 {
     /**
      * Our general strategy here is:
@@ -29,77 +40,69 @@ void ShootOrChipPlay::getNextTactics(TacticCoroutine::push_type &yield,
      *   robot, it will chip to right in front of the robot in the largest open free area
      */
 
-    std::array<std::shared_ptr<CreaseDefenderTactic>, 2> crease_defender_tactics = {
-        std::make_shared<CreaseDefenderTactic>(
-            ai_config.robot_navigation_obstacle_config()),
-        std::make_shared<CreaseDefenderTactic>(
-            ai_config.robot_navigation_obstacle_config()),
-    };
-
-    std::array<std::shared_ptr<MoveTactic>, 2> move_to_open_area_tactics = {
-        std::make_shared<MoveTactic>(), std::make_shared<MoveTactic>()};
-
-    // Figure out where the fallback chip target is
-    // Experimentally determined to be a reasonable value
-    double fallback_chip_target_x_offset = 1.5;
+    const WorldPtr &world_ptr = play_update.world_ptr;
 
-    Point fallback_chip_target =
-        world_ptr->field().enemyGoalCenter() - Vector(fallback_chip_target_x_offset, 0);
-
-    auto attacker = std::make_shared<AttackerTactic>(ai_config);
-    attacker->updateControlParams(fallback_chip_target);
-
-    do
+    // Start over once the attacker has taken its shot or chip
+    if (attacker->done())
     {
-        PriorityTacticVector result = {{}};
-
-        // Update crease defenders
-        std::get<0>(crease_defender_tactics)
-            ->updateControlParams(world_ptr->ball().position(),
-                                  TbotsProto::CreaseDefenderAlignment::LEFT);
-        result[0].emplace_back(std::get<0>(crease_defender_tactics));
-        std::get<1>(crease_defender_tactics)
-            ->updateControlParams(world_ptr->ball().position(),
-                                  TbotsProto::CreaseDefenderAlignment::RIGHT);
-        result[0].emplace_back(std::get<1>(crease_defender_tactics));
-
-        // Update tactics moving to open areas
-        std::vector<Point> enemy_robot_points;
-        for (auto const &robot : world_ptr->enemyTeam().getAllRobots())
-        {
-            enemy_robot_points.emplace_back(robot.position());
-        }
-        std::vector<Circle> chip_targets = findGoodChipTargets(*world_ptr);
-        for (unsigned i = 0;
-             i < chip_targets.size() && i < move_to_open_area_tactics.size(); i++)
-        {
-            // Face towards the ball
-            Angle orientation =
-                (world_ptr->ball().position() - chip_targets[i].origin()).orientation();
-            // Move a bit backwards to make it more likely we'll receive the chip
-            Point position =
-                chip_targets[i].origin() -
-                Vector::createFromAngle(orientation).normalize(ROBOT_MAX_RADIUS_METERS);
-            ;
-            move_to_open_area_tactics[i]->updateControlParams(position, orientation, 0.0);
-            result[0].emplace_back(move_to_open_area_tactics[i]);
-        }
+        restart();
+    }
+
+    PriorityTacticVector result = {{}};
+
+    // Update crease defenders
+    std::get<0>(crease_defender_tactics)
+        ->updateControlParams(world_ptr->ball().position(),
+                              TbotsProto::CreaseDefenderAlignment::LEFT);
+    result[0].emplace_back(std::get<0>(crease_defender_tactics));
+    std::get<1>(crease_defender_tactics)
+        ->updateControlParams(world_ptr->ball().position(),
+                              TbotsProto::CreaseDefenderAlignment::RIGHT);
+    result[0].emplace_back(std::get<1>(crease_defender_tactics));
+
+    // Update tactics moving to open areas
+    std::vector<Circle> chip_targets = findGoodChipTargets(*world_ptr);
+    for (unsigned i = 0;
+         i < chip_targets.size() && i < move_to_open_area_tactics.size(); i++)
+    {
+        // Face towards the ball
+        Angle orientation =
+            (world_ptr->ball().position() - chip_targets[i].origin()).orientation();
+        // Move a bit backwards to make it more likely we'll receive the chip
+        Point position =
+            chip_targets[i].origin() -
+            Vector::createFromAngle(orientation).normalize(ROBOT_MAX_RADIUS_METERS);
+        move_to_open_area_tactics[i]->updateControlParams(position, orientation, 0.0);
+        result[0].emplace_back(move_to_open_area_tactics[i]);
+    }
+
+    // Update chipper
+    std::optional<Point> chip_target = std::nullopt;
+    if (!chip_targets.empty())
+    {
+        chip_target = chip_targets[0].origin();
+    }
+    attacker->updateControlParams(chip_target);
 
-        // Update chipper
-        std::optional<Point> chip_target = std::nullopt;
-        if (!chip_targets.empty())
-        {
-            chip_target = chip_targets[0].origin();
-        }
-        attacker->updateControlParams(chip_target);
+    // We want this second in priority only to the goalie
+    result[0].insert(result[0].begin() + 1, attacker);
 
-        // We want this second in priority only to the goalie
-        result[0].insert(result[0].begin() + 1, attacker);
+    // set the Tactics this Play wants to run, in order of priority
+    play_update.set_tactics(result);
+}
 
-        // yield the Tactics this Play wants to run, in order of priority
-        yield(result);
+void ShootOrChipPlay::reset()
+{
+    Play::reset();
+    restart();
+}
 
-    } while (!attacker->done());
+void ShootOrChipPlay::restart()
+{
+    resetTactics({std::get<0>(crease_defender_tactics),
+                  std::get<1>(crease_defender_tactics),
+                  std::get<0>(move_to_open_area_tactics),
+                  std::get<1>(move_to_open_area_tactics), attacker});
 }
 
 // Register this play in the genericFactory
@@ -2,6 +2,9 @@
 
 #include "proto/parameters.pb.h"
 #include "software/ai/hl/stp/play/play.h"
+#include "software/ai/hl/stp/tactic/attacker/attacker_tactic.h"
+#include "software/ai/hl/stp/tactic/crease_defender/crease_defender_tactic.h"
+#include "software/ai/hl/stp/tactic/move/move_tactic.h"
 
 /**
  * The Defense Play tries to grab the ball from the enemy that has it, and all other
@@ -12,6 +15,17 @@ class ShootOrChipPlay : public Play
    public:
     ShootOrChipPlay(TbotsProto::AiConfig config);
 
-    void getNextTactics(TacticCoroutine::push_type &yield,
-                        const WorldPtr &world_ptr) override;
+    void updateTactics(const PlayUpdate &play_update) override;
+    void reset() override;
+
+   private:
+    /**
+     * Starts the play over with reset tactics, which happens once the attacker has
+     * taken its shot or chip
+     */
+    void restart();
+
+    std::array<std::shared_ptr<CreaseDefenderTactic>, 2> crease_defender_tactics;
+    std::array<std::shared_ptr<MoveTactic>, 2> move_to_open_area_tactics;
+    std::shared_ptr<AttackerTactic> attacker;
 };
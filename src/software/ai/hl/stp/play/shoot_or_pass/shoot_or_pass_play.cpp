@@ -6,29 +6,34 @@
 #include "software/util/generic_factory/generic_factory.h"
 
 ShootOrPassPlay::ShootOrPassPlay(TbotsProto::AiConfig config)
-    : Play(config, true), fsm{ShootOrPassPlayFSM{config}}, control_params{}
+    : Play(config, true),
+      pass_generator(std::make_shared<PassGenerator<EighteenZoneId>>(
+          std::make_shared<const EighteenZonePitchDivision>(
+              Field::createSSLDivisionBField()),
+          config.passing_config())),
+      initial_fsm(config, pass_generator),
+      fsm(std::in_place, initial_fsm),
+      control_params{}
 {
 }
 
-void ShootOrPassPlay::getNextTactics(TacticCoroutine::push_type &yield,
-                                     const WorldPtr &world_ptr)
+void ShootOrPassPlay::updateTactics(const PlayUpdate &play_update)
 {
-    // This function doesn't get called so it does nothing
-    while (true)
-    {
-        yield({{}});
-    }
+    fsm->process_event(ShootOrPassPlayFSM::Update(control_params, play_update));
 }
 
-void ShootOrPassPlay::updateTactics(const PlayUpdate &play_update)
+void ShootOrPassPlay::reset()
 {
-    fsm.process_event(ShootOrPassPlayFSM::Update(control_params, play_update));
+    Play::reset();
+    resetTactics(initial_fsm.getTactics());
+    fsm.emplace(initial_fsm);
+    control_params = {};
 }
 
 std::vector<std::string> ShootOrPassPlay::getState()
 {
     std::vector<std::string> state;
-    state.emplace_back(objectTypeName(*this) + " - " + getCurrentFullStateName(fsm));
+    state.emplace_back(objectTypeName(*this) + " - " + getCurrentFullStateName(*fsm));
     return state;
 }
 
@@ -12,12 +12,14 @@ class ShootOrPassPlay : public Play
    public:
     ShootOrPassPlay(TbotsProto::AiConfig config);
 
-    void getNextTactics(TacticCoroutine::push_type &yield,
-                        const WorldPtr &world_ptr) override;
     void updateTactics(const PlayUpdate &play_update) override;
+    void reset() override;
     std::vector<std::string> getState() override;
 
    private:
-    FSM<ShootOrPassPlayFSM> fsm;
+    // Kept between resets of the play, since creating a pass generator is slow
+    std::shared_ptr<PassGenerator<EighteenZoneId>> pass_generator;
+    ShootOrPassPlayFSM initial_fsm;
+    std::optional<FSM<ShootOrPassPlayFSM>> fsm;
     ShootOrPassPlayFSM::ControlParams control_params;
 };
@@ -4,14 +4,22 @@
 #include <algorithm>
 
 ShootOrPassPlayFSM::ShootOrPassPlayFSM(const TbotsProto::AiConfig& ai_config)
+    : ShootOrPassPlayFSM(
+          ai_config, std::make_shared<PassGenerator<EighteenZoneId>>(
+                         std::make_shared<const EighteenZonePitchDivision>(
+                             Field::createSSLDivisionBField()),
+                         ai_config.passing_config()))
+{
+}
+
+ShootOrPassPlayFSM::ShootOrPassPlayFSM(
+    const TbotsProto::AiConfig& ai_config,
+    std::shared_ptr<PassGenerator<EighteenZoneId>> pass_generator)
     : ai_config(ai_config),
       attacker_tactic(std::make_shared<AttackerTactic>(ai_config)),
       receiver_tactic(std::make_shared<ReceiverTactic>()),
       offensive_positioning_tactics(std::vector<std::shared_ptr<MoveTactic>>()),
-      pass_generator(
-          PassGenerator<EighteenZoneId>(std::make_shared<const EighteenZonePitchDivision>(
-                                            Field::createSSLDivisionBField()),
-                                        ai_config.passing_config())),
+      pass_generator(pass_generator),
       pass_optimization_start_time(Timestamp::fromSeconds(0)),
       best_pass_and_score_so_far(
           PassWithRating{.pass = Pass(Point(), Point(), 0), .rating = 0}),
@@ -20,6 +28,11 @@ ShootOrPassPlayFSM::ShootOrPassPlayFSM(const TbotsProto::AiConfig& ai_config)
 {
 }
 
+TacticVector ShootOrPassPlayFSM::getTactics() const
+{
+    return {attacker_tactic, receiver_tactic};
+}
+
 void ShootOrPassPlayFSM::updateOffensivePositioningTactics(
     const std::vector<EighteenZoneId>& ranked_zones,
     const PassEvaluation<EighteenZoneId>& pass_eval, unsigned int num_tactics)
@@ -54,7 +67,7 @@ void ShootOrPassPlayFSM::lookForPass(const Update& event)
     {
         ZoneNamedN(_tracy_look_for_pass, "ShootOrPassPlayFSM: Look for pass", true);
         PassEvaluation<EighteenZoneId> pass_eval =
-            pass_generator.generatePassEvaluation(*event.common.world_ptr);
+            pass_generator->generatePassEvaluation(*event.common.world_ptr);
         best_pass_and_score_so_far               = pass_eval.getBestPassOnField();
         std::vector<EighteenZoneId> ranked_zones = pass_eval.rankZonesForReceiving(
             *event.common.world_ptr, event.common.world_ptr->ball().position());
@@ -96,7 +109,7 @@ void ShootOrPassPlayFSM::startLookingForPass(const Update& event)
 
 void ShootOrPassPlayFSM::takePass(const Update& event)
 {
-    auto pass_eval = pass_generator.generatePassEvaluation(*event.common.world_ptr);
+    auto pass_eval = pass_generator->generatePassEvaluation(*event.common.world_ptr);
 
     auto ranked_zones = pass_eval.rankZonesForReceiving(
         *event.common.world_ptr, best_pass_and_score_so_far.pass.receiverPoint());
@@ -34,6 +34,25 @@ struct ShootOrPassPlayFSM
      */
     explicit ShootOrPassPlayFSM(const TbotsProto::AiConfig& ai_config);
 
+    /**
+     * Creates a shoot or pass play FSM that looks for passes with the given pass
+     * generator, so that the pass generator can be kept when the FSM is recreated
+     *
+     * @param ai_config the play config for this play FSM
+     * @param pass_generator the pass generator to look for passes with
+     */
+    explicit ShootOrPassPlayFSM(
+        const TbotsProto::AiConfig& ai_config,
+        std::shared_ptr<PassGenerator<EighteenZoneId>> pass_generator);
+
+    /**
+     * Gets the tactics this FSM creates when it is constructed. Copies of the FSM share
+     * these tactics
+     *
+     * @return the tactics
+     */
+    TacticVector getTactics() const;
+
     /**
      * Updates the offensive positioning tactics
      *
@@ -140,7 +159,7 @@ struct ShootOrPassPlayFSM
     std::shared_ptr<AttackerTactic> attacker_tactic;
     std::shared_ptr<ReceiverTactic> receiver_tactic;
     std::vector<std::shared_ptr<MoveTactic>> offensive_positioning_tactics;
-    PassGenerator<EighteenZoneId> pass_generator;
+    std::shared_ptr<PassGenerator<EighteenZoneId>> pass_generator;
     Timestamp pass_optimization_start_time;
     PassWithRating best_pass_and_score_so_far;
     Duration time_since_commit_stage_start;
@@ -2,6 +2,8 @@
 
 #include "proto/parameters.pb.h"
 #include "software/ai/hl/stp/play/play.h"
+#include "software/ai/hl/stp/tactic/crease_defender/crease_defender_tactic.h"
+#include "software/ai/hl/stp/tactic/move/move_tactic.h"
 
 /**
  * This Play moves our robots in a formation while keeping them at least 0.5m from the
@@ -13,6 +15,13 @@ class StopPlay : public Play
    public:
     StopPlay(TbotsProto::AiConfig config);
 
-    void getNextTactics(TacticCoroutine::push_type &yield,
-                        const WorldPtr &world_ptr) override;
+    void updateTactics(const PlayUpdate &play_update) override;
+    void reset() override;
+
+   private:
+    static constexpr TbotsProto::MaxAllowedSpeedMode STOP_MODE =
+        TbotsProto::MaxAllowedSpeedMode::STOP_COMMAND;
+
+    std::vector<std::shared_ptr<MoveTactic>> move_tactics;
+    std::array<std::shared_ptr<CreaseDefenderTactic>, 2> crease_defender_tactics;
 };
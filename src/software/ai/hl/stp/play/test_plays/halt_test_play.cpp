@@ -4,19 +4,22 @@
 #include "software/geom/algorithms/contains.h"
 #include "software/util/generic_factory/generic_factory.h"
 
-HaltTestPlay::HaltTestPlay(TbotsProto::AiConfig config) : Play(config, false) {}
+HaltTestPlay::HaltTestPlay(TbotsProto::AiConfig config)
+    : Play(config, false),
+      stop_test_tactics({std::make_shared<StopTactic>(), std::make_shared<StopTactic>(),
+                         std::make_shared<StopTactic>()})
+{
+}
 
-void HaltTestPlay::getNextTactics(TacticCoroutine::push_type &yield,
-                                  const WorldPtr &world_ptr)
+void HaltTestPlay::updateTactics(const PlayUpdate &play_update)
 {
-    auto stop_test_tactic_1 = std::make_shared<StopTactic>();
-    auto stop_test_tactic_2 = std::make_shared<StopTactic>();
-    auto stop_test_tactic_3 = std::make_shared<StopTactic>();
+    play_update.set_tactics({stop_test_tactics});
+}
 
-    do
-    {
-        yield({{stop_test_tactic_1, stop_test_tactic_2, stop_test_tactic_3}});
-    } while (true);
+void HaltTestPlay::reset()
+{
+    Play::reset();
+    resetTactics(stop_test_tactics);
 }
 
 // Register this play in the genericFactory
@@ -16,9 +16,10 @@ class HaltTestPlay : public Play
    public:
     HaltTestPlay(TbotsProto::AiConfig config);
 
-    void getNextTactics(TacticCoroutine::push_type &yield,
-                        const WorldPtr &world_ptr) override;
+    void updateTactics(const PlayUpdate &play_update) override;
+    void reset() override;
 
    private:
     TbotsProto::AiConfig ai_config;
+    TacticVector stop_test_tactics;
 };
@@ -1,32 +1,47 @@
 #include "software/ai/hl/stp/play/test_plays/move_test_play.h"
 
-#include "software/ai/hl/stp/tactic/move/move_tactic.h"
 #include "software/util/generic_factory/generic_factory.h"
 
-MoveTestPlay::MoveTestPlay(TbotsProto::AiConfig config) : Play(config, false) {}
-
-void MoveTestPlay::getNextTactics(TacticCoroutine::push_type &yield,
-                                  const WorldPtr &world_ptr)
+MoveTestPlay::MoveTestPlay(TbotsProto::AiConfig config)
+    : Play(config, false),
+      move_test_tactic_friendly_goal(std::make_shared<MoveTactic>()),
+      move_test_tactic_enemy_goal(std::make_shared<MoveTactic>()),
+      move_test_tactic_center_field(std::make_shared<MoveTactic>())
 {
-    auto move_test_tactic_friendly_goal = std::make_shared<MoveTactic>();
-    auto move_test_tactic_enemy_goal    = std::make_shared<MoveTactic>();
-    auto move_test_tactic_center_field  = std::make_shared<MoveTactic>();
+}
 
-    do
+void MoveTestPlay::updateTactics(const PlayUpdate &play_update)
+{
+    // Start the moves over once the robot has reached the center of the field
+    if (move_test_tactic_center_field->done())
     {
-        move_test_tactic_friendly_goal->updateControlParams(
-            world_ptr->field().friendlyGoalCenter(), Angle::zero(), 0,
-            TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT);
-        move_test_tactic_enemy_goal->updateControlParams(
-            world_ptr->field().enemyGoalCenter(), Angle::zero(), 0,
-            TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT);
-        move_test_tactic_center_field->updateControlParams(
-            Point(0, 0), Angle::zero(), 0,
-            TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT);
-
-        yield({{move_test_tactic_center_field, move_test_tactic_friendly_goal,
-                move_test_tactic_enemy_goal}});
-    } while (!move_test_tactic_center_field->done());
+        restart();
+    }
+
+    move_test_tactic_friendly_goal->updateControlParams(
+        play_update.world_ptr->field().friendlyGoalCenter(), Angle::zero(), 0,
+        TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT);
+    move_test_tactic_enemy_goal->updateControlParams(
+        play_update.world_ptr->field().enemyGoalCenter(), Angle::zero(), 0,
+        TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT);
+    move_test_tactic_center_field->updateControlParams(
+        Point(0, 0), Angle::zero(), 0, TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT);
+
+    play_update.set_tactics({{move_test_tactic_center_field,
+                              move_test_tactic_friendly_goal,
+                              move_test_tactic_enemy_goal}});
+}
+
+void MoveTestPlay::reset()
+{
+    Play::reset();
+    restart();
+}
+
+void MoveTestPlay::restart()
+{
+    resetTactics({move_test_tactic_friendly_goal, move_test_tactic_enemy_goal,
+                  move_test_tactic_center_field});
 }
 
 // Register this play in the genericFactory
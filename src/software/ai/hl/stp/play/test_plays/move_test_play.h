@@ -2,6 +2,7 @@
 
 #include "proto/parameters.pb.h"
 #include "software/ai/hl/stp/play/play.h"
+#include "software/ai/hl/stp/tactic/move/move_tactic.h"
 
 /**
  * A test Play that moves a robot to the friendly goal, a robot to the enemy goal, and
@@ -17,9 +18,18 @@ class MoveTestPlay : public Play
    public:
     MoveTestPlay(TbotsProto::AiConfig config);
 
-    void getNextTactics(TacticCoroutine::push_type &yield,
-                        const WorldPtr &world_ptr) override;
+    void updateTactics(const PlayUpdate &play_update) override;
+    void reset() override;
 
    private:
+    /**
+     * Starts the moves over with reset tactics, which happens once the robot has
+     * reached the center of the field
+     */
+    void restart();
+
     TbotsProto::AiConfig ai_config;
+    std::shared_ptr<MoveTactic> move_test_tactic_friendly_goal;
+    std::shared_ptr<MoveTactic> move_test_tactic_enemy_goal;
+    std::shared_ptr<MoveTactic> move_test_tactic_center_field;
 };
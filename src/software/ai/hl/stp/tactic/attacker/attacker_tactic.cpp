@@ -15,9 +15,8 @@ AttackerTactic::AttackerTactic(TbotsProto::AiConfig ai_config)
 {
     for (RobotId id = 0; id < MAX_ROBOT_IDS; id++)
     {
-        fsm_map[id] = std::make_unique<FSM<AttackerFSM>>(
-            DribbleFSM(ai_config.dribble_tactic_config()),
-            AttackerFSM(ai_config.attacker_tactic_config()));
+        fsm_map.reset(id, DribbleFSM(ai_config.dribble_tactic_config()),
+                      AttackerFSM(ai_config.attacker_tactic_config()));
     }
 }
 
@@ -43,9 +42,9 @@ void AttackerTactic::updatePrimitive(const TacticUpdate& tactic_update, bool res
 {
     if (reset_fsm)
     {
-        fsm_map[tactic_update.robot.id()] = std::make_unique<FSM<AttackerFSM>>(
-            DribbleFSM(ai_config.dribble_tactic_config()),
-            AttackerFSM(ai_config.attacker_tactic_config()));
+        fsm_map.reset(tactic_update.robot.id(),
+                      DribbleFSM(ai_config.dribble_tactic_config()),
+                      AttackerFSM(ai_config.attacker_tactic_config()));
     }
 
     std::optional<Shot> shot = calcBestShotOnGoal(
@@ -66,5 +65,5 @@ void AttackerTactic::updatePrimitive(const TacticUpdate& tactic_update, bool res
                                               .chip_target      = chip_target};
 
     fsm_map.at(tactic_update.robot.id())
-        ->process_event(AttackerFSM::Update(control_params, tactic_update));
+        .process_event(AttackerFSM::Update(control_params, tactic_update));
 }
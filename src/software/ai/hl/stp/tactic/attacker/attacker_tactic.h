@@ -46,7 +46,7 @@ class AttackerTactic : public Tactic
    private:
     void updatePrimitive(const TacticUpdate& tactic_update, bool reset_fsm) override;
 
-    std::map<RobotId, std::unique_ptr<FSM<AttackerFSM>>> fsm_map;
+    TacticFSMPool<AttackerFSM> fsm_map;
 
     // The pass to execute
     std::optional<Pass> best_pass_so_far;
@@ -8,7 +8,7 @@ ChipTactic::ChipTactic()
 {
     for (RobotId id = 0; id < MAX_ROBOT_IDS; id++)
     {
-        fsm_map[id] = std::make_unique<FSM<ChipFSM>>(GetBehindBallFSM());
+        fsm_map.reset(id, GetBehindBallFSM());
     }
 }
 
@@ -36,9 +36,8 @@ void ChipTactic::updatePrimitive(const TacticUpdate &tactic_update, bool reset_f
 {
     if (reset_fsm)
     {
-        fsm_map[tactic_update.robot.id()] =
-            std::make_unique<FSM<ChipFSM>>(GetBehindBallFSM());
+        fsm_map.reset(tactic_update.robot.id(), GetBehindBallFSM());
     }
     fsm_map.at(tactic_update.robot.id())
-        ->process_event(ChipFSM::Update(control_params, tactic_update));
+        .process_event(ChipFSM::Update(control_params, tactic_update));
 }
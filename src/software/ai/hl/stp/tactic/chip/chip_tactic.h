@@ -44,7 +44,7 @@ class ChipTactic : public Tactic
    private:
     void updatePrimitive(const TacticUpdate& tactic_update, bool reset_fsm) override;
 
-    std::map<RobotId, std::unique_ptr<FSM<ChipFSM>>> fsm_map;
+    TacticFSMPool<ChipFSM> fsm_map;
 
     // Tactic parameters
     ChipFSM::ControlParams control_params;
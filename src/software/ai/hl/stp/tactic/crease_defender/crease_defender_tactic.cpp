@@ -19,8 +19,7 @@ CreaseDefenderTactic::CreaseDefenderTactic(
 {
     for (RobotId id = 0; id < MAX_ROBOT_IDS; id++)
     {
-        fsm_map[id] = std::make_unique<FSM<CreaseDefenderFSM>>(
-            CreaseDefenderFSM(robot_navigation_obstacle_config));
+        fsm_map.reset(id, CreaseDefenderFSM(robot_navigation_obstacle_config));
     }
 }
 
@@ -44,9 +43,9 @@ void CreaseDefenderTactic::updatePrimitive(const TacticUpdate &tactic_update,
 {
     if (reset_fsm)
     {
-        fsm_map[tactic_update.robot.id()] = std::make_unique<FSM<CreaseDefenderFSM>>(
-            CreaseDefenderFSM(robot_navigation_obstacle_config));
+        fsm_map.reset(tactic_update.robot.id(),
+                      CreaseDefenderFSM(robot_navigation_obstacle_config));
     }
     fsm_map.at(tactic_update.robot.id())
-        ->process_event(CreaseDefenderFSM::Update(control_params, tactic_update));
+        .process_event(CreaseDefenderFSM::Update(control_params, tactic_update));
 }
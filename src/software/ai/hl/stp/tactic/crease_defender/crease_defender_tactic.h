@@ -57,7 +57,7 @@ class CreaseDefenderTactic : public Tactic
    private:
     void updatePrimitive(const TacticUpdate &tactic_update, bool reset_fsm) override;
 
-    std::map<RobotId, std::unique_ptr<FSM<CreaseDefenderFSM>>> fsm_map;
+    TacticFSMPool<CreaseDefenderFSM> fsm_map;
 
     CreaseDefenderFSM::ControlParams control_params;
     TbotsProto::RobotNavigationObstacleConfig robot_navigation_obstacle_config;
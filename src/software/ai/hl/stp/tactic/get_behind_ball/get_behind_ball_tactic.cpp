@@ -9,7 +9,7 @@ GetBehindBallTactic::GetBehindBallTactic()
 {
     for (RobotId id = 0; id < MAX_ROBOT_IDS; id++)
     {
-        fsm_map[id] = std::make_unique<FSM<GetBehindBallFSM>>(GetBehindBallFSM());
+        fsm_map.reset(id, GetBehindBallFSM());
     }
 }
 
@@ -30,9 +30,8 @@ void GetBehindBallTactic::updatePrimitive(const TacticUpdate &tactic_update,
 {
     if (reset_fsm)
     {
-        fsm_map[tactic_update.robot.id()] =
-            std::make_unique<FSM<GetBehindBallFSM>>(GetBehindBallFSM());
+        fsm_map.reset(tactic_update.robot.id(), GetBehindBallFSM());
     }
     fsm_map.at(tactic_update.robot.id())
-        ->process_event(GetBehindBallFSM::Update(control_params, tactic_update));
+        .process_event(GetBehindBallFSM::Update(control_params, tactic_update));
 }
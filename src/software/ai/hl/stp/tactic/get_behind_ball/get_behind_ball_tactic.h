@@ -30,7 +30,7 @@ class GetBehindBallTactic : public Tactic
    private:
     void updatePrimitive(const TacticUpdate& tactic_update, bool reset_fsm) override;
 
-    std::map<RobotId, std::unique_ptr<FSM<GetBehindBallFSM>>> fsm_map;
+    TacticFSMPool<GetBehindBallFSM> fsm_map;
 
     GetBehindBallFSM::ControlParams control_params;
 };
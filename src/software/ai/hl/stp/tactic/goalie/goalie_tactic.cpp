@@ -14,8 +14,8 @@ GoalieTactic::GoalieTactic(TbotsProto::AiConfig ai_config,
 {
     for (RobotId id = 0; id < MAX_ROBOT_IDS; id++)
     {
-        fsm_map[id] = std::make_unique<FSM<GoalieFSM>>(
-            DribbleFSM(ai_config.dribble_tactic_config()),
+        fsm_map.reset(
+            id, DribbleFSM(ai_config.dribble_tactic_config()),
             GoalieFSM(ai_config.goalie_tactic_config(), max_allowed_speed_mode));
     }
 }
@@ -34,10 +34,10 @@ void GoalieTactic::updatePrimitive(const TacticUpdate &tactic_update, bool reset
 {
     if (reset_fsm)
     {
-        fsm_map[tactic_update.robot.id()] = std::make_unique<FSM<GoalieFSM>>(
-            DribbleFSM(ai_config.dribble_tactic_config()),
+        fsm_map.reset(
+            tactic_update.robot.id(), DribbleFSM(ai_config.dribble_tactic_config()),
             GoalieFSM(ai_config.goalie_tactic_config(), max_allowed_speed_mode));
     }
     fsm_map.at(tactic_update.robot.id())
-        ->process_event(GoalieFSM::Update(control_params, tactic_update));
+        .process_event(GoalieFSM::Update(control_params, tactic_update));
 }
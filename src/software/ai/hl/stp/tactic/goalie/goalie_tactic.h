@@ -38,7 +38,7 @@ class GoalieTactic : public Tactic
    private:
     void updatePrimitive(const TacticUpdate &tactic_update, bool reset_fsm) override;
 
-    std::map<RobotId, std::unique_ptr<FSM<GoalieFSM>>> fsm_map;
+    TacticFSMPool<GoalieFSM> fsm_map;
 
     TbotsProto::MaxAllowedSpeedMode max_allowed_speed_mode;
 
@@ -47,7 +47,7 @@ class KickTactic : public Tactic
    private:
     void updatePrimitive(const TacticUpdate& tactic_update, bool reset_fsm) override;
 
-    std::map<RobotId, std::unique_ptr<FSM<KickFSM>>> fsm_map;
+    TacticFSMPool<KickFSM> fsm_map;
 
     // Tactic parameters
     KickFSM::ControlParams control_params;
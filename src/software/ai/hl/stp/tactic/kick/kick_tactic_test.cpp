@@ -4,7 +4,9 @@
 
 #include <utility>
 
+#include "software/ai/hl/stp/play/assigned_tactics_play.h"
 #include "software/geom/algorithms/contains.h"
+#include "software/simulated_tests/simulated_er_force_sim_batch_runner.h"
 #include "software/simulated_tests/simulated_er_force_sim_play_test_fixture.h"
 #include "software/simulated_tests/terminating_validation_functions/ball_kicked_validation.h"
 #include "software/simulated_tests/terminating_validation_functions/robot_state_validation.h"
@@ -13,32 +15,62 @@
 #include "software/time/duration.h"
 #include "software/world/world.h"
 
-class KickTacticTest : public SimulatedErForceSimPlayTestFixture,
-                       public ::testing::WithParamInterface<std::tuple<Vector, Angle>>
-{
-   protected:
-    TbotsProto::FieldType field_type = TbotsProto::FieldType::DIV_B;
-    Field field                      = Field::createField(field_type);
-};
+// The offsets of the ball from the robot, and the angles to kick at
+static const std::vector<std::tuple<Vector, Angle>> KICK_TEST_PARAMETERS = {
+    // place the ball directly to the left of the robot
+    std::make_tuple(Vector(0, 0.5), Angle::zero()),
+    // place the ball directly to the right of the robot
+    std::make_tuple(Vector(0, -0.5), Angle::zero()),
+    // place the ball directly infront of the robot
+    std::make_tuple(Vector(0.5, 0), Angle::zero()),
+    // place the ball directly behind the robot
+    std::make_tuple(Vector(-0.5, 0), Angle::zero()),
+    // place the ball in the robots dribbler
+    std::make_tuple(Vector(ROBOT_MAX_RADIUS_METERS, 0), Angle::zero()),
+    // Repeat the same tests but kick in the opposite direction
+    // place the ball directly to the left of the robot
+    std::make_tuple(Vector(0, 0.5), Angle::half()),
+    // place the ball directly to the right of the robot
+    std::make_tuple(Vector(0, -0.5), Angle::half()),
+    // place the ball directly infront of the robot
+    std::make_tuple(Vector(0.5, 0), Angle::half()),
+    // place the ball directly behind the robot
+    std::make_tuple(Vector(-0.5, 0), Angle::half()),
+    // place the ball in the robots dribbler
+    std::make_tuple(Vector(ROBOT_MAX_RADIUS_METERS, 0), Angle::zero())};
 
-TEST_P(KickTacticTest, kick_test)
+/**
+ * Creates the scenario of a kick test, so that it can be run by both the
+ * SimulatedErForceSimPlayTestFixture and the SimulatedErForceSimBatchRunner
+ *
+ * @param ball_offset_from_robot The offset of the ball from the kicking robot
+ * @param angle_to_kick_at The angle to kick the ball at
+ *
+ * @return the scenario
+ */
+static SimulatedTestScenario createKickScenario(const Vector& ball_offset_from_robot,
+                                                const Angle& angle_to_kick_at)
 {
-    Vector ball_offset_from_robot = std::get<0>(GetParam());
-    Angle angle_to_kick_at        = std::get<1>(GetParam());
-
     Point robot_position = Point(0, 0);
-    BallState ball_state(robot_position + ball_offset_from_robot, Vector(0, 0));
+    Point ball_position  = robot_position + ball_offset_from_robot;
 
-    auto friendly_robots =
-        TestUtil::createStationaryRobotStatesWithId({Point(-3, 2.5), robot_position});
-    auto enemy_robots = TestUtil::createStationaryRobotStatesWithId({Point(4, 0)});
+    SimulatedTestScenario scenario;
+    scenario.name            = "kick_test";
+    scenario.field_type      = TbotsProto::FieldType::DIV_B;
+    scenario.ball            = BallState(ball_position, Vector(0, 0));
+    scenario.friendly_robots = TestUtil::createStationaryRobotStatesWithId(
+        {Point(-3, 2.5), robot_position});
+    scenario.enemy_robots = TestUtil::createStationaryRobotStatesWithId({Point(4, 0)});
 
     auto tactic = std::make_shared<KickTactic>();
-    tactic->updateControlParams(robot_position + ball_offset_from_robot, angle_to_kick_at,
-                                5);
-    setTactic(1, tactic);
+    tactic->updateControlParams(ball_position, angle_to_kick_at, 5);
+    scenario.play_factory = [tactic](const TbotsProto::AiConfig& ai_config) {
+        auto play = std::make_unique<AssignedTacticsPlay>(ai_config);
+        play->updateControlParams({{1, tactic}}, {{1, {}}});
+        return std::unique_ptr<Play>(std::move(play));
+    };
 
-    std::vector<ValidationFunction> terminating_validation_functions = {
+    scenario.terminating_validation_functions = {
         [angle_to_kick_at, tactic](std::shared_ptr<World> world_ptr,
                                    ValidationCoroutine::push_type& yield) {
             while (!tactic->done())
@@ -47,35 +79,51 @@ TEST_P(KickTacticTest, kick_test)
             }
             ballKicked(angle_to_kick_at, world_ptr, yield);
         }};
+    scenario.timeout = Duration::fromSeconds(5);
+    return scenario;
+}
 
-    std::vector<ValidationFunction> non_terminating_validation_functions = {};
+class KickTacticTest : public SimulatedErForceSimPlayTestFixture,
+                       public ::testing::WithParamInterface<std::tuple<Vector, Angle>>
+{
+};
 
-    runTest(field_type, ball_state, friendly_robots, enemy_robots,
-            terminating_validation_functions, non_terminating_validation_functions,
-            Duration::fromSeconds(5));
+TEST_P(KickTacticTest, kick_test)
+{
+    SimulatedTestScenario scenario =
+        createKickScenario(std::get<0>(GetParam()), std::get<1>(GetParam()));
+    setAiPlay(scenario.play_factory(getAiConfig()));
+
+    runTest(scenario.field_type, scenario.ball, scenario.friendly_robots,
+            scenario.enemy_robots, scenario.terminating_validation_functions,
+            scenario.non_terminating_validation_functions, scenario.timeout);
 }
 
-INSTANTIATE_TEST_CASE_P(
-    BallLocations, KickTacticTest,
-    ::testing::Values(
-        // place the ball directly to the left of the robot
-        std::make_tuple(Vector(0, 0.5), Angle::zero()),
-        // place the ball directly to the right of the robot
-        std::make_tuple(Vector(0, -0.5), Angle::zero()),
-        // place the ball directly infront of the robot
-        std::make_tuple(Vector(0.5, 0), Angle::zero()),
-        // place the ball directly behind the robot
-        std::make_tuple(Vector(-0.5, 0), Angle::zero()),
-        // place the ball in the robots dribbler
-        std::make_tuple(Vector(ROBOT_MAX_RADIUS_METERS, 0), Angle::zero()),
-        // Repeat the same tests but kick in the opposite direction
-        // place the ball directly to the left of the robot
-        std::make_tuple(Vector(0, 0.5), Angle::half()),
-        // place the ball directly to the right of the robot
-        std::make_tuple(Vector(0, -0.5), Angle::half()),
-        // place the ball directly infront of the robot
-        std::make_tuple(Vector(0.5, 0), Angle::half()),
-        // place the ball directly behind the robot
-        std::make_tuple(Vector(-0.5, 0), Angle::half()),
-        // place the ball in the robots dribbler
-        std::make_tuple(Vector(ROBOT_MAX_RADIUS_METERS, 0), Angle::zero())));
+INSTANTIATE_TEST_CASE_P(BallLocations, KickTacticTest,
+                        ::testing::ValuesIn(KICK_TEST_PARAMETERS));
+
+TEST(KickTacticBatchTest, kick_test)
+{
+    // Runs every parameterization of KickTacticTest at once in the batch runner, which
+    // must give the same results as running them one by one in the test fixture
+    std::vector<SimulatedTestScenario> scenarios;
+    for (const auto& [ball_offset_from_robot, angle_to_kick_at] : KICK_TEST_PARAMETERS)
+    {
+        scenarios.emplace_back(
+            createKickScenario(ball_offset_from_robot, angle_to_kick_at));
+        scenarios.back().name += "/" + std::to_string(scenarios.size() - 1);
+    }
+
+    SimulatedErForceSimBatchRunner runner;
+    auto start_time = std::chrono::system_clock::now();
+    auto results    = runner.run(scenarios);
+    auto summary    = SimulatedErForceSimBatchRunner::summarize(
+        results, TestUtil::millisecondsSince(start_time));
+
+    ASSERT_EQ(scenarios.size(), results.size());
+    for (const auto& result : results)
+    {
+        EXPECT_TRUE(result.passed) << result.name;
+    }
+    EXPECT_EQ(scenarios.size(), summary.num_passed);
+}
@@ -17,7 +17,7 @@ MoveTactic::MoveTactic()
 {
     for (RobotId id = 0; id < MAX_ROBOT_IDS; id++)
     {
-        fsm_map[id] = std::make_unique<FSM<MoveFSM>>();
+        fsm_map.reset(id);
     }
 }
 
@@ -57,10 +57,10 @@ void MoveTactic::updatePrimitive(const TacticUpdate &tactic_update, bool reset_f
 {
     if (reset_fsm)
     {
-        fsm_map[tactic_update.robot.id()] = std::make_unique<FSM<MoveFSM>>();
+        fsm_map.reset(tactic_update.robot.id());
     }
     fsm_map.at(tactic_update.robot.id())
-        ->process_event(MoveFSM::Update(control_params, tactic_update));
+        .process_event(MoveFSM::Update(control_params, tactic_update));
 }
 
 void MoveTactic::accept(TacticVisitor &visitor) const
@@ -59,7 +59,7 @@ class MoveTactic : public Tactic
    private:
     void updatePrimitive(const TacticUpdate& tactic_update, bool reset_fsm) override;
 
-    std::map<RobotId, std::unique_ptr<FSM<MoveFSM>>> fsm_map;
+    TacticFSMPool<MoveFSM> fsm_map;
 
     MoveFSM::ControlParams control_params;
 };
@@ -30,7 +30,7 @@ class PassDefenderTactic : public Tactic
    private:
     void updatePrimitive(const TacticUpdate& tactic_update, bool reset_fsm) override;
 
-    std::map<RobotId, std::unique_ptr<FSM<PassDefenderFSM>>> fsm_map;
+    TacticFSMPool<PassDefenderFSM> fsm_map;
 
     PassDefenderFSM::ControlParams control_params;
 };
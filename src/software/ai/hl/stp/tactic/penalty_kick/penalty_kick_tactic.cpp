@@ -7,9 +7,8 @@ PenaltyKickTactic::PenaltyKickTactic(TbotsProto::AiConfig ai_config)
 {
     for (RobotId id = 0; id < MAX_ROBOT_IDS; id++)
     {
-        fsm_map[id] = std::make_unique<FSM<PenaltyKickFSM>>(
-            DribbleFSM(ai_config.dribble_tactic_config()), PenaltyKickFSM(),
-            GetBehindBallFSM());
+        fsm_map.reset(id, DribbleFSM(ai_config.dribble_tactic_config()), PenaltyKickFSM(),
+                      GetBehindBallFSM());
     }
 }
 
@@ -24,10 +23,10 @@ void PenaltyKickTactic::updatePrimitive(const TacticUpdate& tactic_update, bool
 {
     if (reset_fsm)
     {
-        fsm_map[tactic_update.robot.id()] = std::make_unique<FSM<PenaltyKickFSM>>(
-            DribbleFSM(ai_config.dribble_tactic_config()), PenaltyKickFSM(),
-            GetBehindBallFSM());
+        fsm_map.reset(tactic_update.robot.id(),
+                      DribbleFSM(ai_config.dribble_tactic_config()), PenaltyKickFSM(),
+                      GetBehindBallFSM());
     }
     fsm_map.at(tactic_update.robot.id())
-        ->process_event(PenaltyKickFSM::Update({}, tactic_update));
+        .process_event(PenaltyKickFSM::Update({}, tactic_update));
 }
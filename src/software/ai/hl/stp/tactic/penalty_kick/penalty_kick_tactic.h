@@ -32,6 +32,6 @@ class PenaltyKickTactic : public Tactic
    private:
     void updatePrimitive(const TacticUpdate &tactic_update, bool reset_fsm) override;
 
-    std::map<RobotId, std::unique_ptr<FSM<PenaltyKickFSM>>> fsm_map;
+    TacticFSMPool<PenaltyKickFSM> fsm_map;
     TbotsProto::AiConfig ai_config;
 };
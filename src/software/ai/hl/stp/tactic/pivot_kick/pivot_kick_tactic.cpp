@@ -18,8 +18,7 @@ PivotKickTactic::PivotKickTactic(TbotsProto::AiConfig ai_config)
 {
     for (RobotId id = 0; id < MAX_ROBOT_IDS; id++)
     {
-        fsm_map[id] = std::make_unique<FSM<PivotKickFSM>>(
-            DribbleFSM(ai_config.dribble_tactic_config()));
+        fsm_map.reset(id, DribbleFSM(ai_config.dribble_tactic_config()));
     }
 }
 
@@ -41,9 +40,9 @@ void PivotKickTactic::updatePrimitive(const TacticUpdate &tactic_update, bool re
 {
     if (reset_fsm)
     {
-        fsm_map[tactic_update.robot.id()] = std::make_unique<FSM<PivotKickFSM>>(
-            DribbleFSM(ai_config.dribble_tactic_config()));
+        fsm_map.reset(tactic_update.robot.id(),
+                      DribbleFSM(ai_config.dribble_tactic_config()));
     }
     fsm_map.at(tactic_update.robot.id())
-        ->process_event(PivotKickFSM::Update(control_params, tactic_update));
+        .process_event(PivotKickFSM::Update(control_params, tactic_update));
 }
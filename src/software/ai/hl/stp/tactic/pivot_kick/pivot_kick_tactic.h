@@ -35,7 +35,7 @@ class PivotKickTactic : public Tactic
    private:
     void updatePrimitive(const TacticUpdate& tactic_update, bool reset_fsm) override;
 
-    std::map<RobotId, std::unique_ptr<FSM<PivotKickFSM>>> fsm_map;
+    TacticFSMPool<PivotKickFSM> fsm_map;
 
     PivotKickFSM::ControlParams control_params;
     TbotsProto::AiConfig ai_config;
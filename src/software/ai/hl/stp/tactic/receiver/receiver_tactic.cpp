@@ -14,7 +14,7 @@ ReceiverTactic::ReceiverTactic()
 {
     for (RobotId id = 0; id < MAX_ROBOT_IDS; id++)
     {
-        fsm_map[id] = std::make_unique<FSM<ReceiverFSM>>(ReceiverFSM());
+        fsm_map.reset(id, ReceiverFSM());
     }
 }
 
@@ -35,9 +35,8 @@ void ReceiverTactic::updatePrimitive(const TacticUpdate& tactic_update, bool res
 {
     if (reset_fsm)
     {
-        fsm_map[tactic_update.robot.id()] =
-            std::make_unique<FSM<ReceiverFSM>>(ReceiverFSM());
+        fsm_map.reset(tactic_update.robot.id(), ReceiverFSM());
     }
     fsm_map.at(tactic_update.robot.id())
-        ->process_event(ReceiverFSM::Update(control_params, tactic_update));
+        .process_event(ReceiverFSM::Update(control_params, tactic_update));
 }
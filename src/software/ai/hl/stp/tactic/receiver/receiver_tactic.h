@@ -68,7 +68,7 @@ class ReceiverTactic : public Tactic
 
     void updatePrimitive(const TacticUpdate& tactic_update, bool reset_fsm) override;
 
-    std::map<RobotId, std::unique_ptr<FSM<ReceiverFSM>>> fsm_map;
+    TacticFSMPool<ReceiverFSM> fsm_map;
 
     /**
      * Finds a feasible shot for the robot, if any.
@@ -8,7 +8,7 @@ ShadowEnemyTactic::ShadowEnemyTactic()
 {
     for (RobotId id = 0; id < MAX_ROBOT_IDS; id++)
     {
-        fsm_map[id] = std::make_unique<FSM<ShadowEnemyFSM>>();
+        fsm_map.reset(id);
     }
 }
 
@@ -28,8 +28,8 @@ void ShadowEnemyTactic::updatePrimitive(const TacticUpdate &tactic_update, bool
 {
     if (reset_fsm)
     {
-        fsm_map[tactic_update.robot.id()] = std::make_unique<FSM<ShadowEnemyFSM>>();
+        fsm_map.reset(tactic_update.robot.id());
     }
     fsm_map.at(tactic_update.robot.id())
-        ->process_event(ShadowEnemyFSM::Update(control_params, tactic_update));
+        .process_event(ShadowEnemyFSM::Update(control_params, tactic_update));
 }
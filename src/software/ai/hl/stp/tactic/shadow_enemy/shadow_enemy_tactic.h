@@ -33,7 +33,7 @@ class ShadowEnemyTactic : public Tactic
    private:
     void updatePrimitive(const TacticUpdate &tactic_update, bool reset_fsm) override;
 
-    std::map<RobotId, std::unique_ptr<FSM<ShadowEnemyFSM>>> fsm_map;
+    TacticFSMPool<ShadowEnemyFSM> fsm_map;
 
     ShadowEnemyFSM::ControlParams control_params;
 };
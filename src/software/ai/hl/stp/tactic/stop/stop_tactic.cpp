@@ -6,7 +6,7 @@ StopTactic::StopTactic() : Tactic(std::set<RobotCapability>()), fsm_map()
 {
     for (RobotId id = 0; id < MAX_ROBOT_IDS; id++)
     {
-        fsm_map[id] = std::make_unique<FSM<StopFSM>>(StopFSM());
+        fsm_map.reset(id, StopFSM());
     }
 }
 
@@ -19,8 +19,8 @@ void StopTactic::updatePrimitive(const TacticUpdate &tactic_update, bool reset_f
 {
     if (reset_fsm)
     {
-        fsm_map[tactic_update.robot.id()] = std::make_unique<FSM<StopFSM>>(StopFSM());
+        fsm_map.reset(tactic_update.robot.id(), StopFSM());
     }
     fsm_map.at(tactic_update.robot.id())
-        ->process_event(StopFSM::Update({}, tactic_update));
+        .process_event(StopFSM::Update({}, tactic_update));
 }
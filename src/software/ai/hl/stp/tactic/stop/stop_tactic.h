@@ -22,5 +22,5 @@ class StopTactic : public Tactic
    private:
     void updatePrimitive(const TacticUpdate& tactic_update, bool reset_fsm) override;
 
-    std::map<RobotId, std::unique_ptr<FSM<StopFSM>>> fsm_map;
+    TacticFSMPool<StopFSM> fsm_map;
 };
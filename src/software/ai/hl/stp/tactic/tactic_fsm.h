@@ -1,9 +1,12 @@
 #pragma once
 
+#include <array>
 #include <functional>
+#include <optional>
 
 #include "proto/primitive/primitive_msg_factory.h"
 #include "proto/tbots_software_msgs.pb.h"
+#include "shared/constants.h"
 #include "software/ai/hl/stp/tactic/primitive.h"
 #include "software/ai/hl/stp/tactic/stop_primitive.h"
 #include "software/util/sml_fsm/sml_fsm.h"
@@ -28,6 +31,59 @@ struct TacticUpdate
     SetPrimitiveCallback set_primitive;
 };
 
+/**
+ * A pool of one FSM per robot id, for a tactic to run on any of the friendly robots.
+ *
+ * The FSMs are stored in the pool itself and are reset by recreating them in the same
+ * place, so resetting the FSM of a robot does not allocate memory
+ *
+ * @tparam T The FSM struct
+ */
+template <class T>
+class TacticFSMPool
+{
+   public:
+    TacticFSMPool() = default;
+
+    /**
+     * Resets the FSM of the given robot to its initial state
+     *
+     * @param robot_id The id of the robot
+     * @param fsm_args The arguments to create the FSM with, which are the FSM structs
+     * of the FSM and its sub FSMs
+     *
+     * @return the reset FSM
+     */
+    template <class... FSMArgs>
+    FSM<T> &reset(RobotId robot_id, FSMArgs &&... fsm_args)
+    {
+        return fsms.at(robot_id).emplace(std::forward<FSMArgs>(fsm_args)...);
+    }
+
+    /**
+     * Gets the FSM of the given robot, which must have been reset before
+     *
+     * @param robot_id The id of the robot
+     *
+     * @throws std::out_of_range if the robot id is out of range
+     * @throws std::bad_optional_access if the FSM of the robot was never reset
+     *
+     * @return the FSM of the robot
+     */
+    FSM<T> &at(RobotId robot_id)
+    {
+        return fsms.at(robot_id).value();
+    }
+
+    const FSM<T> &at(RobotId robot_id) const
+    {
+        return fsms.at(robot_id).value();
+    }
+
+   private:
+    std::array<std::optional<FSM<T>>, MAX_ROBOT_IDS> fsms;
+};
+
 /**
  * The Update struct is the only event that a tactic fsm should respond to and it is
  * composed of the following structs:
@@ -52,7 +108,7 @@ struct TacticUpdate
         bool is_done = false;                                                            \
         if (last_execution_robot.has_value())                                            \
         {                                                                                \
-            is_done = fsm_map.at(last_execution_robot.value())->is(boost::sml::X);       \
+            is_done = fsm_map.at(last_execution_robot.value()).is(boost::sml::X);        \
         }                                                                                \
         return is_done;                                                                  \
     }                                                                                    \
@@ -62,7 +118,7 @@ struct TacticUpdate
         std::string state_str = "";                                                      \
         if (last_execution_robot.has_value())                                            \
             state_str =                                                                  \
-                getCurrentFullStateName(*fsm_map.at(last_execution_robot.value()));      \
+                getCurrentFullStateName(fsm_map.at(last_execution_robot.value()));       \
         return state_str;                                                                \
     }
 
@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+
+#include "software/ai/hl/stp/tactic/dribble/dribble_fsm.h"
+#include "software/ai/hl/stp/tactic/stop/stop_fsm.h"
+#include "software/ai/hl/stp/tactic/tactic_fsm.h"
+#include "software/test_util/allocation_counter.h"
+#include "software/test_util/test_util.h"
+
+TEST(TacticFSMPoolTest, test_reset_returns_fsm_to_initial_state)
+{
+    Robot robot                  = ::TestUtil::createRobotAtPos(Point(0.5, 0));
+    std::shared_ptr<World> world = ::TestUtil::createBlankTestingWorld();
+    ::TestUtil::setBallPosition(world, Point(0.5, 0), Timestamp::fromSeconds(123));
+
+    TbotsProto::DribbleTacticConfig dribble_config;
+    TacticFSMPool<DribbleFSM> fsm_pool;
+    FSM<DribbleFSM> &fsm = fsm_pool.reset(robot.id(), DribbleFSM(dribble_config));
+    EXPECT_EQ(&fsm, &fsm_pool.at(robot.id()));
+    EXPECT_TRUE(fsm.is(boost::sml::state<DribbleFSM::GetPossession>));
+
+    // Robot at ball point, so it has possession, so transition to dribble state
+    fsm.process_event(DribbleFSM::Update(
+        {std::nullopt, std::nullopt, false},
+        TacticUpdate(robot, world, [](std::shared_ptr<Primitive>) {})));
+    EXPECT_TRUE(fsm.is(boost::sml::state<DribbleFSM::Dribble>));
+
+    // Resetting recreates the FSM in the same place
+    EXPECT_EQ(&fsm, &fsm_pool.reset(robot.id(), DribbleFSM(dribble_config)));
+    EXPECT_TRUE(fsm.is(boost::sml::state<DribbleFSM::GetPossession>));
+}
+
+TEST(TacticFSMPoolTest, test_fsms_of_robots_are_independent)
+{
+    std::shared_ptr<World> world = ::TestUtil::createBlankTestingWorld();
+    Robot robot                  = ::TestUtil::createRobotAtPos(Point(1, -3));
+
+    TacticFSMPool<StopFSM> fsm_pool;
+    fsm_pool.reset(0, StopFSM());
+    fsm_pool.reset(1, StopFSM());
+
+    // The stationary robot stops right away
+    fsm_pool.at(0).process_event(StopFSM::Update(
+        {}, TacticUpdate(robot, world, [](std::shared_ptr<Primitive>) {})));
+    EXPECT_TRUE(fsm_pool.at(0).is(boost::sml::X));
+    EXPECT_TRUE(fsm_pool.at(1).is(boost::sml::state<StopFSM::StopState>));
+}
+
+TEST(TacticFSMPoolTest, test_at_throws_for_fsms_that_were_never_reset)
+{
+    TacticFSMPool<StopFSM> fsm_pool;
+    EXPECT_THROW(fsm_pool.at(0), std::bad_optional_access);
+    EXPECT_THROW(fsm_pool.at(MAX_ROBOT_IDS), std::out_of_range);
+}
+
+TEST(TacticFSMPoolTest, test_reset_does_not_allocate)
+{
+    TbotsProto::DribbleTacticConfig dribble_config;
+    TacticFSMPool<DribbleFSM> fsm_pool;
+    for (RobotId id = 0; id < MAX_ROBOT_IDS; id++)
+    {
+        fsm_pool.reset(id, DribbleFSM(dribble_config));
+    }
+
+    // Reset the FSMs of every robot, like a tactic does on every tick for the robots
+    // it did not run on last
+    TestUtil::AllocationCounter allocation_counter;
+    for (RobotId id = 0; id < MAX_ROBOT_IDS; id++)
+    {
+        fsm_pool.reset(id, DribbleFSM(dribble_config));
+    }
+    EXPECT_EQ(0, allocation_counter.getNumAllocations());
+}
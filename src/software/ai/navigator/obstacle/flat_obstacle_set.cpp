@@ -0,0 +1,421 @@
+#include "software/ai/navigator/obstacle/flat_obstacle_set.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+/**
+ * Gets the squared distance from a point to a segment, using the same arithmetic as
+ * distanceSquared(Point, Segment)
+ *
+ * @param px The x coordinate of the point
+ * @param py The y coordinate of the point
+ * @param sx The x coordinate of the start of the segment
+ * @param sy The y coordinate of the start of the segment
+ * @param ex The x coordinate of the end of the segment
+ * @param ey The y coordinate of the end of the segment
+ *
+ * @return the squared distance from the point to the segment
+ */
+inline double distanceSquaredToSegment(double px, double py, double sx, double sy,
+                                       double ex, double ey)
+{
+    double seg_x            = ex - sx;
+    double seg_y            = ey - sy;
+    double start_to_point_x = px - sx;
+    double start_to_point_y = py - sy;
+
+    if (seg_x * start_to_point_x + seg_y * start_to_point_y <= 0)
+    {
+        return start_to_point_x * start_to_point_x + start_to_point_y * start_to_point_y;
+    }
+
+    double end_to_point_x = px - ex;
+    double end_to_point_y = py - ey;
+    if (seg_x * end_to_point_x + seg_y * end_to_point_y >= 0)
+    {
+        return end_to_point_x * end_to_point_x + end_to_point_y * end_to_point_y;
+    }
+
+    double cross = start_to_point_x * seg_y - start_to_point_y * seg_x;
+    return std::fabs(cross * cross / (seg_x * seg_x + seg_y * seg_y));
+}
+}  // namespace
+
+FlatObstacleSet::FlatObstacleSet(const std::vector<ObstaclePtr>& obstacles)
+    : locations(obstacles.size())
+{
+    Flattener flattener(*this);
+    for (std::size_t i = 0; i < obstacles.size(); i++)
+    {
+        flattener.setIndex(i);
+        obstacles[i]->accept(flattener);
+    }
+}
+
+std::size_t FlatObstacleSet::size() const
+{
+    return circles.indices.size() + stadiums.indices.size() +
+           rectangles.indices.size() + polygons.indices.size();
+}
+
+bool FlatObstacleSet::contains(const Point& point) const
+{
+    return findContainingObstacle(point).has_value();
+}
+
+std::vector<bool> FlatObstacleSet::contains(const std::vector<Point>& points) const
+{
+    const std::size_t num_points = points.size();
+    std::vector<double> xs(num_points);
+    std::vector<double> ys(num_points);
+    for (std::size_t j = 0; j < num_points; j++)
+    {
+        xs[j] = points[j].x();
+        ys[j] = points[j].y();
+    }
+
+    // Every obstacle is checked against all the points at once, so the inner loops
+    // only do arithmetic on contiguous arrays
+    std::vector<unsigned char> inside(num_points, 0);
+    for (std::size_t i = 0; i < circles.indices.size(); i++)
+    {
+        double cx             = circles.xs[i];
+        double cy             = circles.ys[i];
+        double radius_squared = circles.radii[i] * circles.radii[i];
+        for (std::size_t j = 0; j < num_points; j++)
+        {
+            double dx = cx - xs[j];
+            double dy = cy - ys[j];
+            inside[j] |= (dx * dx + dy * dy <= radius_squared);
+        }
+    }
+    for (std::size_t i = 0; i < stadiums.indices.size(); i++)
+    {
+        double radius_squared = stadiums.radii[i] * stadiums.radii[i];
+        for (std::size_t j = 0; j < num_points; j++)
+        {
+            inside[j] |= (distanceSquaredToSegment(xs[j], ys[j], stadiums.start_xs[i],
+                                                   stadiums.start_ys[i],
+                                                   stadiums.end_xs[i],
+                                                   stadiums.end_ys[i]) <= radius_squared);
+        }
+    }
+    for (std::size_t i = 0; i < rectangles.indices.size(); i++)
+    {
+        double min_x = rectangles.min_xs[i];
+        double min_y = rectangles.min_ys[i];
+        double max_x = rectangles.max_xs[i];
+        double max_y = rectangles.max_ys[i];
+        for (std::size_t j = 0; j < num_points; j++)
+        {
+            inside[j] |= (xs[j] >= min_x && ys[j] >= min_y && xs[j] <= max_x &&
+                          ys[j] <= max_y);
+        }
+    }
+    std::vector<unsigned char> crossings(num_points);
+    for (std::size_t i = 0; i < polygons.indices.size(); i++)
+    {
+        std::fill(crossings.begin(), crossings.end(), 0);
+        std::size_t begin = polygons.vertex_offsets[i];
+        std::size_t end   = polygons.vertex_offsets[i + 1];
+        for (std::size_t k = begin, l = end - 1; k < end; l = k++)
+        {
+            double pix = polygons.vertex_xs[k];
+            double piy = polygons.vertex_ys[k];
+            double pjx = polygons.vertex_xs[l];
+            double pjy = polygons.vertex_ys[l];
+            for (std::size_t j = 0; j < num_points; j++)
+            {
+                bool p_within_edge_y_range = (piy > ys[j]) != (pjy > ys[j]);
+                bool p_in_half_plane_to_left_of_extended_edge =
+                    (pjy == piy) ||
+                    (xs[j] < (pjx - pix) * (ys[j] - piy) / (pjy - piy) + pix);
+                crossings[j] ^=
+                    (p_within_edge_y_range && p_in_half_plane_to_left_of_extended_edge);
+            }
+        }
+        for (std::size_t j = 0; j < num_points; j++)
+        {
+            inside[j] |= crossings[j];
+        }
+    }
+
+    return std::vector<bool>(inside.begin(), inside.end());
+}
+
+std::optional<std::size_t> FlatObstacleSet::findContainingObstacle(
+    const Point& point) const
+{
+    const double px = point.x();
+    const double py = point.y();
+
+    // The obstacles of each shape are in the order of their indices, so the first
+    // obstacle of each shape that contains the point has the lowest index of its shape
+    std::size_t first_index = std::numeric_limits<std::size_t>::max();
+    for (std::size_t i = 0; i < circles.indices.size(); i++)
+    {
+        double dx = circles.xs[i] - px;
+        double dy = circles.ys[i] - py;
+        if (dx * dx + dy * dy <= circles.radii[i] * circles.radii[i])
+        {
+            first_index = std::min(first_index, circles.indices[i]);
+            break;
+        }
+    }
+    for (std::size_t i = 0; i < stadiums.indices.size(); i++)
+    {
+        if (distanceSquaredToSegment(px, py, stadiums.start_xs[i], stadiums.start_ys[i],
+                                     stadiums.end_xs[i], stadiums.end_ys[i]) <=
+            stadiums.radii[i] * stadiums.radii[i])
+        {
+            first_index = std::min(first_index, stadiums.indices[i]);
+            break;
+        }
+    }
+    for (std::size_t i = 0; i < rectangles.indices.size(); i++)
+    {
+        if (px >= rectangles.min_xs[i] && py >= rectangles.min_ys[i] &&
+            px <= rectangles.max_xs[i] && py <= rectangles.max_ys[i])
+        {
+            first_index = std::min(first_index, rectangles.indices[i]);
+            break;
+        }
+    }
+    for (std::size_t i = 0; i < polygons.indices.size(); i++)
+    {
+        if (polygonContains(i, px, py))
+        {
+            first_index = std::min(first_index, polygons.indices[i]);
+            break;
+        }
+    }
+
+    if (first_index == std::numeric_limits<std::size_t>::max())
+    {
+        return std::nullopt;
+    }
+    return first_index;
+}
+
+bool FlatObstacleSet::contains(const Point& point,
+                               const std::vector<unsigned int>& indices) const
+{
+    return findContainingObstacle(point, indices).has_value();
+}
+
+std::optional<std::size_t> FlatObstacleSet::findContainingObstacle(
+    const Point& point, const std::vector<unsigned int>& indices) const
+{
+    for (unsigned int index : indices)
+    {
+        if (obstacleContains(locations[index], point.x(), point.y()))
+        {
+            return index;
+        }
+    }
+    return std::nullopt;
+}
+
+double FlatObstacleSet::distance(const Point& point) const
+{
+    return distance(std::vector<Point>{point})[0];
+}
+
+std::vector<double> FlatObstacleSet::distance(const std::vector<Point>& points) const
+{
+    const std::size_t num_points = points.size();
+    std::vector<double> xs(num_points);
+    std::vector<double> ys(num_points);
+    for (std::size_t j = 0; j < num_points; j++)
+    {
+        xs[j] = points[j].x();
+        ys[j] = points[j].y();
+    }
+
+    std::vector<double> min_distances(num_points,
+                                      std::numeric_limits<double>::infinity());
+    for (std::size_t i = 0; i < circles.indices.size(); i++)
+    {
+        double cx     = circles.xs[i];
+        double cy     = circles.ys[i];
+        double radius = circles.radii[i];
+        for (std::size_t j = 0; j < num_points; j++)
+        {
+            double distance = std::max(std::hypot(xs[j] - cx, ys[j] - cy) - radius, 0.0);
+            min_distances[j] = std::min(min_distances[j], distance);
+        }
+    }
+    for (std::size_t i = 0; i < stadiums.indices.size(); i++)
+    {
+        for (std::size_t j = 0; j < num_points; j++)
+        {
+            double distance = std::max(
+                std::sqrt(distanceSquaredToSegment(
+                    xs[j], ys[j], stadiums.start_xs[i], stadiums.start_ys[i],
+                    stadiums.end_xs[i], stadiums.end_ys[i])) -
+                    stadiums.radii[i],
+                0.0);
+            min_distances[j] = std::min(min_distances[j], distance);
+        }
+    }
+    for (std::size_t i = 0; i < rectangles.indices.size(); i++)
+    {
+        double min_x = rectangles.min_xs[i];
+        double min_y = rectangles.min_ys[i];
+        double max_x = rectangles.max_xs[i];
+        double max_y = rectangles.max_ys[i];
+        for (std::size_t j = 0; j < num_points; j++)
+        {
+            double dx        = std::max({min_x - xs[j], 0.0, xs[j] - max_x});
+            double dy        = std::max({min_y - ys[j], 0.0, ys[j] - max_y});
+            double distance  = std::sqrt(dx * dx + dy * dy);
+            min_distances[j] = std::min(min_distances[j], distance);
+        }
+    }
+    for (std::size_t i = 0; i < polygons.indices.size(); i++)
+    {
+        for (std::size_t j = 0; j < num_points; j++)
+        {
+            double distance = polygonContains(i, xs[j], ys[j])
+                                  ? 0
+                                  : polygonEdgeDistance(i, xs[j], ys[j]);
+            min_distances[j] = std::min(min_distances[j], distance);
+        }
+    }
+    return min_distances;
+}
+
+bool FlatObstacleSet::obstacleContains(const Location& location, double px,
+                                       double py) const
+{
+    const std::size_t i = location.position;
+    switch (location.shape)
+    {
+        case Shape::CIRCLE:
+        {
+            double dx = circles.xs[i] - px;
+            double dy = circles.ys[i] - py;
+            return dx * dx + dy * dy <= circles.radii[i] * circles.radii[i];
+        }
+        case Shape::STADIUM:
+            return distanceSquaredToSegment(px, py, stadiums.start_xs[i],
+                                            stadiums.start_ys[i], stadiums.end_xs[i],
+                                            stadiums.end_ys[i]) <=
+                   stadiums.radii[i] * stadiums.radii[i];
+        case Shape::RECTANGLE:
+            return px >= rectangles.min_xs[i] && py >= rectangles.min_ys[i] &&
+                   px <= rectangles.max_xs[i] && py <= rectangles.max_ys[i];
+        case Shape::POLYGON:
+            return polygonContains(i, px, py);
+    }
+    return false;
+}
+
+bool FlatObstacleSet::polygonContains(std::size_t polygon, double px, double py) const
+{
+    // See contains(Polygon, Point) for a description of this algorithm
+    bool point_is_contained = false;
+    std::size_t begin       = polygons.vertex_offsets[polygon];
+    std::size_t end         = polygons.vertex_offsets[polygon + 1];
+    for (std::size_t i = begin, j = end - 1; i < end; j = i++)
+    {
+        double pix                 = polygons.vertex_xs[i];
+        double piy                 = polygons.vertex_ys[i];
+        double pjx                 = polygons.vertex_xs[j];
+        double pjy                 = polygons.vertex_ys[j];
+        bool p_within_edge_y_range = (piy > py) != (pjy > py);
+        bool p_in_half_plane_to_left_of_extended_edge =
+            (pjy == piy) || (px < (pjx - pix) * (py - piy) / (pjy - piy) + pix);
+
+        if (p_within_edge_y_range && p_in_half_plane_to_left_of_extended_edge)
+        {
+            point_is_contained = !point_is_contained;
+        }
+    }
+    return point_is_contained;
+}
+
+double FlatObstacleSet::polygonEdgeDistance(std::size_t polygon, double px,
+                                            double py) const
+{
+    double min_distance_squared = std::numeric_limits<double>::max();
+    std::size_t begin           = polygons.vertex_offsets[polygon];
+    std::size_t end             = polygons.vertex_offsets[polygon + 1];
+    for (std::size_t i = begin; i < end; i++)
+    {
+        std::size_t next = i + 1 < end ? i + 1 : begin;
+        min_distance_squared =
+            std::min(min_distance_squared,
+                     distanceSquaredToSegment(px, py, polygons.vertex_xs[i],
+                                              polygons.vertex_ys[i],
+                                              polygons.vertex_xs[next],
+                                              polygons.vertex_ys[next]));
+    }
+    return std::sqrt(min_distance_squared);
+}
+
+FlatObstacleSet::Flattener::Flattener(FlatObstacleSet& obstacle_set)
+    : obstacle_set(obstacle_set), index(0)
+{
+}
+
+void FlatObstacleSet::Flattener::setIndex(std::size_t index)
+{
+    this->index = index;
+}
+
+void FlatObstacleSet::Flattener::visit(const GeomObstacle<Circle>& geom_obstacle)
+{
+    Circle circle = geom_obstacle.getGeom();
+    obstacle_set.locations[index] = {Shape::CIRCLE, obstacle_set.circles.indices.size()};
+    obstacle_set.circles.indices.push_back(index);
+    obstacle_set.circles.xs.push_back(circle.origin().x());
+    obstacle_set.circles.ys.push_back(circle.origin().y());
+    obstacle_set.circles.radii.push_back(circle.radius());
+}
+
+void FlatObstacleSet::Flattener::visit(const GeomObstacle<Polygon>& geom_obstacle)
+{
+    Polygon polygon = geom_obstacle.getGeom();
+    obstacle_set.locations[index] = {Shape::POLYGON,
+                                     obstacle_set.polygons.indices.size()};
+    obstacle_set.polygons.indices.push_back(index);
+    for (const Point& vertex : polygon.getPoints())
+    {
+        obstacle_set.polygons.vertex_xs.push_back(vertex.x());
+        obstacle_set.polygons.vertex_ys.push_back(vertex.y());
+    }
+    obstacle_set.polygons.vertex_offsets.push_back(
+        obstacle_set.polygons.vertex_xs.size());
+}
+
+void FlatObstacleSet::Flattener::visit(const GeomObstacle<Rectangle>& geom_obstacle)
+{
+    // The maximum corner is computed the same way as contains(Rectangle, Point) does
+    Rectangle rectangle = geom_obstacle.getGeom();
+    obstacle_set.locations[index] = {Shape::RECTANGLE,
+                                     obstacle_set.rectangles.indices.size()};
+    obstacle_set.rectangles.indices.push_back(index);
+    obstacle_set.rectangles.min_xs.push_back(rectangle.negXNegYCorner().x());
+    obstacle_set.rectangles.min_ys.push_back(rectangle.negXNegYCorner().y());
+    obstacle_set.rectangles.max_xs.push_back(rectangle.negXNegYCorner().x() +
+                                             rectangle.diagonal().x());
+    obstacle_set.rectangles.max_ys.push_back(rectangle.negXNegYCorner().y() +
+                                             rectangle.diagonal().y());
+}
+
+void FlatObstacleSet::Flattener::visit(const GeomObstacle<Stadium>& geom_obstacle)
+{
+    Stadium stadium = geom_obstacle.getGeom();
+    obstacle_set.locations[index] = {Shape::STADIUM,
+                                     obstacle_set.stadiums.indices.size()};
+    obstacle_set.stadiums.indices.push_back(index);
+    obstacle_set.stadiums.start_xs.push_back(stadium.segment().getStart().x());
+    obstacle_set.stadiums.start_ys.push_back(stadium.segment().getStart().y());
+    obstacle_set.stadiums.end_xs.push_back(stadium.segment().getEnd().x());
+    obstacle_set.stadiums.end_ys.push_back(stadium.segment().getEnd().y());
+    obstacle_set.stadiums.radii.push_back(stadium.radius());
+}
@@ -0,0 +1,240 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "software/ai/navigator/obstacle/obstacle.hpp"
+#include "software/ai/navigator/obstacle/obstacle_visitor.h"
+#include "software/geom/point.h"
+
+/**
+ * A set of obstacles flattened into plain arrays of the parameters of each shape, so
+ * that many points can be checked against all of them without a virtual call per
+ * obstacle per point.
+ *
+ * The results match calling the same functions on each Obstacle, and obstacles are
+ * referred to by their index in the list the set was created from.
+ */
+class FlatObstacleSet
+{
+   public:
+    /**
+     * Creates an empty FlatObstacleSet
+     */
+    explicit FlatObstacleSet() = default;
+
+    /**
+     * Creates a new FlatObstacleSet from the given obstacles
+     *
+     * @param obstacles The obstacles to flatten
+     */
+    explicit FlatObstacleSet(const std::vector<ObstaclePtr>& obstacles);
+
+    /**
+     * Gets the number of obstacles in this set
+     *
+     * @return the number of obstacles in this set
+     */
+    std::size_t size() const;
+
+    /**
+     * Determines whether the given point is contained within any of the obstacles
+     *
+     * @param point The point to check
+     *
+     * @return whether the point is contained within any of the obstacles
+     */
+    bool contains(const Point& point) const;
+
+    /**
+     * Determines which of the given points are contained within any of the obstacles
+     *
+     * @param points The points to check
+     *
+     * @return whether each point is contained within any of the obstacles
+     */
+    std::vector<bool> contains(const std::vector<Point>& points) const;
+
+    /**
+     * Finds the first obstacle that contains the given point
+     *
+     * @param point The point to check
+     *
+     * @return the lowest index of the obstacles that contain the point, or
+     * std::nullopt if no obstacle contains it
+     */
+    std::optional<std::size_t> findContainingObstacle(const Point& point) const;
+
+    /**
+     * Determines whether the given point is contained within any of the obstacles with
+     * the given indices. Only those obstacles are checked, so this is cheaper than
+     * contains(point) when most obstacles are already known to be out of the way
+     *
+     * @param point The point to check
+     * @param indices The indices of the obstacles to check
+     *
+     * @return whether the point is contained within any of the given obstacles
+     */
+    bool contains(const Point& point, const std::vector<unsigned int>& indices) const;
+
+    /**
+     * Finds the first of the obstacles with the given indices that contains the given
+     * point
+     *
+     * @param point The point to check
+     * @param indices The indices of the obstacles to check, in increasing order
+     *
+     * @return the lowest of the given indices whose obstacle contains the point, or
+     * std::nullopt if none of them contain it
+     */
+    std::optional<std::size_t> findContainingObstacle(
+        const Point& point, const std::vector<unsigned int>& indices) const;
+
+    /**
+     * Gets the minimum distance from any of the obstacles to the given point
+     *
+     * @param point The point to get the distance to
+     *
+     * @return the distance to the closest obstacle, or infinity if there are no
+     * obstacles
+     */
+    double distance(const Point& point) const;
+
+    /**
+     * Gets the minimum distance from any of the obstacles to each of the given points
+     *
+     * @param points The points to get the distances to
+     *
+     * @return the distance from each point to the closest obstacle, or infinity if
+     * there are no obstacles
+     */
+    std::vector<double> distance(const std::vector<Point>& points) const;
+
+   private:
+    // The obstacles of each shape, with the parameters of each obstacle at the same
+    // position in every array
+    struct Circles
+    {
+        std::vector<std::size_t> indices;
+        std::vector<double> xs;
+        std::vector<double> ys;
+        std::vector<double> radii;
+    };
+
+    struct Stadiums
+    {
+        std::vector<std::size_t> indices;
+        std::vector<double> start_xs;
+        std::vector<double> start_ys;
+        std::vector<double> end_xs;
+        std::vector<double> end_ys;
+        std::vector<double> radii;
+    };
+
+    struct Rectangles
+    {
+        std::vector<std::size_t> indices;
+        std::vector<double> min_xs;
+        std::vector<double> min_ys;
+        std::vector<double> max_xs;
+        std::vector<double> max_ys;
+    };
+
+    // The vertices of every polygon are stored one after the other, and the vertices
+    // of the polygon at position i are between vertex_offsets[i] and
+    // vertex_offsets[i + 1]
+    struct Polygons
+    {
+        std::vector<std::size_t> indices;
+        std::vector<std::size_t> vertex_offsets = {0};
+        std::vector<double> vertex_xs;
+        std::vector<double> vertex_ys;
+    };
+
+    // Where the obstacle with some index is stored: its shape, and its position in
+    // the arrays of that shape
+    enum class Shape
+    {
+        CIRCLE,
+        STADIUM,
+        RECTANGLE,
+        POLYGON
+    };
+
+    struct Location
+    {
+        Shape shape;
+        std::size_t position;
+    };
+
+    /**
+     * Flattens each obstacle it visits into the arrays of its shape
+     */
+    class Flattener : public ObstacleVisitor
+    {
+       public:
+        /**
+         * Creates a new Flattener
+         *
+         * @param obstacle_set The set to add the visited obstacles to
+         */
+        explicit Flattener(FlatObstacleSet& obstacle_set);
+
+        /**
+         * Sets the index that the next visited obstacle is added with
+         *
+         * @param index The index of the next obstacle
+         */
+        void setIndex(std::size_t index);
+
+        void visit(const GeomObstacle<Circle>& geom_obstacle) override;
+        void visit(const GeomObstacle<Polygon>& geom_obstacle) override;
+        void visit(const GeomObstacle<Rectangle>& geom_obstacle) override;
+        void visit(const GeomObstacle<Stadium>& geom_obstacle) override;
+
+       private:
+        FlatObstacleSet& obstacle_set;
+        std::size_t index;
+    };
+
+    /**
+     * Checks if the given point is contained within the obstacle at the given location
+     *
+     * @param location The location of the obstacle
+     * @param px The x coordinate of the point
+     * @param py The y coordinate of the point
+     *
+     * @return whether the point is contained within the obstacle
+     */
+    bool obstacleContains(const Location& location, double px, double py) const;
+
+    /**
+     * Checks if the given point is contained within the polygon at the given position,
+     * using the same algorithm as contains(Polygon, Point)
+     *
+     * @param polygon The position of the polygon in the polygon arrays
+     * @param px The x coordinate of the point
+     * @param py The y coordinate of the point
+     *
+     * @return whether the point is contained within the polygon
+     */
+    bool polygonContains(std::size_t polygon, double px, double py) const;
+
+    /**
+     * Gets the distance from the given point to the boundary of the polygon at the
+     * given position
+     *
+     * @param polygon The position of the polygon in the polygon arrays
+     * @param px The x coordinate of the point
+     * @param py The y coordinate of the point
+     *
+     * @return the distance from the point to the closest edge of the polygon
+     */
+    double polygonEdgeDistance(std::size_t polygon, double px, double py) const;
+
+    Circles circles;
+    Stadiums stadiums;
+    Rectangles rectangles;
+    Polygons polygons;
+    std::vector<Location> locations;
+};
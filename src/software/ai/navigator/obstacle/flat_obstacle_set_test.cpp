@@ -0,0 +1,199 @@
+#include "software/ai/navigator/obstacle/flat_obstacle_set.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <random>
+
+#include "software/geom/circle.h"
+#include "software/geom/polygon.h"
+#include "software/geom/rectangle.h"
+#include "software/geom/stadium.h"
+
+class FlatObstacleSetTest : public testing::Test
+{
+   protected:
+    FlatObstacleSetTest()
+        : obstacles({
+              std::make_shared<GeomObstacle<Circle>>(Circle(Point(1, 1), 0.5)),
+              std::make_shared<GeomObstacle<Rectangle>>(
+                  Rectangle(Point(-2, -1), Point(-1, 1))),
+              std::make_shared<GeomObstacle<Stadium>>(
+                  Stadium(Point(0, -2), Point(2, -1), 0.3)),
+              // A concave polygon, so points in its notch are outside it
+              std::make_shared<GeomObstacle<Polygon>>(Polygon({
+                  Point(2, 1),
+                  Point(3, 1),
+                  Point(3, 3),
+                  Point(2.5, 2),
+                  Point(2, 3),
+              })),
+              std::make_shared<GeomObstacle<Circle>>(Circle(Point(1.2, 1), 0.5)),
+              std::make_shared<GeomObstacle<Polygon>>(
+                  Rectangle(Point(-3, -3), Point(-1.5, -0.5))),
+          }),
+          flat_obstacles(obstacles)
+    {
+    }
+
+    /**
+     * Creates random points around the obstacles
+     *
+     * @param num_points The number of points to create
+     *
+     * @return the random points
+     */
+    static std::vector<Point> createRandomPoints(std::size_t num_points)
+    {
+        std::mt19937 random_num_gen;
+        std::uniform_real_distribution coordinate_distribution(-4.0, 4.0);
+
+        std::vector<Point> points;
+        for (std::size_t i = 0; i < num_points; i++)
+        {
+            points.emplace_back(coordinate_distribution(random_num_gen),
+                                coordinate_distribution(random_num_gen));
+        }
+        return points;
+    }
+
+    std::vector<ObstaclePtr> obstacles;
+    FlatObstacleSet flat_obstacles;
+};
+
+TEST_F(FlatObstacleSetTest, empty_set)
+{
+    FlatObstacleSet empty_obstacles(std::vector<ObstaclePtr>{});
+
+    EXPECT_EQ(0, empty_obstacles.size());
+    EXPECT_FALSE(empty_obstacles.contains(Point(0, 0)));
+    EXPECT_EQ(std::nullopt, empty_obstacles.findContainingObstacle(Point(0, 0)));
+    EXPECT_EQ(std::numeric_limits<double>::infinity(),
+              empty_obstacles.distance(Point(0, 0)));
+}
+
+TEST_F(FlatObstacleSetTest, size)
+{
+    EXPECT_EQ(obstacles.size(), flat_obstacles.size());
+}
+
+TEST_F(FlatObstacleSetTest, find_containing_obstacle_returns_lowest_index)
+{
+    // Inside both of the overlapping circles
+    EXPECT_EQ(0, flat_obstacles.findContainingObstacle(Point(1.1, 1)));
+    // Only inside the second circle
+    EXPECT_EQ(4, flat_obstacles.findContainingObstacle(Point(1.6, 1)));
+    // In the notch of the concave polygon
+    EXPECT_EQ(std::nullopt, flat_obstacles.findContainingObstacle(Point(2.5, 2.5)));
+}
+
+TEST_F(FlatObstacleSetTest, contains_matches_obstacles)
+{
+    std::vector<Point> points       = createRandomPoints(2000);
+    std::vector<bool> flat_contains = flat_obstacles.contains(points);
+
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        std::optional<std::size_t> first_containing_obstacle;
+        for (std::size_t j = 0; j < obstacles.size(); j++)
+        {
+            if (obstacles[j]->contains(points[i]))
+            {
+                first_containing_obstacle = j;
+                break;
+            }
+        }
+
+        EXPECT_EQ(first_containing_obstacle,
+                  flat_obstacles.findContainingObstacle(points[i]))
+            << points[i];
+        EXPECT_EQ(first_containing_obstacle.has_value(), flat_contains[i]) << points[i];
+        EXPECT_EQ(first_containing_obstacle.has_value(),
+                  flat_obstacles.contains(points[i]))
+            << points[i];
+    }
+}
+
+TEST_F(FlatObstacleSetTest, distance_matches_obstacles)
+{
+    std::vector<Point> points          = createRandomPoints(2000);
+    std::vector<double> flat_distances = flat_obstacles.distance(points);
+
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        double min_distance = std::numeric_limits<double>::infinity();
+        for (const ObstaclePtr& obstacle : obstacles)
+        {
+            min_distance = std::min(min_distance, obstacle->distance(points[i]));
+        }
+
+        EXPECT_NEAR(min_distance, flat_distances[i], 1e-12) << points[i];
+        EXPECT_NEAR(min_distance, flat_obstacles.distance(points[i]), 1e-12)
+            << points[i];
+    }
+}
+
+TEST_F(FlatObstacleSetTest, only_the_given_obstacles_are_checked)
+{
+    const std::vector<unsigned int> indices = {1, 2, 3, 4, 5};
+
+    // The first circle is not checked
+    EXPECT_EQ(4, flat_obstacles.findContainingObstacle(Point(1.1, 1), indices));
+    EXPECT_EQ(3, flat_obstacles.findContainingObstacle(Point(2.5, 1.5), indices));
+    EXPECT_EQ(std::nullopt,
+              flat_obstacles.findContainingObstacle(Point(0.6, 1), indices));
+    EXPECT_EQ(std::nullopt, flat_obstacles.findContainingObstacle(Point(1, 1), {}));
+
+    std::vector<Point> points = createRandomPoints(500);
+    for (const Point& point : points)
+    {
+        std::optional<std::size_t> expected_index;
+        for (unsigned int index : indices)
+        {
+            if (obstacles[index]->contains(point))
+            {
+                expected_index = index;
+                break;
+            }
+        }
+        EXPECT_EQ(expected_index, flat_obstacles.findContainingObstacle(point, indices))
+            << point;
+        EXPECT_EQ(expected_index.has_value(), flat_obstacles.contains(point, indices))
+            << point;
+    }
+}
+
+TEST_F(FlatObstacleSetTest, DISABLED_contains_speed_test)
+{
+    std::vector<Point> points = createRandomPoints(100000);
+
+    auto start_time                   = std::chrono::system_clock::now();
+    std::size_t num_contained_virtual = 0;
+    for (const Point& point : points)
+    {
+        for (const ObstaclePtr& obstacle : obstacles)
+        {
+            if (obstacle->contains(point))
+            {
+                num_contained_virtual++;
+                break;
+            }
+        }
+    }
+    double virtual_time_ms = std::chrono::duration<double, std::milli>(
+                                 std::chrono::system_clock::now() - start_time)
+                                 .count();
+
+    start_time                  = std::chrono::system_clock::now();
+    std::vector<bool> contained = flat_obstacles.contains(points);
+    double flat_time_ms         = std::chrono::duration<double, std::milli>(
+                              std::chrono::system_clock::now() - start_time)
+                              .count();
+
+    EXPECT_EQ(num_contained_virtual,
+              static_cast<std::size_t>(
+                  std::count(contained.begin(), contained.end(), true)));
+    std::cout << "Checking " << points.size() << " points against " << obstacles.size()
+              << " obstacles took " << virtual_time_ms << "ms with virtual calls and "
+              << flat_time_ms << "ms with the flat obstacle set" << std::endl;
+}
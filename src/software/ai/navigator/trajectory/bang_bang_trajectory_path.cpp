@@ -0,0 +1,131 @@
+#include "software/ai/navigator/trajectory/bang_bang_trajectory_path.h"
+
+BangBangTrajectoryPath::BangBangTrajectoryPath()
+    : BangBangTrajectoryPath(Point(), Point(), Vector(), KinematicConstraints(1, 1, 1))
+{
+}
+
+BangBangTrajectoryPath::BangBangTrajectoryPath(const Point& initial_pos,
+                                               const Point& final_pos,
+                                               const Vector& initial_vel,
+                                               const KinematicConstraints& constraints)
+    : trajectories(), trajectory_end_times_s(), num_trajectories(0)
+{
+    generate(initial_pos, final_pos, initial_vel, constraints);
+}
+
+void BangBangTrajectoryPath::generate(const Point& initial_pos, const Point& final_pos,
+                                      const Vector& initial_vel,
+                                      const KinematicConstraints& constraints)
+{
+    trajectories[0].generate(initial_pos, final_pos, initial_vel,
+                             constraints.getMaxVelocity(),
+                             constraints.getMaxAcceleration(),
+                             constraints.getMaxDeceleration());
+    trajectory_end_times_s[0] = trajectories[0].getTotalTime();
+    num_trajectories          = 1;
+}
+
+bool BangBangTrajectoryPath::append(double connection_time_sec,
+                                    const Point& destination,
+                                    const KinematicConstraints& constraints)
+{
+    // Find the trajectory that the new trajectory should connect to
+    for (std::size_t i = 0; i < num_trajectories; i++)
+    {
+        if (connection_time_sec <= trajectory_end_times_s[i])
+        {
+            // Drop all trajectories after the one that is at the connection time
+            num_trajectories = i + 1;
+            if (num_trajectories == MAX_TRAJECTORIES)
+            {
+                return false;
+            }
+
+            // To have a smooth and continuous trajectory path, we want the start
+            // position and velocity of the newly generated trajectory to be
+            // the end position and velocity of the last trajectory.
+            Point connection_pos  = getPosition(connection_time_sec);
+            Vector connection_vel = getVelocity(connection_time_sec);
+
+            BangBangTrajectory2D& new_trajectory = trajectories[num_trajectories];
+            new_trajectory.generate(connection_pos, destination, connection_vel,
+                                    constraints.getMaxVelocity(),
+                                    constraints.getMaxAcceleration(),
+                                    constraints.getMaxDeceleration());
+            trajectory_end_times_s[num_trajectories] = new_trajectory.getTotalTime();
+            trajectory_end_times_s[i]                = connection_time_sec;
+            num_trajectories++;
+            return true;
+        }
+        else
+        {
+            connection_time_sec -= trajectory_end_times_s[i];
+        }
+    }
+    return true;
+}
+
+std::size_t BangBangTrajectoryPath::findTrajectory(double& t_sec) const
+{
+    for (std::size_t i = 0; i < num_trajectories; i++)
+    {
+        if (t_sec <= trajectory_end_times_s[i])
+        {
+            return i;
+        }
+        t_sec -= trajectory_end_times_s[i];
+    }
+    return num_trajectories;
+}
+
+Point BangBangTrajectoryPath::getPosition(double t_sec) const
+{
+    std::size_t i = findTrajectory(t_sec);
+    if (i == num_trajectories)
+    {
+        return getDestination();
+    }
+    return trajectories[i].getPosition(t_sec);
+}
+
+Vector BangBangTrajectoryPath::getVelocity(double t_sec) const
+{
+    std::size_t i = findTrajectory(t_sec);
+    if (i == num_trajectories)
+    {
+        return Vector();
+    }
+    return trajectories[i].getVelocity(t_sec);
+}
+
+Vector BangBangTrajectoryPath::getAcceleration(double t_sec) const
+{
+    std::size_t i = findTrajectory(t_sec);
+    if (i == num_trajectories)
+    {
+        return Vector();
+    }
+    return trajectories[i].getAcceleration(t_sec);
+}
+
+double BangBangTrajectoryPath::getTotalTime() const
+{
+    double total_time = 0.0;
+    for (std::size_t i = 0; i < num_trajectories; i++)
+    {
+        total_time += trajectory_end_times_s[i];
+    }
+    return total_time;
+}
+
+Point BangBangTrajectoryPath::getDestination() const
+{
+    const BangBangTrajectory2D& last_trajectory = trajectories[num_trajectories - 1];
+    return last_trajectory.getPosition(last_trajectory.getTotalTime());
+}
+
+std::size_t BangBangTrajectoryPath::getNumTrajectories() const
+{
+    return num_trajectories;
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "software/ai/navigator/trajectory/bang_bang_trajectory_2d.h"
+#include "software/ai/navigator/trajectory/kinematic_constraints.h"
+
+/**
+ * BangBangTrajectoryPath represents a list of BangBangTrajectory2Ds that are connected
+ * end-to-end to form a path, like TrajectoryPath. Unlike TrajectoryPath, the
+ * trajectories are stored by value in a fixed size array and are not accessed through
+ * the Trajectory2D interface, so the path can be generated and evaluated without
+ * allocating or making virtual calls. This makes it suitable for the robot's control
+ * loop.
+ */
+class BangBangTrajectoryPath
+{
+   public:
+    static constexpr std::size_t MAX_TRAJECTORIES = 8;
+
+    /**
+     * Creates a path with a single trajectory that stays at the origin
+     */
+    BangBangTrajectoryPath();
+
+    /**
+     * Constructor
+     *
+     * @param initial_pos The initial position of the path
+     * @param final_pos The destination of the initial trajectory of the path
+     * @param initial_vel The initial velocity of the path
+     * @param constraints Constraints of the initial trajectory
+     */
+    BangBangTrajectoryPath(const Point& initial_pos, const Point& final_pos,
+                           const Vector& initial_vel,
+                           const KinematicConstraints& constraints);
+
+    /**
+     * Replaces the path with a single trajectory, reusing the storage of the path
+     *
+     * @param initial_pos The initial position of the path
+     * @param final_pos The destination of the initial trajectory of the path
+     * @param initial_vel The initial velocity of the path
+     * @param constraints Constraints of the initial trajectory
+     */
+    void generate(const Point& initial_pos, const Point& final_pos,
+                  const Vector& initial_vel, const KinematicConstraints& constraints);
+
+    /**
+     * Generate and append a new trajectory to the end of this trajectory path, the same
+     * way as TrajectoryPath::append. If the connection time is past the end of the path,
+     * the path is left unchanged
+     *
+     * @param connection_time_sec The time where the last existing trajectory should
+     * connect to the newly generated trajectory
+     * @param destination Destination of the newly generated trajectory
+     * @param constraints Constraints of the new generated trajectory
+     *
+     * @return false if the trajectory could not be appended because the path would
+     * have more than MAX_TRAJECTORIES trajectories, true otherwise
+     */
+    bool append(double connection_time_sec, const Point& destination,
+                const KinematicConstraints& constraints);
+
+    /**
+     * Get the position at time t of this trajectory path
+     *
+     * @param t_sec The time elapsed since the start of the trajectory path
+     * @return The position at time t
+     */
+    Point getPosition(double t_sec) const;
+
+    /**
+     * Get the velocity at time t of this trajectory path
+     *
+     * @param t_sec The time elapsed since the start of the trajectory path
+     * @return The velocity at time t
+     */
+    Vector getVelocity(double t_sec) const;
+
+    /**
+     * Get the acceleration at time t of this trajectory path
+     *
+     * @param t_sec The time elapsed since the start of the trajectory path
+     * @return The acceleration at time t
+     */
+    Vector getAcceleration(double t_sec) const;
+
+    /**
+     * Get the total duration of the trajectory until it reaches the destination
+     *
+     * @return The total duration for this trajectory path
+     */
+    double getTotalTime() const;
+
+    /**
+     * Get the final destination of this trajectory path
+     *
+     * @return The position which the trajectory path ends at
+     */
+    Point getDestination() const;
+
+    /**
+     * Get the number of trajectories that make up this trajectory path
+     *
+     * @return The number of trajectories
+     */
+    std::size_t getNumTrajectories() const;
+
+   private:
+    /**
+     * Finds the trajectory that is running at time t, and the time elapsed since the
+     * start of that trajectory
+     *
+     * @param t_sec The time elapsed since the start of the trajectory path, which is
+     * set to the time elapsed since the start of the found trajectory
+     * @return The index of the trajectory, or num_trajectories if t is past the end of
+     * the path
+     */
+    std::size_t findTrajectory(double& t_sec) const;
+
+    std::array<BangBangTrajectory2D, MAX_TRAJECTORIES> trajectories;
+
+    // The time at which each trajectory ends and the next one begins, relative to the
+    // start of that trajectory
+    std::array<double, MAX_TRAJECTORIES> trajectory_end_times_s;
+
+    std::size_t num_trajectories;
+};
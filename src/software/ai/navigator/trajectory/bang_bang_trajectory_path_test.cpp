@@ -0,0 +1,136 @@
+#include "software/ai/navigator/trajectory/bang_bang_trajectory_path.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "software/ai/navigator/trajectory/trajectory_path.h"
+#include "software/test_util/test_util.h"
+
+class BangBangTrajectoryPathTest : public testing::Test
+{
+   public:
+    // Use a fixed seed for the random number generator so that the tests are
+    // deterministic
+    BangBangTrajectoryPathTest()
+        : rng(1010), pos_uniform_dist(-5, 5), vel_uniform_dist(-2, 2)
+    {
+    }
+
+   protected:
+    static const int NUM_SUB_POINTS   = 50;
+    static const int NUM_RANDOM_TESTS = 200;
+
+    /**
+     * Checks that the given paths have the same position and velocity along their
+     * whole duration
+     *
+     * @param path The path stored by value
+     * @param expected_path The equivalent TrajectoryPath
+     */
+    void expectSamePath(const BangBangTrajectoryPath& path,
+                        const TrajectoryPath& expected_path)
+    {
+        ASSERT_EQ(expected_path.getTrajectoryPathNodes().size(),
+                  path.getNumTrajectories());
+        EXPECT_DOUBLE_EQ(expected_path.getTotalTime(), path.getTotalTime());
+        EXPECT_TRUE(TestUtil::equalWithinTolerance(expected_path.getDestination(),
+                                                   path.getDestination()));
+
+        // Check slightly past the end of the path too
+        double sub_point_length_sec = path.getTotalTime() / NUM_SUB_POINTS;
+        for (int i = 0; i <= NUM_SUB_POINTS + 2; i++)
+        {
+            double t = i * sub_point_length_sec;
+            EXPECT_TRUE(TestUtil::equalWithinTolerance(expected_path.getPosition(t),
+                                                       path.getPosition(t)))
+                << "Position differs at t=" << t;
+            EXPECT_TRUE(TestUtil::equalWithinTolerance(expected_path.getVelocity(t),
+                                                       path.getVelocity(t)))
+                << "Velocity differs at t=" << t;
+        }
+    }
+
+    Point randomPoint()
+    {
+        return Point(pos_uniform_dist(rng), pos_uniform_dist(rng));
+    }
+
+    Vector randomVelocity()
+    {
+        return Vector(vel_uniform_dist(rng), vel_uniform_dist(rng));
+    }
+
+    KinematicConstraints constraints = KinematicConstraints(3.0, 3.0, 3.0);
+    std::mt19937 rng;
+    std::uniform_real_distribution<double> pos_uniform_dist;
+    std::uniform_real_distribution<double> vel_uniform_dist;
+};
+
+TEST_F(BangBangTrajectoryPathTest, single_trajectory_matches_trajectory_path)
+{
+    for (int i = 0; i < NUM_RANDOM_TESTS; i++)
+    {
+        Point initial_pos = randomPoint();
+        Point final_pos   = randomPoint();
+        Vector initial_vel = randomVelocity();
+
+        BangBangTrajectoryPath path(initial_pos, final_pos, initial_vel, constraints);
+        TrajectoryPath expected_path(
+            std::make_shared<BangBangTrajectory2D>(initial_pos, final_pos, initial_vel,
+                                                   constraints),
+            BangBangTrajectory2D::generator);
+
+        expectSamePath(path, expected_path);
+    }
+}
+
+TEST_F(BangBangTrajectoryPathTest, appended_trajectories_match_trajectory_path)
+{
+    for (int i = 0; i < NUM_RANDOM_TESTS; i++)
+    {
+        Point initial_pos   = randomPoint();
+        Point sub_dest      = randomPoint();
+        Point final_pos     = randomPoint();
+        Vector initial_vel  = randomVelocity();
+        BangBangTrajectory2D initial_trajectory(initial_pos, sub_dest, initial_vel,
+                                                constraints);
+        double connection_time_s =
+            initial_trajectory.getTotalTime() * (i % 10) / 10.0;
+
+        BangBangTrajectoryPath path(initial_pos, sub_dest, initial_vel, constraints);
+        EXPECT_TRUE(path.append(connection_time_s, final_pos, constraints));
+        TrajectoryPath expected_path(
+            std::make_shared<BangBangTrajectory2D>(initial_trajectory),
+            BangBangTrajectory2D::generator);
+        expected_path.append(connection_time_s, final_pos, constraints);
+
+        expectSamePath(path, expected_path);
+    }
+}
+
+TEST_F(BangBangTrajectoryPathTest, generate_replaces_path)
+{
+    BangBangTrajectoryPath path(Point(0, 0), Point(1, 0), Vector(), constraints);
+    EXPECT_TRUE(path.append(0.1, Point(1, 1), constraints));
+    EXPECT_EQ(2, path.getNumTrajectories());
+
+    path.generate(Point(2, 2), Point(-1, 3), Vector(1, 0), constraints);
+    TrajectoryPath expected_path(
+        std::make_shared<BangBangTrajectory2D>(Point(2, 2), Point(-1, 3), Vector(1, 0),
+                                               constraints),
+        BangBangTrajectory2D::generator);
+    expectSamePath(path, expected_path);
+}
+
+TEST_F(BangBangTrajectoryPathTest, append_to_full_path_fails)
+{
+    BangBangTrajectoryPath path(Point(0, 0), Point(1, 0), Vector(), constraints);
+    for (std::size_t i = 1; i < BangBangTrajectoryPath::MAX_TRAJECTORIES; i++)
+    {
+        EXPECT_TRUE(path.append(path.getTotalTime() / 2,
+                                Point(static_cast<double>(i), 1), constraints));
+    }
+    EXPECT_EQ(BangBangTrajectoryPath::MAX_TRAJECTORIES, path.getNumTrajectories());
+    EXPECT_FALSE(path.append(path.getTotalTime() / 2, Point(0, 0), constraints));
+}
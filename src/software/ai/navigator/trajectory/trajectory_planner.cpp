@@ -1,5 +1,7 @@
 #include "software/ai/navigator/trajectory/trajectory_planner.h"
 
+#include <algorithm>
+
 TrajectoryPlanner::TrajectoryPlanner()
     : relative_sub_destinations(getRelativeSubDestinations())
 {
@@ -71,9 +73,11 @@ std::optional<TrajectoryPath> TrajectoryPlanner::findTrajectory(
         std::vector aabb_upper = {aabb.posXPosYCorner().x(), aabb.posXPosYCorner().y()};
         tree.insertParticle(i, aabb_lower, aabb_upper);
     }
+    FlatObstacleSet flat_obstacles(obstacles);
 
-    TrajectoryPathWithCost best_traj_with_cost = getDirectTrajectoryWithCost(
-        start, destination, initial_velocity, constraints, tree, obstacles);
+    TrajectoryPathWithCost best_traj_with_cost =
+        getDirectTrajectoryWithCost(start, destination, initial_velocity, constraints,
+                                    tree, obstacles, flat_obstacles);
 
     // Return direct trajectory to the destination if it doesn't have any collisions
     if (!best_traj_with_cost.collides())
@@ -86,8 +90,9 @@ std::optional<TrajectoryPath> TrajectoryPlanner::findTrajectory(
     for (const Point &sub_dest : getSubDestinations(start, destination, navigable_area))
     {
         // Generate a direct trajectory to the sub destination
-        TrajectoryPathWithCost sub_trajectory = getDirectTrajectoryWithCost(
-            start, sub_dest, initial_velocity, constraints, tree, obstacles);
+        TrajectoryPathWithCost sub_trajectory =
+            getDirectTrajectoryWithCost(start, sub_dest, initial_velocity, constraints,
+                                        tree, obstacles, flat_obstacles);
 
         for (double connection_time = SUB_DESTINATION_STEP_INTERVAL_SEC;
              connection_time <= sub_trajectory.traj_path.getTotalTime();
@@ -105,8 +110,9 @@ std::optional<TrajectoryPath> TrajectoryPlanner::findTrajectory(
                 break;
             }
 
-            TrajectoryPathWithCost full_traj_with_cost = getTrajectoryWithCost(
-                traj_path_to_dest, tree, obstacles, sub_trajectory, connection_time);
+            TrajectoryPathWithCost full_traj_with_cost =
+                getTrajectoryWithCost(traj_path_to_dest, tree, obstacles, flat_obstacles,
+                                      sub_trajectory, connection_time);
             if (full_traj_with_cost.cost < best_traj_with_cost.cost)
             {
                 best_traj_with_cost = full_traj_with_cost;
@@ -134,18 +140,18 @@ std::optional<TrajectoryPath> TrajectoryPlanner::findTrajectory(
 TrajectoryPathWithCost TrajectoryPlanner::getDirectTrajectoryWithCost(
     const Point &start, const Point &destination, const Vector &initial_velocity,
     const KinematicConstraints &constraints, aabb::Tree &obstacle_tree,
-    const std::vector<ObstaclePtr> &obstacles)
+    const std::vector<ObstaclePtr> &obstacles, const FlatObstacleSet &flat_obstacles)
 {
     return getTrajectoryWithCost(
         TrajectoryPath(std::make_shared<BangBangTrajectory2D>(
                            start, destination, initial_velocity, constraints),
                        BangBangTrajectory2D::generator),
-        obstacle_tree, obstacles, std::nullopt, std::nullopt);
+        obstacle_tree, obstacles, flat_obstacles, std::nullopt, std::nullopt);
 }
 
 TrajectoryPathWithCost TrajectoryPlanner::getTrajectoryWithCost(
     const TrajectoryPath &trajectory, aabb::Tree &obstacle_tree,
-    const std::vector<ObstaclePtr> &obstacles,
+    const std::vector<ObstaclePtr> &obstacles, const FlatObstacleSet &flat_obstacles,
     const std::optional<TrajectoryPathWithCost> &sub_traj_with_cost,
     const std::optional<double> sub_traj_duration_s)
 {
@@ -153,14 +159,20 @@ TrajectoryPathWithCost TrajectoryPlanner::getTrajectoryWithCost(
 
     // Get the list of obstacle indices that this trajectory path could collide with
     // This is used as an optimization to avoid checking every obstacle for collisions
-    std::set<unsigned int> possible_collisions_indices;
+    std::vector<unsigned int> possible_collisions_indices;
     for (const Rectangle &bounding_box : trajectory.getBoundingBoxes())
     {
         std::vector<unsigned int> bb_collisions =
             obstacle_tree.query(aabb::AABB({bounding_box.xMin(), bounding_box.yMin()},
                                            {bounding_box.xMax(), bounding_box.yMax()}));
-        possible_collisions_indices.insert(bb_collisions.begin(), bb_collisions.end());
+        possible_collisions_indices.insert(possible_collisions_indices.end(),
+                                           bb_collisions.begin(), bb_collisions.end());
     }
+    // Sorted so that collisions are reported with the obstacle of the lowest index
+    std::sort(possible_collisions_indices.begin(), possible_collisions_indices.end());
+    possible_collisions_indices.erase(std::unique(possible_collisions_indices.begin(),
+                                                  possible_collisions_indices.end()),
+                                      possible_collisions_indices.end());
 
     const double search_end_time_s =
         std::min(trajectory.getTotalTime(), MAX_FUTURE_COLLISION_CHECK_SEC);
@@ -178,8 +190,9 @@ TrajectoryPathWithCost TrajectoryPlanner::getTrajectoryWithCost(
     }
     else
     {
-        first_non_collision_time = getFirstNonCollisionTime(
-            trajectory, possible_collisions_indices, obstacles, search_end_time_s);
+        first_non_collision_time =
+            getFirstNonCollisionTime(trajectory, flat_obstacles,
+                                     possible_collisions_indices, search_end_time_s);
     }
     traj_with_cost.collision_duration_front_s = first_non_collision_time;
 
@@ -187,7 +200,7 @@ TrajectoryPathWithCost TrajectoryPlanner::getTrajectoryWithCost(
      * Find the duration we're within an obstacle before search_end_time_s
      */
     double last_non_collision_time = getLastNonCollisionTime(
-        trajectory, possible_collisions_indices, obstacles, search_end_time_s);
+        trajectory, flat_obstacles, possible_collisions_indices, search_end_time_s);
     traj_with_cost.collision_duration_back_s =
         search_end_time_s - last_non_collision_time;
 
@@ -205,8 +218,9 @@ TrajectoryPathWithCost TrajectoryPlanner::getTrajectoryWithCost(
     else
     {
         std::pair<double, ObstaclePtr> collision =
-            getFirstCollisionTime(trajectory, possible_collisions_indices, obstacles,
-                                  first_non_collision_time, last_non_collision_time);
+            getFirstCollisionTime(trajectory, flat_obstacles, possible_collisions_indices,
+                                  obstacles, first_non_collision_time,
+                                  last_non_collision_time);
         traj_with_cost.first_collision_time_s = collision.first;
         traj_with_cost.colliding_obstacle     = collision.second;
     }
@@ -246,25 +260,16 @@ double TrajectoryPlanner::calculateCost(
 }
 
 double TrajectoryPlanner::getFirstNonCollisionTime(
-    const TrajectoryPath &traj_path, const std::set<unsigned int> &obstacle_indices,
-    const std::vector<ObstaclePtr> &obstacles, const double search_end_time_s) const
+    const TrajectoryPath &traj_path, const FlatObstacleSet &flat_obstacles,
+    const std::vector<unsigned int> &possible_collisions_indices,
+    const double search_end_time_s) const
 {
     double path_duration = traj_path.getTotalTime();
     for (double time = 0.0; time <= search_end_time_s;
          time += FORWARD_COLLISION_CHECK_STEP_INTERVAL_SEC)
     {
-        Point position       = traj_path.getPosition(time);
-        bool collision_found = false;
-        for (unsigned int obstacle_index : obstacle_indices)
-        {
-            if (obstacles[obstacle_index]->contains(position))
-            {
-                collision_found = true;
-                break;
-            }
-        }
-
-        if (!collision_found)
+        if (!flat_obstacles.contains(traj_path.getPosition(time),
+                                     possible_collisions_indices))
         {
             return time;
         }
@@ -273,20 +278,20 @@ double TrajectoryPlanner::getFirstNonCollisionTime(
 }
 
 std::pair<double, ObstaclePtr> TrajectoryPlanner::getFirstCollisionTime(
-    const TrajectoryPath &traj_path, const std::set<unsigned int> &obstacle_indices,
+    const TrajectoryPath &traj_path, const FlatObstacleSet &flat_obstacles,
+    const std::vector<unsigned int> &possible_collisions_indices,
     const std::vector<ObstaclePtr> &obstacles, const double start_time_s,
     const double search_end_time_s) const
 {
     for (double time = start_time_s; time <= search_end_time_s;
          time += COLLISION_CHECK_STEP_INTERVAL_SEC)
     {
-        Point position = traj_path.getPosition(time);
-        for (unsigned int obstacle_index : obstacle_indices)
+        std::optional<std::size_t> obstacle_index =
+            flat_obstacles.findContainingObstacle(traj_path.getPosition(time),
+                                                  possible_collisions_indices);
+        if (obstacle_index)
         {
-            if (obstacles[obstacle_index]->contains(position))
-            {
-                return std::make_pair(time, obstacles[obstacle_index]);
-            }
+            return std::make_pair(time, obstacles[*obstacle_index]);
         }
     }
 
@@ -295,24 +300,15 @@ std::pair<double, ObstaclePtr> TrajectoryPlanner::getFirstCollisionTime(
 }
 
 double TrajectoryPlanner::getLastNonCollisionTime(
-    const TrajectoryPath &traj_path, const std::set<unsigned int> &obstacle_indices,
-    const std::vector<ObstaclePtr> &obstacles, const double search_end_time_s) const
+    const TrajectoryPath &traj_path, const FlatObstacleSet &flat_obstacles,
+    const std::vector<unsigned int> &possible_collisions_indices,
+    const double search_end_time_s) const
 {
     for (double time = search_end_time_s; time >= 0.0;
          time -= COLLISION_CHECK_STEP_INTERVAL_SEC)
     {
-        Point position       = traj_path.getPosition(time);
-        bool collision_found = false;
-        for (unsigned int obstacle_index : obstacle_indices)
-        {
-            if (obstacles[obstacle_index]->contains(position))
-            {
-                collision_found = true;
-                break;
-            }
-        }
-
-        if (!collision_found)
+        if (!flat_obstacles.contains(traj_path.getPosition(time),
+                                     possible_collisions_indices))
         {
             return time;
         }
@@ -4,6 +4,7 @@
 
 #include <optional>
 
+#include "software/ai/navigator/obstacle/flat_obstacle_set.h"
 #include "software/ai/navigator/obstacle/obstacle.hpp"
 #include "software/ai/navigator/trajectory/trajectory_path.h"
 #include "software/ai/navigator/trajectory/trajectory_path_with_cost.h"
@@ -52,12 +53,13 @@ class TrajectoryPlanner
      * @param constraints Kinematic constraints of the trajectory
      * @param obstacle_tree Axis aligned bounding box tree of the obstacles
      * @param obstacles List of all obstacles
+     * @param flat_obstacles All the obstacles flattened into a FlatObstacleSet
      * @return A trajectory path with only a single trajectory + its cost
      */
     TrajectoryPathWithCost getDirectTrajectoryWithCost(
         const Point &start, const Point &destination, const Vector &initial_velocity,
         const KinematicConstraints &constraints, aabb::Tree &obstacle_tree,
-        const std::vector<ObstaclePtr> &obstacles);
+        const std::vector<ObstaclePtr> &obstacles, const FlatObstacleSet &flat_obstacles);
 
     /**
      * Given a trajectory path, calculate its cost
@@ -65,6 +67,7 @@ class TrajectoryPlanner
      * @param trajectory The trajectory path to calculate the cost of
      * @param obstacle_tree Axis aligned bounding box tree of the obstacles
      * @param obstacles List of all obstacles
+     * @param flat_obstacles All the obstacles flattened into a FlatObstacleSet
      * @param sub_traj_with_cost Optional cached trajectory path with cost of the sub
      * trajectory
      * @param sub_traj_duration_s Optional duration of the cached sub_traj_with_cost
@@ -72,7 +75,7 @@ class TrajectoryPlanner
      */
     TrajectoryPathWithCost getTrajectoryWithCost(
         const TrajectoryPath &trajectory, aabb::Tree &obstacle_tree,
-        const std::vector<ObstaclePtr> &obstacles,
+        const std::vector<ObstaclePtr> &obstacles, const FlatObstacleSet &flat_obstacles,
         const std::optional<TrajectoryPathWithCost> &sub_traj_with_cost,
         const std::optional<double> sub_traj_duration_s);
 
@@ -81,24 +84,27 @@ class TrajectoryPlanner
      * E.g. will return 0 if the trajectory's start position is not in an obstacle
      *
      * @param traj_path The trajectory path to check
-     * @param obstacle_indices A list of indices of the obstacles which this trajectory
-     * may collide with. Used to reduce the number of collision checks
-     * @param obstacles A list of all obstacles
+     * @param flat_obstacles All the obstacles flattened into a FlatObstacleSet
+     * @param possible_collisions_indices The sorted indices of the obstacles which this
+     * trajectory may collide with. Only checking these reduces the number of collision
+     * checks
      * @param search_end_time_s The latest time to check for collisions
      * @return Earliest non-collision time, or traj_path.getTotalDuration() if the
      * trajectory is in a collision from start to search_end_time_s
      */
-    double getFirstNonCollisionTime(const TrajectoryPath &traj_path,
-                                    const std::set<unsigned int> &obstacle_indices,
-                                    const std::vector<ObstaclePtr> &obstacles,
-                                    const double search_end_time_s) const;
+    double getFirstNonCollisionTime(
+        const TrajectoryPath &traj_path, const FlatObstacleSet &flat_obstacles,
+        const std::vector<unsigned int> &possible_collisions_indices,
+        const double search_end_time_s) const;
 
     /**
      * Find if there was a collision between the start_time_sec and search_end_time_s
      * for the given trajectory path and obstacles.
      *
      * @param traj_path The trajectory path to check
-     * @param obstacle_indices The indices of the obstacles to check for collisions
+     * @param flat_obstacles All the obstacles flattened into a FlatObstacleSet
+     * @param possible_collisions_indices The sorted indices of the obstacles to check
+     * for collisions
      * @param obstacles The list of all obstacles
      * @param start_time_s The time in seconds to start the search from
      * @param search_end_time_s The time in seconds to stop the search at
@@ -107,7 +113,8 @@ class TrajectoryPlanner
      * std::numeric_limits<double>::max() and nullptr.
      */
     std::pair<double, ObstaclePtr> getFirstCollisionTime(
-        const TrajectoryPath &traj_path, const std::set<unsigned int> &obstacle_indices,
+        const TrajectoryPath &traj_path, const FlatObstacleSet &flat_obstacles,
+        const std::vector<unsigned int> &possible_collisions_indices,
         const std::vector<ObstaclePtr> &obstacles, const double start_time_s,
         const double search_end_time_s) const;
 
@@ -117,17 +124,18 @@ class TrajectoryPlanner
      * end in a collision.
      *
      * @param traj_path The trajectory path to check
-     * @param obstacle_indices The indices of the obstacles to check for collisions
-     * @param obstacles The list of all obstacles
+     * @param flat_obstacles All the obstacles flattened into a FlatObstacleSet
+     * @param possible_collisions_indices The sorted indices of the obstacles to check
+     * for collisions
      * @param search_end_time_s The latest time to check for collisions. Assumed to
      * be within the duration of the trajectory path.
      * @return Time in seconds at which the trajectory is not in a collision. Result
      * will be in the range [0, search_end_time_s].
      */
-    double getLastNonCollisionTime(const TrajectoryPath &traj_path,
-                                   const std::set<unsigned int> &obstacle_indices,
-                                   const std::vector<ObstaclePtr> &obstacles,
-                                   const double search_end_time_s) const;
+    double getLastNonCollisionTime(
+        const TrajectoryPath &traj_path, const FlatObstacleSet &flat_obstacles,
+        const std::vector<unsigned int> &possible_collisions_indices,
+        const double search_end_time_s) const;
 
     /**
      * Get a list of sub destinations which trajectory paths should be sampled through for
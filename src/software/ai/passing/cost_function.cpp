@@ -85,35 +85,24 @@ double rateZone(const Field& field, const Team& enemy_team, const Rectangle& zon
 double ratePassShootScore(const Field& field, const Team& enemy_team, const Pass& pass,
                           TbotsProto::PassingConfig passing_config)
 {
-    double ideal_max_rotation_to_shoot_degrees =
-        passing_config.ideal_max_rotation_to_shoot_degrees();
-
     // Figure out the range of angles for which we have an open shot to the goal after
     // receiving the pass
     auto shot_opt = calcBestShotOnGoal(
         Segment(field.enemyGoalpostPos(), field.enemyGoalpostNeg()), pass.receiverPoint(),
         enemy_team.getAllRobots(), TeamType::ENEMY);
 
-    Angle open_angle_to_goal = Angle::zero();
-    Point shot_target        = field.enemyGoalCenter();
-    if (shot_opt && shot_opt.value().getOpenAngle().abs() > Angle::fromDegrees(0))
-    {
-        open_angle_to_goal = shot_opt.value().getOpenAngle();
-    }
+    return ratePassShootScore(field, pass, shot_opt, passing_config);
+}
 
-    // Figure out what the maximum open angle of the goal could be from the receiver pos.
-    Angle goal_angle = convexAngle(field.enemyGoalpostNeg(), pass.receiverPoint(),
-                                   field.enemyGoalpostPos())
-                           .abs();
-    double net_percent_open = 0;
-    if (goal_angle > Angle::zero())
-    {
-        net_percent_open = open_angle_to_goal.toDegrees() / goal_angle.toDegrees();
-    }
+double ratePassShootScore(const Field& field, const Pass& pass,
+                          const std::optional<Shot>& best_shot,
+                          TbotsProto::PassingConfig passing_config)
+{
+    double ideal_max_rotation_to_shoot_degrees =
+        passing_config.ideal_max_rotation_to_shoot_degrees();
 
-    // Create the shoot score by creating a sigmoid that goes to a large value as
-    // the section of net we're shooting on approaches 100% (ie. completely open)
-    double shot_openness_score = sigmoid(net_percent_open, 0.45, 0.95);
+    Point shot_target          = field.enemyGoalCenter();
+    double shot_openness_score = rateShotOpenness(field, pass.receiverPoint(), best_shot);
 
     // Prefer angles where the robot does not have to turn much after receiving the
     // pass to take the shot (or equivalently the shot deflection angle)
@@ -136,6 +125,30 @@ double ratePassShootScore(const Field& field, const Team& enemy_team, const Pass
     return shot_openness_score * required_rotation_for_shot_score;
 }
 
+double rateShotOpenness(const Field& field, const Point& shot_origin,
+                        const std::optional<Shot>& best_shot)
+{
+    Angle open_angle_to_goal = Angle::zero();
+    if (best_shot && best_shot.value().getOpenAngle().abs() > Angle::fromDegrees(0))
+    {
+        open_angle_to_goal = best_shot.value().getOpenAngle();
+    }
+
+    // Figure out what the maximum open angle of the goal could be from the shot origin
+    Angle goal_angle =
+        convexAngle(field.enemyGoalpostNeg(), shot_origin, field.enemyGoalpostPos())
+            .abs();
+    double net_percent_open = 0;
+    if (goal_angle > Angle::zero())
+    {
+        net_percent_open = open_angle_to_goal.toDegrees() / goal_angle.toDegrees();
+    }
+
+    // Create the shoot score by creating a sigmoid that goes to a large value as
+    // the section of net we're shooting on approaches 100% (ie. completely open)
+    return sigmoid(net_percent_open, 0.45, 0.95);
+}
+
 double ratePassEnemyRisk(const Team& enemy_team, const Pass& pass,
                          const Duration& enemy_reaction_time,
                          double enemy_proximity_importance)
@@ -239,17 +252,7 @@ double ratePassFriendlyCapability(const Team& friendly_team, const Pass& pass,
     }
 
     // Get the robot that is closest to where the pass would be received
-    Robot best_receiver = friendly_team.getAllRobots()[0];
-    for (const Robot& robot : friendly_team.getAllRobots())
-    {
-        double distance = (robot.position() - pass.receiverPoint()).length();
-        double curr_best_distance =
-            (best_receiver.position() - pass.receiverPoint()).length();
-        if (distance < curr_best_distance)
-        {
-            best_receiver = robot;
-        }
-    }
+    Robot best_receiver = *friendly_team.getNearestRobot(pass.receiverPoint());
 
     // Figure out what time the robot would have to receive the ball at
     // TODO (#2988): We should generate a more realistic ball trajectory
@@ -326,9 +329,9 @@ double calculateProximityRisk(const Point& point, const Team& enemy_team,
     // Calculate a risk score based on the distance of the enemy robots from the receive
     // point, based on an exponential function of the distance of each robot from the
     // receiver point
-    auto enemy_robots                 = enemy_team.getAllRobots();
-    double point_enemy_proximity_risk = 1;
-    for (const Robot& enemy : enemy_team.getAllRobots())
+    const std::vector<Robot>& enemy_robots = enemy_team.getAllRobots();
+    double point_enemy_proximity_risk      = 1;
+    for (const Robot& enemy : enemy_robots)
     {
         double dist = (point - enemy.position()).length();
         point_enemy_proximity_risk *= enemy_proximity_importance * std::exp(-dist * dist);
@@ -358,6 +361,8 @@ void samplePassesForVisualization(const World& world,
     double pass_shoot_score_costs;
 
     // We loop column wise (in the same order as how zones are defined)
+    std::vector<Point> receiver_points;
+    receiver_points.reserve(num_cols * num_rows);
     for (int i = 0; i < num_cols; i++)
     {
         // x coordinate of the centre of the column
@@ -365,50 +370,65 @@ void samplePassesForVisualization(const World& world,
         for (int j = 0; j < num_rows; j++)
         {
             // y coordinate of the centre of the row
-            double y  = height * j + height / 2 - world.field().yLength() / 2;
-            auto pass = Pass(world.ball().position(), Point(x, y),
-                             passing_config.max_pass_speed_m_per_s());
-
-            // default values
-            static_pos_quality_costs       = 1;
-            pass_friendly_capability_costs = 1;
-            pass_enemy_risk_costs          = 1;
-            pass_shoot_score_costs         = 1;
-
-            // getStaticPositionQuality
-            if (passing_config.cost_vis_config().static_position_quality())
-            {
-                static_pos_quality_costs = getStaticPositionQuality(
-                    world.field(), pass.receiverPoint(), passing_config);
-            }
-
-            // ratePassFriendlyCapability
-            if (passing_config.cost_vis_config().pass_friendly_capability())
-            {
-                pass_friendly_capability_costs = ratePassFriendlyCapability(
-                    world.friendlyTeam(), pass, passing_config);
-            }
-
-            // ratePassEnemyRisk
-            if (passing_config.cost_vis_config().pass_enemy_risk())
-            {
-                pass_enemy_risk_costs = ratePassEnemyRisk(
-                    world.enemyTeam(), pass,
-                    Duration::fromSeconds(passing_config.enemy_reaction_time()),
-                    passing_config.enemy_proximity_importance());
-            }
-
-            // ratePassShootScore
-            if (passing_config.cost_vis_config().pass_shoot_score())
-            {
-                pass_shoot_score_costs = ratePassShootScore(
-                    world.field(), world.enemyTeam(), pass, passing_config);
-            }
-
-            costs.push_back(static_pos_quality_costs * pass_friendly_capability_costs *
-                            pass_enemy_risk_costs * pass_shoot_score_costs);
+            double y = height * j + height / 2 - world.field().yLength() / 2;
+            receiver_points.emplace_back(Point(x, y));
         }
     }
 
+    // The best shots from all the receiver points are found at once, since they are
+    // all against the same enemy robots
+    std::vector<std::optional<Shot>> best_shots;
+    if (passing_config.cost_vis_config().pass_shoot_score())
+    {
+        best_shots = calcBestShotsOnGoal(
+            Segment(world.field().enemyGoalpostPos(), world.field().enemyGoalpostNeg()),
+            receiver_points, world.enemyTeam().getAllRobots(), TeamType::ENEMY);
+    }
+
+    for (size_t i = 0; i < receiver_points.size(); i++)
+    {
+        auto pass = Pass(world.ball().position(), receiver_points[i],
+                         passing_config.max_pass_speed_m_per_s());
+
+        // default values
+        static_pos_quality_costs       = 1;
+        pass_friendly_capability_costs = 1;
+        pass_enemy_risk_costs          = 1;
+        pass_shoot_score_costs         = 1;
+
+        // getStaticPositionQuality
+        if (passing_config.cost_vis_config().static_position_quality())
+        {
+            static_pos_quality_costs = getStaticPositionQuality(
+                world.field(), pass.receiverPoint(), passing_config);
+        }
+
+        // ratePassFriendlyCapability
+        if (passing_config.cost_vis_config().pass_friendly_capability())
+        {
+            pass_friendly_capability_costs = ratePassFriendlyCapability(
+                world.friendlyTeam(), pass, passing_config);
+        }
+
+        // ratePassEnemyRisk
+        if (passing_config.cost_vis_config().pass_enemy_risk())
+        {
+            pass_enemy_risk_costs = ratePassEnemyRisk(
+                world.enemyTeam(), pass,
+                Duration::fromSeconds(passing_config.enemy_reaction_time()),
+                passing_config.enemy_proximity_importance());
+        }
+
+        // ratePassShootScore
+        if (passing_config.cost_vis_config().pass_shoot_score())
+        {
+            pass_shoot_score_costs = ratePassShootScore(world.field(), pass,
+                                                        best_shots[i], passing_config);
+        }
+
+        costs.push_back(static_pos_quality_costs * pass_friendly_capability_costs *
+                        pass_enemy_risk_costs * pass_shoot_score_costs);
+    }
+
     LOG(VISUALIZE) << *createCostVisualization(costs, num_rows, num_cols);
 }
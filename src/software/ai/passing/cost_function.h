@@ -1,9 +1,11 @@
 #pragma once
 
 #include <functional>
+#include <optional>
 
 #include "proto/message_translation/tbots_protobuf.h"
 #include "proto/parameters.pb.h"
+#include "software/ai/evaluation/shot.h"
 #include "software/ai/passing/pass.h"
 #include "software/math/math_functions.h"
 #include "software/util/make_enum/make_enum.h"
@@ -55,6 +57,38 @@ double rateZone(const Field& field, const Team& enemy_team, const Rectangle& zon
 double ratePassShootScore(const Field& field, const Team& enemy_team, const Pass& pass,
                           TbotsProto::PassingConfig passing_config);
 
+/**
+ * Rate pass based on the probability of scoring once we receive the pass, given the
+ * best shot on the enemy goal from the receiver point. This allows the best shots from
+ * many receiver points to be found at once with calcBestShotsOnGoal
+ *
+ * @param field The field we are playing on
+ * @param pass The pass to rate
+ * @param best_shot The best shot on the enemy goal from the receiver point of the pass
+ * @param passing_config The passing config used for tuning
+ *
+ * @return A value in [0,1], with 0 indicating that it's impossible to score off of
+ *         the pass, and 1 indicating that it is guaranteed to be able to score off of
+ *         the pass
+ */
+double ratePassShootScore(const Field& field, const Pass& pass,
+                          const std::optional<Shot>& best_shot,
+                          TbotsProto::PassingConfig passing_config);
+
+/**
+ * Rates how open the enemy goal is from the given shot origin, given the best shot on
+ * the enemy goal from the shot origin
+ *
+ * @param field The field we are playing on
+ * @param shot_origin The point that the shot will be taken from
+ * @param best_shot The best shot on the enemy goal from the shot origin
+ *
+ * @return A value in [0,1], with 0 indicating that the goal is completely blocked, and
+ *         1 indicating that the goal is completely open
+ */
+double rateShotOpenness(const Field& field, const Point& shot_origin,
+                        const std::optional<Shot>& best_shot);
+
 /**
  * Calculates the risk of an enemy robot interfering with a given pass
  *
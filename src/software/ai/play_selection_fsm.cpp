@@ -15,8 +15,19 @@
 
 
 PlaySelectionFSM::PlaySelectionFSM(TbotsProto::AiConfig ai_config)
-    : ai_config(ai_config), current_play(std::make_unique<HaltPlay>(ai_config))
+    : ai_config(ai_config), play_registry(ai_config)
 {
+    play_registry.prepare<BallPlacementPlay>();
+    play_registry.prepare<EnemyBallPlacementPlay>();
+    play_registry.prepare<KickoffFriendlyPlay>();
+    play_registry.prepare<KickoffEnemyPlay>();
+    play_registry.prepare<PenaltyKickPlay>();
+    play_registry.prepare<PenaltyKickEnemyPlay>();
+    play_registry.prepare<FreeKickPlay>();
+    play_registry.prepare<EnemyFreekickPlay>();
+    play_registry.prepare<StopPlay>();
+    play_registry.prepare<HaltPlay>();
+    play_registry.prepare<OffensePlay>();
 }
 
 bool PlaySelectionFSM::gameStateStopped(const Update& event)
@@ -41,59 +52,58 @@ bool PlaySelectionFSM::gameStateSetupRestart(const Update& event)
 
 void PlaySelectionFSM::setupSetPlay(const Update& event)
 {
-    current_play.reset();
     if (event.game_state.isOurBallPlacement())
     {
-        event.set_current_play(std::make_unique<BallPlacementPlay>(ai_config));
+        event.set_current_play(play_registry.activate<BallPlacementPlay>());
     }
 
     if (event.game_state.isTheirBallPlacement())
     {
-        event.set_current_play(std::make_unique<EnemyBallPlacementPlay>(ai_config));
+        event.set_current_play(play_registry.activate<EnemyBallPlacementPlay>());
     }
 
     if (event.game_state.isOurKickoff())
     {
-        event.set_current_play(std::make_unique<KickoffFriendlyPlay>(ai_config));
+        event.set_current_play(play_registry.activate<KickoffFriendlyPlay>());
     }
 
     if (event.game_state.isTheirKickoff())
     {
-        event.set_current_play(std::make_unique<KickoffEnemyPlay>(ai_config));
+        event.set_current_play(play_registry.activate<KickoffEnemyPlay>());
     }
 
     if (event.game_state.isOurPenalty())
     {
-        event.set_current_play(std::make_unique<PenaltyKickPlay>(ai_config));
+        event.set_current_play(play_registry.activate<PenaltyKickPlay>());
     }
 
     if (event.game_state.isTheirPenalty())
     {
-        event.set_current_play(std::make_unique<PenaltyKickEnemyPlay>(ai_config));
+        event.set_current_play(play_registry.activate<PenaltyKickEnemyPlay>());
     }
 
     if (event.game_state.isOurDirectFree() || event.game_state.isOurIndirectFree())
     {
-        event.set_current_play(std::make_unique<FreeKickPlay>(ai_config));
+        event.set_current_play(play_registry.activate<FreeKickPlay>());
     }
 
     if (event.game_state.isTheirDirectFree() || event.game_state.isTheirIndirectFree())
     {
-        event.set_current_play(std::make_unique<EnemyFreekickPlay>(ai_config));
+        event.set_current_play(play_registry.activate<EnemyFreekickPlay>());
     }
 }
 
 void PlaySelectionFSM::setupStopPlay(const Update& event)
 {
-    event.set_current_play(std::make_unique<StopPlay>(ai_config));
+    event.set_current_play(play_registry.activate<StopPlay>());
 }
 
 void PlaySelectionFSM::setupHaltPlay(const Update& event)
 {
-    event.set_current_play(std::make_unique<HaltPlay>(ai_config));
+    event.set_current_play(play_registry.activate<HaltPlay>());
 }
 
 void PlaySelectionFSM::setupOffensePlay(const Update& event)
 {
-    event.set_current_play(std::make_unique<OffensePlay>(ai_config));
+    event.set_current_play(play_registry.activate<OffensePlay>());
 }
@@ -3,6 +3,7 @@
 #include "proto/parameters.pb.h"
 #include "shared/constants.h"
 #include "software/ai/hl/stp/play/play.h"
+#include "software/ai/hl/stp/play/play_registry.h"
 
 struct PlaySelectionFSM
 {
@@ -14,20 +15,21 @@ struct PlaySelectionFSM
 
     struct Update
     {
-        Update(const std::function<void(std::unique_ptr<Play>)>& set_current_play,
+        Update(const std::function<void(std::shared_ptr<Play>)>& set_current_play,
                const GameState& game_state, const TbotsProto::AiConfig& ai_config)
             : set_current_play(set_current_play),
               game_state(game_state),
               ai_config(ai_config)
         {
         }
-        std::function<void(std::unique_ptr<Play>)> set_current_play;
+        std::function<void(std::shared_ptr<Play>)> set_current_play;
         GameState game_state;
         TbotsProto::AiConfig ai_config;
     };
 
     /**
-     * Creates a play selection FSM
+     * Creates a play selection FSM, which creates all the plays it can select ahead of
+     * time
      *
      * @param ai_config the default play config for this play fsm
      */
@@ -119,5 +121,5 @@ struct PlaySelectionFSM
 
    private:
     TbotsProto::AiConfig ai_config;
-    std::shared_ptr<Play> current_play;
+    PlayRegistry play_registry;
 };
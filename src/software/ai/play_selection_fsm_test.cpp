@@ -19,11 +19,11 @@ class PlaySelectionFSMTest : public ::testing::Test
 
 TEST_F(PlaySelectionFSMTest, test_transition_out_of_penalty_kick)
 {
-    std::unique_ptr<Play> current_play = std::make_unique<HaltPlay>(ai_config);
+    std::shared_ptr<Play> current_play = std::make_shared<HaltPlay>(ai_config);
 
     // Start in halt
     fsm->process_event(PlaySelectionFSM::Update(
-        [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
+        [&current_play](std::shared_ptr<Play> play) { current_play = std::move(play); },
         game_state, ai_config));
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::Halt>));
     EXPECT_EQ("HaltPlay", objectTypeName(*current_play));
@@ -31,7 +31,7 @@ TEST_F(PlaySelectionFSMTest, test_transition_out_of_penalty_kick)
     // Stop
     game_state.updateRefereeCommand(RefereeCommand::STOP);
     fsm->process_event(PlaySelectionFSM::Update(
-        [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
+        [&current_play](std::shared_ptr<Play> play) { current_play = std::move(play); },
         game_state, ai_config));
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::Stop>));
     EXPECT_EQ("StopPlay", objectTypeName(*current_play));
@@ -39,7 +39,7 @@ TEST_F(PlaySelectionFSMTest, test_transition_out_of_penalty_kick)
     // Penalty kick preparation
     game_state.updateRefereeCommand(RefereeCommand::PREPARE_PENALTY_US);
     fsm->process_event(PlaySelectionFSM::Update(
-        [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
+        [&current_play](std::shared_ptr<Play> play) { current_play = std::move(play); },
         game_state, ai_config));
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::SetPlay>));
     EXPECT_EQ("PenaltyKickPlay", objectTypeName(*current_play));
@@ -48,7 +48,7 @@ TEST_F(PlaySelectionFSMTest, test_transition_out_of_penalty_kick)
     game_state.updateRefereeCommand(RefereeCommand::NORMAL_START);
     EXPECT_TRUE(game_state.isReadyState());
     fsm->process_event(PlaySelectionFSM::Update(
-        [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
+        [&current_play](std::shared_ptr<Play> play) { current_play = std::move(play); },
         game_state, ai_config));
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::SetPlay>));
     EXPECT_EQ("PenaltyKickPlay", objectTypeName(*current_play));
@@ -58,7 +58,7 @@ TEST_F(PlaySelectionFSMTest, test_transition_out_of_penalty_kick)
     game_state.updateRefereeCommand(RefereeCommand::FORCE_START);
     EXPECT_TRUE(game_state.isPlaying());
     fsm->process_event(PlaySelectionFSM::Update(
-        [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
+        [&current_play](std::shared_ptr<Play> play) { current_play = std::move(play); },
         game_state, ai_config));
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::Playing>));
     EXPECT_EQ("OffensePlay", objectTypeName(*current_play));
@@ -66,11 +66,11 @@ TEST_F(PlaySelectionFSMTest, test_transition_out_of_penalty_kick)
 
 TEST_F(PlaySelectionFSMTest, test_transition_out_of_penalty_kick_enemy_when_goal_conceded)
 {
-    std::unique_ptr<Play> current_play = std::make_unique<HaltPlay>(ai_config);
+    std::shared_ptr<Play> current_play = std::make_shared<HaltPlay>(ai_config);
 
     // Start in halt
     fsm->process_event(PlaySelectionFSM::Update(
-        [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
+        [&current_play](std::shared_ptr<Play> play) { current_play = std::move(play); },
         game_state, ai_config));
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::Halt>));
     EXPECT_EQ("HaltPlay", objectTypeName(*current_play));
@@ -78,7 +78,7 @@ TEST_F(PlaySelectionFSMTest, test_transition_out_of_penalty_kick_enemy_when_goal
     // Stop
     game_state.updateRefereeCommand(RefereeCommand::STOP);
     fsm->process_event(PlaySelectionFSM::Update(
-        [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
+        [&current_play](std::shared_ptr<Play> play) { current_play = std::move(play); },
         game_state, ai_config));
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::Stop>));
     EXPECT_EQ("StopPlay", objectTypeName(*current_play));
@@ -86,7 +86,7 @@ TEST_F(PlaySelectionFSMTest, test_transition_out_of_penalty_kick_enemy_when_goal
     // Penalty kick preparation
     game_state.updateRefereeCommand(RefereeCommand::PREPARE_PENALTY_THEM);
     fsm->process_event(PlaySelectionFSM::Update(
-        [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
+        [&current_play](std::shared_ptr<Play> play) { current_play = std::move(play); },
         game_state, ai_config));
     EXPECT_TRUE(game_state.isTheirPenalty());
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::SetPlay>));
@@ -95,7 +95,7 @@ TEST_F(PlaySelectionFSMTest, test_transition_out_of_penalty_kick_enemy_when_goal
     // Normal start
     game_state.updateRefereeCommand(RefereeCommand::NORMAL_START);
     fsm->process_event(PlaySelectionFSM::Update(
-        [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
+        [&current_play](std::shared_ptr<Play> play) { current_play = std::move(play); },
         game_state, ai_config));
     EXPECT_TRUE(game_state.isReadyState());
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::SetPlay>));
@@ -104,7 +104,7 @@ TEST_F(PlaySelectionFSMTest, test_transition_out_of_penalty_kick_enemy_when_goal
     // Goal conceded
     game_state.updateRefereeCommand(RefereeCommand::GOAL_THEM);
     fsm->process_event(PlaySelectionFSM::Update(
-        [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
+        [&current_play](std::shared_ptr<Play> play) { current_play = std::move(play); },
         game_state, ai_config));
     EXPECT_TRUE(game_state.isStopped());
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::Stop>));
@@ -113,7 +113,7 @@ TEST_F(PlaySelectionFSMTest, test_transition_out_of_penalty_kick_enemy_when_goal
     // Kickoff preparation
     game_state.updateRefereeCommand(RefereeCommand::PREPARE_KICKOFF_US);
     fsm->process_event(PlaySelectionFSM::Update(
-        [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
+        [&current_play](std::shared_ptr<Play> play) { current_play = std::move(play); },
         game_state, ai_config));
     EXPECT_TRUE(game_state.isSetupState());
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::SetPlay>));
@@ -122,7 +122,7 @@ TEST_F(PlaySelectionFSMTest, test_transition_out_of_penalty_kick_enemy_when_goal
     // Normal start
     game_state.updateRefereeCommand(RefereeCommand::NORMAL_START);
     fsm->process_event(PlaySelectionFSM::Update(
-        [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
+        [&current_play](std::shared_ptr<Play> play) { current_play = std::move(play); },
         game_state, ai_config));
     EXPECT_TRUE(game_state.isReadyState());
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::SetPlay>));
@@ -131,7 +131,7 @@ TEST_F(PlaySelectionFSMTest, test_transition_out_of_penalty_kick_enemy_when_goal
     // Ball is kicked and restart state is cleared, enter playing state
     game_state.setRestartCompleted();
     fsm->process_event(PlaySelectionFSM::Update(
-        [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
+        [&current_play](std::shared_ptr<Play> play) { current_play = std::move(play); },
         game_state, ai_config));
     EXPECT_TRUE(game_state.isPlaying());
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::Playing>));
@@ -141,11 +141,11 @@ TEST_F(PlaySelectionFSMTest, test_transition_out_of_penalty_kick_enemy_when_goal
 TEST_F(PlaySelectionFSMTest,
        test_transition_out_of_penalty_kick_enemy_when_no_goal_conceded)
 {
-    std::unique_ptr<Play> current_play = std::make_unique<HaltPlay>(ai_config);
+    std::shared_ptr<Play> current_play = std::make_shared<HaltPlay>(ai_config);
 
     // Start in halt
     fsm->process_event(PlaySelectionFSM::Update(
-        [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
+        [&current_play](std::shared_ptr<Play> play) { current_play = std::move(play); },
         game_state, ai_config));
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::Halt>));
     EXPECT_EQ("HaltPlay", objectTypeName(*current_play));
@@ -153,7 +153,7 @@ TEST_F(PlaySelectionFSMTest,
     // Stop
     game_state.updateRefereeCommand(RefereeCommand::STOP);
     fsm->process_event(PlaySelectionFSM::Update(
-        [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
+        [&current_play](std::shared_ptr<Play> play) { current_play = std::move(play); },
         game_state, ai_config));
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::Stop>));
     EXPECT_EQ("StopPlay", objectTypeName(*current_play));
@@ -161,7 +161,7 @@ TEST_F(PlaySelectionFSMTest,
     // Penalty kick preparation
     game_state.updateRefereeCommand(RefereeCommand::PREPARE_PENALTY_THEM);
     fsm->process_event(PlaySelectionFSM::Update(
-        [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
+        [&current_play](std::shared_ptr<Play> play) { current_play = std::move(play); },
         game_state, ai_config));
     EXPECT_TRUE(game_state.isTheirPenalty());
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::SetPlay>));
@@ -170,7 +170,7 @@ TEST_F(PlaySelectionFSMTest,
     // Normal start
     game_state.updateRefereeCommand(RefereeCommand::NORMAL_START);
     fsm->process_event(PlaySelectionFSM::Update(
-        [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
+        [&current_play](std::shared_ptr<Play> play) { current_play = std::move(play); },
         game_state, ai_config));
     EXPECT_TRUE(game_state.isReadyState());
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::SetPlay>));
@@ -179,7 +179,7 @@ TEST_F(PlaySelectionFSMTest,
     // Stop because no goal
     game_state.updateRefereeCommand(RefereeCommand::STOP);
     fsm->process_event(PlaySelectionFSM::Update(
-        [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
+        [&current_play](std::shared_ptr<Play> play) { current_play = std::move(play); },
         game_state, ai_config));
     EXPECT_TRUE(game_state.isStopped());
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::Stop>));
@@ -188,7 +188,7 @@ TEST_F(PlaySelectionFSMTest,
     // Free kick
     game_state.updateRefereeCommand(RefereeCommand::DIRECT_FREE_US);
     fsm->process_event(PlaySelectionFSM::Update(
-        [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
+        [&current_play](std::shared_ptr<Play> play) { current_play = std::move(play); },
         game_state, ai_config));
     EXPECT_TRUE(game_state.isOurDirectFree());
     EXPECT_TRUE(game_state.isReadyState());
@@ -198,9 +198,35 @@ TEST_F(PlaySelectionFSMTest,
     // Ball is kicked and restart state is cleared, enter playing state
     game_state.setRestartCompleted();
     fsm->process_event(PlaySelectionFSM::Update(
-        [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
+        [&current_play](std::shared_ptr<Play> play) { current_play = std::move(play); },
         game_state, ai_config));
     EXPECT_TRUE(game_state.isPlaying());
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::Playing>));
     EXPECT_EQ("OffensePlay", objectTypeName(*current_play));
 }
+
+TEST_F(PlaySelectionFSMTest, test_plays_are_reused_between_transitions)
+{
+    std::shared_ptr<Play> current_play = std::make_shared<HaltPlay>(ai_config);
+    auto set_current_play = [&current_play](std::shared_ptr<Play> play) {
+        current_play = std::move(play);
+    };
+
+    // Stop
+    game_state.updateRefereeCommand(RefereeCommand::STOP);
+    fsm->process_event(PlaySelectionFSM::Update(set_current_play, game_state, ai_config));
+    EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::Stop>));
+    std::shared_ptr<Play> stop_play = current_play;
+
+    // Halt
+    game_state.updateRefereeCommand(RefereeCommand::HALT);
+    fsm->process_event(PlaySelectionFSM::Update(set_current_play, game_state, ai_config));
+    EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::Halt>));
+    EXPECT_EQ("HaltPlay", objectTypeName(*current_play));
+
+    // Stop again, which should switch back to the same play instead of a new one
+    game_state.updateRefereeCommand(RefereeCommand::STOP);
+    fsm->process_event(PlaySelectionFSM::Update(set_current_play, game_state, ai_config));
+    EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::Stop>));
+    EXPECT_EQ(stop_play, current_play);
+}
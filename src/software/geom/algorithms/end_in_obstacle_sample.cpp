@@ -1,11 +1,66 @@
 #include "software/geom/algorithms/end_in_obstacle_sample.h"
 
+#include "software/ai/navigator/obstacle/flat_obstacle_set.h"
 #include "software/ai/navigator/obstacle/obstacle.hpp"
 #include "software/geom/point.h"
 
 static constexpr double OBSTACLE_AVOIDANCE_BUFFER_CENTIMETERS = 0.01;
 
 
+/**
+ * Samples points on circles of increasing radius around the given point, and returns
+ * the first sample that is inside the navigable area and outside all the obstacles
+ *
+ * @param flat_obstacles the obstacles the sample must be outside of
+ * @param point the point to sample around
+ * @param navigable_area the rectangular region which the sample must be inside of
+ * @param initial_count the number of samples on the circle of the initial radius
+ * @param radius_step the distance to increase the radius for each iteration
+ * @param samples_per_radius_step the number of samples to add for each iteration
+ * @param max_search_radius the max distance from point that we are allowed to sample
+ *
+ * @return the first valid sample, or std::nullopt if no sample is valid
+ */
+static std::optional<Point> sampleOutsideObstacles(const FlatObstacleSet &flat_obstacles,
+                                                   const Point &point,
+                                                   const Rectangle &navigable_area,
+                                                   int initial_count, double radius_step,
+                                                   int samples_per_radius_step,
+                                                   double max_search_radius)
+{
+    double radius          = 0.15;
+    int samples_per_radius = initial_count;
+    std::vector<Point> sample_points;
+    while (radius <= max_search_radius)
+    {
+        // All the samples on a circle are checked against the obstacles at once
+        sample_points.clear();
+        double increment = 360.0 / samples_per_radius;
+        for (int i = 0; i < samples_per_radius; i++)
+        {
+            Angle angle      = Angle::fromDegrees(static_cast<double>(i) * increment);
+            Vector direction = Vector::createFromAngle(angle);
+            sample_points.emplace_back(point + direction * radius);
+        }
+
+        std::vector<bool> samples_in_obstacles = flat_obstacles.contains(sample_points);
+        for (std::size_t i = 0; i < sample_points.size(); i++)
+        {
+            // check if candidate sample point is in an obstacle or outside navigable
+            // area
+            if (!samples_in_obstacles[i] && contains(navigable_area, sample_points[i]))
+            {
+                return sample_points[i];
+            }
+        }
+        // increase the number of samples per radius to prevent density of samples from
+        // dropping off
+        samples_per_radius += samples_per_radius_step;
+        radius += radius_step;
+    }
+    return std::nullopt;
+}
+
 std::optional<Point> endInObstacleSample(const std::vector<ObstaclePtr> &obstacles,
                                          const Point &point,
                                          const Rectangle &navigable_area,
@@ -13,112 +68,42 @@ std::optional<Point> endInObstacleSample(const std::vector<ObstaclePtr> &obstacl
                                          int samples_per_radius_step,
                                          double max_search_radius)
 {
+    FlatObstacleSet flat_obstacles(obstacles);
+
     // first, check if point is inside an obstacle or outside the navigable area
-    bool point_in_obstacle = false;
-    if (contains(navigable_area, point))
+    if (!contains(navigable_area, point))
     {
-        for (auto const &obstacle : obstacles)
-        {
-            if (obstacle->contains(point))
-            {
-                if (!point_in_obstacle)
-                {
-                    point_in_obstacle = true;
-                }
-
-                // if point is inside obstacle, perform a second check to see if the
-                // closest point outside the first encroached obstacle is inside another
-                // obstacle
-                Point closest_point = obstacle->closestPoint(point);
-                closest_point += (closest_point - point)
-                                     .normalize(OBSTACLE_AVOIDANCE_BUFFER_CENTIMETERS);
-                bool closest_point_in_obstacle = false;
+        return sampleOutsideObstacles(flat_obstacles, point, navigable_area,
+                                      initial_count, radius_step,
+                                      samples_per_radius_step, max_search_radius);
+    }
 
-                // break out of loop if closest point outside first encroached obstacle is
-                // outside navigable area
-                if (contains(navigable_area, closest_point))
-                {
-                    for (auto const &obstacle : obstacles)
-                    {
-                        // break out of loop if closest point outside first encroached
-                        // obstacle happens to be inside another obstacle
-                        if (obstacle->contains(closest_point))
-                        {
-                            closest_point_in_obstacle = true;
-                            break;
-                        }
-                    }
-                }
-                else
-                {
-                    closest_point_in_obstacle = true;
-                    break;
-                }
+    std::optional<std::size_t> encroached_obstacle =
+        flat_obstacles.findContainingObstacle(point);
 
-                if (closest_point_in_obstacle)
-                {
-                    break;
-                }
-                else
-                {
-                    // if the closest point outside the first encroached obstacle is not
-                    // inside any other obstacle, then return it
-                    return closest_point;
-                }
-            }
-        }
-    }
-    else
+    // if provided point isn't inside an obstacle, just return point as is
+    if (!encroached_obstacle)
     {
-        point_in_obstacle = true;
+        return point;
     }
 
-    // if provided point isn't inside an obstacle, just return point as is
-    if (!point_in_obstacle)
+    // if point is inside obstacle, perform a second check to see if the closest point
+    // outside the first encroached obstacle is inside another obstacle or outside the
+    // navigable area
+    Point closest_point = obstacles[*encroached_obstacle]->closestPoint(point);
+    closest_point +=
+        (closest_point - point).normalize(OBSTACLE_AVOIDANCE_BUFFER_CENTIMETERS);
+    if (contains(navigable_area, closest_point) &&
+        !flat_obstacles.contains(closest_point))
     {
-        return point;
+        // if the closest point outside the first encroached obstacle is not inside any
+        // other obstacle, then return it
+        return closest_point;
     }
 
     // perform sampling only if the provided point or the closest point outside the first
     // encroached obstacle are not valid
-    double radius          = 0.15;
-    int samples_per_radius = 6;
-    while (radius <= max_search_radius)
-    {
-        double increment = 360.0 / samples_per_radius;
-        for (int i = 0; i < samples_per_radius; i++)
-        {
-            Angle angle        = Angle::fromDegrees(static_cast<double>(i) * increment);
-            Vector direction   = Vector::createFromAngle(angle);
-            Point sample_point = point + direction * radius;
-            bool sample_point_in_obstacle = false;
-            // check if candidate sample point is in an obstacle or outside navigable area
-            if (contains(navigable_area, sample_point))
-            {
-                for (auto const &obstacle : obstacles)
-                {
-                    if (obstacle->contains(sample_point) ||
-                        !contains(navigable_area, sample_point))
-                    {
-                        sample_point_in_obstacle = true;
-                        break;
-                    }
-                }
-            }
-            else
-            {
-                sample_point_in_obstacle = true;
-            }
-
-            if (!sample_point_in_obstacle)
-            {
-                return sample_point;
-            }
-        }
-        // increase the number of samples per radius to prevent density of samples from
-        // dropping off
-        samples_per_radius += samples_per_radius_step;
-        radius += radius_step;
-    }
-    return std::nullopt;
+    return sampleOutsideObstacles(flat_obstacles, point, navigable_area, initial_count,
+                                  radius_step, samples_per_radius_step,
+                                  max_search_radius);
 }
@@ -0,0 +1,298 @@
+#include "software/geom/algorithms/open_circle_finder.h"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+
+#include "software/geom/algorithms/contains.h"
+#include "software/geom/algorithms/voronoi_diagram.h"
+
+// How much the points are scaled up by to build the triangulation, which gives
+// micrometre precision when the points are in metres
+static constexpr double TRIANGULATION_SCALE = 1e6;
+
+/**
+ * Finds the circle passing through the corners of a counter-clockwise triangle
+ *
+ * @param a, b, c The corners of the triangle
+ *
+ * @return the circumcircle of the triangle
+ */
+static Circle circumcircle(const Point &a, const Point &b, const Point &c)
+{
+    Vector ab          = b - a;
+    Vector ac          = c - a;
+    double denominator = 2 * ab.cross(ac);
+    Vector a_to_center((ac.y() * ab.lengthSquared() - ab.y() * ac.lengthSquared()) /
+                           denominator,
+                       (ab.x() * ac.lengthSquared() - ac.x() * ab.lengthSquared()) /
+                           denominator);
+    return Circle(a + a_to_center, a_to_center.length());
+}
+
+/**
+ * Finds the points where part of a line crosses the sides of a rectangle
+ *
+ * @param rectangle The rectangle
+ * @param start A point on the line
+ * @param direction The direction of the line
+ * @param min_scale The start of the part of the line, as a multiple of the direction
+ * away from the start point
+ * @param max_scale The end of the part of the line, as a multiple of the direction
+ * away from the start point
+ * @param crossings The points where the line crosses the sides are added to this
+ */
+static void findRectangleCrossings(const Rectangle &rectangle, const Point &start,
+                                   const Vector &direction, double min_scale,
+                                   double max_scale, std::vector<Point> &crossings)
+{
+    if (direction.x() != 0)
+    {
+        for (double x : {rectangle.xMin(), rectangle.xMax()})
+        {
+            double scale = (x - start.x()) / direction.x();
+            double y     = start.y() + direction.y() * scale;
+            if (scale >= min_scale && scale <= max_scale && y >= rectangle.yMin() &&
+                y <= rectangle.yMax())
+            {
+                crossings.emplace_back(x, y);
+            }
+        }
+    }
+    if (direction.y() != 0)
+    {
+        for (double y : {rectangle.yMin(), rectangle.yMax()})
+        {
+            double scale = (y - start.y()) / direction.y();
+            double x     = start.x() + direction.x() * scale;
+            if (scale >= min_scale && scale <= max_scale && x >= rectangle.xMin() &&
+                x <= rectangle.xMax())
+            {
+                crossings.emplace_back(x, y);
+            }
+        }
+    }
+}
+
+bool OpenCircleFinder::update(const std::vector<Point> &points)
+{
+    bool same_number_of_points = points.size() == this->points.size();
+    this->points               = points;
+    num_updates++;
+
+    if (same_number_of_points && !triangles.empty() && isTriangulationStillDelaunay())
+    {
+        computeCircumcircles();
+        return false;
+    }
+
+    rebuildTriangulation();
+    computeCircumcircles();
+    num_rebuilds++;
+    return true;
+}
+
+unsigned int OpenCircleFinder::getNumUpdates() const
+{
+    return num_updates;
+}
+
+unsigned int OpenCircleFinder::getNumRebuilds() const
+{
+    return num_rebuilds;
+}
+
+std::vector<Circle> OpenCircleFinder::findOpenCircles(const Rectangle &bounding_box) const
+{
+    std::vector<Circle> open_circles;
+    if (points.empty())
+    {
+        return open_circles;
+    }
+
+    for (const Point &corner : bounding_box.getPoints())
+    {
+        open_circles.emplace_back(corner, distanceToClosestPoint(corner));
+    }
+
+    // The vertices of the voronoi diagram are the centers of the circumcircles, which
+    // do not contain any points since the triangulation is Delaunay
+    for (const Circle &vertex_circle : circumcircles)
+    {
+        if (contains(bounding_box, vertex_circle.origin()))
+        {
+            open_circles.emplace_back(vertex_circle);
+        }
+    }
+
+    std::vector<Point> edge_crossings;
+    for (const DelaunayEdge &edge : edges)
+    {
+        Point vertex = circumcircles[edge.first_triangle].origin();
+        if (edge.second_triangle)
+        {
+            findRectangleCrossings(bounding_box, vertex,
+                                   circumcircles[*edge.second_triangle].origin() - vertex,
+                                   0, 1, edge_crossings);
+        }
+        else
+        {
+            // Edges on the convex hull are the dual of voronoi edges that extend
+            // forever, away from the inside of the hull
+            Vector hull_edge = points[edge.end] - points[edge.start];
+            findRectangleCrossings(bounding_box, vertex,
+                                   Vector(hull_edge.y(), -hull_edge.x()), 0,
+                                   std::numeric_limits<double>::infinity(),
+                                   edge_crossings);
+        }
+    }
+
+    // If the points are all on the same line there is no triangulation, and the edges
+    // of the voronoi diagram are the lines halfway between neighbouring points
+    if (triangles.empty() && points.size() > 1)
+    {
+        std::vector<Point> sorted_points = points;
+        std::sort(sorted_points.begin(), sorted_points.end(),
+                  [](const Point &p1, const Point &p2) {
+                      return std::make_pair(p1.x(), p1.y()) <
+                             std::make_pair(p2.x(), p2.y());
+                  });
+        for (std::size_t i = 0; i + 1 < sorted_points.size(); i++)
+        {
+            Vector between = sorted_points[i + 1] - sorted_points[i];
+            if (between.length() != 0)
+            {
+                findRectangleCrossings(bounding_box, sorted_points[i] + between * 0.5,
+                                       between.perpendicular(),
+                                       -std::numeric_limits<double>::infinity(),
+                                       std::numeric_limits<double>::infinity(),
+                                       edge_crossings);
+            }
+        }
+    }
+
+    for (const Point &crossing : edge_crossings)
+    {
+        open_circles.emplace_back(crossing, distanceToClosestPoint(crossing));
+    }
+
+    // Sort the circles in descending order of radius
+    std::sort(open_circles.begin(), open_circles.end(),
+              [](auto c1, auto c2) { return c1.radius() > c2.radius(); });
+
+    return open_circles;
+}
+
+void OpenCircleFinder::rebuildTriangulation()
+{
+    triangles.clear();
+    edges.clear();
+
+    // The voronoi diagram has no vertices with less than 3 points
+    if (points.size() < 3)
+    {
+        return;
+    }
+
+    // Boost builds voronoi diagrams from integer coordinates, so the points are scaled
+    // up to keep them from being rounded together
+    std::vector<Point> scaled_points;
+    for (const Point &point : points)
+    {
+        scaled_points.emplace_back(point.toVector() * TRIANGULATION_SCALE);
+    }
+    triangles = VoronoiDiagram(scaled_points).getDelaunayTriangles();
+
+    // Find the triangles on either side of every edge
+    std::map<std::pair<std::size_t, std::size_t>, std::size_t> edge_indices;
+    for (std::size_t triangle = 0; triangle < triangles.size(); triangle++)
+    {
+        for (std::size_t corner = 0; corner < 3; corner++)
+        {
+            std::size_t start = triangles[triangle][corner];
+            std::size_t end   = triangles[triangle][(corner + 1) % 3];
+            auto [edge_index, inserted] =
+                edge_indices.try_emplace(std::minmax(start, end), edges.size());
+            if (inserted)
+            {
+                edges.emplace_back(DelaunayEdge{.start           = start,
+                                                .end             = end,
+                                                .first_triangle  = triangle,
+                                                .second_triangle = std::nullopt});
+            }
+            else
+            {
+                edges[edge_index->second].second_triangle = triangle;
+            }
+        }
+    }
+}
+
+bool OpenCircleFinder::isTriangulationStillDelaunay() const
+{
+    for (const auto &triangle : triangles)
+    {
+        const Point &a = points[triangle[0]];
+        const Point &b = points[triangle[1]];
+        const Point &c = points[triangle[2]];
+        if ((b - a).cross(c - a) <= 0)
+        {
+            return false;
+        }
+
+        // Points exactly on the circumcircle are allowed, since they just make the
+        // triangulation one of several Delaunay triangulations
+        Circle circle = circumcircle(a, b, c);
+        double max_distance_squared = circle.radius() * circle.radius() *
+                                      (1 - std::numeric_limits<float>::epsilon());
+        for (std::size_t i = 0; i < points.size(); i++)
+        {
+            if (i != triangle[0] && i != triangle[1] && i != triangle[2] &&
+                (points[i] - circle.origin()).lengthSquared() < max_distance_squared)
+            {
+                return false;
+            }
+        }
+    }
+
+    // The triangles must still cover the whole convex hull of the points, so every
+    // point must be inside every edge of the hull
+    for (const DelaunayEdge &edge : edges)
+    {
+        if (edge.second_triangle)
+        {
+            continue;
+        }
+
+        Vector hull_edge = points[edge.end] - points[edge.start];
+        for (const Point &point : points)
+        {
+            if (hull_edge.cross(point - points[edge.start]) < 0)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void OpenCircleFinder::computeCircumcircles()
+{
+    circumcircles.clear();
+    for (const auto &triangle : triangles)
+    {
+        circumcircles.emplace_back(circumcircle(points[triangle[0]], points[triangle[1]],
+                                                points[triangle[2]]));
+    }
+}
+
+double OpenCircleFinder::distanceToClosestPoint(const Point &point) const
+{
+    double min_distance_squared = std::numeric_limits<double>::max();
+    for (const Point &other : points)
+    {
+        min_distance_squared =
+            std::min(min_distance_squared, (other - point).lengthSquared());
+    }
+    return std::sqrt(min_distance_squared);
+}
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <array>
+#include <optional>
+#include <vector>
+
+#include "software/geom/circle.h"
+#include "software/geom/point.h"
+#include "software/geom/rectangle.h"
+
+/**
+ * Finds the circles that do not contain any of a set of points (ex. the enemy robots)
+ * within rectangles, using the Delaunay triangulation of the points.
+ *
+ * The triangulation is kept between updates as long as it is still the Delaunay
+ * triangulation of the updated points, which is usually the case when the points
+ * only move a little, so it only has to be rebuilt when the points move past each
+ * other. The same triangulation can be queried for open circles in any number of
+ * rectangles.
+ */
+class OpenCircleFinder
+{
+   public:
+    /**
+     * Creates a new OpenCircleFinder with no points
+     */
+    explicit OpenCircleFinder() = default;
+
+    /**
+     * Updates the points that the open circles must not contain
+     *
+     * @param points The new points
+     *
+     * @return whether the Delaunay triangulation had to be rebuilt for the new points
+     */
+    bool update(const std::vector<Point> &points);
+
+    /**
+     * Finds the largest circles centered within the given rectangle that do not
+     * contain any of the points. These are the circles centered at the corners of the
+     * rectangle, the vertices of the voronoi diagram (the circumcenters of the
+     * Delaunay triangles) inside the rectangle, and the points where the edges of the
+     * voronoi diagram cross the rectangle. Points outside the rectangle still limit
+     * the size of the circles
+     *
+     * NOTE: this only guarantees that the center of each circle is within the
+     *       rectangle, some portion of the circle may extend outside the rectangle
+     *
+     * @param bounding_box The rectangle in which to look for open circles
+     *
+     * @return A list of circles, sorted in descending order of radius. If there are no
+     * points, returns an empty list
+     */
+    std::vector<Circle> findOpenCircles(const Rectangle &bounding_box) const;
+
+    /**
+     * Gets the number of times the points have been updated
+     *
+     * @return the number of updates
+     */
+    unsigned int getNumUpdates() const;
+
+    /**
+     * Gets the number of updates that had to rebuild the Delaunay triangulation
+     *
+     * @return the number of times the triangulation was rebuilt
+     */
+    unsigned int getNumRebuilds() const;
+
+   private:
+    // An edge of the Delaunay triangulation, which is the dual of an edge of the
+    // voronoi diagram between the cells of its two points
+    struct DelaunayEdge
+    {
+        // The indices of the points at the ends of the edge, in counter-clockwise
+        // order around the first triangle
+        std::size_t start;
+        std::size_t end;
+        // The indices of the triangles on either side of the edge. Edges on the convex
+        // hull of the points only have the first triangle
+        std::size_t first_triangle;
+        std::optional<std::size_t> second_triangle;
+    };
+
+    /**
+     * Rebuilds the Delaunay triangulation of the points from scratch
+     */
+    void rebuildTriangulation();
+
+    /**
+     * Checks if the current triangles are still the Delaunay triangulation of the
+     * points: every triangle is still counter-clockwise, no point lies inside the
+     * circumcircle of a triangle and the convex hull is still made of the same edges
+     *
+     * @return whether the current triangles are still the Delaunay triangulation
+     */
+    bool isTriangulationStillDelaunay() const;
+
+    /**
+     * Computes the circumcircles of the current triangles
+     */
+    void computeCircumcircles();
+
+    /**
+     * Gets the distance from the given point to the closest of the points
+     *
+     * @param point The point to find the distance from
+     *
+     * @return the distance to the closest of the points
+     */
+    double distanceToClosestPoint(const Point &point) const;
+
+    std::vector<Point> points;
+    // The corners of each triangle, as indices into the points, in counter-clockwise
+    // order
+    std::vector<std::array<std::size_t, 3>> triangles;
+    // The circumcircle of each triangle, whose center is a vertex of the voronoi
+    // diagram
+    std::vector<Circle> circumcircles;
+    std::vector<DelaunayEdge> edges;
+    unsigned int num_updates  = 0;
+    unsigned int num_rebuilds = 0;
+};
@@ -0,0 +1,256 @@
+#include "software/geom/algorithms/open_circle_finder.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "software/geom/algorithms/contains.h"
+#include "software/geom/algorithms/find_open_circles.h"
+#include "software/test_util/test_util.h"
+
+/**
+ * Checks that none of the given circles contain any of the given points, and that
+ * their centers are inside the bounding box
+ */
+static void expectCirclesAreOpen(const std::vector<Circle> &circles,
+                                 const Rectangle &bounding_box,
+                                 const std::vector<Point> &points)
+{
+    for (const Circle &circle : circles)
+    {
+        EXPECT_TRUE(contains(bounding_box, circle.origin()));
+        for (const Point &point : points)
+        {
+            EXPECT_GE((point - circle.origin()).length(), circle.radius() - 1e-9);
+        }
+    }
+}
+
+TEST(OpenCircleFinderTest, no_points)
+{
+    OpenCircleFinder open_circle_finder;
+    open_circle_finder.update({});
+
+    EXPECT_TRUE(open_circle_finder.findOpenCircles(Rectangle(Point(-1, -1), Point(1, 1)))
+                    .empty());
+}
+
+TEST(OpenCircleFinderTest, one_point)
+{
+    OpenCircleFinder open_circle_finder;
+    open_circle_finder.update({Point(0.9, 0.9)});
+
+    std::vector<Circle> open_circles =
+        open_circle_finder.findOpenCircles(Rectangle(Point(-1, -1), Point(1, 1)));
+
+    ASSERT_EQ(4, open_circles.size());
+    EXPECT_EQ(Point(-1, -1), open_circles[0].origin());
+    EXPECT_DOUBLE_EQ(std::sqrt(2 * std::pow(1.9, 2)), open_circles[0].radius());
+}
+
+TEST(OpenCircleFinderTest, points_on_a_line)
+{
+    Rectangle bounding_box(Point(-1, -1), Point(1, 1));
+    std::vector<Point> points = {Point(-0.5, 0), Point(0.5, 0), Point(0, 0)};
+    OpenCircleFinder open_circle_finder;
+    open_circle_finder.update(points);
+
+    std::vector<Circle> open_circles = open_circle_finder.findOpenCircles(bounding_box);
+
+    // The 4 corners and where the lines halfway between the points cross the top and
+    // bottom of the rectangle
+    ASSERT_EQ(8, open_circles.size());
+    EXPECT_NEAR(std::sqrt(1 + 0.25), open_circles[0].radius(), 1e-9);
+    expectCirclesAreOpen(open_circles, bounding_box, points);
+}
+
+TEST(OpenCircleFinderTest, three_points)
+{
+    Rectangle bounding_box    = Field::createSSLDivisionBField().fieldLines();
+    std::vector<Point> points = {Point(-1, -1), Point(1, -1), Point(0, 1)};
+    OpenCircleFinder open_circle_finder;
+    open_circle_finder.update(points);
+
+    std::vector<Circle> open_circles = open_circle_finder.findOpenCircles(bounding_box);
+
+    ASSERT_EQ(8, open_circles.size());
+
+    // Corner points
+    EXPECT_EQ(Point(-4.5, 3), open_circles[0].origin());
+    EXPECT_DOUBLE_EQ(std::sqrt(std::pow(4.5, 2) + std::pow(2, 2)),
+                     open_circles[0].radius());
+    EXPECT_EQ(Point(4.5, 3), open_circles[1].origin());
+    EXPECT_EQ(Point(-4.5, -3), open_circles[4].origin());
+    EXPECT_EQ(Point(4.5, -3), open_circles[5].origin());
+
+    // Where the edges of the voronoi diagram cross the rectangle
+    EXPECT_TRUE(
+        TestUtil::equalWithinTolerance(Point(-4.5, 2), open_circles[2].origin(), 1e-9));
+    EXPECT_TRUE(
+        TestUtil::equalWithinTolerance(Point(4.5, 2), open_circles[3].origin(), 1e-9));
+    EXPECT_NEAR(std::sqrt(std::pow(4.5, 2) + 1), open_circles[3].radius(), 1e-9);
+    EXPECT_TRUE(
+        TestUtil::equalWithinTolerance(Point(0, -3), open_circles[6].origin(), 1e-9));
+    EXPECT_NEAR(std::sqrt(5), open_circles[6].radius(), 1e-9);
+
+    // The vertex of the voronoi diagram
+    EXPECT_TRUE(
+        TestUtil::equalWithinTolerance(Point(0, -0.25), open_circles[7].origin(), 1e-9));
+    EXPECT_NEAR(1.25, open_circles[7].radius(), 1e-9);
+}
+
+TEST(OpenCircleFinderTest, points_outside_the_rectangle_limit_the_circles)
+{
+    Rectangle bounding_box(Point(-1, -1), Point(1, 1));
+    std::vector<Point> points = {Point(0.9, 0.9), Point(-1.1, -1.1)};
+    OpenCircleFinder open_circle_finder;
+    open_circle_finder.update(points);
+
+    std::vector<Circle> open_circles = open_circle_finder.findOpenCircles(bounding_box);
+
+    // The corner next to the point outside the rectangle is not open anymore
+    expectCirclesAreOpen(open_circles, bounding_box, points);
+    EXPECT_NE(Point(-1, -1), open_circles[0].origin());
+}
+
+TEST(OpenCircleFinderTest, small_movements_keep_the_triangulation)
+{
+    Rectangle bounding_box    = Field::createSSLDivisionBField().fieldLines();
+    std::vector<Point> points = {Point(-1, -1), Point(1, -1), Point(0, 1), Point(1, 1),
+                                 Point(1.5, 1), Point(-3, 2)};
+    OpenCircleFinder open_circle_finder;
+    EXPECT_TRUE(open_circle_finder.update(points));
+
+    for (Point &point : points)
+    {
+        point += Vector(0.01, -0.02);
+    }
+    points[2] += Vector(0.05, 0);
+
+    EXPECT_FALSE(open_circle_finder.update(points));
+
+    // The results must match a triangulation built from scratch
+    OpenCircleFinder rebuilt_open_circle_finder;
+    rebuilt_open_circle_finder.update(points);
+    std::vector<Circle> open_circles = open_circle_finder.findOpenCircles(bounding_box);
+    std::vector<Circle> expected =
+        rebuilt_open_circle_finder.findOpenCircles(bounding_box);
+    ASSERT_EQ(expected.size(), open_circles.size());
+    for (std::size_t i = 0; i < expected.size(); i++)
+    {
+        EXPECT_NEAR(expected[i].radius(), open_circles[i].radius(), 1e-9);
+    }
+}
+
+TEST(OpenCircleFinderTest, points_moving_past_each_other_rebuild_the_triangulation)
+{
+    Rectangle bounding_box    = Field::createSSLDivisionBField().fieldLines();
+    std::vector<Point> points = {Point(-1, 0), Point(1, 0), Point(0, 1), Point(0, -1)};
+    OpenCircleFinder open_circle_finder;
+    open_circle_finder.update(points);
+
+    // Spread the top and bottom points out so the triangles have to flip
+    points[2] = Point(0, 3);
+    points[3] = Point(0, -3);
+
+    EXPECT_TRUE(open_circle_finder.update(points));
+    expectCirclesAreOpen(open_circle_finder.findOpenCircles(bounding_box), bounding_box,
+                         points);
+}
+
+TEST(OpenCircleFinderTest, random_points_give_open_circles)
+{
+    Rectangle bounding_box = Field::createSSLDivisionBField().fieldLines();
+    Rectangle query_box(Point(0, -2), Point(4, 2));
+    std::uniform_real_distribution x_distribution(-4.5, 4.5);
+    std::uniform_real_distribution y_distribution(-3.0, 3.0);
+    std::uniform_real_distribution movement_distribution(-0.05, 0.05);
+    std::mt19937 random_num_gen;
+
+    std::vector<Point> points;
+    for (int i = 0; i < 11; i++)
+    {
+        points.emplace_back(x_distribution(random_num_gen),
+                            y_distribution(random_num_gen));
+    }
+
+    OpenCircleFinder open_circle_finder;
+    for (int update = 0; update < 50; update++)
+    {
+        for (Point &point : points)
+        {
+            point += Vector(movement_distribution(random_num_gen),
+                            movement_distribution(random_num_gen));
+        }
+        open_circle_finder.update(points);
+
+        for (const Rectangle &rectangle : {bounding_box, query_box})
+        {
+            std::vector<Circle> open_circles =
+                open_circle_finder.findOpenCircles(rectangle);
+            ASSERT_FALSE(open_circles.empty());
+            expectCirclesAreOpen(open_circles, rectangle, points);
+
+            // findOpenCircles ignores the points outside the rectangle, so it can only
+            // be compared when all the points are inside. It also does not consider
+            // where the finite edges of the voronoi diagram cross the rectangle, so it
+            // can only find smaller circles
+            if (std::all_of(points.begin(), points.end(), [&](const Point &point) {
+                    return contains(rectangle, point);
+                }))
+            {
+                EXPECT_GE(open_circles[0].radius() + 1e-9,
+                          findOpenCircles(rectangle, points)[0].radius());
+            }
+        }
+    }
+}
+
+TEST(OpenCircleFinderTest, DISABLED_update_speed_test)
+{
+    // This test does not assert anything. Rather, it can be used to gauge how fast the
+    // open circles are updated and found as the points move
+
+    const int num_updates = 1000;
+
+    Rectangle bounding_box = Field::createSSLDivisionBField().fieldLines();
+    std::uniform_real_distribution x_distribution(-4.5, 4.5);
+    std::uniform_real_distribution y_distribution(-3.0, 3.0);
+    std::uniform_real_distribution movement_distribution(-0.01, 0.01);
+    std::mt19937 random_num_gen;
+
+    std::vector<Point> points;
+    for (int i = 0; i < 11; i++)
+    {
+        points.emplace_back(x_distribution(random_num_gen),
+                            y_distribution(random_num_gen));
+    }
+
+    OpenCircleFinder open_circle_finder;
+    int num_rebuilds = 0;
+
+    auto start_time = std::chrono::system_clock::now();
+    for (int i = 0; i < num_updates; i++)
+    {
+        for (Point &point : points)
+        {
+            point += Vector(movement_distribution(random_num_gen),
+                            movement_distribution(random_num_gen));
+        }
+        num_rebuilds += open_circle_finder.update(points);
+        open_circle_finder.findOpenCircles(bounding_box);
+    }
+    double finder_duration_ms = ::TestUtil::millisecondsSince(start_time);
+
+    start_time = std::chrono::system_clock::now();
+    for (int i = 0; i < num_updates; i++)
+    {
+        findOpenCircles(bounding_box, points);
+    }
+    double find_open_circles_duration_ms = ::TestUtil::millisecondsSince(start_time);
+
+    std::cout << "Took " << finder_duration_ms / num_updates
+              << "ms on average to update and find the open circles (" << num_rebuilds
+              << " rebuilds), and " << find_open_circles_duration_ms / num_updates
+              << "ms with findOpenCircles" << std::endl;
+}
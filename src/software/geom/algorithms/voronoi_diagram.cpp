@@ -127,3 +127,39 @@ std::vector<Circle> VoronoiDiagram::voronoiVerticesToOpenCircles(
     }
     return empty_circles;
 }
+
+std::vector<std::array<std::size_t, 3>> VoronoiDiagram::getDelaunayTriangles() const
+{
+    std::vector<std::array<std::size_t, 3>> triangles;
+    for (auto vertex : diagram->vertices())
+    {
+        // The cells around a vertex are the corners of its delauney triangle, or of a
+        // convex polygon if the vertex is degenerate
+        std::vector<std::size_t> corners;
+        auto edge = vertex.incident_edge();
+        do
+        {
+            if (edge->cell()->contains_point())
+            {
+                corners.emplace_back(edge->cell()->source_index());
+            }
+            edge = edge->rot_next();
+        } while (edge != vertex.incident_edge());
+
+        for (std::size_t i = 1; i + 1 < corners.size(); i++)
+        {
+            std::array<std::size_t, 3> triangle = {corners[0], corners[i],
+                                                   corners[i + 1]};
+
+            // Keep the corners in counter-clockwise order
+            Vector side1 = points[triangle[1]] - points[triangle[0]];
+            Vector side2 = points[triangle[2]] - points[triangle[0]];
+            if (side1.cross(side2) < 0)
+            {
+                std::swap(triangle[1], triangle[2]);
+            }
+            triangles.emplace_back(triangle);
+        }
+    }
+    return triangles;
+}
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <array>
 #include <memory>
+#include <vector>
 
 #include "software/geom/circle.h"
 #include "software/geom/point.h"
@@ -51,6 +53,16 @@ class VoronoiDiagram
      */
     std::vector<Circle> voronoiVerticesToOpenCircles(const Rectangle &bounding_box);
 
+    /**
+     * Finds the triangles of the Delaunay triangulation that is the dual of this
+     * voronoi diagram. Vertices shared by more than three cells (ie. more than three
+     * points lie on the same circle) are split into several triangles
+     *
+     * @return The triangles, each holding the indices of its corners in the points
+     * used to generate the diagram, in counter-clockwise order
+     */
+    std::vector<std::array<std::size_t, 3>> getDelaunayTriangles() const;
+
    private:
     std::shared_ptr<boost::polygon::voronoi_diagram<
         double, boost::polygon::voronoi_diagram_traits<double>>>
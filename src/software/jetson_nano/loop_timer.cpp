@@ -0,0 +1,131 @@
+#include "software/jetson_nano/loop_timer.h"
+
+#include <algorithm>
+#include <cerrno>
+
+namespace
+{
+    constexpr int64_t NANOSECONDS_PER_MICROSECOND = 1000;
+    constexpr int64_t NANOSECONDS_PER_SECOND      = 1000000000;
+}  // namespace
+
+LoopTimer::LoopTimer(int64_t period_ns)
+    : period_ns(period_ns),
+      next_deadline_ns(getCurrentTimeNs()),
+      iteration_start_ns(next_deadline_ns),
+      last_lateness_ns(0),
+      max_lateness_ns(0),
+      last_iteration_time_ns(0),
+      num_iterations(0),
+      num_overruns(0),
+      num_missed_deadlines(0),
+      lateness_histogram(),
+      overrun_histogram()
+{
+}
+
+void LoopTimer::waitForNextIteration()
+{
+    // Note: CLOCK_MONOTONIC is used over CLOCK_REALTIME since CLOCK_REALTIME can jump
+    // backwards
+    struct timespec deadline;
+    deadline.tv_sec  = static_cast<time_t>(next_deadline_ns / NANOSECONDS_PER_SECOND);
+    deadline.tv_nsec = static_cast<long>(next_deadline_ns % NANOSECONDS_PER_SECOND);
+
+    // clock_nanosleep returns early if the thread is interrupted by a signal
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, nullptr) == EINTR)
+    {
+    }
+
+    iteration_start_ns = getCurrentTimeNs();
+    last_lateness_ns   = std::max<int64_t>(iteration_start_ns - next_deadline_ns, 0);
+    max_lateness_ns    = std::max(max_lateness_ns, last_lateness_ns);
+    lateness_histogram[getHistogramBucket(last_lateness_ns)]++;
+    num_iterations++;
+}
+
+void LoopTimer::finishIteration()
+{
+    int64_t iteration_end_ns = getCurrentTimeNs();
+    last_iteration_time_ns   = iteration_end_ns - iteration_start_ns;
+
+    next_deadline_ns += period_ns;
+    if (iteration_end_ns > next_deadline_ns)
+    {
+        int64_t overrun_ns = iteration_end_ns - next_deadline_ns;
+        overrun_histogram[getHistogramBucket(overrun_ns)]++;
+        num_overruns++;
+
+        // Skip to the first deadline after the end of the iteration
+        int64_t num_missed = overrun_ns / period_ns + 1;
+        next_deadline_ns += num_missed * period_ns;
+        num_missed_deadlines += static_cast<uint64_t>(num_missed);
+    }
+}
+
+int64_t LoopTimer::getNextDeadlineNs() const
+{
+    return next_deadline_ns;
+}
+
+int64_t LoopTimer::getLastLatenessNs() const
+{
+    return last_lateness_ns;
+}
+
+int64_t LoopTimer::getMaxLatenessNs() const
+{
+    return max_lateness_ns;
+}
+
+int64_t LoopTimer::getLastIterationTimeNs() const
+{
+    return last_iteration_time_ns;
+}
+
+uint64_t LoopTimer::getNumIterations() const
+{
+    return num_iterations;
+}
+
+uint64_t LoopTimer::getNumOverruns() const
+{
+    return num_overruns;
+}
+
+uint64_t LoopTimer::getNumMissedDeadlines() const
+{
+    return num_missed_deadlines;
+}
+
+const LoopTimer::Histogram& LoopTimer::getLatenessHistogram() const
+{
+    return lateness_histogram;
+}
+
+const LoopTimer::Histogram& LoopTimer::getOverrunHistogram() const
+{
+    return overrun_histogram;
+}
+
+std::size_t LoopTimer::getHistogramBucket(int64_t time_ns)
+{
+    // The bucket is the number of bits needed to hold the time in microseconds
+    uint64_t time_us   = static_cast<uint64_t>(std::max<int64_t>(time_ns, 0)) /
+                       static_cast<uint64_t>(NANOSECONDS_PER_MICROSECOND);
+    std::size_t bucket = 0;
+    while (time_us > 0 && bucket < NUM_HISTOGRAM_BUCKETS - 1)
+    {
+        time_us >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+int64_t LoopTimer::getCurrentTimeNs()
+{
+    struct timespec current_time;
+    clock_gettime(CLOCK_MONOTONIC, &current_time);
+    return static_cast<int64_t>(current_time.tv_sec) * NANOSECONDS_PER_SECOND +
+           static_cast<int64_t>(current_time.tv_nsec);
+}
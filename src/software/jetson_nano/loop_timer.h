@@ -0,0 +1,152 @@
+#pragma once
+
+#include <time.h>
+
+#include <array>
+#include <cstdint>
+
+/**
+ * Runs a loop at a fixed period on absolute CLOCK_MONOTONIC deadlines, and measures how
+ * late each iteration wakes up after its deadline and how far iterations overrun their
+ * period.
+ *
+ * Each iteration of the loop should be wrapped in waitForNextIteration and
+ * finishIteration:
+ *
+ *  LoopTimer loop_timer(period_ns);
+ *  for (;;)
+ *  {
+ *      loop_timer.waitForNextIteration();
+ *      ...
+ *      loop_timer.finishIteration();
+ *  }
+ *
+ * If an iteration runs past the next deadline, the deadlines it missed are skipped so
+ * that the loop keeps its phase instead of running several iterations back to back.
+ */
+class LoopTimer
+{
+   public:
+    // Bucket 0 counts times under 1 microsecond, bucket i counts times in
+    // [2^(i-1), 2^i) microseconds, and the last bucket also counts all longer times
+    static constexpr std::size_t NUM_HISTOGRAM_BUCKETS = 16;
+    using Histogram = std::array<uint64_t, NUM_HISTOGRAM_BUCKETS>;
+
+    /**
+     * Creates a new LoopTimer with its first deadline at the current time
+     *
+     * @param period_ns The period of the loop in nanoseconds
+     */
+    explicit LoopTimer(int64_t period_ns);
+
+    /**
+     * Sleeps until the deadline of the next iteration, and records how late the
+     * thread woke up
+     */
+    void waitForNextIteration();
+
+    /**
+     * Records the end of the current iteration and schedules the next one, skipping
+     * any deadlines that the iteration ran past
+     */
+    void finishIteration();
+
+    /**
+     * Gets the deadline that the next call to waitForNextIteration sleeps until
+     *
+     * @return the time of the next deadline on CLOCK_MONOTONIC in nanoseconds
+     */
+    int64_t getNextDeadlineNs() const;
+
+    /**
+     * Gets how late the thread woke up for the current iteration
+     *
+     * @return the time between the deadline and the start of the current iteration
+     * in nanoseconds
+     */
+    int64_t getLastLatenessNs() const;
+
+    /**
+     * Gets the most that the thread has woken up late for any iteration
+     *
+     * @return the maximum wakeup lateness in nanoseconds
+     */
+    int64_t getMaxLatenessNs() const;
+
+    /**
+     * Gets how long the last finished iteration took
+     *
+     * @return the duration of the last finished iteration in nanoseconds
+     */
+    int64_t getLastIterationTimeNs() const;
+
+    /**
+     * Gets the number of iterations that have been started
+     *
+     * @return the number of iterations
+     */
+    uint64_t getNumIterations() const;
+
+    /**
+     * Gets the number of iterations that finished after the deadline of the next
+     * iteration
+     *
+     * @return the number of overrunning iterations
+     */
+    uint64_t getNumOverruns() const;
+
+    /**
+     * Gets the number of deadlines that were skipped because an iteration ran past
+     * them
+     *
+     * @return the number of missed deadlines
+     */
+    uint64_t getNumMissedDeadlines() const;
+
+    /**
+     * Gets the histogram of how late the thread woke up for each iteration
+     *
+     * @return the wakeup lateness histogram
+     */
+    const Histogram& getLatenessHistogram() const;
+
+    /**
+     * Gets the histogram of how far each overrunning iteration ran past the deadline
+     * of the next iteration
+     *
+     * @return the overrun histogram
+     */
+    const Histogram& getOverrunHistogram() const;
+
+    /**
+     * Gets the histogram bucket that the given time is counted in
+     *
+     * @param time_ns The time in nanoseconds
+     *
+     * @return the index of the bucket that counts the time
+     */
+    static std::size_t getHistogramBucket(int64_t time_ns);
+
+   private:
+    /**
+     * Gets the current time of CLOCK_MONOTONIC
+     *
+     * @return the current time in nanoseconds
+     */
+    static int64_t getCurrentTimeNs();
+
+    int64_t period_ns;
+    int64_t next_deadline_ns;
+    int64_t iteration_start_ns;
+
+    int64_t last_lateness_ns;
+    int64_t max_lateness_ns;
+    int64_t last_iteration_time_ns;
+
+    uint64_t num_iterations;
+    uint64_t num_overruns;
+    uint64_t num_missed_deadlines;
+
+    Histogram lateness_histogram;
+    Histogram overrun_histogram;
+};
@@ -0,0 +1,208 @@
+#include "software/jetson_nano/loop_timer.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "shared/constants.h"
+#include "software/jetson_nano/realtime.h"
+
+namespace
+{
+    constexpr int64_t PERIOD_NS = 2000000;
+
+    /**
+     * Spins on the CPU for the given time, to stand in for work done in the loop
+     *
+     * @param duration The time to spin for
+     */
+    void busyWait(std::chrono::nanoseconds duration)
+    {
+        auto end_time = std::chrono::steady_clock::now() + duration;
+        while (std::chrono::steady_clock::now() < end_time)
+        {
+        }
+    }
+
+    /**
+     * Sums the counts in all buckets of a histogram
+     *
+     * @param histogram The histogram to sum
+     *
+     * @return the total count of the histogram
+     */
+    uint64_t sumHistogram(const LoopTimer::Histogram& histogram)
+    {
+        return std::accumulate(histogram.begin(), histogram.end(), uint64_t{0});
+    }
+
+    /**
+     * Gets the upper bound of the bucket that the given fraction of counts in a
+     * histogram fall under
+     *
+     * @param histogram The histogram
+     * @param fraction The fraction of counts, between 0 and 1
+     *
+     * @return the upper bound of the bucket in microseconds
+     */
+    uint64_t getPercentileUpperBoundUs(const LoopTimer::Histogram& histogram,
+                                       double fraction)
+    {
+        auto target = static_cast<uint64_t>(
+            fraction * static_cast<double>(sumHistogram(histogram)));
+        uint64_t count = 0;
+        for (std::size_t bucket = 0; bucket < histogram.size(); bucket++)
+        {
+            count += histogram[bucket];
+            if (count >= target)
+            {
+                return uint64_t{1} << bucket;
+            }
+        }
+        return uint64_t{1} << (histogram.size() - 1);
+    }
+}  // namespace
+
+TEST(LoopTimerTest, histogram_buckets)
+{
+    EXPECT_EQ(0, LoopTimer::getHistogramBucket(-10));
+    EXPECT_EQ(0, LoopTimer::getHistogramBucket(0));
+    EXPECT_EQ(0, LoopTimer::getHistogramBucket(999));
+    EXPECT_EQ(1, LoopTimer::getHistogramBucket(1000));
+    EXPECT_EQ(1, LoopTimer::getHistogramBucket(1999));
+    EXPECT_EQ(2, LoopTimer::getHistogramBucket(2000));
+    EXPECT_EQ(2, LoopTimer::getHistogramBucket(3999));
+    EXPECT_EQ(11, LoopTimer::getHistogramBucket(1500000));
+    EXPECT_EQ(LoopTimer::NUM_HISTOGRAM_BUCKETS - 1,
+              LoopTimer::getHistogramBucket(INT64_MAX));
+}
+
+TEST(LoopTimerTest, runs_at_period)
+{
+    constexpr unsigned NUM_ITERATIONS = 50;
+
+    LoopTimer loop_timer(PERIOD_NS);
+    auto start_time = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < NUM_ITERATIONS; i++)
+    {
+        loop_timer.waitForNextIteration();
+        busyWait(std::chrono::microseconds(100));
+        loop_timer.finishIteration();
+    }
+    auto elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          std::chrono::steady_clock::now() - start_time)
+                          .count();
+
+    // The first iteration starts immediately, and each of the others waits for the
+    // start of its period
+    EXPECT_GE(elapsed_ns, (NUM_ITERATIONS - 1) * PERIOD_NS);
+    EXPECT_EQ(NUM_ITERATIONS, loop_timer.getNumIterations());
+    EXPECT_EQ(NUM_ITERATIONS, sumHistogram(loop_timer.getLatenessHistogram()));
+    EXPECT_EQ(loop_timer.getNumOverruns(),
+              sumHistogram(loop_timer.getOverrunHistogram()));
+    EXPECT_GE(loop_timer.getLastIterationTimeNs(), 100000);
+    EXPECT_GE(loop_timer.getMaxLatenessNs(), loop_timer.getLastLatenessNs());
+}
+
+TEST(LoopTimerTest, overrunning_iteration_skips_missed_deadlines)
+{
+    LoopTimer loop_timer(PERIOD_NS);
+    const int64_t first_deadline_ns = loop_timer.getNextDeadlineNs();
+
+    loop_timer.waitForNextIteration();
+    // Runs past the deadlines of at least the next two iterations
+    busyWait(std::chrono::nanoseconds(PERIOD_NS * 5 / 2));
+    struct timespec overrun_time;
+    clock_gettime(CLOCK_MONOTONIC, &overrun_time);
+    const int64_t overrun_time_ns =
+        static_cast<int64_t>(overrun_time.tv_sec) *
+            static_cast<int64_t>(NANOSECONDS_PER_SECOND) +
+        overrun_time.tv_nsec;
+    loop_timer.finishIteration();
+
+    EXPECT_EQ(1, loop_timer.getNumOverruns());
+    EXPECT_GE(loop_timer.getNumMissedDeadlines(), 2);
+    EXPECT_EQ(1, sumHistogram(loop_timer.getOverrunHistogram()));
+
+    // The next iteration waits for the first deadline after the overrun instead of
+    // starting immediately at one of the missed deadlines, and keeps the phase of the
+    // loop
+    EXPECT_GT(loop_timer.getNextDeadlineNs(), overrun_time_ns);
+    EXPECT_EQ(static_cast<int64_t>(loop_timer.getNumMissedDeadlines() + 1) * PERIOD_NS,
+              loop_timer.getNextDeadlineNs() - first_deadline_ns);
+}
+
+/**
+ * Measures the jitter of a loop at THUNDERLOOP_HZ under synthetic CPU load, with the
+ * services of the loop mocked by spinning for about as long as they take on the robot.
+ * This runs on any Linux machine, and measures with real-time scheduling too if the
+ * process is allowed to use it (ex. when run as root)
+ */
+TEST(LoopTimerTest, DISABLED_jitter_under_cpu_load_speed_test)
+{
+    const int64_t THUNDERLOOP_PERIOD_NS =
+        static_cast<int64_t>(NANOSECONDS_PER_SECOND) / THUNDERLOOP_HZ;
+    constexpr unsigned NUM_ITERATIONS = 3 * THUNDERLOOP_HZ;
+
+    // Keep every CPU busy so that the loop has to compete for them
+    std::atomic_bool stop_load(false);
+    std::vector<std::thread> load_threads;
+    for (unsigned i = 0; i < std::max(1u, std::thread::hardware_concurrency()); i++)
+    {
+        load_threads.emplace_back([&stop_load]() {
+            while (!stop_load)
+            {
+            }
+        });
+    }
+
+    auto measure_jitter = [&](const std::string& name) {
+        LoopTimer loop_timer(THUNDERLOOP_PERIOD_NS);
+        for (unsigned i = 0; i < NUM_ITERATIONS; i++)
+        {
+            loop_timer.waitForNextIteration();
+            // Mocked network, primitive executor, power and motor services
+            busyWait(std::chrono::microseconds(50));
+            busyWait(std::chrono::microseconds(300));
+            busyWait(std::chrono::microseconds(100));
+            busyWait(std::chrono::microseconds(400));
+            loop_timer.finishIteration();
+        }
+
+        const auto& lateness_histogram = loop_timer.getLatenessHistogram();
+        std::cout << name << ": " << loop_timer.getNumIterations()
+                  << " iterations, p50 lateness < "
+                  << getPercentileUpperBoundUs(lateness_histogram, 0.5)
+                  << "us, p99 lateness < "
+                  << getPercentileUpperBoundUs(lateness_histogram, 0.99)
+                  << "us, max lateness " << loop_timer.getMaxLatenessNs() / 1000
+                  << "us, " << loop_timer.getNumOverruns() << " overruns and "
+                  << loop_timer.getNumMissedDeadlines() << " missed deadlines"
+                  << std::endl;
+    };
+
+    measure_jitter("Default scheduling");
+
+    std::thread realtime_thread([&]() {
+        if (configureRealtimeThread(80, 0))
+        {
+            measure_jitter("SCHED_FIFO on CPU 0");
+        }
+        else
+        {
+            std::cout << "Real-time scheduling is not allowed, skipping it" << std::endl;
+        }
+    });
+    realtime_thread.join();
+
+    stop_load = true;
+    for (std::thread& load_thread : load_threads)
+    {
+        load_thread.join();
+    }
+}
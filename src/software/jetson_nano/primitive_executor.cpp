@@ -1,5 +1,7 @@
 #include "software/jetson_nano/primitive_executor.h"
 
+#include <cmath>
+
 #include "proto/message_translation/tbots_geometry.h"
 #include "proto/message_translation/tbots_protobuf.h"
 #include "proto/primitive.pb.h"
@@ -28,21 +30,113 @@ void PrimitiveExecutor::updatePrimitiveSet(
     auto primitive_set_msg_iter = primitive_set_msg.robot_primitives().find(robot_id_);
     if (primitive_set_msg_iter != primitive_set_msg.robot_primitives().end())
     {
-        current_primitive_ = primitive_set_msg_iter->second;
+        updatePrimitive(primitive_set_msg_iter->second);
+    }
+}
+
+void PrimitiveExecutor::updatePrimitive(const TbotsProto::Primitive &primitive_msg)
+{
+    // Keep following the current trajectories if the new ones would be the same, since
+    // the AI resends the same move primitive every frame while the robot is moving
+    bool keep_trajectory = current_primitive_.has_move() && primitive_msg.has_move() &&
+                           continuesCurrentTrajectory(primitive_msg.move());
+
+    if (keep_trajectory)
+    {
+        // Only update the fields that are not part of the trajectories, since copying
+        // the whole primitive would reallocate its sub-messages
+        TbotsProto::MovePrimitive *move_primitive = current_primitive_.mutable_move();
+        move_primitive->set_dribbler_mode(primitive_msg.move().dribbler_mode());
+        *(move_primitive->mutable_auto_chip_or_kick()) =
+            primitive_msg.move().auto_chip_or_kick();
+        return;
+    }
 
-        if (current_primitive_.has_move())
+    current_primitive_ = primitive_msg;
+
+    if (current_primitive_.has_move())
+    {
+        if (!trajectory_path_.has_value())
         {
-            trajectory_path_ = createTrajectoryPathFromParams(
-                current_primitive_.move().xy_traj_params(), velocity_, robot_constants_);
+            trajectory_path_.emplace();
+        }
+        trajectory_path_params_ = current_primitive_.move().xy_traj_params();
+        if (!generateTrajectoryPathFromParams(trajectory_path_params_, velocity_,
+                                              robot_constants_, trajectory_path_.value()))
+        {
+            trajectory_path_.reset();
+        }
 
-            angular_trajectory_ = createAngularTrajectoryFromParams(
-                current_primitive_.move().w_traj_params(), angular_velocity_,
-                robot_constants_);
+        angular_trajectory_ = createAngularTrajectoryFromParams(
+            current_primitive_.move().w_traj_params(), angular_velocity_,
+            robot_constants_);
 
-            time_since_trajectory_creation_ =
-                Duration::fromSeconds(VISION_TO_ROBOT_DELAY_S);
+        time_since_trajectory_creation_ = Duration::fromSeconds(VISION_TO_ROBOT_DELAY_S);
+    }
+}
+
+bool PrimitiveExecutor::continuesCurrentTrajectory(
+    const TbotsProto::MovePrimitive &move_primitive) const
+{
+    if (!trajectory_path_.has_value() || !angular_trajectory_.has_value())
+    {
+        return false;
+    }
+
+    const TbotsProto::TrajectoryPathParams2D &current_params = trajectory_path_params_;
+    const TbotsProto::TrajectoryPathParams2D &new_params =
+        move_primitive.xy_traj_params();
+    if (new_params.max_speed_mode() != current_params.max_speed_mode() ||
+        new_params.sub_destinations_size() != current_params.sub_destinations_size() ||
+        distance(createPoint(new_params.destination()),
+                 createPoint(current_params.destination())) >
+            TRAJECTORY_CONTINUATION_POSITION_TOLERANCE_M)
+    {
+        return false;
+    }
+
+    // The new trajectory starts from where the robot was seen, which is where the
+    // current trajectory was VISION_TO_ROBOT_DELAY_S ago
+    double elapsed_time_s =
+        time_since_trajectory_creation_.toSeconds() - VISION_TO_ROBOT_DELAY_S;
+    for (int i = 0; i < new_params.sub_destinations_size(); ++i)
+    {
+        const auto &new_sub_destination     = new_params.sub_destinations(i);
+        const auto &current_sub_destination = current_params.sub_destinations(i);
+        if (distance(createPoint(new_sub_destination.sub_destination()),
+                     createPoint(current_sub_destination.sub_destination())) >
+                TRAJECTORY_CONTINUATION_POSITION_TOLERANCE_M ||
+            std::abs(new_sub_destination.connection_time_s() -
+                     (current_sub_destination.connection_time_s() - elapsed_time_s)) >
+                TRAJECTORY_CONTINUATION_TIME_TOLERANCE_S)
+        {
+            return false;
         }
     }
+
+    // The robot must also be where, and moving how, the current trajectory expects
+    if (distance(createPoint(new_params.start_position()),
+                 trajectory_path_->getPosition(elapsed_time_s)) >
+            TRAJECTORY_CONTINUATION_START_TOLERANCE_M ||
+        (createVector(new_params.initial_velocity()) -
+         trajectory_path_->getVelocity(elapsed_time_s))
+                .length() > TRAJECTORY_CONTINUATION_VELOCITY_TOLERANCE_M_PER_S)
+    {
+        return false;
+    }
+
+    const TbotsProto::TrajectoryParamsAngular1D &new_angular_params =
+        move_primitive.w_traj_params();
+    return createAngle(new_angular_params.final_angle())
+                   .minDiff(angular_trajectory_->getDestination())
+                   .toDegrees() <= TRAJECTORY_CONTINUATION_ANGLE_TOLERANCE_DEG &&
+           createAngle(new_angular_params.start_angle())
+                   .minDiff(angular_trajectory_->getPosition(elapsed_time_s))
+                   .toDegrees() <= TRAJECTORY_CONTINUATION_START_ANGLE_TOLERANCE_DEG &&
+           std::abs((createAngularVelocity(new_angular_params.initial_velocity()) -
+                     angular_trajectory_->getVelocity(elapsed_time_s))
+                        .toDegrees()) <=
+               TRAJECTORY_CONTINUATION_W_VELOCITY_TOLERANCE_DEG_PER_S;
 }
 
 void PrimitiveExecutor::setStopPrimitive()
@@ -94,8 +188,35 @@ AngularVelocity PrimitiveExecutor::getTargetAngularVelocity()
 }
 
 
+void PrimitiveExecutor::setDirectVelocityControl(
+    const Vector &velocity, const AngularVelocity &angular_velocity,
+    double dribbler_speed_rpm, const TbotsProto::AutoChipOrKick &auto_chip_or_kick,
+    TbotsProto::DirectControlPrimitive &output)
+{
+    TbotsProto::MotorControl *motor_control = output.mutable_motor_control();
+    TbotsProto::MotorControl::DirectVelocityControl *direct_velocity_control =
+        motor_control->mutable_direct_velocity_control();
+    direct_velocity_control->mutable_velocity()->set_x_component_meters(velocity.x());
+    direct_velocity_control->mutable_velocity()->set_y_component_meters(velocity.y());
+    direct_velocity_control->mutable_angular_velocity()->set_radians_per_second(
+        angular_velocity.toRadians());
+    motor_control->set_dribbler_speed_rpm(static_cast<int32_t>(dribbler_speed_rpm));
+
+    TbotsProto::PowerControl *power_control = output.mutable_power_control();
+    *(power_control->mutable_chicker()->mutable_auto_chip_or_kick()) = auto_chip_or_kick;
+    power_control->clear_geneva_slot();
+}
+
 std::unique_ptr<TbotsProto::DirectControlPrimitive> PrimitiveExecutor::stepPrimitive(
     TbotsProto::PrimitiveExecutorStatus &status)
+{
+    auto output = std::make_unique<TbotsProto::DirectControlPrimitive>();
+    stepPrimitive(status, *output);
+    return output;
+}
+
+void PrimitiveExecutor::stepPrimitive(TbotsProto::PrimitiveExecutorStatus &status,
+                                      TbotsProto::DirectControlPrimitive &output)
 {
     time_since_trajectory_creation_ += time_step_;
     status.set_running_primitive(true);
@@ -104,42 +225,36 @@ std::unique_ptr<TbotsProto::DirectControlPrimitive> PrimitiveExecutor::stepPrimi
     {
         case TbotsProto::Primitive::kStop:
         {
-            auto prim   = createDirectControlPrimitive(Vector(), AngularVelocity(), 0.0,
-                                                     TbotsProto::AutoChipOrKick());
-            auto output = std::make_unique<TbotsProto::DirectControlPrimitive>(
-                prim->direct_control());
+            setDirectVelocityControl(Vector(), AngularVelocity(), 0.0,
+                                     TbotsProto::AutoChipOrKick(), output);
             status.set_running_primitive(false);
-            return output;
+            return;
         }
         case TbotsProto::Primitive::kDirectControl:
         {
-            return std::make_unique<TbotsProto::DirectControlPrimitive>(
-                current_primitive_.direct_control());
+            output = current_primitive_.direct_control();
+            return;
         }
         case TbotsProto::Primitive::kMove:
         {
             if (!trajectory_path_.has_value() || !angular_trajectory_.has_value())
             {
-                auto prim = createDirectControlPrimitive(Vector(), AngularVelocity(), 0.0,
-                                                         TbotsProto::AutoChipOrKick());
-                auto output = std::make_unique<TbotsProto::DirectControlPrimitive>(
-                    prim->direct_control());
+                setDirectVelocityControl(Vector(), AngularVelocity(), 0.0,
+                                         TbotsProto::AutoChipOrKick(), output);
                 LOG(INFO)
                     << "Not moving because trajectory_path_ or angular_trajectory_ is not set";
-                return output;
+                return;
             }
 
             Vector local_velocity            = getTargetLinearVelocity();
             AngularVelocity angular_velocity = getTargetAngularVelocity();
 
-            auto output = createDirectControlPrimitive(
+            setDirectVelocityControl(
                 local_velocity, angular_velocity,
                 convertDribblerModeToDribblerSpeed(
                     current_primitive_.move().dribbler_mode(), robot_constants_),
-                current_primitive_.move().auto_chip_or_kick());
-
-            return std::make_unique<TbotsProto::DirectControlPrimitive>(
-                output->direct_control());
+                current_primitive_.move().auto_chip_or_kick(), output);
+            return;
         }
         case TbotsProto::Primitive::PRIMITIVE_NOT_SET:
         {
@@ -150,7 +265,7 @@ std::unique_ptr<TbotsProto::DirectControlPrimitive> PrimitiveExecutor::stepPrimi
             // LOG(DEBUG) << "No primitive set!";
         }
     }
-    return std::make_unique<TbotsProto::DirectControlPrimitive>();
+    output.Clear();
 }
 
 void PrimitiveExecutor::setRobotId(const RobotId robot_id)
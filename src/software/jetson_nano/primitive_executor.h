@@ -3,7 +3,7 @@
 #include "proto/robot_status_msg.pb.h"
 #include "proto/tbots_software_msgs.pb.h"
 #include "software/ai/navigator/trajectory/bang_bang_trajectory_1d_angular.h"
-#include "software/ai/navigator/trajectory/trajectory_path.h"
+#include "software/ai/navigator/trajectory/bang_bang_trajectory_path.h"
 #include "software/geom/vector.h"
 #include "software/world/world.h"
 
@@ -29,6 +29,14 @@ class PrimitiveExecutor
      */
     void updatePrimitiveSet(const TbotsProto::PrimitiveSet &primitive_set_msg);
 
+    /**
+     * Update primitive executor with a new Primitive for this robot. If the primitive
+     * is a move primitive whose trajectory continues the trajectory that is currently
+     * being followed, the current trajectory is kept instead of being regenerated
+     * @param primitive_msg The primitive to start
+     */
+    void updatePrimitive(const TbotsProto::Primitive &primitive_msg);
+
     /**
      * Set the current primitive to the stop primitive
      */
@@ -60,6 +68,17 @@ class PrimitiveExecutor
     std::unique_ptr<TbotsProto::DirectControlPrimitive> stepPrimitive(
         TbotsProto::PrimitiveExecutorStatus &status);
 
+    /**
+     * Steps the current primitive and writes a direct control primitive with the
+     * target wheel velocities into the given output, reusing its storage so that
+     * stepping a primitive does not allocate
+     * @param status The status of the primitive executor, set to false if current
+     * primitive is a Stop primitive
+     * @param output The direct control primitive msg to write to
+     */
+    void stepPrimitive(TbotsProto::PrimitiveExecutorStatus &status,
+                       TbotsProto::DirectControlPrimitive &output);
+
    private:
     /*
      * Compute the next target linear _local_ velocity the robot should be at.
@@ -74,6 +93,35 @@ class PrimitiveExecutor
      */
     AngularVelocity getTargetAngularVelocity();
 
+    /**
+     * Checks whether the given move primitive's trajectories continue the trajectories
+     * that are currently being followed, i.e. they are generated from the same
+     * parameters, shifted by the time elapsed since the current trajectories were
+     * created, and they start from the position and velocity that the current
+     * trajectories are at after that time. If so, the current trajectories can be kept
+     * instead of being regenerated
+     *
+     * @param move_primitive The new move primitive
+     * @return true if the current trajectories can be kept, false otherwise
+     */
+    bool continuesCurrentTrajectory(
+        const TbotsProto::MovePrimitive &move_primitive) const;
+
+    /**
+     * Writes a direct velocity control primitive into the given output, setting every
+     * field so that nothing is left over from what the output previously held
+     *
+     * @param velocity The target _local_ velocity
+     * @param angular_velocity The target angular velocity
+     * @param dribbler_speed_rpm The target dribbler speed
+     * @param auto_chip_or_kick The auto chip or kick command
+     * @param output The direct control primitive msg to write to
+     */
+    static void setDirectVelocityControl(
+        const Vector &velocity, const AngularVelocity &angular_velocity,
+        double dribbler_speed_rpm, const TbotsProto::AutoChipOrKick &auto_chip_or_kick,
+        TbotsProto::DirectControlPrimitive &output);
+
     TbotsProto::Primitive current_primitive_;
     Duration time_since_trajectory_creation_;
     Vector velocity_;
@@ -81,7 +129,9 @@ class PrimitiveExecutor
     Angle orientation_;
     TeamColour friendly_team_colour_;
     RobotConstants_t robot_constants_;
-    std::optional<TrajectoryPath> trajectory_path_;
+    std::optional<BangBangTrajectoryPath> trajectory_path_;
+    // The parameters that trajectory_path_ was generated from
+    TbotsProto::TrajectoryPathParams2D trajectory_path_params_;
     std::optional<BangBangTrajectory1DAngular> angular_trajectory_;
 
     // TODO (#2855): Add dynamic time_step to `stepPrimitive` and remove this constant
@@ -95,4 +145,14 @@ class PrimitiveExecutor
     // The distance away from the destination at which we start dampening the velocity
     // to avoid jittering around the destination.
     static constexpr double MAX_DAMPENING_VELOCITY_DISTANCE_M = 0.05;
+
+    // How far the parameters of a new move primitive can be from the trajectory that
+    // is currently being followed for that trajectory to be kept
+    static constexpr double TRAJECTORY_CONTINUATION_POSITION_TOLERANCE_M          = 0.02;
+    static constexpr double TRAJECTORY_CONTINUATION_START_TOLERANCE_M             = 0.02;
+    static constexpr double TRAJECTORY_CONTINUATION_VELOCITY_TOLERANCE_M_PER_S    = 0.1;
+    static constexpr double TRAJECTORY_CONTINUATION_TIME_TOLERANCE_S              = 0.05;
+    static constexpr double TRAJECTORY_CONTINUATION_ANGLE_TOLERANCE_DEG           = 2.0;
+    static constexpr double TRAJECTORY_CONTINUATION_START_ANGLE_TOLERANCE_DEG     = 5.0;
+    static constexpr double TRAJECTORY_CONTINUATION_W_VELOCITY_TOLERANCE_DEG_PER_S = 10.0;
 };
@@ -0,0 +1,227 @@
+#include "software/jetson_nano/primitive_executor.h"
+
+#include <gtest/gtest.h>
+
+#include "proto/message_translation/tbots_geometry.h"
+#include "proto/message_translation/tbots_protobuf.h"
+#include "proto/primitive/primitive_msg_factory.h"
+#include "shared/2021_robot_constants.h"
+#include "software/test_util/allocation_counter.h"
+
+class PrimitiveExecutorTest : public ::testing::Test
+{
+   protected:
+    PrimitiveExecutorTest()
+        : robot_constants(create2021RobotConstants()),
+          executor(TIME_STEP, robot_constants, TeamColour::BLUE, ROBOT_ID)
+    {
+    }
+
+    /**
+     * Creates a move primitive from the given start position to the given destination
+     *
+     * @param start_position The position the robot was seen at
+     * @param destination The destination of the move primitive
+     * @return The move primitive
+     */
+    static TbotsProto::Primitive createMovePrimitive(const Point& start_position,
+                                                     const Point& destination)
+    {
+        TbotsProto::Primitive primitive;
+        TbotsProto::TrajectoryPathParams2D* xy_traj_params =
+            primitive.mutable_move()->mutable_xy_traj_params();
+        *(xy_traj_params->mutable_start_position()) = *createPointProto(start_position);
+        *(xy_traj_params->mutable_destination())    = *createPointProto(destination);
+        xy_traj_params->set_max_speed_mode(
+            TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT);
+
+        TbotsProto::TrajectoryParamsAngular1D* w_traj_params =
+            primitive.mutable_move()->mutable_w_traj_params();
+        *(w_traj_params->mutable_start_angle()) = *createAngleProto(Angle::zero());
+        *(w_traj_params->mutable_final_angle()) = *createAngleProto(Angle::zero());
+        return primitive;
+    }
+
+    /**
+     * Creates the move primitive that the AI sends once the robot has followed the
+     * trajectory of the given move primitive for the given number of steps, which
+     * starts from the position and velocity that the robot is at by then
+     *
+     * @param move_primitive The move primitive the robot is following
+     * @param num_steps The number of steps the robot has followed it for
+     * @return The move primitive starting from where the robot is after num_steps
+     */
+    TbotsProto::Primitive createContinuedMovePrimitive(
+        const TbotsProto::Primitive& move_primitive, unsigned int num_steps) const
+    {
+        BangBangTrajectoryPath trajectory_path;
+        generateTrajectoryPathFromParams(move_primitive.move().xy_traj_params(),
+                                         Vector(), robot_constants, trajectory_path);
+        double elapsed_time_s = num_steps * TIME_STEP.toSeconds();
+
+        TbotsProto::Primitive continued_primitive = move_primitive;
+        TbotsProto::TrajectoryPathParams2D* xy_traj_params =
+            continued_primitive.mutable_move()->mutable_xy_traj_params();
+        *(xy_traj_params->mutable_start_position()) =
+            *createPointProto(trajectory_path.getPosition(elapsed_time_s));
+        *(xy_traj_params->mutable_initial_velocity()) =
+            *createVectorProto(trajectory_path.getVelocity(elapsed_time_s));
+        return continued_primitive;
+    }
+
+    /**
+     * Steps the given executor the given number of times
+     *
+     * @param primitive_executor The executor to step
+     * @param num_steps The number of times to step the executor
+     * @return The direct control primitive from the last step
+     */
+    static TbotsProto::DirectControlPrimitive step(PrimitiveExecutor& primitive_executor,
+                                                   unsigned int num_steps)
+    {
+        TbotsProto::PrimitiveExecutorStatus status;
+        TbotsProto::DirectControlPrimitive output;
+        for (unsigned int i = 0; i < num_steps; i++)
+        {
+            primitive_executor.stepPrimitive(status, output);
+        }
+        return output;
+    }
+
+    static Vector getVelocity(const TbotsProto::DirectControlPrimitive& output)
+    {
+        return createVector(output.motor_control().direct_velocity_control().velocity());
+    }
+
+    static constexpr RobotId ROBOT_ID = 0;
+    const Duration TIME_STEP          = Duration::fromSeconds(1.0 / 60.0);
+    RobotConstants_t robot_constants;
+    PrimitiveExecutor executor;
+};
+
+TEST_F(PrimitiveExecutorTest, resending_same_move_primitive_continues_trajectory)
+{
+    TbotsProto::Primitive move_primitive = createMovePrimitive(Point(0, 0), Point(2, 0));
+    executor.updatePrimitive(move_primitive);
+    step(executor, 3);
+
+    // The robot is following the trajectory, so the AI sends the same move primitive
+    // again, starting from where the robot is now
+    executor.updatePrimitive(createContinuedMovePrimitive(move_primitive, 3));
+    Vector velocity = getVelocity(step(executor, 1));
+
+    PrimitiveExecutor expected_executor(TIME_STEP, robot_constants, TeamColour::BLUE,
+                                        ROBOT_ID);
+    expected_executor.updatePrimitive(move_primitive);
+    Vector expected_velocity = getVelocity(step(expected_executor, 4));
+
+    EXPECT_GT(velocity.x(), 0);
+    EXPECT_DOUBLE_EQ(expected_velocity.x(), velocity.x());
+    EXPECT_DOUBLE_EQ(expected_velocity.y(), velocity.y());
+}
+
+TEST_F(PrimitiveExecutorTest, new_destination_regenerates_trajectory)
+{
+    executor.updatePrimitive(createMovePrimitive(Point(0, 0), Point(2, 0)));
+    step(executor, 3);
+
+    TbotsProto::Primitive new_move_primitive =
+        createMovePrimitive(Point(0, 0), Point(-2, 0));
+    executor.updatePrimitive(new_move_primitive);
+    Vector velocity = getVelocity(step(executor, 1));
+
+    PrimitiveExecutor expected_executor(TIME_STEP, robot_constants, TeamColour::BLUE,
+                                        ROBOT_ID);
+    expected_executor.updatePrimitive(new_move_primitive);
+    Vector expected_velocity = getVelocity(step(expected_executor, 1));
+
+    EXPECT_LT(velocity.x(), 0);
+    EXPECT_DOUBLE_EQ(expected_velocity.x(), velocity.x());
+    EXPECT_DOUBLE_EQ(expected_velocity.y(), velocity.y());
+}
+
+TEST_F(PrimitiveExecutorTest, different_start_velocity_regenerates_trajectory)
+{
+    TbotsProto::Primitive move_primitive = createMovePrimitive(Point(0, 0), Point(2, 0));
+    executor.updatePrimitive(move_primitive);
+    step(executor, 3);
+
+    // The robot is where the trajectory expects it to be, but has been pushed sideways
+    TbotsProto::Primitive pushed_move_primitive =
+        createContinuedMovePrimitive(move_primitive, 3);
+    *(pushed_move_primitive.mutable_move()
+          ->mutable_xy_traj_params()
+          ->mutable_initial_velocity()) = *createVectorProto(Vector(0, 0.5));
+    executor.updatePrimitive(pushed_move_primitive);
+    Vector velocity = getVelocity(step(executor, 1));
+
+    PrimitiveExecutor expected_executor(TIME_STEP, robot_constants, TeamColour::BLUE,
+                                        ROBOT_ID);
+    expected_executor.updatePrimitive(pushed_move_primitive);
+    Vector expected_velocity = getVelocity(step(expected_executor, 1));
+
+    EXPECT_DOUBLE_EQ(expected_velocity.x(), velocity.x());
+    EXPECT_DOUBLE_EQ(expected_velocity.y(), velocity.y());
+}
+
+TEST_F(PrimitiveExecutorTest, step_overwrites_previous_output)
+{
+    executor.updatePrimitive(createMovePrimitive(Point(0, 0), Point(2, 1)));
+    PrimitiveExecutor expected_executor(TIME_STEP, robot_constants, TeamColour::BLUE,
+                                        ROBOT_ID);
+    expected_executor.updatePrimitive(createMovePrimitive(Point(0, 0), Point(2, 1)));
+
+    // Start from an output holding a different direct control primitive to check that
+    // nothing is left over from it
+    TbotsProto::DirectControlPrimitive output =
+        createDirectControlPrimitive(Vector(1, 1), AngularVelocity::fromRadians(1), 100,
+                                     TbotsProto::AutoChipOrKick())
+            ->direct_control();
+    output.mutable_power_control()->set_geneva_slot(TbotsProto::Geneva::LEFT);
+    output.mutable_power_control()->mutable_chicker()->set_kick_speed_m_per_s(3);
+
+    TbotsProto::PrimitiveExecutorStatus status;
+    executor.stepPrimitive(status, output);
+    TbotsProto::DirectControlPrimitive expected_output = step(expected_executor, 1);
+    EXPECT_EQ(expected_output.SerializeAsString(), output.SerializeAsString());
+
+    executor.setStopPrimitive();
+    executor.stepPrimitive(status, output);
+    EXPECT_EQ(createDirectControlPrimitive(Vector(), AngularVelocity(), 0.0,
+                                           TbotsProto::AutoChipOrKick())
+                  ->direct_control()
+                  .SerializeAsString(),
+              output.SerializeAsString());
+    EXPECT_FALSE(status.running_primitive());
+}
+
+TEST_F(PrimitiveExecutorTest, steady_state_does_not_allocate)
+{
+    TbotsProto::Primitive move_primitive = createMovePrimitive(Point(0, 0), Point(2, 0));
+    TbotsProto::PrimitiveExecutorStatus status;
+    TbotsProto::DirectControlPrimitive output;
+
+    // The AI resends the same move primitive, starting from where the robot is, while
+    // the robot follows its trajectory
+    std::vector<TbotsProto::Primitive> continued_move_primitives;
+    for (unsigned int i = 0; i < 5; i++)
+    {
+        continued_move_primitives.push_back(
+            createContinuedMovePrimitive(move_primitive, i));
+    }
+
+    // Warm up the executor and the output, like the first ticks of Thunderloop
+    executor.updatePrimitive(continued_move_primitives[0]);
+    executor.stepPrimitive(status, output);
+    executor.updatePrimitive(continued_move_primitives[1]);
+    executor.stepPrimitive(status, output);
+
+    TestUtil::AllocationCounter allocation_counter;
+    for (unsigned int i = 2; i < 5; i++)
+    {
+        executor.updatePrimitive(continued_move_primitives[i]);
+        executor.stepPrimitive(status, output);
+    }
+    EXPECT_EQ(0, allocation_counter.getNumAllocations());
+    EXPECT_GT(getVelocity(output).x(), 0);
+}
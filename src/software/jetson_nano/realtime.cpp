@@ -0,0 +1,68 @@
+#include "software/jetson_nano/realtime.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+#include <cstring>
+
+#include "software/logger/logger.h"
+
+namespace
+{
+    // The size of the block of stack that is pre-faulted. This is well under the
+    // default 8MB stack, and covers the deepest call stacks of the loop
+    constexpr std::size_t STACK_PREFAULT_SIZE = 512 * 1024;
+}  // namespace
+
+bool configureRealtimeThread(int priority, std::optional<int> cpu)
+{
+    bool configured = true;
+
+    struct sched_param param;
+    param.sched_priority = priority;
+    int error            = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+    if (error != 0)
+    {
+        LOG(WARNING) << "Could not set SCHED_FIFO with priority " << priority << ": "
+                     << std::strerror(error);
+        configured = false;
+    }
+
+    if (cpu.has_value() && !pinThreadToCpu(cpu.value()))
+    {
+        configured = false;
+    }
+
+    prefaultStack();
+
+    return configured;
+}
+
+bool pinThreadToCpu(int cpu)
+{
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(cpu, &cpu_set);
+    int error = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+    if (error != 0)
+    {
+        LOG(WARNING) << "Could not pin thread to CPU " << cpu << ": "
+                     << std::strerror(error);
+        return false;
+    }
+    return true;
+}
+
+void prefaultStack()
+{
+    // Each write generates a page fault the first time a page is touched. Since
+    // memory is locked, the page then stays mapped for the rest of the process
+    volatile unsigned char stack[STACK_PREFAULT_SIZE];
+    const auto page_size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    for (std::size_t i = 0; i < STACK_PREFAULT_SIZE; i += page_size)
+    {
+        stack[i] = 0;
+    }
+    static_cast<void>(stack[0]);
+}
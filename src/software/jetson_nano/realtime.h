@@ -0,0 +1,38 @@
+#pragma once
+
+#include <optional>
+
+/**
+ * Makes the calling thread real-time. The thread is scheduled with SCHED_FIFO at the
+ * given priority, optionally pinned to a single CPU, and has its stack pre-faulted so
+ * that it does not page fault the first time the loop goes deep into its calls.
+ *
+ * Memory should already be locked with mlockall(MCL_CURRENT | MCL_FUTURE) so that the
+ * pre-faulted stack stays resident. Threads created by the calling thread afterwards
+ * inherit its scheduling policy, so this should be called after any non real-time
+ * threads have been started.
+ *
+ * Each setting that can not be applied (ex. without the CAP_SYS_NICE capability) is
+ * logged and skipped.
+ *
+ * @param priority The SCHED_FIFO priority of the thread, between 1 and 99
+ * @param cpu The CPU to pin the thread to, or std::nullopt to let it run on any CPU
+ *
+ * @return whether all of the settings were applied
+ */
+bool configureRealtimeThread(int priority, std::optional<int> cpu);
+
+/**
+ * Pins the calling thread to a single CPU. If it can not be pinned, a warning is logged
+ *
+ * @param cpu The CPU to pin the thread to
+ *
+ * @return whether the thread was pinned
+ */
+bool pinThreadToCpu(int cpu);
+
+/**
+ * Touches every page of a block of the calling thread's stack, so that the pages are
+ * mapped before they are needed
+ */
+void prefaultStack();
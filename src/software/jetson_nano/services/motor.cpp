@@ -23,6 +23,7 @@
 #include "proto/tbots_software_msgs.pb.h"
 #include "shared/constants.h"
 #include "software/logger/logger.h"
+#include "software/spi/spidev_communication.h"
 #include "software/util/scoped_timespec_timer/scoped_timespec_timer.h"
 
 extern "C"
@@ -78,9 +79,12 @@ MotorService::MotorService(const RobotConstants_t& robot_constants,
                           GpioState::LOW),
       spi_demux_select_1_(SPI_CS_DRIVER_TO_CONTROLLER_MUX_1_GPIO, GpioDirection::OUTPUT,
                           GpioState::LOW),
+      spi_demux_selection_(SpiDemuxSelection::NONE),
       driver_control_enable_gpio_(DRIVER_CONTROL_ENABLE_GPIO, GpioDirection::OUTPUT,
                                   GpioState::HIGH),
       reset_gpio_(MOTOR_DRIVER_RESET_GPIO, GpioDirection::OUTPUT, GpioState::HIGH),
+      velocity_batch_(TMC4671_SPI_SPEED),
+      spi_(std::make_unique<SpidevCommunication>()),
       robot_constants_(robot_constants),
       euclidean_to_four_wheel_(robot_constants),
       motor_fault_detector_(0),
@@ -446,29 +450,44 @@ TbotsProto::MotorStatus MotorService::poll(const TbotsProto::MotorControl& motor
     // Get current wheel electical RPM (don't account for pole pairs). We will use these
     // for robot status feedback We assume the motors have ramped to the expected RPM from
     // the previous iteration.
+    //
+    // The velocities of all motors are read and their target velocities written in one
+    // batch, with one SPI message per motor
+    velocity_batch_.clear();
+    std::size_t front_right_transaction = velocity_batch_.addReadThenWrite(
+        file_descriptors_[FRONT_RIGHT_MOTOR_CHIP_SELECT], TMC4671_PID_VELOCITY_ACTUAL,
+        TMC4671_PID_VELOCITY_TARGET, front_right_target_rpm);
+    std::size_t front_left_transaction = velocity_batch_.addReadThenWrite(
+        file_descriptors_[FRONT_LEFT_MOTOR_CHIP_SELECT], TMC4671_PID_VELOCITY_ACTUAL,
+        TMC4671_PID_VELOCITY_TARGET, front_left_target_rpm);
+    std::size_t back_right_transaction = velocity_batch_.addReadThenWrite(
+        file_descriptors_[BACK_RIGHT_MOTOR_CHIP_SELECT], TMC4671_PID_VELOCITY_ACTUAL,
+        TMC4671_PID_VELOCITY_TARGET, back_right_target_rpm);
+    std::size_t back_left_transaction = velocity_batch_.addReadThenWrite(
+        file_descriptors_[BACK_LEFT_MOTOR_CHIP_SELECT], TMC4671_PID_VELOCITY_ACTUAL,
+        TMC4671_PID_VELOCITY_TARGET, back_left_target_rpm);
+    std::size_t dribbler_transaction = velocity_batch_.addReadThenWrite(
+        file_descriptors_[DRIBBLER_MOTOR_CHIP_SELECT], TMC4671_PID_VELOCITY_ACTUAL,
+        TMC4671_PID_VELOCITY_TARGET, dribbler_ramp_rpm_);
+
+    selectOnSpiDemux(SpiDemuxSelection::CONTROLLER);
+    CHECK(velocity_batch_.transfer(*spi_))
+        << "SPI Transfer to motor failed, not safe to proceed: errno " << strerror(errno);
+
     double front_right_velocity =
-        static_cast<double>(tmc4671ReadThenWriteValue(
-            FRONT_RIGHT_MOTOR_CHIP_SELECT, TMC4671_PID_VELOCITY_ACTUAL,
-            TMC4671_PID_VELOCITY_TARGET, front_right_target_rpm)) *
+        static_cast<double>(velocity_batch_.getReadValue(front_right_transaction)) *
         MECHANICAL_MPS_PER_ELECTRICAL_RPM;
     double front_left_velocity =
-        static_cast<double>(tmc4671ReadThenWriteValue(
-            FRONT_LEFT_MOTOR_CHIP_SELECT, TMC4671_PID_VELOCITY_ACTUAL,
-            TMC4671_PID_VELOCITY_TARGET, front_left_target_rpm)) *
+        static_cast<double>(velocity_batch_.getReadValue(front_left_transaction)) *
         MECHANICAL_MPS_PER_ELECTRICAL_RPM;
     double back_right_velocity =
-        static_cast<double>(tmc4671ReadThenWriteValue(
-            BACK_RIGHT_MOTOR_CHIP_SELECT, TMC4671_PID_VELOCITY_ACTUAL,
-            TMC4671_PID_VELOCITY_TARGET, back_right_target_rpm)) *
+        static_cast<double>(velocity_batch_.getReadValue(back_right_transaction)) *
         MECHANICAL_MPS_PER_ELECTRICAL_RPM;
     double back_left_velocity =
-        static_cast<double>(tmc4671ReadThenWriteValue(
-            BACK_LEFT_MOTOR_CHIP_SELECT, TMC4671_PID_VELOCITY_ACTUAL,
-            TMC4671_PID_VELOCITY_TARGET, back_left_target_rpm)) *
+        static_cast<double>(velocity_batch_.getReadValue(back_left_transaction)) *
         MECHANICAL_MPS_PER_ELECTRICAL_RPM;
-    double dribbler_rpm = static_cast<double>(
-        tmc4671ReadThenWriteValue(DRIBBLER_MOTOR_CHIP_SELECT, TMC4671_PID_VELOCITY_ACTUAL,
-                                  TMC4671_PID_VELOCITY_TARGET, dribbler_ramp_rpm_));
+    double dribbler_rpm =
+        static_cast<double>(velocity_batch_.getReadValue(dribbler_transaction));
 
     // Construct a MotorStatus object with the current velocities and dribbler rpm
     TbotsProto::MotorStatus motor_status =
@@ -612,8 +631,6 @@ bool MotorService::requiresMotorReinit(uint8_t motor)
 void MotorService::spiTransfer(int fd, uint8_t const* tx, uint8_t const* rx, unsigned len,
                                uint32_t spi_speed)
 {
-    int ret;
-
     struct spi_ioc_transfer tr[1];
     memset(tr, 0, sizeof(tr));
 
@@ -624,41 +641,7 @@ void MotorService::spiTransfer(int fd, uint8_t const* tx, uint8_t const* rx, uns
     tr[0].speed_hz      = spi_speed;
     tr[0].bits_per_word = 8;
 
-    ret = ioctl(fd, SPI_IOC_MESSAGE(1), &tr);
-
-    CHECK(ret >= 1) << "SPI Transfer to motor failed, not safe to proceed: errno "
-                    << strerror(errno);
-}
-
-
-void MotorService::readThenWriteSpiTransfer(int fd, const uint8_t* read_tx,
-                                            const uint8_t* write_tx,
-                                            const uint8_t* read_rx, uint32_t spi_speed)
-{
-    uint8_t write_rx[5] = {0};
-
-    struct spi_ioc_transfer tr[2];
-    memset(tr, 0, sizeof(tr));
-
-    tr[0].tx_buf        = (unsigned long)read_tx;
-    tr[0].rx_buf        = (unsigned long)read_rx;
-    tr[0].len           = TMC_CMD_MSG_SIZE;
-    tr[0].delay_usecs   = 0;
-    tr[0].speed_hz      = spi_speed;
-    tr[0].bits_per_word = 8;
-    tr[0].cs_change     = 0;
-    tr[1].tx_buf        = (unsigned long)write_tx;
-    tr[1].rx_buf        = (unsigned long)write_rx;
-    tr[1].len           = TMC_CMD_MSG_SIZE;
-    tr[1].delay_usecs   = 0;
-    tr[1].speed_hz      = spi_speed;
-    tr[1].bits_per_word = 8;
-    tr[1].cs_change     = 0;
-
-    int ret1 = ioctl(fd, SPI_IOC_MESSAGE(1), &tr);
-    int ret2 = ioctl(fd, SPI_IOC_MESSAGE(1), &tr[1]);
-
-    CHECK(ret1 >= 1 && ret2 >= 1)
+    CHECK(spi_->transfer(fd, tr, 1))
         << "SPI Transfer to motor failed, not safe to proceed: errno " << strerror(errno);
 }
 
@@ -700,56 +683,47 @@ void MotorService::readThenWriteSpiTransfer(int fd, const uint8_t* read_tx,
 uint8_t MotorService::tmc4671ReadWriteByte(uint8_t motor, uint8_t data,
                                            uint8_t last_transfer)
 {
-    spi_demux_select_0_.setValue(GpioState::HIGH);
-    spi_demux_select_1_.setValue(GpioState::LOW);
+    selectOnSpiDemux(SpiDemuxSelection::CONTROLLER);
     return readWriteByte(motor, data, last_transfer, TMC4671_SPI_SPEED);
 }
 
-int32_t MotorService::tmc4671ReadThenWriteValue(uint8_t motor, uint8_t read_addr,
-                                                uint8_t write_addr, int32_t write_data)
+void MotorService::selectOnSpiDemux(SpiDemuxSelection selection)
 {
-    spi_demux_select_0_.setValue(GpioState::HIGH);
-    spi_demux_select_1_.setValue(GpioState::LOW);
-    // ensure tx_ and rx_ are cleared
-    memset(read_tx_, 0, 5);
-    memset(write_tx_, 0, 5);
-    memset(read_rx_, 0, 5);
-
-    //  Trinamic transactions looks like this:
-    //  + - - - + - - - + - - - + - - - + - - - +
-    //  |  ADDR |             DATA              |
-    //  + - - - + - - - + - - - + - - - + - - - +
-    //      0        1      2       3       4
-    //  Also it is in BIG Endian, therefore MSB is leftmost bit of 0.
-    //  For a write, MSB must be 1, for read, MSB must be 0
-    //  https://github.com/trinamic/TMC-API/blob/master/tmc/ic/TMC4671/TMC4671.c
-    read_tx_[0]  = read_addr & 0x7f;
-    write_tx_[0] = write_addr | 0x80;
-
-    // Convert from little endian to big endian
-    for (int i = 3; i >= 0; i--)
+    // Setting a gpio writes to sysfs, so the selects are only set when they change
+    if (selection == spi_demux_selection_)
     {
-        uint8_t byte_to_copy = (uint8_t)(0xff & (write_data >> 8 * i));
-        write_tx_[4 - i]     = byte_to_copy;
+        return;
     }
 
-    readThenWriteSpiTransfer(file_descriptors_[motor], read_tx_, write_tx_, read_rx_,
-                             TMC4671_SPI_SPEED);
-
-    int32_t value = read_rx_[0];
-    for (int i = 1; i < 5; i++)
+    switch (selection)
     {
-        value <<= 8;
-        value |= read_rx_[i];
+        case SpiDemuxSelection::NONE:
+        {
+            spi_demux_select_0_.setValue(GpioState::LOW);
+            spi_demux_select_1_.setValue(GpioState::LOW);
+            break;
+        }
+        case SpiDemuxSelection::CONTROLLER:
+        {
+            spi_demux_select_0_.setValue(GpioState::HIGH);
+            spi_demux_select_1_.setValue(GpioState::LOW);
+            break;
+        }
+        case SpiDemuxSelection::DRIVER:
+        {
+            spi_demux_select_0_.setValue(GpioState::LOW);
+            spi_demux_select_1_.setValue(GpioState::HIGH);
+            break;
+        }
     }
-    return value;
+
+    spi_demux_selection_ = selection;
 }
 
 uint8_t MotorService::tmc6100ReadWriteByte(uint8_t motor, uint8_t data,
                                            uint8_t last_transfer)
 {
-    spi_demux_select_0_.setValue(GpioState::LOW);
-    spi_demux_select_1_.setValue(GpioState::HIGH);
+    selectOnSpiDemux(SpiDemuxSelection::DRIVER);
     return readWriteByte(motor, data, last_transfer, TMC6100_SPI_SPEED);
 }
 
@@ -8,7 +8,9 @@
 #include "proto/tbots_software_msgs.pb.h"
 #include "shared/robot_constants.h"
 #include "software/jetson_nano/gpio.h"
+#include "software/jetson_nano/services/trinamic_spi_batch.h"
 #include "software/physics/euclidean_to_wheel.h"
+#include "software/spi/spi_communication.h"
 
 class MotorService
 {
@@ -239,32 +241,22 @@ class MotorService
                      uint32_t spi_speed);
 
     /**
-     * Performs two back to back SPI transactions, first a read and then a write.
-     * NOTE: read_tx and write_tx must both be in BIG ENDIAN, as required by the
-     * Trinamic controller
-     *
-     * @param fd the SPI file descriptor to transfer data over
-     * @param read_tx pointer to the buffer containing the address for reading
-     * @param write_tx pointer to the buffer containing the address + data for write
-     * @param read_rx the buffer our read response will be placed in
-     * @param spi_speed the speed to run spi at
+     * The chips that can be selected on the SPI demux of each motor
      */
-    void readThenWriteSpiTransfer(int fd, const uint8_t* read_tx, uint8_t const* write_tx,
-                                  uint8_t const* read_rx, uint32_t spi_speed);
+    enum class SpiDemuxSelection
+    {
+        NONE,
+        CONTROLLER,
+        DRIVER,
+    };
 
     /**
-     * A function which is written in the same style as the rest of the Trinamic API.
-     * This will trigger two SPI transactions back to back, reading a value and then
-     * writing a value for a specific motor
-     *
-     * @param motor The motor we want to read & write from
-     * @param read_addr the address of the register to read
-     * @param write_addr the address of the register to write
-     * @param write_data the data to write
-     * @return the value read from the trinamic controller
+     * Selects a chip on the SPI demux, only setting the select gpios if a different
+     * chip was selected before
+     *
+     * @param selection The chip to select
      */
-    int32_t tmc4671ReadThenWriteValue(uint8_t motor, uint8_t read_addr,
-                                      uint8_t write_addr, int32_t write_data);
+    void selectOnSpiDemux(SpiDemuxSelection selection);
 
     /**
      * Trinamic API Binding function
@@ -337,6 +329,7 @@ class MotorService
     // Select between driver and controller gpio
     Gpio spi_demux_select_0_;
     Gpio spi_demux_select_1_;
+    SpiDemuxSelection spi_demux_selection_;
 
     // Enable driver gpio
     Gpio driver_control_enable_gpio_;
@@ -346,10 +339,9 @@ class MotorService
     uint8_t tx_[5] = {0};
     uint8_t rx_[5] = {0};
 
-    // Transfer Buffers for readThenWriteSpiTransfer
-    uint8_t write_tx_[5] = {0};
-    uint8_t read_tx_[5]  = {0};
-    uint8_t read_rx_[5]  = {0};
+    // Reads the velocities and writes the target velocities of all motors, batched
+    // into one SPI message per motor each poll
+    TrinamicSpiBatch velocity_batch_;
 
     // Transfer State
     bool transfer_started_  = false;
@@ -359,6 +351,7 @@ class MotorService
 
     // SPI File Descriptors
     std::unordered_map<int, int> file_descriptors_;
+    std::unique_ptr<SpiCommunication> spi_;
 
     RobotConstants_t robot_constants_;
 
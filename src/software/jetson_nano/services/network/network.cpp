@@ -2,8 +2,12 @@
 
 NetworkService::NetworkService(const std::string& ip_address,
                                unsigned short primitive_listener_port,
-                               unsigned short robot_status_sender_port, bool multicast)
-    : primitive_tracker(ProtoTracker("primitive set"))
+                               unsigned short compact_primitive_listener_port,
+                               unsigned short robot_status_sender_port, bool multicast,
+                               RobotId robot_id)
+    : robot_id(robot_id),
+      primitive_set_loss_rate(0.0f),
+      primitive_tracker(ProtoTracker("primitive set"))
 {
     sender = std::make_unique<ThreadedProtoUdpSender<TbotsProto::RobotStatus>>(
         ip_address, robot_status_sender_port, multicast);
@@ -13,17 +17,22 @@ NetworkService::NetworkService(const std::string& ip_address,
             ip_address, primitive_listener_port,
             boost::bind(&NetworkService::primitiveSetCallback, this, _1), multicast);
 
+    udp_listener_compact_primitive_set =
+        std::make_unique<ThreadedProtoUdpListener<CompactPrimitiveSet>>(
+            ip_address, compact_primitive_listener_port,
+            boost::bind(&NetworkService::compactPrimitiveSetCallback, this, _1),
+            multicast);
+
     radio_listener_primitive_set =
         std::make_unique<ThreadedProtoRadioListener<TbotsProto::PrimitiveSet>>(
             boost::bind(&NetworkService::primitiveSetCallback, this, _1));
 }
 
-TbotsProto::PrimitiveSet NetworkService::poll(TbotsProto::RobotStatus& robot_status)
+const std::optional<TbotsProto::Primitive>* NetworkService::poll(
+    TbotsProto::RobotStatus& robot_status)
 {
-    std::scoped_lock lock{primitive_set_mutex};
-
     robot_status.mutable_network_status()->set_primitive_packet_loss_percentage(
-        static_cast<unsigned int>(primitive_tracker.getLossRate() * 100));
+        static_cast<unsigned int>(primitive_set_loss_rate.load() * 100));
 
     // Rate limit sending of proto based on thunderloop freq
     if (shouldSendNewRobotStatus(robot_status))
@@ -33,7 +42,12 @@ TbotsProto::PrimitiveSet NetworkService::poll(TbotsProto::RobotStatus& robot_sta
         network_ticks = (network_ticks + 1) % ROBOT_STATUS_BROADCAST_RATE_HZ;
     }
     thunderloop_ticks = (thunderloop_ticks + 1) % THUNDERLOOP_HZ;
-    return primitive_set_msg;
+    return primitive_buffer.takeLatest();
+}
+
+uint64_t NetworkService::getLastPolledPrimitiveSetSequenceNumber() const
+{
+    return primitive_buffer.getLastTakenSequenceNumber();
 }
 
 bool NetworkService::shouldSendNewRobotStatus(
@@ -58,19 +72,47 @@ bool NetworkService::shouldSendNewRobotStatus(
 
 void NetworkService::primitiveSetCallback(TbotsProto::PrimitiveSet input)
 {
-    std::scoped_lock<std::mutex> lock(primitive_set_mutex);
-    const uint64_t seq_num = input.sequence_number();
+    std::scoped_lock<std::mutex> lock(primitive_set_callback_mutex);
+
+    // Only this robot's primitive is handed to the loop, moving it out of the
+    // received set rather than copying it
+    std::optional<TbotsProto::Primitive> primitive;
+    auto primitive_iter = input.mutable_robot_primitives()->find(robot_id);
+    if (primitive_iter != input.mutable_robot_primitives()->end())
+    {
+        primitive = std::move(primitive_iter->second);
+    }
+
+    handlePrimitive(input.sequence_number(), std::move(primitive));
+}
+
+void NetworkService::compactPrimitiveSetCallback(CompactPrimitiveSet input)
+{
+    std::scoped_lock<std::mutex> lock(primitive_set_callback_mutex);
 
-    primitive_tracker.send(seq_num);
+    if (!input.isValid())
+    {
+        LOG(WARNING) << "Received an invalid compact primitive set";
+        return;
+    }
+
+    // Only this robot's record is decoded
+    handlePrimitive(input.getSequenceNumber(), input.getRobotPrimitive(robot_id));
+}
+
+void NetworkService::handlePrimitive(uint64_t sequence_number,
+                                     std::optional<TbotsProto::Primitive> primitive)
+{
+    primitive_tracker.send(sequence_number);
     if (primitive_tracker.isLastValid())
     {
-        primitive_set_msg = input;
+        primitive_buffer.publish(std::move(primitive), sequence_number);
     }
 
-    float primitive_set_loss_rate = primitive_tracker.getLossRate();
-    if (primitive_set_loss_rate > PROTO_LOSS_WARNING_THRESHOLD)
+    float loss_rate = primitive_tracker.getLossRate();
+    primitive_set_loss_rate.store(loss_rate);
+    if (loss_rate > PROTO_LOSS_WARNING_THRESHOLD)
     {
-        LOG(WARNING) << "Primitive set loss rate is " << primitive_set_loss_rate * 100
-                     << "%";
+        LOG(WARNING) << "Primitive set loss rate is " << loss_rate * 100 << "%";
     }
 }
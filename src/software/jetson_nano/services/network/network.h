@@ -1,16 +1,21 @@
 #pragma once
 
+#include <atomic>
 #include <mutex>
+#include <optional>
 #include <queue>
 
+#include "proto/message_translation/compact_primitive_set.h"
 #include "proto/robot_status_msg.pb.h"
 #include "proto/tbots_software_msgs.pb.h"
 #include "shared/constants.h"
 #include "shared/robot_constants.h"
 #include "software/jetson_nano/services/network/proto_tracker.h"
+#include "software/multithreading/triple_buffer.hpp"
 #include "software/networking/radio/threaded_proto_radio_listener.hpp"
 #include "software/networking/udp/threaded_proto_udp_listener.hpp"
 #include "software/networking/udp/threaded_proto_udp_sender.hpp"
+#include "software/world/robot_state.h"
 
 class NetworkService
 {
@@ -21,20 +26,40 @@ class NetworkService
      *
      * @param ip_address The IP Address the service should connect to
      * @param primitive_listener_port The port to listen for primitive protos
+     * @param compact_primitive_listener_port The port to listen for primitive sets in
+     * the compact wire format
      * @param robot_status_sender_port The port to send robot status
      * @param multicast  If true, then the provided IP address is a multicast address and
      * we should join the group
+     * @param robot_id The id of the robot to receive primitives for
      */
     NetworkService(const std::string& ip_address, unsigned short primitive_listener_port,
-                   unsigned short robot_status_sender_port, bool multicast);
+                   unsigned short compact_primitive_listener_port,
+                   unsigned short robot_status_sender_port, bool multicast,
+                   RobotId robot_id);
 
     /**
      * When the network service is polled, it sends the robot_status and returns
-     * a tuple of the most recent PrimitiveSet
+     * the primitive for this robot from the most recent PrimitiveSet, if a new one has
+     * been received since the last poll.
      *
-     * @returns a tuple of the stored primitive_set
+     * This never blocks on the network threads, and must only be called from one
+     * thread.
+     *
+     * @returns the primitive for this robot from the new PrimitiveSet, which is empty
+     * if the set has no primitive for this robot and stays valid until the next poll,
+     * or nullptr if no new PrimitiveSet has been received
+     */
+    const std::optional<TbotsProto::Primitive>* poll(
+        TbotsProto::RobotStatus& robot_status);
+
+    /**
+     * Gets the sequence number of the PrimitiveSet last returned by poll
+     *
+     * @returns the sequence number of the last polled PrimitiveSet, or 0 if no
+     * PrimitiveSet has been polled
      */
-    TbotsProto::PrimitiveSet poll(TbotsProto::RobotStatus& robot_status);
+    uint64_t getLastPolledPrimitiveSetSequenceNumber() const;
 
    private:
     /**
@@ -58,21 +83,46 @@ class NetworkService
         ROBOT_STATUS_BROADCAST_RATE_HZ / (THUNDERLOOP_HZ + 1.0);
 
     // Variables
-    TbotsProto::PrimitiveSet primitive_set_msg;
+    RobotId robot_id;
 
-    std::mutex primitive_set_mutex;
+    // This robot's primitive from each received PrimitiveSet, tagged with the
+    // sequence number of the set. Only this robot's primitive is kept so that the
+    // loop never copies the primitives of the other robots. Sets without a primitive
+    // for this robot are still passed on, so that the loop sees every new set
+    TripleBuffer<std::optional<TbotsProto::Primitive>> primitive_buffer;
+
+    // PrimitiveSets can be received from both the UDP and radio listener threads, so
+    // the callback is serialized so that there is only one producer for the
+    // primitive buffer
+    std::mutex primitive_set_callback_mutex;
+    std::atomic<float> primitive_set_loss_rate;
 
     std::unique_ptr<ThreadedProtoUdpSender<TbotsProto::RobotStatus>> sender;
     std::unique_ptr<ThreadedProtoUdpListener<TbotsProto::PrimitiveSet>>
         udp_listener_primitive_set;
+    std::unique_ptr<ThreadedProtoUdpListener<CompactPrimitiveSet>>
+        udp_listener_compact_primitive_set;
     std::unique_ptr<ThreadedProtoRadioListener<TbotsProto::PrimitiveSet>>
         radio_listener_primitive_set;
 
     unsigned int network_ticks     = 0;
     unsigned int thunderloop_ticks = 0;
 
-    // Callback function for storing the received primitive_sets
+    // Callback functions for storing the received primitive_sets
     void primitiveSetCallback(TbotsProto::PrimitiveSet input);
+    void compactPrimitiveSetCallback(CompactPrimitiveSet input);
+
+    /**
+     * Tracks the sequence number of a received PrimitiveSet, and hands this robot's
+     * primitive from it to the loop if the set is newer than any set received before.
+     * Must be called with the primitive set callback mutex held
+     *
+     * @param sequence_number The sequence number of the received PrimitiveSet
+     * @param primitive This robot's primitive from the set, or std::nullopt if the
+     * set has no primitive for this robot
+     */
+    void handlePrimitive(uint64_t sequence_number,
+                         std::optional<TbotsProto::Primitive> primitive);
 
     // ProtoTrackers for tracking recent primitive_set packet loss
     ProtoTracker primitive_tracker;
@@ -1,50 +1,44 @@
 #include "software/jetson_nano/services/power.h"
 
-#include <boost/bind/bind.hpp>
 #include <boost/filesystem.hpp>
 #include <cstdint>
 
 #include "proto/power_frame_msg.nanopb.h"
 
-PowerService::PowerService()
+namespace
 {
-    if (!boost::filesystem::exists(DEVICE_SERIAL_PORT))
+    /**
+     * Checks that the serial port of the power board exists
+     *
+     * @param device_serial_port the serial port to check
+     * @return the serial port
+     * @throws std::runtime_error if the serial port doesn't exist
+     */
+    const std::string& checkSerialPortExists(const std::string& device_serial_port)
     {
-        throw std::runtime_error("USB not plugged into the Jetson Nano");
+        if (!boost::filesystem::exists(device_serial_port))
+        {
+            throw std::runtime_error("USB not plugged into the Jetson Nano");
+        }
+        return device_serial_port;
     }
-    this->uart = std::make_unique<BoostUartCommunication>(BAUD_RATE, DEVICE_SERIAL_PORT);
-    this->read_thread = std::thread(boost::bind(&PowerService::continuousRead, this));
-}
+}  // namespace
 
-PowerService::~PowerService()
-{
-    is_running = false;
-    read_thread.join();
-}
+PowerService::PowerService() : PowerService(DEVICE_SERIAL_PORT) {}
 
-void PowerService::continuousRead()
+PowerService::PowerService(const std::string& device_serial_port)
+    : status(TbotsProto_PowerStatus TbotsProto_PowerStatus_init_default),
+      nanopb_command(
+          TbotsProto_PowerPulseControl TbotsProto_PowerPulseControl_init_default),
+      uart(BAUD_RATE, checkSerialPortExists(device_serial_port),
+           [this](uint8_t* frame, std::size_t length) { handleFrame(frame, length); })
 {
-    while (is_running)
-    {
-        tick();
-    }
 }
 
-void PowerService::tick()
+void PowerService::handleFrame(uint8_t* frame, std::size_t length)
 {
-    std::vector<uint8_t> power_status;
-    try
-    {
-        uart->flushSerialPort(uart->flush_receive);
-        power_status = uart->serialRead(READ_BUFFER_SIZE);
-    }
-    catch (std::exception& e)
-    {
-        LOG(FATAL) << "Read thread has crashed" << e.what();
-    }
-
     TbotsProto_PowerFrame status_frame = TbotsProto_PowerFrame_init_default;
-    if (!unmarshalUartPacket(power_status, status_frame))
+    if (!unmarshalUartPacket(frame, length, status_frame))
     {
         LOG(WARNING) << "Unmarshal failed";
     }
@@ -53,23 +47,14 @@ void PowerService::tick()
         status = status_frame.power_msg.power_status;
     }
 
-    auto command =
-        nanopb_command.load(std::memory_order_relaxed);  // get value atomically
-    auto frame                = createUartFrame(command);
-    auto power_command_buffer = marshallUartPacket(frame);
-
-    try
-    {
-        // Write power command
-        uart->flushSerialPort(uart->flush_send);
-        if (!uart->serialWrite(power_command_buffer))
-        {
-            LOG(WARNING) << "Writing power command failed.";
-        }
-    }
-    catch (std::exception& e)
+    // Reply to every power status with the latest power command, like the power board
+    // expects. If the last command hasn't been sent yet, the next status gets the reply
+    uint8_t* write_buffer = uart.getWriteBuffer();
+    if (write_buffer != nullptr)
     {
-        LOG(FATAL) << "ESP32 has disconnected. Power service has crashed" << e.what();
+        auto command =
+            nanopb_command.load(std::memory_order_relaxed);  // get value atomically
+        uart.startWrite(marshallUartPacket(createUartFrame(command), write_buffer));
     }
 }
 
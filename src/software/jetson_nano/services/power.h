@@ -1,12 +1,12 @@
 #pragma once
 
 #include <atomic>
-#include <thread>
+#include <string>
 
 #include "proto/power_frame_msg.pb.h"
 #include "shared/uart_framing/uart_framing.hpp"
 #include "software/logger/logger.h"
-#include "software/uart/boost_uart_communication.h"
+#include "software/uart/async_uart_communication.h"
 
 extern "C"
 {
@@ -21,11 +21,17 @@ class PowerService
      * Opens all the required ports and maintains them until destroyed.
      */
     PowerService();
-    ~PowerService();
 
     /**
-     * When the power service is polled it sends the given power control msg and
-     * returns the latest power status
+     * Service that interacts with the power board over the given serial port
+     *
+     * @param device_serial_port the serial port the power board is connected to
+     */
+    explicit PowerService(const std::string& device_serial_port);
+
+    /**
+     * When the power service is polled it stores the given power control msg to be sent
+     * and returns the latest power status. This never waits on the serial port
      *
      * @param control The power control msg to send
      * @return the latest power status
@@ -33,28 +39,23 @@ class PowerService
     TbotsProto::PowerStatus poll(const TbotsProto::PowerControl& control,
                                  double kick_coeff, int kick_constant, int chip_constant);
 
-    /**
-     * Handler method called every time the timer expires a new read is requested
-     */
-    void tick();
-
    private:
     /**
-     * Initiates timer for serial reading
+     * Handler method called on the uart thread with every frame received from the power
+     * board. It stores the power status and replies with the latest power command
+     *
+     * @param frame the frame received, which is decoded in place
+     * @param length the number of bytes in the frame
      */
-    void continuousRead();
+    void handleFrame(uint8_t* frame, std::size_t length);
 
-    std::thread read_thread;
     std::atomic<TbotsProto_PowerStatus> status;
     std::atomic<TbotsProto_PowerPulseControl> nanopb_command;
-    std::unique_ptr<BoostUartCommunication> uart;
 
     // Constants
-    const size_t READ_BUFFER_SIZE =
-        getMarshalledSize(TbotsProto_PowerStatus TbotsProto_PowerStatus_init_default);
-    const std::string DEVICE_SERIAL_PORT    = "/dev/ttyUSB0";
-    static constexpr unsigned int BAUD_RATE = 460800;
+    static constexpr const char* DEVICE_SERIAL_PORT = "/dev/ttyUSB0";
+    static constexpr unsigned int BAUD_RATE         = 460800;
 
-    // Required flag to exit power service cleanly
-    bool is_running = true;
+    // Constructed last, so that reads and writes stop before anything else is destroyed
+    AsyncUartCommunication uart;
 };
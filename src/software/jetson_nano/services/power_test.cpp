@@ -0,0 +1,137 @@
+#include "software/jetson_nano/services/power.h"
+
+#include <gtest/gtest.h>
+#include <poll.h>
+#include <pty.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr std::chrono::seconds TIMEOUT = std::chrono::seconds(2);
+}  // namespace
+
+/**
+ * Stands in for the power board with a pseudo-terminal pair. The power service opens
+ * the slave side like it would the USB serial port, and the test reads and writes the
+ * master side like the ESP32 would
+ */
+class PowerServiceTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        char slave_name[256];
+        ASSERT_EQ(0, openpty(&master_fd, &slave_fd, slave_name, nullptr, nullptr));
+
+        struct termios attributes;
+        ASSERT_EQ(0, tcgetattr(slave_fd, &attributes));
+        cfmakeraw(&attributes);
+        ASSERT_EQ(0, tcsetattr(slave_fd, TCSANOW, &attributes));
+
+        power_service = std::make_unique<PowerService>(slave_name);
+    }
+
+    void TearDown() override
+    {
+        // Stop the power service before the power board goes away
+        power_service.reset();
+        close(slave_fd);
+        close(master_fd);
+    }
+
+    /**
+     * Sends a power status from the power board, split in two writes like a serial port
+     * might deliver it
+     *
+     * @param power_status the power status to send
+     */
+    void sendPowerStatus(const TbotsProto_PowerStatus& power_status)
+    {
+        auto packet      = marshallUartPacket(createUartFrame(power_status));
+        std::size_t half = packet.size() / 2;
+        ASSERT_EQ(static_cast<ssize_t>(half), write(master_fd, packet.data(), half));
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        ASSERT_EQ(static_cast<ssize_t>(packet.size() - half),
+                  write(master_fd, packet.data() + half, packet.size() - half));
+    }
+
+    /**
+     * Receives a power command on the power board, like the ESP32 does by reading
+     * the marshalled size of a command
+     *
+     * @param frame set to the frame of the power command
+     * @return true if a valid frame was received before the timeout, false otherwise
+     */
+    bool receivePowerCommand(TbotsProto_PowerFrame& frame)
+    {
+        const std::size_t packet_size = getMarshalledSize(
+            TbotsProto_PowerPulseControl TbotsProto_PowerPulseControl_init_default);
+        std::vector<uint8_t> packet(packet_size);
+        std::size_t num_received = 0;
+        auto end_time            = std::chrono::steady_clock::now() + TIMEOUT;
+
+        while (num_received < packet_size && std::chrono::steady_clock::now() < end_time)
+        {
+            struct pollfd poll_fd = {master_fd, POLLIN, 0};
+            if (poll(&poll_fd, 1, 10) > 0)
+            {
+                ssize_t num_read = read(master_fd, packet.data() + num_received,
+                                        packet_size - num_received);
+                if (num_read > 0)
+                {
+                    num_received += static_cast<std::size_t>(num_read);
+                }
+            }
+        }
+        return num_received == packet_size && unmarshalUartPacket(packet, frame);
+    }
+
+    int master_fd;
+    int slave_fd;
+    std::unique_ptr<PowerService> power_service;
+};
+
+TEST_F(PowerServiceTest, replies_to_power_status_with_latest_command)
+{
+    TbotsProto::PowerControl control;
+    control.mutable_chicker()->set_chip_distance_meters(1.0);
+    control.set_geneva_slot(TbotsProto::Geneva::RIGHT);
+    power_service->poll(control, 0.3, 300, 500);
+
+    sendPowerStatus(createNanoPbPowerStatus(24.0f, 200.0f, 1.0f,
+                                            TbotsProto_Geneva_Slot_CENTRE, 1, false));
+
+    TbotsProto_PowerFrame frame = TbotsProto_PowerFrame_init_default;
+    ASSERT_TRUE(receivePowerCommand(frame));
+    EXPECT_EQ(TbotsProto_PowerFrame_power_control_tag, frame.which_power_msg);
+    EXPECT_EQ(serializeToVector(createNanoPbPowerPulseControl(control, 0.3, 300, 500)),
+              serializeToVector(frame.power_msg.power_control));
+}
+
+TEST_F(PowerServiceTest, poll_returns_latest_power_status)
+{
+    TbotsProto::PowerControl control;
+    TbotsProto_PowerFrame frame = TbotsProto_PowerFrame_init_default;
+
+    // Start partway through a frame, like when the port is opened while the power
+    // board is sending
+    uint8_t partial_frame[] = {0x05, 0x06, START_END_FLAG_BYTE};
+    ASSERT_EQ(3, write(master_fd, partial_frame, sizeof(partial_frame)));
+
+    for (uint32_t sequence_num = 1; sequence_num <= 3; sequence_num++)
+    {
+        sendPowerStatus(createNanoPbPowerStatus(
+            24.0f, 200.0f, 1.0f, TbotsProto_Geneva_Slot_CENTRE, sequence_num, false));
+        ASSERT_TRUE(receivePowerCommand(frame));
+    }
+
+    // The status is stored before the reply is sent
+    TbotsProto::PowerStatus status = power_service->poll(control, 0.3, 300, 500);
+    EXPECT_EQ(3, status.sequence_num());
+    EXPECT_FLOAT_EQ(24.0f, status.battery_voltage());
+}
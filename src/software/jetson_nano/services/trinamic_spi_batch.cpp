@@ -0,0 +1,94 @@
+#include "software/jetson_nano/services/trinamic_spi_batch.h"
+
+#include <cstring>
+
+#include "software/logger/logger.h"
+
+TrinamicSpiBatch::TrinamicSpiBatch(uint32_t spi_speed_hz)
+    : spi_speed_hz(spi_speed_hz), num_transactions(0), transactions(), spi_transfers()
+{
+    // The transfers always point at the same buffers, so only the buffers have to be
+    // filled in each cycle
+    for (std::size_t i = 0; i < MAX_TRANSACTIONS; i++)
+    {
+        Transaction& transaction                = transactions[i];
+        struct spi_ioc_transfer& read_transfer  = spi_transfers[2 * i];
+        struct spi_ioc_transfer& write_transfer = spi_transfers[2 * i + 1];
+
+        read_transfer.tx_buf         = reinterpret_cast<uintptr_t>(transaction.read_tx);
+        read_transfer.rx_buf         = reinterpret_cast<uintptr_t>(transaction.read_rx);
+        read_transfer.len            = DATAGRAM_SIZE;
+        read_transfer.speed_hz       = spi_speed_hz;
+        read_transfer.bits_per_word  = 8;
+        write_transfer.tx_buf        = reinterpret_cast<uintptr_t>(transaction.write_tx);
+        write_transfer.rx_buf        = reinterpret_cast<uintptr_t>(transaction.write_rx);
+        write_transfer.len           = DATAGRAM_SIZE;
+        write_transfer.speed_hz      = spi_speed_hz;
+        write_transfer.bits_per_word = 8;
+
+        // Deselect the controller between the datagrams so that it handles them as
+        // two datagrams, and leave it deselected after the write
+        read_transfer.cs_change  = 1;
+        write_transfer.cs_change = 0;
+    }
+}
+
+void TrinamicSpiBatch::clear()
+{
+    num_transactions = 0;
+}
+
+std::size_t TrinamicSpiBatch::addReadThenWrite(int fd, uint8_t read_addr,
+                                               uint8_t write_addr, int32_t write_data)
+{
+    CHECK(num_transactions < MAX_TRANSACTIONS)
+        << "Too many transactions in one Trinamic SPI batch";
+
+    Transaction& transaction = transactions[num_transactions];
+    transaction.fd           = fd;
+    memset(transaction.read_tx, 0, DATAGRAM_SIZE);
+    memset(transaction.read_rx, 0, DATAGRAM_SIZE);
+    memset(transaction.write_tx, 0, DATAGRAM_SIZE);
+
+    // For a write, MSB must be 1, for read, MSB must be 0
+    // https://github.com/trinamic/TMC-API/blob/master/tmc/ic/TMC4671/TMC4671.c
+    transaction.read_tx[0]  = read_addr & 0x7f;
+    transaction.write_tx[0] = write_addr | 0x80;
+
+    // Convert from little endian to big endian
+    for (int i = 3; i >= 0; i--)
+    {
+        transaction.write_tx[4 - i] = static_cast<uint8_t>(0xff & (write_data >> 8 * i));
+    }
+
+    return num_transactions++;
+}
+
+bool TrinamicSpiBatch::transfer(SpiCommunication& spi)
+{
+    for (std::size_t i = 0; i < num_transactions; i++)
+    {
+        if (!spi.transfer(transactions[i].fd, &spi_transfers[2 * i], 2))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+int32_t TrinamicSpiBatch::getReadValue(std::size_t index) const
+{
+    // The value is in the last 4 bytes of the read datagram, in BIG Endian
+    const uint8_t* read_rx = transactions[index].read_rx;
+    uint32_t value         = 0;
+    for (std::size_t i = 1; i < DATAGRAM_SIZE; i++)
+    {
+        value = (value << 8) | read_rx[i];
+    }
+    return static_cast<int32_t>(value);
+}
+
+std::size_t TrinamicSpiBatch::size() const
+{
+    return num_transactions;
+}
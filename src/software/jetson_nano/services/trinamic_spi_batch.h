@@ -0,0 +1,104 @@
+#pragma once
+
+#include <linux/spi/spidev.h>
+
+#include <array>
+#include <cstdint>
+
+#include "software/spi/spi_communication.h"
+
+/**
+ * A batch of read then write transactions with TMC4671 controllers, which is built
+ * once per control cycle and sent with a single SPI message per controller.
+ *
+ * Each transaction is a read datagram followed by a write datagram. Both datagrams are
+ * described in one spi_ioc_transfer array that is reused every cycle, and the chip
+ * select is toggled between them with cs_change, so each controller only needs one
+ * syscall instead of one per datagram.
+ *
+ * The controllers must already be selected on the SPI demux.
+ */
+class TrinamicSpiBatch
+{
+   public:
+    static constexpr std::size_t MAX_TRANSACTIONS = 5;
+    static constexpr std::size_t DATAGRAM_SIZE    = 5;
+
+    /**
+     * Creates an empty TrinamicSpiBatch
+     *
+     * @param spi_speed_hz The speed to run spi at
+     */
+    explicit TrinamicSpiBatch(uint32_t spi_speed_hz);
+
+    TrinamicSpiBatch(const TrinamicSpiBatch&) = delete;
+
+    TrinamicSpiBatch& operator=(const TrinamicSpiBatch&) = delete;
+
+    /**
+     * Removes all transactions from the batch, so that the next cycle can be built
+     */
+    void clear();
+
+    /**
+     * Adds a transaction that reads a register and then writes a register of a
+     * controller
+     *
+     * @param fd The SPI file descriptor of the controller
+     * @param read_addr the address of the register to read
+     * @param write_addr the address of the register to write
+     * @param write_data the data to write
+     *
+     * @return the index of the transaction in the batch
+     */
+    std::size_t addReadThenWrite(int fd, uint8_t read_addr, uint8_t write_addr,
+                                 int32_t write_data);
+
+    /**
+     * Sends the transactions in the batch, with one SPI message per transaction
+     *
+     * @param spi The SPI communication to send the messages over
+     *
+     * @return true if all of the messages were sent, false otherwise
+     */
+    bool transfer(SpiCommunication& spi);
+
+    /**
+     * Gets the value read by a transaction in the last transfer
+     *
+     * @param index The index of the transaction in the batch
+     *
+     * @return the value read from the controller
+     */
+    int32_t getReadValue(std::size_t index) const;
+
+    /**
+     * Gets the number of transactions in the batch
+     *
+     * @return the number of transactions
+     */
+    std::size_t size() const;
+
+   private:
+    // The buffers of the datagrams of a transaction. Trinamic datagrams look like this:
+    //  + - - - + - - - + - - - + - - - + - - - +
+    //  |  ADDR |             DATA              |
+    //  + - - - + - - - + - - - + - - - + - - - +
+    //      0        1      2       3       4
+    // and are in BIG Endian, with the MSB of the address set for writes
+    struct Transaction
+    {
+        int fd;
+        uint8_t read_tx[DATAGRAM_SIZE];
+        uint8_t read_rx[DATAGRAM_SIZE];
+        uint8_t write_tx[DATAGRAM_SIZE];
+        uint8_t write_rx[DATAGRAM_SIZE];
+    };
+
+    uint32_t spi_speed_hz;
+    std::size_t num_transactions;
+    std::array<Transaction, MAX_TRANSACTIONS> transactions;
+
+    // The read and write transfers of each transaction, next to each other
+    std::array<struct spi_ioc_transfer, 2 * MAX_TRANSACTIONS> spi_transfers;
+};
@@ -0,0 +1,213 @@
+#include "software/jetson_nano/services/trinamic_spi_batch.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <map>
+
+#include "software/spi/mock_spi_communication.h"
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::Return;
+
+namespace
+{
+    constexpr uint32_t SPI_SPEED_HZ             = 1000000;
+    constexpr uint8_t VELOCITY_ACTUAL_ADDRESS   = 0x6A;
+    constexpr uint8_t VELOCITY_TARGET_ADDRESS   = 0x66;
+    constexpr unsigned NUM_MOTORS               = 5;
+    constexpr std::chrono::microseconds SYSCALL = std::chrono::microseconds(20);
+
+    /**
+     * Emulates the registers of the TMC4671 controllers on each SPI device, so that
+     * batches can be checked without hardware
+     */
+    class FakeTrinamicControllers
+    {
+       public:
+        /**
+         * Performs the transfers of an SPI message like the spidev driver and the
+         * controller would, and counts the message as one syscall
+         *
+         * @param fd the file descriptor of the SPI device
+         * @param transfers the transfers of the message
+         * @param num_transfers the number of transfers
+         *
+         * @return true
+         */
+        bool transfer(int fd, struct spi_ioc_transfer* transfers, unsigned num_transfers)
+        {
+            num_syscalls++;
+            for (unsigned i = 0; i < num_transfers; i++)
+            {
+                EXPECT_EQ(TrinamicSpiBatch::DATAGRAM_SIZE, transfers[i].len);
+                EXPECT_EQ(SPI_SPEED_HZ, transfers[i].speed_hz);
+                // The chip select is toggled between datagrams, but not after the last
+                EXPECT_EQ(i + 1 < num_transfers, transfers[i].cs_change == 1);
+
+                const auto* tx = reinterpret_cast<const uint8_t*>(transfers[i].tx_buf);
+                auto* rx       = reinterpret_cast<uint8_t*>(transfers[i].rx_buf);
+                uint8_t address = tx[0] & 0x7f;
+
+                if (tx[0] & 0x80)
+                {
+                    registers[fd][address] = static_cast<int32_t>(
+                        (uint32_t{tx[1]} << 24) | (uint32_t{tx[2]} << 16) |
+                        (uint32_t{tx[3]} << 8) | uint32_t{tx[4]});
+                }
+                else
+                {
+                    auto value = static_cast<uint32_t>(registers[fd][address]);
+                    rx[1]      = static_cast<uint8_t>(value >> 24);
+                    rx[2]      = static_cast<uint8_t>(value >> 16);
+                    rx[3]      = static_cast<uint8_t>(value >> 8);
+                    rx[4]      = static_cast<uint8_t>(value);
+                }
+            }
+            return true;
+        }
+
+        std::map<int, std::map<uint8_t, int32_t>> registers;
+        unsigned num_syscalls = 0;
+    };
+
+    /**
+     * Spins on the CPU for the given time, to stand in for the cost of a syscall
+     *
+     * @param duration The time to spin for
+     */
+    void busyWait(std::chrono::nanoseconds duration)
+    {
+        auto end_time = std::chrono::steady_clock::now() + duration;
+        while (std::chrono::steady_clock::now() < end_time)
+        {
+        }
+    }
+}  // namespace
+
+class TrinamicSpiBatchTest : public testing::Test
+{
+   protected:
+    TrinamicSpiBatchTest() : batch(SPI_SPEED_HZ)
+    {
+        ON_CALL(mock_spi, transfer(_, _, _))
+            .WillByDefault(Invoke(&controllers, &FakeTrinamicControllers::transfer));
+    }
+
+    MockSpi mock_spi;
+    FakeTrinamicControllers controllers;
+    TrinamicSpiBatch batch;
+};
+
+TEST_F(TrinamicSpiBatchTest, one_message_per_motor_per_cycle)
+{
+    EXPECT_CALL(mock_spi, transfer(_, _, 2)).Times(NUM_MOTORS);
+
+    for (int fd = 0; fd < static_cast<int>(NUM_MOTORS); fd++)
+    {
+        batch.addReadThenWrite(fd, VELOCITY_ACTUAL_ADDRESS, VELOCITY_TARGET_ADDRESS,
+                               1000 * fd);
+    }
+    EXPECT_EQ(NUM_MOTORS, batch.size());
+    EXPECT_TRUE(batch.transfer(mock_spi));
+    EXPECT_EQ(NUM_MOTORS, controllers.num_syscalls);
+}
+
+TEST_F(TrinamicSpiBatchTest, reads_then_writes_each_motor)
+{
+    EXPECT_CALL(mock_spi, transfer(_, _, _)).Times(2 * NUM_MOTORS);
+
+    for (int fd = 0; fd < static_cast<int>(NUM_MOTORS); fd++)
+    {
+        controllers.registers[fd][VELOCITY_ACTUAL_ADDRESS] = -1234 * fd;
+    }
+
+    for (int cycle = 0; cycle < 2; cycle++)
+    {
+        batch.clear();
+        for (int fd = 0; fd < static_cast<int>(NUM_MOTORS); fd++)
+        {
+            EXPECT_EQ(static_cast<std::size_t>(fd),
+                      batch.addReadThenWrite(fd, VELOCITY_ACTUAL_ADDRESS,
+                                             VELOCITY_TARGET_ADDRESS,
+                                             -100000 * fd + cycle));
+        }
+        EXPECT_TRUE(batch.transfer(mock_spi));
+
+        for (int fd = 0; fd < static_cast<int>(NUM_MOTORS); fd++)
+        {
+            EXPECT_EQ(-1234 * fd, batch.getReadValue(static_cast<std::size_t>(fd)));
+            EXPECT_EQ(-100000 * fd + cycle,
+                      controllers.registers[fd][VELOCITY_TARGET_ADDRESS]);
+        }
+    }
+}
+
+TEST_F(TrinamicSpiBatchTest, failed_transfer_stops_batch)
+{
+    EXPECT_CALL(mock_spi, transfer(0, _, 2)).WillOnce(Return(true));
+    EXPECT_CALL(mock_spi, transfer(1, _, 2)).WillOnce(Return(false));
+    EXPECT_CALL(mock_spi, transfer(2, _, _)).Times(0);
+
+    for (int fd = 0; fd < 3; fd++)
+    {
+        batch.addReadThenWrite(fd, VELOCITY_ACTUAL_ADDRESS, VELOCITY_TARGET_ADDRESS, 0);
+    }
+    EXPECT_FALSE(batch.transfer(mock_spi));
+}
+
+TEST_F(TrinamicSpiBatchTest, DISABLED_batched_cycle_speed_test)
+{
+    constexpr unsigned NUM_CYCLES = 1000;
+
+    // Every message costs about as long as a syscall
+    ON_CALL(mock_spi, transfer(_, _, _))
+        .WillByDefault(Invoke([this](int fd, struct spi_ioc_transfer* transfers,
+                                     unsigned num_transfers) {
+            busyWait(SYSCALL);
+            return controllers.transfer(fd, transfers, num_transfers);
+        }));
+    EXPECT_CALL(mock_spi, transfer(_, _, _)).Times(3 * NUM_MOTORS * NUM_CYCLES);
+
+    // Sends the read and the write of each motor in separate messages, like when each
+    // motor was polled on its own. The empty message stands in for the second ioctl
+    auto start_time = std::chrono::steady_clock::now();
+    for (unsigned cycle = 0; cycle < NUM_CYCLES; cycle++)
+    {
+        for (int fd = 0; fd < static_cast<int>(NUM_MOTORS); fd++)
+        {
+            batch.clear();
+            batch.addReadThenWrite(fd, VELOCITY_ACTUAL_ADDRESS, VELOCITY_TARGET_ADDRESS,
+                                   static_cast<int32_t>(cycle));
+            batch.transfer(mock_spi);
+            mock_spi.transfer(fd, nullptr, 0);
+        }
+    }
+    double unbatched_cycle_us = std::chrono::duration<double, std::micro>(
+                                    std::chrono::steady_clock::now() - start_time)
+                                    .count() /
+                                NUM_CYCLES;
+
+    start_time = std::chrono::steady_clock::now();
+    for (unsigned cycle = 0; cycle < NUM_CYCLES; cycle++)
+    {
+        batch.clear();
+        for (int fd = 0; fd < static_cast<int>(NUM_MOTORS); fd++)
+        {
+            batch.addReadThenWrite(fd, VELOCITY_ACTUAL_ADDRESS, VELOCITY_TARGET_ADDRESS,
+                                   static_cast<int32_t>(cycle));
+        }
+        batch.transfer(mock_spi);
+    }
+    double batched_cycle_us = std::chrono::duration<double, std::micro>(
+                                  std::chrono::steady_clock::now() - start_time)
+                                  .count() /
+                              NUM_CYCLES;
+
+    std::cout << "With " << SYSCALL.count() << "us per syscall, a cycle took "
+              << unbatched_cycle_us << "us with 2 messages per motor and "
+              << batched_cycle_us << "us when batched" << std::endl;
+}
@@ -8,6 +8,7 @@
 #include "proto/tbots_software_msgs.pb.h"
 #include "shared/2021_robot_constants.h"
 #include "shared/constants.h"
+#include "software/jetson_nano/loop_timer.h"
 #include "software/jetson_nano/primitive_executor.h"
 #include "software/jetson_nano/services/motor.h"
 #include "software/logger/logger.h"
@@ -17,13 +18,6 @@
 #include "software/world/robot_state.h"
 #include "software/world/team.h"
 
-/**
- * https://web.archive.org/web/20210308013218/https://rt.wiki.kernel.org/index.php/Squarewave-example
- * using clock_nanosleep of librt
- */
-extern int clock_nanosleep(clockid_t __clock_id, int __flags,
-                           __const struct timespec* __req, struct timespec* __rem);
-
 // signal handling is done by csignal which requires a function pointer with C linkage
 extern "C"
 {
@@ -108,7 +102,7 @@ Thunderloop::Thunderloop(const RobotConstants_t& robot_constants, bool enable_lo
 
     network_service_ = std::make_unique<NetworkService>(
         std::string(ROBOT_MULTICAST_CHANNELS.at(channel_id_)) + "%" + network_interface_,
-        PRIMITIVE_PORT, ROBOT_STATUS_PORT, true);
+        PRIMITIVE_PORT, COMPACT_PRIMITIVE_PORT, ROBOT_STATUS_PORT, true, robot_id_);
     LOG(INFO)
         << "THUNDERLOOP: Network Service initialized! Next initializing Power Service";
 
@@ -136,7 +130,6 @@ Thunderloop::~Thunderloop() {}
 [[noreturn]] void Thunderloop::runLoop()
 {
     // Timing
-    struct timespec next_shot;
     struct timespec poll_time;
     struct timespec iteration_time;
     struct timespec last_primitive_received_time;
@@ -146,18 +139,16 @@ Thunderloop::~Thunderloop() {}
     struct timespec last_kicker_fired;
 
     // Input buffer
-    TbotsProto::PrimitiveSet new_primitive_set;
+    const std::optional<TbotsProto::Primitive>* new_primitive = nullptr;
     TbotsProto::World new_world;
-    const TbotsProto::PrimitiveSet empty_primitive_set;
 
-    // Loop interval
-    int interval =
-        static_cast<int>(1.0f / static_cast<float>(loop_hz_) * NANOSECONDS_PER_SECOND);
+    // Runs the loop on absolute deadlines one loop interval apart
+    LoopTimer loop_timer(
+        static_cast<int64_t>(NANOSECONDS_PER_SECOND / static_cast<double>(loop_hz_)));
 
     // Get current time
     // Note: CLOCK_MONOTONIC is used over CLOCK_REALTIME since
     // CLOCK_REALTIME can jump backwards
-    clock_gettime(CLOCK_MONOTONIC, &next_shot);
     clock_gettime(CLOCK_MONOTONIC, &last_primitive_received_time);
     clock_gettime(CLOCK_MONOTONIC, &last_world_received_time);
     clock_gettime(CLOCK_MONOTONIC, &last_chipper_fired);
@@ -169,18 +160,22 @@ Thunderloop::~Thunderloop() {}
     {
         {
             // Wait until next shot
-            //
-            // Note: CLOCK_MONOTONIC is used over CLOCK_REALTIME since
-            // CLOCK_REALTIME can jump backwards
-            clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next_shot, NULL);
+            loop_timer.waitForNextIteration();
 
             FrameMarkStart(TracyConstants::THUNDERLOOP_FRAME_MARKER);
 
             ScopedTimespecTimer iteration_timer(&iteration_time);
 
+            updateLoopTimingStatus(loop_timer);
+
             // Collect jetson status
             jetson_status_.set_cpu_temperature(getCpuTemperature());
 
+            // The last PrimitiveSet handled before this iteration, like the robot
+            // status that is sent by this poll
+            uint64_t last_handled_primitive_set =
+                network_service_->getLastPolledPrimitiveSetSequenceNumber();
+
             // Network Service: receive newest world, primitives and set out the last
             // robot status
             {
@@ -188,14 +183,12 @@ Thunderloop::~Thunderloop() {}
 
                 ZoneNamedN(_tracy_network_poll, "Thunderloop: Poll NetworkService", true);
 
-                new_primitive_set = network_service_->poll(robot_status_);
+                new_primitive = network_service_->poll(robot_status_);
             }
 
             thunderloop_status_.set_network_service_poll_time_ms(
                 getMilliseconds(poll_time));
 
-            uint64_t last_handled_primitive_set = primitive_set_.sequence_number();
-
             // Updating primitives and world with newly received data
             // and setting the correct time elasped since last primitive / world
 
@@ -207,22 +200,20 @@ Thunderloop::~Thunderloop() {}
             network_status_.set_ms_since_last_primitive_received(
                 getMilliseconds(time_since_last_primitive_received));
 
-            // If the primitive msg is new, update the internal buffer
-            // and start the new primitive.
-            if (new_primitive_set.time_sent().epoch_timestamp_seconds() >
-                primitive_set_.time_sent().epoch_timestamp_seconds())
+            // If the primitive msg is new, start the new primitive
+            if (new_primitive != nullptr)
             {
-                // Save new primitive set
-                primitive_set_ = new_primitive_set;
-
-                // Update primitive executor's primitive set
+                // Update primitive executor's primitive
                 {
                     clock_gettime(CLOCK_MONOTONIC, &last_primitive_received_time);
 
-                    // Start new primitive
+                    // Start new primitive, if the set has one for this robot
                     {
                         ScopedTimespecTimer timer(&poll_time);
-                        primitive_executor_.updatePrimitiveSet(primitive_set_);
+                        if (new_primitive->has_value())
+                        {
+                            primitive_executor_.updatePrimitive(new_primitive->value());
+                        }
                     }
 
                     thunderloop_status_.set_primitive_executor_start_time_ms(
@@ -257,8 +248,8 @@ Thunderloop::~Thunderloop() {}
                     primitive_executor_.setStopPrimitive();
                 }
 
-                direct_control_ =
-                    *primitive_executor_.stepPrimitive(primitive_executor_status_);
+                primitive_executor_.stepPrimitive(primitive_executor_status_,
+                                                  direct_control_);
             }
 
             thunderloop_status_.set_primitive_executor_step_time_ms(
@@ -365,9 +356,8 @@ Thunderloop::~Thunderloop() {}
         loop_duration_seconds =
             static_cast<double>(loop_duration_ns) * SECONDS_PER_NANOSECOND;
 
-        // Calculate next shot taking into account how long this iteration took
-        next_shot.tv_nsec += interval - static_cast<long int>(loop_duration_ns);
-        timespecNorm(next_shot);
+        // Schedule the next shot, skipping any that this iteration ran past
+        loop_timer.finishIteration();
 
         FrameMarkEnd(TracyConstants::THUNDERLOOP_FRAME_MARKER);
     }
@@ -385,13 +375,26 @@ double Thunderloop::getNanoseconds(timespec time)
            static_cast<double>(time.tv_nsec);
 }
 
-void Thunderloop::timespecNorm(struct timespec& ts)
+void Thunderloop::updateLoopTimingStatus(const LoopTimer& loop_timer)
 {
-    while (ts.tv_nsec >= static_cast<int>(NANOSECONDS_PER_SECOND))
-    {
-        ts.tv_nsec -= static_cast<int>(NANOSECONDS_PER_SECOND);
-        ts.tv_sec++;
-    }
+    thunderloop_status_.set_wakeup_lateness_ms(
+        static_cast<double>(loop_timer.getLastLatenessNs()) /
+        NANOSECONDS_PER_MILLISECOND);
+    thunderloop_status_.set_max_wakeup_lateness_ms(
+        static_cast<double>(loop_timer.getMaxLatenessNs()) /
+        NANOSECONDS_PER_MILLISECOND);
+    thunderloop_status_.set_num_overruns(loop_timer.getNumOverruns());
+    thunderloop_status_.set_num_missed_deadlines(loop_timer.getNumMissedDeadlines());
+
+    const LoopTimer::Histogram& lateness_histogram = loop_timer.getLatenessHistogram();
+    thunderloop_status_.clear_wakeup_lateness_histogram();
+    thunderloop_status_.mutable_wakeup_lateness_histogram()->Add(
+        lateness_histogram.begin(), lateness_histogram.end());
+
+    const LoopTimer::Histogram& overrun_histogram = loop_timer.getOverrunHistogram();
+    thunderloop_status_.clear_overrun_histogram();
+    thunderloop_status_.mutable_overrun_histogram()->Add(overrun_histogram.begin(),
+                                                         overrun_histogram.end());
 }
 
 double Thunderloop::getCpuTemperature()
@@ -7,6 +7,7 @@
 #include "proto/tbots_software_msgs.pb.h"
 #include "shared/2021_robot_constants.h"
 #include "shared/constants.h"
+#include "software/jetson_nano/loop_timer.h"
 #include "software/jetson_nano/primitive_executor.h"
 #include "software/jetson_nano/redis/redis_client.h"
 #include "software/jetson_nano/services/motor.h"
@@ -64,14 +65,12 @@ class Thunderloop
     std::unique_ptr<RedisClient> redis_client_;
 
    private:
-    /*
-     * The struct timespec consists of nanoseconds and seconds. If the nanoseconds
-     * are getting bigger than 1000000000 (= 1 second) the variable containing
-     * seconds has to be incremented and the nanoseconds decremented by 1000000000.
+    /**
+     * Updates the ThunderloopStatus with the lateness and overruns of the loop
      *
-     * @param ts timespec to modify
+     * @param loop_timer The timer that the loop runs on
      */
-    void timespecNorm(struct timespec &ts);
+    void updateLoopTimingStatus(const LoopTimer &loop_timer);
 
     /**
      * Get the CPU temp thunderloop is running on
@@ -98,7 +97,6 @@ class Thunderloop
     void updateErrorCodes();
 
     // Input Msg Buffers
-    TbotsProto::PrimitiveSet primitive_set_;
     TbotsProto::World world_;
     TbotsProto::Primitive primitive_;
     TbotsProto::DirectControlPrimitive direct_control_;
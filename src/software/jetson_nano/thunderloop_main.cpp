@@ -13,6 +13,7 @@
 #include "proto/tbots_software_msgs.pb.h"
 #include "shared/2021_robot_constants.h"
 #include "shared/constants.h"
+#include "software/jetson_nano/realtime.h"
 #include "software/jetson_nano/thunderloop.h"
 #include "software/logger/network_logger.h"
 #include "software/world/robot_state.h"
@@ -91,6 +92,8 @@ int main(int argc, char** argv)
     struct CommandLineArgs
     {
         bool enable_log_merging = true;
+        int realtime_priority   = 0;
+        int cpu_affinity        = -1;
     };
 
     CommandLineArgs args;
@@ -99,6 +102,14 @@ int main(int argc, char** argv)
     desc.add_options()("enable_log_merging",
                        boost::program_options::value<bool>(&args.enable_log_merging),
                        "merging repeated log messages");
+    desc.add_options()(
+        "realtime_priority",
+        boost::program_options::value<int>(&args.realtime_priority),
+        "run the loop with SCHED_FIFO at this priority (1-99), or 0 to not run it in "
+        "real-time");
+    desc.add_options()("cpu_affinity",
+                       boost::program_options::value<int>(&args.cpu_affinity),
+                       "pin the loop to this CPU, or -1 to not pin it");
 
     boost::program_options::variables_map vm;
     boost::program_options::store(parse_command_line(argc, argv, desc), vm);
@@ -113,6 +124,28 @@ int main(int argc, char** argv)
 
     auto thunderloop =
         Thunderloop(create2021RobotConstants(), args.enable_log_merging, THUNDERLOOP_HZ);
+
+    std::optional<int> cpu = std::nullopt;
+    if (args.cpu_affinity >= 0)
+    {
+        cpu = args.cpu_affinity;
+    }
+
+    // The services have started their threads by now, so only the loop runs in
+    // real-time and is pinned
+    if (args.realtime_priority > 0)
+    {
+        if (configureRealtimeThread(args.realtime_priority, cpu))
+        {
+            LOG(INFO) << "THUNDERLOOP: running in real-time with priority "
+                      << args.realtime_priority;
+        }
+    }
+    else if (cpu.has_value() && pinThreadToCpu(cpu.value()))
+    {
+        LOG(INFO) << "THUNDERLOOP: pinned to CPU " << cpu.value();
+    }
+
     thunderloop.runLoop();
 
     return 0;
@@ -0,0 +1,123 @@
+#include "software/multithreading/thread_pool.h"
+
+#include <algorithm>
+
+ThreadPool::ThreadPool(unsigned int num_worker_threads)
+    : current_task(nullptr),
+      num_tasks(0),
+      next_task_index(0),
+      batch_number(0),
+      num_worker_slots(0),
+      num_workers_running(0),
+      in_destructor(false)
+{
+    workers.reserve(num_worker_threads);
+    for (unsigned int i = 0; i < num_worker_threads; i++)
+    {
+        workers.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::scoped_lock lock(mutex);
+        in_destructor = true;
+    }
+    batch_available_cv.notify_all();
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+void ThreadPool::parallelFor(std::size_t num_tasks,
+                             const std::function<void(std::size_t)>& task)
+{
+    // Waking up the workers isn't worth it if there's no work to share
+    if (workers.empty() || num_tasks <= 1)
+    {
+        for (std::size_t i = 0; i < num_tasks; i++)
+        {
+            task(i);
+        }
+        return;
+    }
+
+    // The calling thread runs tasks too, so only as many workers as there are other
+    // tasks are woken up. The rest keep sleeping instead of waking up to find that
+    // every task has already been claimed
+    unsigned int num_workers_needed = static_cast<unsigned int>(
+        std::min(workers.size(), static_cast<std::size_t>(num_tasks - 1)));
+    {
+        std::scoped_lock lock(mutex);
+        current_task        = &task;
+        this->num_tasks     = num_tasks;
+        next_task_index     = 0;
+        num_worker_slots    = num_workers_needed;
+        num_workers_running = num_workers_needed;
+        batch_number++;
+    }
+    if (num_workers_needed == workers.size())
+    {
+        batch_available_cv.notify_all();
+    }
+    else
+    {
+        for (unsigned int i = 0; i < num_workers_needed; i++)
+        {
+            batch_available_cv.notify_one();
+        }
+    }
+
+    // The calling thread would otherwise sit idle, so it helps run the batch
+    runTasks();
+
+    std::unique_lock lock(mutex);
+    batch_done_cv.wait(lock, [this]() { return num_workers_running == 0; });
+    current_task = nullptr;
+}
+
+unsigned int ThreadPool::getNumWorkerThreads() const
+{
+    return static_cast<unsigned int>(workers.size());
+}
+
+void ThreadPool::workerLoop()
+{
+    unsigned int last_batch_number = 0;
+    while (true)
+    {
+        {
+            std::unique_lock lock(mutex);
+            batch_available_cv.wait(lock, [this, last_batch_number]() {
+                return in_destructor ||
+                       (batch_number != last_batch_number && num_worker_slots > 0);
+            });
+            if (in_destructor)
+            {
+                return;
+            }
+            last_batch_number = batch_number;
+            num_worker_slots--;
+        }
+
+        runTasks();
+
+        {
+            std::scoped_lock lock(mutex);
+            num_workers_running--;
+        }
+        batch_done_cv.notify_one();
+    }
+}
+
+void ThreadPool::runTasks()
+{
+    std::size_t i;
+    while ((i = next_task_index++) < num_tasks)
+    {
+        (*current_task)(i);
+    }
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * A fixed set of worker threads that can run a batch of independent tasks in
+ * parallel. The worker threads are created once and reused for every batch, so
+ * running a batch does not create threads or allocate memory, which makes it suitable
+ * for work that is split up at a high rate (ex. once per simulation step).
+ *
+ * The public API is not thread-safe: only one thread may run batches on a pool
+ */
+class ThreadPool
+{
+   public:
+    /**
+     * Creates a new ThreadPool
+     *
+     * @param num_worker_threads The number of worker threads to create. The thread
+     * calling parallelFor also runs tasks, so a pool with 0 worker threads runs all
+     * tasks serially on the calling thread
+     */
+    explicit ThreadPool(unsigned int num_worker_threads);
+
+    ~ThreadPool();
+
+    // Copying or moving this class is not permitted
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * Runs task(i) for every i in [0, num_tasks) and blocks until all tasks have
+     * completed. Tasks may run in any order and on any thread, so each task must
+     * only write to data that no other task accesses. Tasks must not throw. Only as
+     * many worker threads as are needed for the tasks are woken up.
+     *
+     * @param num_tasks The number of tasks to run
+     * @param task The task to run, called with the index of the task
+     */
+    void parallelFor(std::size_t num_tasks, const std::function<void(std::size_t)>& task);
+
+    /**
+     * Gets the number of worker threads in this pool
+     *
+     * @return the number of worker threads
+     */
+    unsigned int getNumWorkerThreads() const;
+
+   private:
+    /**
+     * The function run by each worker thread. Waits for a new batch of tasks, helps
+     * run it, and repeats until the pool is destroyed
+     */
+    void workerLoop();
+
+    /**
+     * Claims and runs tasks from the current batch until none are left
+     */
+    void runTasks();
+
+    std::vector<std::thread> workers;
+
+    std::mutex mutex;
+    std::condition_variable batch_available_cv;
+    std::condition_variable batch_done_cv;
+
+    // The current batch of tasks. These are only written while no worker is running
+    // tasks, and are published to the workers through the mutex
+    const std::function<void(std::size_t)>* current_task;
+    std::size_t num_tasks;
+    std::atomic<std::size_t> next_task_index;
+
+    // Incremented every time a new batch is started, so that workers can tell a new
+    // batch apart from a spurious wake up
+    unsigned int batch_number;
+    // The number of workers that can still join the current batch. Batches with fewer
+    // tasks than workers only need some of the workers
+    unsigned int num_worker_slots;
+    unsigned int num_workers_running;
+    bool in_destructor;
+};
@@ -0,0 +1,100 @@
+#include "software/multithreading/thread_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <numeric>
+
+TEST(ThreadPoolTest, run_every_task_exactly_once)
+{
+    ThreadPool thread_pool(4);
+    std::vector<std::atomic<int>> run_counts(1000);
+
+    thread_pool.parallelFor(run_counts.size(),
+                            [&run_counts](std::size_t i) { run_counts[i]++; });
+
+    for (const auto& run_count : run_counts)
+    {
+        EXPECT_EQ(1, run_count);
+    }
+}
+
+TEST(ThreadPoolTest, run_many_batches_on_the_same_pool)
+{
+    ThreadPool thread_pool(3);
+    std::vector<int> results(50, 0);
+
+    for (int batch = 0; batch < 1000; batch++)
+    {
+        thread_pool.parallelFor(results.size(),
+                                [&results](std::size_t i) { results[i] += 1; });
+    }
+
+    for (const auto& result : results)
+    {
+        EXPECT_EQ(1000, result);
+    }
+}
+
+TEST(ThreadPoolTest, run_batches_with_fewer_tasks_than_workers)
+{
+    // Only some of the workers join these batches, so the workers that sat out a batch
+    // must still join later ones
+    ThreadPool thread_pool(4);
+    std::vector<int> results(6, 0);
+    std::vector<int> expected_results(results.size(), 0);
+
+    for (std::size_t batch = 0; batch < 1000; batch++)
+    {
+        std::size_t num_tasks = batch % (results.size() + 1);
+        thread_pool.parallelFor(num_tasks,
+                                [&results](std::size_t i) { results[i] += 1; });
+        for (std::size_t i = 0; i < num_tasks; i++)
+        {
+            expected_results[i] += 1;
+        }
+    }
+
+    EXPECT_EQ(expected_results, results);
+}
+
+TEST(ThreadPoolTest, run_tasks_with_no_worker_threads)
+{
+    ThreadPool thread_pool(0);
+    std::vector<std::size_t> order;
+
+    thread_pool.parallelFor(5, [&order](std::size_t i) { order.push_back(i); });
+
+    EXPECT_EQ(0u, thread_pool.getNumWorkerThreads());
+    EXPECT_EQ(std::vector<std::size_t>({0, 1, 2, 3, 4}), order);
+}
+
+TEST(ThreadPoolTest, run_empty_batch)
+{
+    ThreadPool thread_pool(2);
+    bool task_ran = false;
+
+    thread_pool.parallelFor(0, [&task_ran](std::size_t) { task_ran = true; });
+
+    EXPECT_FALSE(task_ran);
+}
+
+TEST(ThreadPoolTest, results_match_serial_computation)
+{
+    ThreadPool thread_pool(4);
+    std::vector<double> inputs(256);
+    std::iota(inputs.begin(), inputs.end(), 0.0);
+    std::vector<double> parallel_outputs(inputs.size());
+    std::vector<double> serial_outputs(inputs.size());
+
+    auto compute = [&inputs](std::size_t i) { return std::sin(inputs[i]) * 1.5 + 0.1; };
+    thread_pool.parallelFor(inputs.size(), [&](std::size_t i) {
+        parallel_outputs[i] = compute(i);
+    });
+    for (std::size_t i = 0; i < inputs.size(); i++)
+    {
+        serial_outputs[i] = compute(i);
+    }
+
+    EXPECT_EQ(serial_outputs, parallel_outputs);
+}
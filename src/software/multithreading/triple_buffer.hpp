@@ -0,0 +1,117 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+/**
+ * A single slot holding the latest value published by one producer thread, which one
+ * consumer thread can take without either thread ever locking or waiting.
+ *
+ * The slot is made of three buffers: one being written by the producer, one being
+ * read by the consumer, and one holding the latest published value. Publishing and
+ * taking swap a buffer with the latest one, so the consumer always gets the most
+ * recent value and never sees one that is being written. Values that are published
+ * while the consumer is not taking them are overwritten.
+ *
+ * Only one thread may publish and only one thread may take at a time.
+ *
+ * @tparam T The type of the value
+ */
+template <typename T>
+class TripleBuffer
+{
+   public:
+    /**
+     * Creates a new TripleBuffer with no published value
+     */
+    explicit TripleBuffer();
+
+    // Copying this class is not permitted
+    TripleBuffer(const TripleBuffer&) = delete;
+
+    /**
+     * Publishes a new value. Must only be called from the producer thread
+     *
+     * @param value The value to publish
+     * @param sequence_number The sequence number of the value
+     */
+    void publish(T value, uint64_t sequence_number);
+
+    /**
+     * Takes the latest published value, if a value has been published since it was
+     * last called. Must only be called from the consumer thread
+     *
+     * @return the latest published value, which stays valid until this is called
+     * again, or nullptr if there is no new value
+     */
+    const T* takeLatest();
+
+    /**
+     * Gets the sequence number of the value that was last taken. Must only be called
+     * from the consumer thread
+     *
+     * @return the sequence number of the last taken value, or 0 if no value has
+     * been taken
+     */
+    uint64_t getLastTakenSequenceNumber() const;
+
+   private:
+    // Set on the index of the latest buffer when it holds a value that has not been
+    // taken yet
+    static constexpr uint8_t NEW_VALUE_FLAG = 0x4;
+    static constexpr uint8_t INDEX_MASK     = 0x3;
+
+    std::array<T, 3> values;
+    std::array<uint64_t, 3> sequence_numbers;
+
+    // The index of the buffer holding the latest published value, along with
+    // NEW_VALUE_FLAG
+    std::atomic<uint8_t> latest_index;
+    // Only used by the producer thread
+    uint8_t write_index;
+    // Only used by the consumer thread
+    uint8_t read_index;
+};
+
+template <typename T>
+TripleBuffer<T>::TripleBuffer()
+    : values(),
+      sequence_numbers({0, 0, 0}),
+      latest_index(0),
+      write_index(1),
+      read_index(2)
+{
+}
+
+template <typename T>
+void TripleBuffer<T>::publish(T value, uint64_t sequence_number)
+{
+    values[write_index]           = std::move(value);
+    sequence_numbers[write_index] = sequence_number;
+
+    // Releases the written buffer to the consumer, and takes back whichever buffer
+    // the consumer is not reading
+    write_index = latest_index.exchange(write_index | NEW_VALUE_FLAG,
+                                        std::memory_order_acq_rel) &
+                  INDEX_MASK;
+}
+
+template <typename T>
+const T* TripleBuffer<T>::takeLatest()
+{
+    if (!(latest_index.load(std::memory_order_relaxed) & NEW_VALUE_FLAG))
+    {
+        return nullptr;
+    }
+
+    read_index =
+        latest_index.exchange(read_index, std::memory_order_acq_rel) & INDEX_MASK;
+    return &values[read_index];
+}
+
+template <typename T>
+uint64_t TripleBuffer<T>::getLastTakenSequenceNumber() const
+{
+    return sequence_numbers[read_index];
+}
@@ -0,0 +1,108 @@
+#include "software/multithreading/triple_buffer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+TEST(TripleBufferTest, take_latest_with_no_published_value)
+{
+    TripleBuffer<int> buffer;
+
+    EXPECT_EQ(nullptr, buffer.takeLatest());
+    EXPECT_EQ(0, buffer.getLastTakenSequenceNumber());
+}
+
+TEST(TripleBufferTest, take_latest_single_value)
+{
+    TripleBuffer<int> buffer;
+
+    buffer.publish(7, 1);
+
+    const int* value = buffer.takeLatest();
+    ASSERT_NE(nullptr, value);
+    EXPECT_EQ(7, *value);
+    EXPECT_EQ(1, buffer.getLastTakenSequenceNumber());
+}
+
+TEST(TripleBufferTest, take_latest_returns_most_recently_published_value)
+{
+    TripleBuffer<int> buffer;
+
+    buffer.publish(7, 1);
+    buffer.publish(8, 2);
+    buffer.publish(9, 3);
+
+    const int* value = buffer.takeLatest();
+    ASSERT_NE(nullptr, value);
+    EXPECT_EQ(9, *value);
+    EXPECT_EQ(3, buffer.getLastTakenSequenceNumber());
+}
+
+TEST(TripleBufferTest, take_latest_only_returns_each_value_once)
+{
+    TripleBuffer<int> buffer;
+
+    buffer.publish(7, 1);
+    EXPECT_NE(nullptr, buffer.takeLatest());
+    EXPECT_EQ(nullptr, buffer.takeLatest());
+
+    // The last taken value is still kept
+    EXPECT_EQ(1, buffer.getLastTakenSequenceNumber());
+
+    buffer.publish(8, 2);
+    const int* value = buffer.takeLatest();
+    ASSERT_NE(nullptr, value);
+    EXPECT_EQ(8, *value);
+    EXPECT_EQ(nullptr, buffer.takeLatest());
+}
+
+TEST(TripleBufferTest, taken_value_stays_valid_while_publishing)
+{
+    TripleBuffer<int> buffer;
+
+    buffer.publish(7, 1);
+    const int* value = buffer.takeLatest();
+
+    buffer.publish(8, 2);
+    buffer.publish(9, 3);
+    buffer.publish(10, 4);
+
+    ASSERT_NE(nullptr, value);
+    EXPECT_EQ(7, *value);
+}
+
+TEST(TripleBufferTest, take_latest_from_another_thread)
+{
+    constexpr uint64_t NUM_VALUES = 100000;
+
+    // Each value is a vector whose elements all equal its sequence number, so a value
+    // that is read while being written would show up as a mismatch
+    TripleBuffer<std::vector<uint64_t>> buffer;
+
+    std::thread producer_thread([&]() {
+        for (uint64_t i = 1; i <= NUM_VALUES; i++)
+        {
+            buffer.publish(std::vector<uint64_t>(16, i), i);
+        }
+    });
+
+    uint64_t last_sequence_number = 0;
+    while (last_sequence_number < NUM_VALUES)
+    {
+        const std::vector<uint64_t>* value = buffer.takeLatest();
+        if (value == nullptr)
+        {
+            continue;
+        }
+
+        uint64_t sequence_number = buffer.getLastTakenSequenceNumber();
+        EXPECT_GT(sequence_number, last_sequence_number);
+        for (uint64_t element : *value)
+        {
+            ASSERT_EQ(sequence_number, element);
+        }
+        last_sequence_number = sequence_number;
+    }
+
+    producer_thread.join();
+}
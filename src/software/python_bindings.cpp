@@ -7,6 +7,7 @@
 #include <sstream>
 
 #include "proto/geometry.pb.h"
+#include "proto/message_translation/compact_primitive_set.h"
 #include "proto/message_translation/ssl_geometry.h"
 #include "proto/message_translation/tbots_geometry.h"
 #include "proto/parameters.pb.h"
@@ -364,6 +365,17 @@ PYBIND11_MODULE(python_bindings, m)
     declareThreadedProtoUdpSender<TbotsProto::PrimitiveSet>(m, "PrimitiveSet");
     declareThreadedProtoRadioSender<TbotsProto::PrimitiveSet>(m, "PrimitiveSet");
 
+    // Sends PrimitiveSets in the compact wire format, encoding them on the C++ side
+    using CompactPrimitiveSetUdpSender = ThreadedProtoUdpSender<CompactPrimitiveSet>;
+    py::class_<CompactPrimitiveSetUdpSender,
+               std::shared_ptr<CompactPrimitiveSetUdpSender>>(
+        m, "CompactPrimitiveSetUdpSender", py::buffer_protocol(), py::dynamic_attr())
+        .def(py::init<std::string, int, bool>())
+        .def("send_proto", [](CompactPrimitiveSetUdpSender& sender,
+                              const TbotsProto::PrimitiveSet& primitive_set) {
+            sender.sendProto(CompactPrimitiveSet(primitive_set));
+        });
+
     // Estop Reader
     py::class_<ThreadedEstopReader, std::unique_ptr<ThreadedEstopReader>>(
         m, "ThreadedEstopReader")
@@ -0,0 +1,85 @@
+#include "software/sensor_fusion/filter/constant_acceleration_kalman_filter.h"
+
+ConstantAccelerationKalmanFilter::ConstantAccelerationKalmanFilter(
+    double position, double velocity, const Eigen::Vector3d& initial_variances,
+    double measurement_variance, double jerk_spectral_density)
+    : state(position, velocity, 0),
+      covariance(initial_variances.asDiagonal()),
+      measurement_variance(measurement_variance),
+      jerk_spectral_density(jerk_spectral_density)
+{
+}
+
+void ConstantAccelerationKalmanFilter::predict(const Duration& duration)
+{
+    double dt  = duration.toSeconds();
+    double dt2 = dt * dt;
+    double dt3 = dt2 * dt;
+
+    // The covariance of the error added by the white noise jerk over the duration
+    Eigen::Matrix3d process_noise;
+    // clang-format off
+    process_noise <<
+        dt3 * dt2 / 20, dt2 * dt2 / 8, dt3 / 6,
+        dt2 * dt2 / 8,  dt3 / 3,       dt2 / 2,
+        dt3 / 6,        dt2 / 2,       dt;
+    // clang-format on
+    process_noise *= jerk_spectral_density;
+
+    Eigen::Matrix3d transition = stateTransition(duration);
+    state                      = transition * state;
+    covariance = transition * covariance * transition.transpose() + process_noise;
+}
+
+void ConstantAccelerationKalmanFilter::update(double measured_position)
+{
+    // Only the position is measured, so the measurement matrix is [1 0 0] and the
+    // products with it reduce to picking out the first row or column
+    double innovation          = measured_position - state(0);
+    double innovation_variance = covariance(0, 0) + measurement_variance;
+    Eigen::Vector3d gain       = covariance.col(0) / innovation_variance;
+
+    state += gain * innovation;
+
+    // The Joseph form of the covariance update keeps the covariance symmetric and
+    // positive definite despite rounding errors
+    Eigen::Matrix3d correction = Eigen::Matrix3d::Identity();
+    correction.col(0) -= gain;
+    covariance = correction * covariance * correction.transpose() +
+                 gain * measurement_variance * gain.transpose();
+}
+
+Eigen::Vector3d ConstantAccelerationKalmanFilter::getPredictedState(
+    const Duration& duration) const
+{
+    return stateTransition(duration) * state;
+}
+
+double ConstantAccelerationKalmanFilter::getPosition() const
+{
+    return state(0);
+}
+
+double ConstantAccelerationKalmanFilter::getVelocity() const
+{
+    return state(1);
+}
+
+double ConstantAccelerationKalmanFilter::getAcceleration() const
+{
+    return state(2);
+}
+
+Eigen::Matrix3d ConstantAccelerationKalmanFilter::stateTransition(
+    const Duration& duration)
+{
+    double dt = duration.toSeconds();
+    Eigen::Matrix3d transition;
+    // clang-format off
+    transition <<
+        1, dt, dt * dt / 2,
+        0, 1,  dt,
+        0, 0,  1;
+    // clang-format on
+    return transition;
+}
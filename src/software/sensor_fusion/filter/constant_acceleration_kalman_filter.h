@@ -0,0 +1,99 @@
+#pragma once
+
+#include <Eigen/Dense>
+
+#include "software/time/duration.h"
+
+/**
+ * A Kalman filter that estimates the position, velocity and acceleration along a single
+ * axis from noisy position measurements.
+ *
+ * The filter assumes that the acceleration stays constant between measurements, except
+ * for random changes modelled as white noise jerk (the rate of change of acceleration).
+ * The larger the jerk spectral density, the faster the filter responds to changes in
+ * acceleration, but the more measurement noise makes it into the velocity and
+ * acceleration estimates.
+ *
+ * All the matrices are fixed size, so the filter never allocates memory.
+ */
+class ConstantAccelerationKalmanFilter
+{
+   public:
+    /**
+     * Creates a new filter with the given initial state
+     *
+     * @param position The initial position
+     * @param velocity The initial velocity
+     * @param initial_variances The variances of the initial position, velocity and
+     * acceleration
+     * @param measurement_variance The variance of the position measurements
+     * @param jerk_spectral_density The power spectral density of the white noise jerk
+     */
+    explicit ConstantAccelerationKalmanFilter(double position, double velocity,
+                                              const Eigen::Vector3d& initial_variances,
+                                              double measurement_variance,
+                                              double jerk_spectral_density);
+
+    /**
+     * Advances the estimated state by the given duration
+     *
+     * @param duration How far to advance the state. Must not be negative
+     */
+    void predict(const Duration& duration);
+
+    /**
+     * Corrects the estimated state with a new position measurement. The measurement
+     * must have been taken at the time of the estimated state, so predict must be used
+     * to advance the state to the measurement time first
+     *
+     * @param measured_position The measured position
+     */
+    void update(double measured_position);
+
+    /**
+     * Returns what the estimated state will be after the given duration, without
+     * changing the state of the filter
+     *
+     * @param duration How far into the future to predict the state
+     *
+     * @return The predicted position, velocity and acceleration
+     */
+    Eigen::Vector3d getPredictedState(const Duration& duration) const;
+
+    /**
+     * Returns the estimated position
+     *
+     * @return the estimated position
+     */
+    double getPosition() const;
+
+    /**
+     * Returns the estimated velocity
+     *
+     * @return the estimated velocity
+     */
+    double getVelocity() const;
+
+    /**
+     * Returns the estimated acceleration
+     *
+     * @return the estimated acceleration
+     */
+    double getAcceleration() const;
+
+   private:
+    /**
+     * Returns the matrix that advances the state by the given duration
+     *
+     * @param duration The duration
+     *
+     * @return The state transition matrix
+     */
+    static Eigen::Matrix3d stateTransition(const Duration& duration);
+
+    // The estimated position, velocity and acceleration, and their covariance
+    Eigen::Vector3d state;
+    Eigen::Matrix3d covariance;
+    double measurement_variance;
+    double jerk_spectral_density;
+};
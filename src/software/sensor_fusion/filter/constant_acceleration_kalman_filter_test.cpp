@@ -0,0 +1,107 @@
+#include "software/sensor_fusion/filter/constant_acceleration_kalman_filter.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+class ConstantAccelerationKalmanFilterTest : public ::testing::Test
+{
+   protected:
+    ConstantAccelerationKalmanFilterTest()
+        : filter(0, 0, Eigen::Vector3d(1e-4, 1, 10),
+                 MEASUREMENT_STDDEV * MEASUREMENT_STDDEV, 100),
+          time_step(Duration::fromSeconds(1.0 / 60.0))
+    {
+    }
+
+    static constexpr double MEASUREMENT_STDDEV = 0.003;
+    ConstantAccelerationKalmanFilter filter;
+    Duration time_step;
+};
+
+TEST_F(ConstantAccelerationKalmanFilterTest, initial_state)
+{
+    ConstantAccelerationKalmanFilter initial_filter(1.5, -2, Eigen::Vector3d(1, 1, 1),
+                                                    1, 1);
+
+    EXPECT_DOUBLE_EQ(1.5, initial_filter.getPosition());
+    EXPECT_DOUBLE_EQ(-2, initial_filter.getVelocity());
+    EXPECT_DOUBLE_EQ(0, initial_filter.getAcceleration());
+}
+
+TEST_F(ConstantAccelerationKalmanFilterTest, predict_follows_constant_acceleration)
+{
+    ConstantAccelerationKalmanFilter initial_filter(1, 2, Eigen::Vector3d(1, 1, 1), 1, 1);
+    initial_filter.predict(Duration::fromSeconds(0.5));
+
+    EXPECT_DOUBLE_EQ(2, initial_filter.getPosition());
+    EXPECT_DOUBLE_EQ(2, initial_filter.getVelocity());
+}
+
+TEST_F(ConstantAccelerationKalmanFilterTest, get_predicted_state_does_not_change_state)
+{
+    ConstantAccelerationKalmanFilter initial_filter(1, 2, Eigen::Vector3d(1, 1, 1), 1, 1);
+    Eigen::Vector3d predicted_state =
+        initial_filter.getPredictedState(Duration::fromSeconds(0.5));
+
+    EXPECT_DOUBLE_EQ(2, predicted_state(0));
+    EXPECT_DOUBLE_EQ(2, predicted_state(1));
+    EXPECT_DOUBLE_EQ(0, predicted_state(2));
+    EXPECT_DOUBLE_EQ(1, initial_filter.getPosition());
+}
+
+TEST_F(ConstantAccelerationKalmanFilterTest, update_moves_towards_measurement)
+{
+    filter.predict(time_step);
+    filter.update(0.01);
+
+    EXPECT_GT(filter.getPosition(), 0);
+    EXPECT_LT(filter.getPosition(), 0.01);
+    EXPECT_GT(filter.getVelocity(), 0);
+}
+
+TEST_F(ConstantAccelerationKalmanFilterTest, converges_to_constant_acceleration)
+{
+    double acceleration = 2.0;
+    double velocity     = -1.0;
+    for (unsigned int i = 1; i <= 120; i++)
+    {
+        double t = i * time_step.toSeconds();
+        filter.predict(time_step);
+        filter.update(velocity * t + acceleration * t * t / 2);
+    }
+
+    double t = 120 * time_step.toSeconds();
+    EXPECT_NEAR(velocity * t + acceleration * t * t / 2, filter.getPosition(), 1e-4);
+    EXPECT_NEAR(velocity + acceleration * t, filter.getVelocity(), 1e-2);
+    EXPECT_NEAR(acceleration, filter.getAcceleration(), 0.1);
+}
+
+TEST_F(ConstantAccelerationKalmanFilterTest, filters_noise_from_constant_velocity)
+{
+    // Use a constant seed so results are deterministic
+    std::mt19937 random_generator(1);
+    std::normal_distribution<double> noise_distribution(0, MEASUREMENT_STDDEV);
+
+    double velocity                = 1.5;
+    double squared_velocity_errors = 0;
+    unsigned int num_steps         = 300;
+    // Give the filter a second to converge before measuring the error
+    unsigned int num_warmup_steps = 60;
+    for (unsigned int i = 1; i <= num_steps; i++)
+    {
+        double t = i * time_step.toSeconds();
+        filter.predict(time_step);
+        filter.update(velocity * t + noise_distribution(random_generator));
+        if (i > num_warmup_steps)
+        {
+            squared_velocity_errors += std::pow(filter.getVelocity() - velocity, 2);
+        }
+    }
+
+    // Velocities calculated from the difference between consecutive measurements have
+    // a standard deviation of about 0.25 m/s
+    double velocity_rmse =
+        std::sqrt(squared_velocity_errors / (num_steps - num_warmup_steps));
+    EXPECT_LT(velocity_rmse, 0.1);
+}
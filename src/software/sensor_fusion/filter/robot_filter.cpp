@@ -1,47 +1,47 @@
 #include "software/sensor_fusion/filter/robot_filter.h"
 
+#include <algorithm>
+
 RobotFilter::RobotFilter(Robot current_robot_state, Duration expiry_buffer_duration)
     : current_robot_state(current_robot_state),
-      expiry_buffer_duration(expiry_buffer_duration)
+      expiry_buffer_duration(expiry_buffer_duration),
+      x_filter(createKalmanFilter(
+          current_robot_state.position().x(), current_robot_state.velocity().x(),
+          POSITION_MEASUREMENT_STDDEV, INITIAL_VELOCITY_STDDEV,
+          INITIAL_ACCELERATION_STDDEV, LINEAR_JERK_SPECTRAL_DENSITY)),
+      y_filter(createKalmanFilter(
+          current_robot_state.position().y(), current_robot_state.velocity().y(),
+          POSITION_MEASUREMENT_STDDEV, INITIAL_VELOCITY_STDDEV,
+          INITIAL_ACCELERATION_STDDEV, LINEAR_JERK_SPECTRAL_DENSITY)),
+      orientation_filter(createKalmanFilter(
+          current_robot_state.orientation().toRadians(),
+          current_robot_state.angularVelocity().toRadians(),
+          ORIENTATION_MEASUREMENT_STDDEV, INITIAL_ANGULAR_VELOCITY_STDDEV,
+          INITIAL_ANGULAR_ACCELERATION_STDDEV, ANGULAR_JERK_SPECTRAL_DENSITY))
 {
 }
 
 RobotFilter::RobotFilter(RobotDetection current_robot_state,
                          Duration expiry_buffer_duration)
-    : current_robot_state(current_robot_state.id, current_robot_state.position,
-                          Vector(0, 0), current_robot_state.orientation,
-                          AngularVelocity::zero(), current_robot_state.timestamp),
-      expiry_buffer_duration(expiry_buffer_duration)
+    : RobotFilter(Robot(current_robot_state.id, current_robot_state.position,
+                        Vector(0, 0), current_robot_state.orientation,
+                        AngularVelocity::zero(), current_robot_state.timestamp),
+                  expiry_buffer_duration)
 {
 }
 
 std::optional<Robot> RobotFilter::getFilteredData(
     const std::vector<RobotDetection> &new_robot_data)
 {
-    int data_num               = 0;
     Timestamp latest_timestamp = Timestamp().fromSeconds(0);
-    FilteredRobotData filtered_data{.id               = this->getRobotId(),
-                                    .position         = Point(0, 0),
-                                    .velocity         = Vector(0, 0),
-                                    .orientation      = Angle::fromRadians(0),
-                                    .angular_velocity = AngularVelocity::fromRadians(0),
-                                    .timestamp        = Timestamp().fromSeconds(0)};
+    std::vector<RobotDetection> robot_detections;
 
     for (const RobotDetection &robot_data : new_robot_data)
     {
-        // add up all data points for this robot and then average it
-        if (robot_data.id == this->getRobotId() &&
-            robot_data.timestamp > this->current_robot_state.timestamp())
+        // Use all the new data points for this robot, from every camera
+        if (robot_data.id == this->getRobotId())
         {
-            filtered_data.position =
-                filtered_data.position + robot_data.position.toVector();
-            filtered_data.orientation =
-                filtered_data.orientation + robot_data.orientation;
-
-            filtered_data.timestamp = filtered_data.timestamp.fromMilliseconds(
-                filtered_data.timestamp.toMilliseconds() +
-                robot_data.timestamp.toMilliseconds());
-            data_num++;
+            robot_detections.emplace_back(robot_data);
         }
 
         // to get the latest timestamp of all data points in case there is no data for
@@ -52,11 +52,59 @@ std::optional<Robot> RobotFilter::getFilteredData(
         }
     }
 
-    if (data_num == 0)
+    std::stable_sort(robot_detections.begin(), robot_detections.end());
+    return getFilteredData(robot_detections, latest_timestamp);
+}
+
+std::optional<Robot> RobotFilter::getFilteredData(
+    const std::vector<RobotDetection> &robot_detections,
+    const Timestamp &latest_detection_timestamp)
+{
+    // Fuse the detections in the order they were captured. Detections captured at the
+    // same time by different cameras are fused without advancing the state
+    Timestamp previous_timestamp = current_robot_state.timestamp();
+    Timestamp filtered_timestamp = previous_timestamp;
+    for (const RobotDetection &robot_detection : robot_detections)
+    {
+        if (robot_detection.timestamp <= previous_timestamp)
+        {
+            continue;
+        }
+
+        Duration time_since_last_update = robot_detection.timestamp - filtered_timestamp;
+        filtered_timestamp              = robot_detection.timestamp;
+        if (time_since_last_update > expiry_buffer_duration)
+        {
+            // The robot has not been detected for long enough to have been removed
+            // from the field, so its old state says nothing about where it is now.
+            // The filters restart from this detection instead of predicting across
+            // the gap with a stale velocity and acceleration
+            resetKalmanFilters(robot_detection);
+            continue;
+        }
+
+        x_filter.predict(time_since_last_update);
+        y_filter.predict(time_since_last_update);
+        orientation_filter.predict(time_since_last_update);
+
+        x_filter.update(robot_detection.position.x());
+        y_filter.update(robot_detection.position.y());
+
+        // The detected orientation is wrapped to [-pi, pi], so we measure it relative to
+        // the estimated orientation, which isn't wrapped
+        Angle estimated_orientation =
+            Angle::fromRadians(orientation_filter.getPosition());
+        Angle orientation_difference =
+            (robot_detection.orientation - estimated_orientation).clamp();
+        orientation_filter.update(
+            (estimated_orientation + orientation_difference).toRadians());
+    }
+
+    if (filtered_timestamp == previous_timestamp)
     {
         // if there is no data the duration of expiry_buffer_duration after previously
         // recorded robot state, return null. Otherwise remain the same state
-        if (latest_timestamp.toMilliseconds() >
+        if (latest_detection_timestamp.toMilliseconds() >
             this->expiry_buffer_duration.toMilliseconds() +
                 current_robot_state.timestamp().toMilliseconds())
         {
@@ -67,38 +115,66 @@ std::optional<Robot> RobotFilter::getFilteredData(
             return std::make_optional(current_robot_state);
         }
     }
-    else
-    {
-        // update data by returning filtered robot data
-        filtered_data.position    = Point(filtered_data.position.toVector() / data_num);
-        filtered_data.orientation = filtered_data.orientation / data_num;
-
-        filtered_data.timestamp = filtered_data.timestamp.fromMilliseconds(
-            filtered_data.timestamp.toMilliseconds() / data_num);
-
-        // velocity = position difference / time difference
-        filtered_data.velocity =
-            (filtered_data.position - current_robot_state.position()) /
-            (filtered_data.timestamp.toSeconds() -
-             current_robot_state.timestamp().toSeconds());
-
-        // angular_velocity = orientation difference / time difference
-        filtered_data.angular_velocity =
-            (filtered_data.orientation - current_robot_state.orientation()).clamp() /
-            (filtered_data.timestamp.toSeconds() -
-             current_robot_state.timestamp().toSeconds());
-
-        // update current_robot_state
-        this->current_robot_state =
-            Robot(this->getRobotId(), filtered_data.position, filtered_data.velocity,
-                  filtered_data.orientation, filtered_data.angular_velocity,
-                  filtered_data.timestamp);
-
-        return std::make_optional(this->current_robot_state);
-    }
+
+    this->current_robot_state = Robot(
+        this->getRobotId(), Point(x_filter.getPosition(), y_filter.getPosition()),
+        Vector(x_filter.getVelocity(), y_filter.getVelocity()),
+        Angle::fromRadians(orientation_filter.getPosition()).clamp(),
+        AngularVelocity::fromRadians(orientation_filter.getVelocity()),
+        filtered_timestamp);
+
+    return std::make_optional(this->current_robot_state);
+}
+
+Robot RobotFilter::predictState(const Timestamp &timestamp) const
+{
+    double prediction_duration_seconds =
+        std::clamp((timestamp - current_robot_state.timestamp()).toSeconds(), 0.0,
+                   MAX_PREDICTION_DURATION_SECONDS);
+    Duration prediction_duration = Duration::fromSeconds(prediction_duration_seconds);
+
+    Eigen::Vector3d x = x_filter.getPredictedState(prediction_duration);
+    Eigen::Vector3d y = y_filter.getPredictedState(prediction_duration);
+    Eigen::Vector3d orientation =
+        orientation_filter.getPredictedState(prediction_duration);
+
+    return Robot(this->getRobotId(), Point(x(0), y(0)), Vector(x(1), y(1)),
+                 Angle::fromRadians(orientation(0)).clamp(),
+                 AngularVelocity::fromRadians(orientation(1)),
+                 current_robot_state.timestamp() + prediction_duration);
 }
 
 unsigned int RobotFilter::getRobotId() const
 {
     return this->current_robot_state.id();
 }
+
+void RobotFilter::resetKalmanFilters(const RobotDetection &robot_detection)
+{
+    x_filter = createKalmanFilter(robot_detection.position.x(), 0.0,
+                                  POSITION_MEASUREMENT_STDDEV, INITIAL_VELOCITY_STDDEV,
+                                  INITIAL_ACCELERATION_STDDEV,
+                                  LINEAR_JERK_SPECTRAL_DENSITY);
+    y_filter = createKalmanFilter(robot_detection.position.y(), 0.0,
+                                  POSITION_MEASUREMENT_STDDEV, INITIAL_VELOCITY_STDDEV,
+                                  INITIAL_ACCELERATION_STDDEV,
+                                  LINEAR_JERK_SPECTRAL_DENSITY);
+    orientation_filter = createKalmanFilter(
+        robot_detection.orientation.toRadians(), 0.0, ORIENTATION_MEASUREMENT_STDDEV,
+        INITIAL_ANGULAR_VELOCITY_STDDEV, INITIAL_ANGULAR_ACCELERATION_STDDEV,
+        ANGULAR_JERK_SPECTRAL_DENSITY);
+}
+
+ConstantAccelerationKalmanFilter RobotFilter::createKalmanFilter(
+    double position, double velocity, double position_stddev,
+    double initial_velocity_stddev, double initial_acceleration_stddev,
+    double jerk_spectral_density)
+{
+    Eigen::Vector3d initial_variances(position_stddev * position_stddev,
+                                      initial_velocity_stddev * initial_velocity_stddev,
+                                      initial_acceleration_stddev *
+                                          initial_acceleration_stddev);
+    return ConstantAccelerationKalmanFilter(position, velocity, initial_variances,
+                                            position_stddev * position_stddev,
+                                            jerk_spectral_density);
+}
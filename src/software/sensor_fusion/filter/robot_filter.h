@@ -5,26 +5,49 @@
 
 #include "software/geom/angle.h"
 #include "software/geom/point.h"
+#include "software/sensor_fusion/filter/constant_acceleration_kalman_filter.h"
 #include "software/sensor_fusion/filter/vision_detection.h"
 #include "software/time/timestamp.h"
 #include "software/world/robot.h"
 
 /**
- * A lightweight datatype used to pass filtered robot data
+ * Given robot data from SSL Vision, filters and returns the position/velocity of a
+ * single robot.
+ *
+ * The x coordinate, y coordinate and orientation of the robot are each estimated by a
+ * constant acceleration Kalman filter. Detections of the robot from different cameras
+ * are fused by updating the filters with each detection in the order they were
+ * captured, so overlapping cameras improve the estimate rather than being averaged. If
+ * the robot is detected again after not being detected for longer than the expiry
+ * buffer duration, the filters restart from the new detection.
+ *
+ * The filtered state is always as of the most recent detection, which is one vision
+ * latency behind the real robot. The state can be predicted forward to the time at
+ * which it is used with predictState.
  */
-typedef struct FilteredRobotData_t
-{
-    unsigned int id;
-    Point position;
-    Vector velocity;
-    Angle orientation;
-    AngularVelocity angular_velocity;
-    Timestamp timestamp;
-} FilteredRobotData;
-
 class RobotFilter
 {
    public:
+    // The standard deviations of the position (m) and orientation (rad) of a detection
+    static constexpr double POSITION_MEASUREMENT_STDDEV    = 0.003;
+    static constexpr double ORIENTATION_MEASUREMENT_STDDEV = 0.02;
+    // The power spectral densities of the white noise linear (m^2/s^5) and angular
+    // (rad^2/s^5) jerk of the robot. Larger values make the filter respond faster to
+    // changes in acceleration, at the cost of noisier velocity estimates. Determined
+    // experimentally with trapezoidal velocity profiles and 3mm of detection noise
+    static constexpr double LINEAR_JERK_SPECTRAL_DENSITY  = 100.0;
+    static constexpr double ANGULAR_JERK_SPECTRAL_DENSITY = 1000.0;
+    // The standard deviations of the velocity (m/s), acceleration (m/s^2), angular
+    // velocity (rad/s) and angular acceleration (rad/s^2) of a newly detected robot
+    static constexpr double INITIAL_VELOCITY_STDDEV             = 2.0;
+    static constexpr double INITIAL_ACCELERATION_STDDEV         = 5.0;
+    static constexpr double INITIAL_ANGULAR_VELOCITY_STDDEV     = 10.0;
+    static constexpr double INITIAL_ANGULAR_ACCELERATION_STDDEV = 50.0;
+    // How far into the future the robot state can be predicted. The robot's acceleration
+    // does not stay constant for long, so predictions further into the future are
+    // limited to this duration
+    static constexpr double MAX_PREDICTION_DURATION_SECONDS = 0.2;
+
     /**
      * Creates a new robot filter
      *
@@ -49,6 +72,36 @@ class RobotFilter
     std::optional<Robot> getFilteredData(
         const std::vector<RobotDetection>& new_robot_data);
 
+    /**
+     * Updates the filter given the new detections of this robot, and returns the most up
+     * to date filtered data for the Robot. This does not allocate any memory, so it is
+     * used when the detections have already been grouped by robot id
+     *
+     * @param robot_detections The new detections of the robot this filter is filtering
+     * for, sorted by timestamp. Detections older than the filtered data are ignored
+     * @param latest_detection_timestamp The timestamp of the most recent detection of
+     * any robot, used to determine if the robot has been removed from the field when
+     * there are no detections of it
+     *
+     * @return The filtered data for the robot
+     */
+    std::optional<Robot> getFilteredData(
+        const std::vector<RobotDetection>& robot_detections,
+        const Timestamp& latest_detection_timestamp);
+
+    /**
+     * Returns the state the robot is predicted to be in at the given timestamp, based on
+     * the filtered data. This does not change the state of the filter.
+     *
+     * @param timestamp The timestamp to predict the robot's state at. Timestamps before
+     * the filtered data return the filtered data, and timestamps more than
+     * MAX_PREDICTION_DURATION_SECONDS after the filtered data are limited to that
+     * duration
+     *
+     * @return The predicted state of the robot
+     */
+    Robot predictState(const Timestamp& timestamp) const;
+
     /**
      * Returns the id of the Robot that this filter is filtering for
      *
@@ -57,6 +110,38 @@ class RobotFilter
     unsigned int getRobotId() const;
 
    private:
+    /**
+     * Restarts the Kalman filters from the given detection, as if the robot was newly
+     * detected
+     *
+     * @param robot_detection The detection to restart the filters from
+     */
+    void resetKalmanFilters(const RobotDetection& robot_detection);
+
+    /**
+     * Creates a Kalman filter for the x coordinate, y coordinate or orientation of the
+     * robot
+     *
+     * @param position The initial position
+     * @param velocity The initial velocity
+     * @param position_stddev The standard deviation of the position measurements
+     * @param initial_velocity_stddev The standard deviation of the initial velocity
+     * @param initial_acceleration_stddev The standard deviation of the initial
+     * acceleration
+     * @param jerk_spectral_density The power spectral density of the white noise jerk
+     *
+     * @return The Kalman filter
+     */
+    static ConstantAccelerationKalmanFilter createKalmanFilter(
+        double position, double velocity, double position_stddev,
+        double initial_velocity_stddev, double initial_acceleration_stddev,
+        double jerk_spectral_density);
+
     Robot current_robot_state;
     Duration expiry_buffer_duration;
+    // The orientation filter estimates the orientation without wrapping it around,
+    // so that the angular velocity stays continuous when the robot turns past +-pi
+    ConstantAccelerationKalmanFilter x_filter;
+    ConstantAccelerationKalmanFilter y_filter;
+    ConstantAccelerationKalmanFilter orientation_filter;
 };
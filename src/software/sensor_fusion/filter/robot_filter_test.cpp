@@ -3,6 +3,8 @@
 #include <gtest/gtest.h>
 #include <string.h>
 
+#include <random>
+
 #include "software/test_util/equal_within_tolerance.h"
 
 TEST(RobotFilterTest, no_match_robot_data_robot_state_expired_test)
@@ -26,34 +28,118 @@ TEST(RobotFilterTest, no_match_robot_data_robot_state_not_expired_test)
     EXPECT_EQ(op_robot.value(), robot_filter.getFilteredData(new_robot_data).value());
 }
 
-
 TEST(RobotFilterTest, one_match_robot_data_robot_state_not_expired_test)
 {
     Robot robot(1, Point(0, 0), Vector(0, 0), Angle::fromRadians(0),
                 AngularVelocity::fromRadians(0), Timestamp::fromSeconds(0));
     RobotFilter robot_filter(robot, Duration::fromSeconds(10));
     std::vector<RobotDetection> new_robot_data = {
-        {1, Point(2, 0), Angle::fromRadians(1), 0.5, Timestamp::fromSeconds(9)}};
-    std::optional<Robot> op_robot;
-    op_robot.emplace(Robot(1, Point(2, 0), Vector(2.0 / 9, 0), Angle::fromRadians(1),
-                           AngularVelocity::fromRadians(1.0 / 9),
-                           Timestamp::fromSeconds(9)));
-    EXPECT_EQ(op_robot.value(), robot_filter.getFilteredData(new_robot_data).value());
+        {1, Point(0.1, 0), Angle::fromRadians(0.1), 0.5, Timestamp::fromSeconds(0.1)}};
+
+    Robot filtered_robot = robot_filter.getFilteredData(new_robot_data).value();
+
+    // The initial velocity is uncertain, so the filter should trust the detection
+    EXPECT_TRUE(
+        TestUtil::equalWithinTolerance(Point(0.1, 0), filtered_robot.position(), 0.001));
+    EXPECT_NEAR(0.1, filtered_robot.orientation().toRadians(), 0.01);
+    EXPECT_GT(filtered_robot.velocity().x(), 0);
+    EXPECT_GT(filtered_robot.angularVelocity().toRadians(), 0);
+    EXPECT_EQ(Timestamp::fromSeconds(0.1), filtered_robot.timestamp());
 }
 
-TEST(RobotFilterTest, two_match_robot_data_robot_state_not_expired_test)
+TEST(RobotFilterTest, two_match_robot_data_from_different_cameras_test)
 {
     Robot robot(1, Point(0, 0), Vector(0, 0), Angle::fromRadians(0),
                 AngularVelocity::fromRadians(0), Timestamp::fromSeconds(0));
     RobotFilter robot_filter(robot, Duration::fromSeconds(10));
+    // Two cameras seeing the robot at the same time, with slightly different positions
     std::vector<RobotDetection> new_robot_data = {
-        {1, Point(1.5, 0), Angle::fromRadians(0.75), 0.5, Timestamp::fromSeconds(8.5)},
-        {1, Point(2.5, 0), Angle::fromRadians(1.25), 0.5, Timestamp::fromSeconds(9.5)}};
-    std::optional<Robot> op_robot;
-    op_robot.emplace(Robot(1, Point(2, 0), Vector(2.0 / 9, 0), Angle::fromRadians(1),
-                           AngularVelocity::fromRadians(1.0 / 9),
-                           Timestamp::fromSeconds(9)));
-    EXPECT_EQ(op_robot.value(), robot_filter.getFilteredData(new_robot_data).value());
+        {1, Point(0.098, 0), Angle::fromRadians(0), 0.5, Timestamp::fromSeconds(0.1)},
+        {1, Point(0.102, 0), Angle::fromRadians(0), 0.5, Timestamp::fromSeconds(0.1)}};
+
+    Robot filtered_robot = robot_filter.getFilteredData(new_robot_data).value();
+
+    EXPECT_TRUE(
+        TestUtil::equalWithinTolerance(Point(0.1, 0), filtered_robot.position(), 0.001));
+    EXPECT_EQ(Timestamp::fromSeconds(0.1), filtered_robot.timestamp());
+}
+
+TEST(RobotFilterTest, old_robot_data_is_ignored_test)
+{
+    Robot robot(1, Point(0, 0), Vector(0, 0), Angle::fromRadians(0),
+                AngularVelocity::fromRadians(0), Timestamp::fromSeconds(1));
+    RobotFilter robot_filter(robot, Duration::fromSeconds(10));
+    std::vector<RobotDetection> new_robot_data = {
+        {1, Point(2, 0), Angle::fromRadians(1), 0.5, Timestamp::fromSeconds(0.5)}};
+
+    EXPECT_EQ(robot, robot_filter.getFilteredData(new_robot_data).value());
+}
+
+TEST(RobotFilterTest, moving_and_rotating_robot_with_noise_test)
+{
+    // Use a constant seed so results are deterministic
+    std::mt19937 random_generator(1);
+    std::normal_distribution<double> position_noise(
+        0, RobotFilter::POSITION_MEASUREMENT_STDDEV);
+    std::normal_distribution<double> orientation_noise(
+        0, RobotFilter::ORIENTATION_MEASUREMENT_STDDEV);
+
+    Vector velocity(1.0, -0.5);
+    AngularVelocity angular_velocity = AngularVelocity::fromRadians(3.0);
+    Robot robot(1, Point(0, 0), Vector(0, 0), Angle::zero(), AngularVelocity::zero(),
+                Timestamp::fromSeconds(0));
+    RobotFilter robot_filter(robot, Duration::fromSeconds(10));
+
+    double squared_position_errors         = 0;
+    double squared_velocity_errors         = 0;
+    double squared_orientation_errors      = 0;
+    double squared_angular_velocity_errors = 0;
+    unsigned int num_steps                 = 180;
+    // Give the filter a second to converge before measuring the error
+    unsigned int num_warmup_steps = 60;
+
+    // Rotate through +-pi multiple times to make sure the angular velocity stays
+    // continuous when the detected orientation wraps around
+    for (unsigned int i = 1; i <= num_steps; i++)
+    {
+        Timestamp timestamp = Timestamp::fromSeconds(i / 60.0);
+        Point position      = Point(velocity * timestamp.toSeconds());
+        Angle orientation   = angular_velocity * timestamp.toSeconds();
+        std::vector<RobotDetection> new_robot_data = {
+            {1,
+             position + Vector(position_noise(random_generator),
+                               position_noise(random_generator)),
+             (orientation + Angle::fromRadians(orientation_noise(random_generator)))
+                 .clamp(),
+             0.5, timestamp}};
+
+        Robot filtered_robot = robot_filter.getFilteredData(new_robot_data).value();
+
+        if (i > num_warmup_steps)
+        {
+            Angle orientation_error =
+                (filtered_robot.orientation() - orientation).clamp();
+            AngularVelocity angular_velocity_error =
+                filtered_robot.angularVelocity() - angular_velocity;
+
+            squared_position_errors +=
+                (filtered_robot.position() - position).lengthSquared();
+            squared_velocity_errors +=
+                (filtered_robot.velocity() - velocity).lengthSquared();
+            squared_orientation_errors += std::pow(orientation_error.toRadians(), 2);
+            squared_angular_velocity_errors +=
+                std::pow(angular_velocity_error.toRadians(), 2);
+        }
+    }
+
+    // The filtered position should be more accurate than the detections (which have a
+    // 2D error of about 4.2mm), and the velocity much more accurate than the difference
+    // between consecutive detections
+    unsigned int num_samples = num_steps - num_warmup_steps;
+    EXPECT_LT(std::sqrt(squared_position_errors / num_samples), 0.004);
+    EXPECT_LT(std::sqrt(squared_velocity_errors / num_samples), 0.1);
+    EXPECT_LT(std::sqrt(squared_orientation_errors / num_samples), 0.02);
+    EXPECT_LT(std::sqrt(squared_angular_velocity_errors / num_samples), 0.5);
 }
 
 TEST(RobotFilterTest, large_positive_orientation_test)
@@ -64,12 +150,85 @@ TEST(RobotFilterTest, large_positive_orientation_test)
     std::vector<RobotDetection> new_robot_data = {
         {1, Point(0, 0), Angle::fromDegrees(359), 0.5, Timestamp::fromSeconds(1)}};
 
-    Robot expected_robot(1, Point(0, 0), Vector(0, 0), Angle::fromDegrees(359.0),
-                         AngularVelocity::fromDegrees(-2.0), Timestamp::fromSeconds(1));
     Robot filtered_robot = robot_filter.getFilteredData(new_robot_data).value();
 
+    // The robot turned 2 degrees clockwise past 0, not 358 degrees counterclockwise
+    EXPECT_NEAR(-1.0, filtered_robot.orientation().toDegrees(), 0.1);
+    EXPECT_LT(filtered_robot.angularVelocity().toDegrees(), 0);
+}
+
+TEST(RobotFilterTest, predict_state_test)
+{
+    Robot robot(1, Point(0, 0), Vector(0, 0), Angle::zero(), AngularVelocity::zero(),
+                Timestamp::fromSeconds(0));
+    RobotFilter robot_filter(robot, Duration::fromSeconds(10));
+    Vector velocity(1.0, 2.0);
+    for (unsigned int i = 1; i <= 60; i++)
+    {
+        Timestamp timestamp = Timestamp::fromSeconds(i / 60.0);
+        robot_filter.getFilteredData(
+            {{1, Point(velocity * timestamp.toSeconds()), Angle::zero(), 0.5,
+              timestamp}});
+    }
+
+    Robot predicted_robot = robot_filter.predictState(Timestamp::fromSeconds(1.05));
+
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(Point(velocity * 1.05),
+                                               predicted_robot.position(), 0.001));
+    EXPECT_TRUE(
+        TestUtil::equalWithinTolerance(velocity, predicted_robot.velocity(), 0.01));
+    EXPECT_EQ(Timestamp::fromSeconds(1.05), predicted_robot.timestamp());
+}
+
+TEST(RobotFilterTest, predict_state_is_limited_test)
+{
+    Robot robot(1, Point(0, 0), Vector(1, 0), Angle::zero(), AngularVelocity::zero(),
+                Timestamp::fromSeconds(0));
+    RobotFilter robot_filter(robot, Duration::fromSeconds(10));
+
+    Robot predicted_robot = robot_filter.predictState(Timestamp::fromSeconds(5));
+
     EXPECT_TRUE(TestUtil::equalWithinTolerance(
-        expected_robot.angularVelocity().toDegrees(),
-        filtered_robot.angularVelocity().toDegrees(), 1e-6));
-    EXPECT_EQ(expected_robot, filtered_robot);
+        Point(RobotFilter::MAX_PREDICTION_DURATION_SECONDS, 0),
+        predicted_robot.position(), 1e-9));
+    EXPECT_EQ(Timestamp::fromSeconds(RobotFilter::MAX_PREDICTION_DURATION_SECONDS),
+              predicted_robot.timestamp());
+}
+
+TEST(RobotFilterTest, predict_state_in_the_past_test)
+{
+    Robot robot(1, Point(1, 1), Vector(1, 0), Angle::zero(), AngularVelocity::zero(),
+                Timestamp::fromSeconds(1));
+    RobotFilter robot_filter(robot, Duration::fromSeconds(10));
+
+    EXPECT_EQ(robot, robot_filter.predictState(Timestamp::fromSeconds(0.5)));
+}
+
+TEST(RobotFilterTest, robot_detected_again_after_expiry_test)
+{
+    Robot robot(1, Point(0, 0), Vector(0, 0), Angle::zero(), AngularVelocity::zero(),
+                Timestamp::fromSeconds(0));
+    RobotFilter robot_filter(robot, Duration::fromSeconds(1));
+    for (unsigned int i = 1; i <= 60; i++)
+    {
+        Timestamp timestamp = Timestamp::fromSeconds(i / 60.0);
+        robot_filter.getFilteredData(
+            {{1, Point(timestamp.toSeconds(), 0), Angle::zero(), 0.5, timestamp}});
+    }
+
+    // The robot is taken off the field, and put back somewhere else after the expiry
+    // buffer duration
+    std::vector<RobotDetection> new_robot_data = {
+        {1, Point(-3, 2), Angle::quarter(), 0.5, Timestamp::fromSeconds(3)}};
+    Robot filtered_robot = robot_filter.getFilteredData(new_robot_data).value();
+
+    // The filter restarts from the new detection, instead of predicting the old motion
+    // across the gap
+    EXPECT_TRUE(
+        TestUtil::equalWithinTolerance(Point(-3, 2), filtered_robot.position(), 1e-9));
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(Vector(0, 0), filtered_robot.velocity(),
+                                               1e-9));
+    EXPECT_NEAR(Angle::quarter().toRadians(), filtered_robot.orientation().toRadians(),
+                1e-9);
+    EXPECT_EQ(Timestamp::fromSeconds(3), filtered_robot.timestamp());
 }
@@ -10,43 +10,86 @@ Team RobotTeamFilter::getFilteredData(
     const Team &current_team_state,
     const std::vector<RobotDetection> &new_robot_detections)
 {
-    // Add filters for any robot we haven't seen before
-    for (auto detection : new_robot_detections)
+    Team new_team_state = current_team_state;
+    updateTeam(new_team_state, new_robot_detections);
+    return new_team_state;
+}
+
+void RobotTeamFilter::updateTeam(Team &team_state,
+                                 const std::vector<RobotDetection> &new_robot_detections)
+{
+    // Group the detections by robot id in a single pass, so each robot filter only
+    // sees its own detections
+    Timestamp latest_detection_timestamp = Timestamp::fromSeconds(0);
+    for (const RobotDetection &detection : new_robot_detections)
     {
-        if (robot_filters.find(detection.id) == robot_filters.end())
+        latest_detection_timestamp =
+            std::max(latest_detection_timestamp, detection.timestamp);
+        if (detection.id >= MAX_ROBOT_IDS)
         {
-            robot_filters.insert(
-                {detection.id,
-                 RobotFilter(detection, Duration::fromMilliseconds(
-                                            ROBOT_DEBOUNCE_DURATION_MILLISECONDS))});
+            continue;
+        }
+
+        robot_detections_by_id[detection.id].push_back(detection);
+
+        // Add filters for any robot we haven't seen before
+        if (!robot_filters[detection.id])
+        {
+            robot_filters[detection.id].emplace(
+                detection,
+                Duration::fromMilliseconds(ROBOT_DEBOUNCE_DURATION_MILLISECONDS));
         }
     }
 
     // Get the filtered data for each robot from the robot filters. The robot filters
     // handle robot expiry (robots disappearing after not being detected for a while),
     // so we ignore any expired robots
-    std::vector<Robot> new_filtered_robot_data;
-    for (auto it = robot_filters.begin(); it != robot_filters.end(); it++)
+    filtered_robots.clear();
+    for (RobotId id = 0; id < MAX_ROBOT_IDS; id++)
     {
-        auto data = it->second.getFilteredData(new_robot_detections);
-        if (data)
+        if (!robot_filters[id])
         {
-            new_filtered_robot_data.emplace_back(*data);
+            continue;
         }
+
+        std::vector<RobotDetection> &robot_detections = robot_detections_by_id[id];
+        std::stable_sort(robot_detections.begin(), robot_detections.end());
+        std::optional<Robot> filtered_robot = robot_filters[id]->getFilteredData(
+            robot_detections, latest_detection_timestamp);
+        if (filtered_robot)
+        {
+            filtered_robots.emplace_back(*filtered_robot);
+        }
+        robot_detections.clear();
     }
 
-    Team new_team_state = current_team_state;
-    new_team_state.updateRobots(new_filtered_robot_data);
+    team_state.updateRobots(filtered_robots);
 
     // Using the most recent timestamp for the team, remove any robots that have not
     // been detected for a while
     // TODO: Mathew - The RobotFilter and Team are both handling expiry now?
     // Just the filter probably should
-    auto most_recent_team_timestamp = new_team_state.timestamp();
+    auto most_recent_team_timestamp = team_state.timestamp();
     if (most_recent_team_timestamp)
     {
-        new_team_state.removeExpiredRobots(*most_recent_team_timestamp);
+        team_state.removeExpiredRobots(*most_recent_team_timestamp);
     }
+}
 
-    return new_team_state;
+Team RobotTeamFilter::getPredictedTeam(const Team &current_team_state,
+                                       const Timestamp &timestamp) const
+{
+    std::vector<Robot> predicted_robots;
+    for (const Robot &robot : current_team_state.getAllRobots())
+    {
+        if (robot.id() < MAX_ROBOT_IDS && robot_filters[robot.id()])
+        {
+            predicted_robots.emplace_back(
+                robot_filters[robot.id()]->predictState(timestamp));
+        }
+    }
+
+    Team predicted_team_state = current_team_state;
+    predicted_team_state.updateRobots(predicted_robots);
+    return predicted_team_state;
 }
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <array>
+#include <optional>
+
 #include "software/constants.h"
 #include "software/geom/angle.h"
 #include "software/geom/point.h"
@@ -26,8 +29,39 @@ class RobotTeamFilter
     Team getFilteredData(const Team& current_team_state,
                          const std::vector<RobotDetection>& new_robot_detections);
 
+    /**
+     * Filters the new robot detection data, and updates the state of the team in place.
+     * Once the filter has seen every robot, this does not allocate any memory
+     *
+     * @param team_state The state of the Team to update
+     * @param new_robot_detections A list of new SSL Robot detections. Detections of
+     * robots with an id of MAX_ROBOT_IDS or greater are ignored
+     */
+    void updateTeam(Team& team_state,
+                    const std::vector<RobotDetection>& new_robot_detections);
 
-    // A map used to store a separate robot filter for each robot on this team, so
+    /**
+     * Returns the state the team is predicted to be in at the given timestamp. The
+     * robots are predicted by their robot filters, so the team should be the most
+     * recent team returned by getFilteredData
+     *
+     * @param current_team_state The current state of the Team
+     * @param timestamp The timestamp to predict the state of the team at
+     *
+     * @return The predicted state of the team
+     */
+    Team getPredictedTeam(const Team& current_team_state,
+                          const Timestamp& timestamp) const;
+
+   private:
+    // A separate robot filter for each robot on this team, indexed by robot id, so
     // each robot can be filtered and handled separately
-    std::map<int, RobotFilter> robot_filters;
+    std::array<std::optional<RobotFilter>, MAX_ROBOT_IDS> robot_filters;
+
+    // The new detections of each robot, indexed by robot id. These are kept between
+    // updates so their memory can be reused
+    std::array<std::vector<RobotDetection>, MAX_ROBOT_IDS> robot_detections_by_id;
+    // The filtered robots of the latest update, kept between updates so their memory
+    // can be reused
+    std::vector<Robot> filtered_robots;
 };
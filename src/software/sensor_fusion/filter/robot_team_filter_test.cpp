@@ -88,3 +88,68 @@ TEST(RobotTeamFilterTest, detections_with_different_times_test)
 
     EXPECT_EQ(1, new_team.numRobots());
 }
+
+TEST(RobotTeamFilterTest, get_predicted_team_test)
+{
+    Team old_team = Team(Duration::fromMilliseconds(1000));
+    RobotTeamFilter robot_team_filter;
+
+    std::vector<RobotDetection> robot_detections = {
+        {0, Point(1, 0), Angle::zero(), 1.0, Timestamp::fromSeconds(0.5)},
+        {1, Point(2, 0), Angle::zero(), 1.0, Timestamp::fromSeconds(0.5)}};
+    Team new_team = robot_team_filter.getFilteredData(old_team, robot_detections);
+
+    Team predicted_team =
+        robot_team_filter.getPredictedTeam(new_team, Timestamp::fromSeconds(0.55));
+
+    EXPECT_EQ(2, predicted_team.numRobots());
+    for (const Robot &robot : new_team.getAllRobots())
+    {
+        std::optional<Robot> predicted_robot = predicted_team.getRobotById(robot.id());
+        ASSERT_NE(std::nullopt, predicted_robot);
+        // The robots are stationary, so only the timestamp should change
+        EXPECT_EQ(robot.position(), predicted_robot->position());
+        EXPECT_EQ(Timestamp::fromSeconds(0.55), predicted_robot->timestamp());
+    }
+}
+
+TEST(RobotTeamFilterTest, update_team_in_place_test)
+{
+    Team team = Team(Duration::fromMilliseconds(1000));
+    RobotTeamFilter robot_team_filter;
+
+    std::vector<RobotDetection> robot_detections = {
+        {3, Point(1, 0), Angle::zero(), 1.0, Timestamp::fromSeconds(0.5)},
+        {7, Point(2, 0), Angle::zero(), 1.0, Timestamp::fromSeconds(0.5)}};
+    robot_team_filter.updateTeam(team, robot_detections);
+
+    EXPECT_EQ(2, team.numRobots());
+    ASSERT_NE(std::nullopt, team.getRobotById(3));
+    EXPECT_EQ(Point(1, 0), team.getRobotById(3)->position());
+    ASSERT_NE(std::nullopt, team.getRobotById(7));
+    EXPECT_EQ(Point(2, 0), team.getRobotById(7)->position());
+
+    // Only robot 3 is detected again, so robot 7 keeps its state
+    robot_detections = {
+        {3, Point(1.01, 0), Angle::zero(), 1.0, Timestamp::fromSeconds(0.52)}};
+    robot_team_filter.updateTeam(team, robot_detections);
+
+    EXPECT_EQ(2, team.numRobots());
+    EXPECT_EQ(Timestamp::fromSeconds(0.52), team.getRobotById(3)->timestamp());
+    EXPECT_GT(team.getRobotById(3)->position().x(), 1);
+    EXPECT_EQ(Timestamp::fromSeconds(0.5), team.getRobotById(7)->timestamp());
+}
+
+TEST(RobotTeamFilterTest, detections_with_invalid_id_are_ignored_test)
+{
+    Team team = Team(Duration::fromMilliseconds(1000));
+    RobotTeamFilter robot_team_filter;
+
+    std::vector<RobotDetection> robot_detections = {
+        {0, Point(1, 0), Angle::zero(), 1.0, Timestamp::fromSeconds(0.5)},
+        {MAX_ROBOT_IDS, Point(2, 0), Angle::zero(), 1.0, Timestamp::fromSeconds(0.5)}};
+    robot_team_filter.updateTeam(team, robot_detections);
+
+    EXPECT_EQ(1, team.numRobots());
+    EXPECT_NE(std::nullopt, team.getRobotById(0));
+}
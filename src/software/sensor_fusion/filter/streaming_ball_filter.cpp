@@ -0,0 +1,403 @@
+#include "software/sensor_fusion/filter/streaming_ball_filter.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "shared/constants.h"
+#include "software/geom/algorithms/closest_point.h"
+#include "software/geom/algorithms/contains.h"
+#include "software/math/math_functions.h"
+
+// If the spread of the x coordinates being fit is this small relative to their
+// magnitude, all the x coordinates are considered to be the same, and the line of best
+// fit is vertical
+static constexpr double MIN_RELATIVE_X_SPREAD = 1e-12;
+
+StreamingBallFilter::RegressionSums StreamingBallFilter::RegressionSums::operator+(
+    const RegressionSums &other) const
+{
+    return RegressionSums{n + other.n,           sum_x + other.sum_x,
+                          sum_y + other.sum_y,   sum_xx + other.sum_xx,
+                          sum_xy + other.sum_xy, sum_yy + other.sum_yy};
+}
+
+StreamingBallFilter::RegressionSums StreamingBallFilter::RegressionSums::operator-(
+    const RegressionSums &other) const
+{
+    return RegressionSums{n - other.n,           sum_x - other.sum_x,
+                          sum_y - other.sum_y,   sum_xx - other.sum_xx,
+                          sum_xy - other.sum_xy, sum_yy - other.sum_yy};
+}
+
+StreamingBallFilter::StreamingBallFilter()
+    : ball_detection_buffer(BallFilter::MAX_BUFFER_SIZE),
+      num_detections_since_sums_reset(0)
+{
+}
+
+std::optional<Ball> StreamingBallFilter::estimateBallState(
+    const std::vector<BallDetection> &new_ball_detections, const Rectangle &filter_area)
+{
+    // The detections must be processed in increasing order. They almost always arrive
+    // in order, so we only copy and sort them when they don't
+    if (std::is_sorted(new_ball_detections.begin(), new_ball_detections.end()))
+    {
+        for (const auto &detection : new_ball_detections)
+        {
+            addNewDetectionToBuffer(detection, filter_area);
+        }
+    }
+    else
+    {
+        std::vector<BallDetection> sorted_ball_detections = new_ball_detections;
+        std::sort(sorted_ball_detections.begin(), sorted_ball_detections.end());
+        for (const auto &detection : sorted_ball_detections)
+        {
+            addNewDetectionToBuffer(detection, filter_area);
+        }
+    }
+
+    return estimateBallStateFromBuffer();
+}
+
+void StreamingBallFilter::addNewDetectionToBuffer(const BallDetection &detection,
+                                                  const Rectangle &filter_area)
+{
+    // Remove any detections outside the filter area
+    if (!contains(filter_area, detection.position))
+    {
+        return;
+    }
+
+    if (ball_detection_buffer.empty())
+    {
+        // If there is no data in the buffer, we always add the new data
+        insertIntoBuffer(detection);
+        return;
+    }
+
+    // The buffer is sorted, so the oldest detection is always at the back. Using the
+    // smallest timestamp minimizes time_diffs of 0
+    const BallDetection &oldest_detection = ball_detection_buffer.back().detection;
+    Duration time_diff = detection.timestamp - oldest_detection.timestamp;
+
+    // Ignore any data from the past, and any data that is as old as the oldest
+    // data in the buffer since it provides no additional value. This also
+    // prevents division by 0 when calculating the estimated velocity
+    if (time_diff.toSeconds() <= 0)
+    {
+        return;
+    }
+
+    // If reaching the new detection from the oldest detection would require the ball
+    // to move much faster than it is allowed to, the new detection is likely noise. See
+    // BallFilter::addNewDetectionsToBuffer for details
+    double detection_distance = (detection.position - oldest_detection.position).length();
+    double estimated_detection_velocity_magnitude =
+        detection_distance / time_diff.toSeconds();
+    double maximum_acceptable_velocity_magnitude =
+        BALL_MAX_SPEED_METERS_PER_SECOND + BallFilter::MAX_ACCEPTABLE_BALL_SPEED_BUFFER;
+    if (estimated_detection_velocity_magnitude > maximum_acceptable_velocity_magnitude)
+    {
+        // Shrink the buffer so that it can start tracking the ball at its new location
+        // if we have lost track of it
+        ball_detection_buffer.pop_back();
+    }
+    else
+    {
+        insertIntoBuffer(detection);
+    }
+}
+
+void StreamingBallFilter::insertIntoBuffer(const BallDetection &detection)
+{
+    if (ball_detection_buffer.full())
+    {
+        ball_detection_buffer.pop_back();
+    }
+
+    // Find where the detection belongs to keep the buffer sorted from newest to oldest.
+    // This is almost always the front of the buffer
+    size_t index = 0;
+    while (index < ball_detection_buffer.size() &&
+           detection.timestamp < ball_detection_buffer[index].detection.timestamp)
+    {
+        index++;
+    }
+
+    RegressionSums sums = detectionSums(detection);
+    BufferEntry entry{detection, RegressionSums{0, 0, 0, 0, 0, 0}};
+    if (index < ball_detection_buffer.size())
+    {
+        entry.sums_before = cumulativeSums(ball_detection_buffer[index]);
+        // Any newer detections now also have the new detection before them
+        for (size_t i = 0; i < index; i++)
+        {
+            ball_detection_buffer[i].sums_before =
+                ball_detection_buffer[i].sums_before + sums;
+        }
+    }
+    else if (!ball_detection_buffer.empty())
+    {
+        // The new detection is the oldest, so we choose its sums so that the sums of the
+        // newer detections don't have to change
+        entry.sums_before = ball_detection_buffer.back().sums_before - sums;
+    }
+    ball_detection_buffer.insert(ball_detection_buffer.begin() + index, entry);
+
+    num_detections_since_sums_reset++;
+    if (num_detections_since_sums_reset >= BallFilter::MAX_BUFFER_SIZE)
+    {
+        resetRegressionSums();
+    }
+}
+
+void StreamingBallFilter::resetRegressionSums()
+{
+    RegressionSums sums{0, 0, 0, 0, 0, 0};
+    for (auto it = ball_detection_buffer.rbegin(); it != ball_detection_buffer.rend();
+         it++)
+    {
+        it->sums_before = sums;
+        sums            = cumulativeSums(*it);
+    }
+    num_detections_since_sums_reset = 0;
+}
+
+std::optional<Ball> StreamingBallFilter::estimateBallStateFromBuffer() const
+{
+    if (ball_detection_buffer.empty())
+    {
+        return std::nullopt;
+    }
+
+    const BallDetection &latest_detection = ball_detection_buffer.front().detection;
+    if (ball_detection_buffer.size() == 1)
+    {
+        // If there is only 1 entry in the buffer, we can't fit a regression line
+        // or calculate a velocity so we do our best with just the position
+        BallState ball_state(latest_detection.position, Vector(0, 0),
+                             latest_detection.distance_from_ground);
+        return Ball(ball_state, latest_detection.timestamp);
+    }
+
+    std::optional<size_t> adjusted_buffer_size = getAdjustedBufferSize();
+    if (!adjusted_buffer_size)
+    {
+        return std::nullopt;
+    }
+
+    auto regression = calculateLineOfBestFit(*adjusted_buffer_size);
+
+    // Project the most recent detection onto the line of best fit, since the ball must
+    // be travelling along it
+    Point filtered_position =
+        closestPoint(latest_detection.position, regression.regression_line);
+
+    std::optional<BallVelocityEstimate> estimated_velocity;
+    if (regression.regression_error < BallFilter::LINEAR_REGRESSION_ERROR_THRESHOLD)
+    {
+        estimated_velocity =
+            estimateBallVelocity(*adjusted_buffer_size, regression.regression_line);
+    }
+    else
+    {
+        estimated_velocity = estimateBallVelocity(*adjusted_buffer_size);
+    }
+    if (!estimated_velocity)
+    {
+        return std::nullopt;
+    }
+
+    BallState ball_state(filtered_position, estimated_velocity->average_velocity,
+                         latest_detection.distance_from_ground);
+    return Ball(ball_state, latest_detection.timestamp);
+}
+
+std::optional<size_t> StreamingBallFilter::getAdjustedBufferSize() const
+{
+    double buffer_size_velocity_magnitude_diff =
+        BallFilter::MAX_BUFFER_SIZE_VELOCITY_MAGNITUDE -
+        BallFilter::MIN_BUFFER_SIZE_VELOCITY_MAGNITUDE;
+
+    auto num_detections = static_cast<unsigned int>(ball_detection_buffer.size());
+    unsigned int max_buffer_size = std::min(BallFilter::MAX_BUFFER_SIZE, num_detections);
+    unsigned int min_buffer_size = std::min(BallFilter::MIN_BUFFER_SIZE, num_detections);
+    double buffer_size_diff      = max_buffer_size - min_buffer_size;
+
+    std::optional<BallVelocityEstimate> velocity_estimate =
+        estimateBallVelocity(ball_detection_buffer.size());
+    if (!velocity_estimate)
+    {
+        return std::nullopt;
+    }
+
+    // Between the min and max velocity magnitudes, we linearly scale the size of the
+    // buffer. See BallFilter::getAdjustedBufferSize for why the average of the min and
+    // max velocity magnitudes is used
+    double linear_offset = BallFilter::MIN_BUFFER_SIZE_VELOCITY_MAGNITUDE +
+                           (buffer_size_velocity_magnitude_diff / 2);
+    double linear_scaling_factor =
+        linear(velocity_estimate->min_max_magnitude_average, linear_offset,
+               buffer_size_velocity_magnitude_diff);
+
+    return static_cast<size_t>(
+        max_buffer_size -
+        static_cast<unsigned int>(std::floor(linear_scaling_factor * buffer_size_diff)));
+}
+
+StreamingBallFilter::LinearRegressionResults StreamingBallFilter::calculateLineOfBestFit(
+    size_t num_detections) const
+{
+    if (num_detections < 2 || num_detections > ball_detection_buffer.size())
+    {
+        throw std::invalid_argument("At least 2 elements required for linear regression");
+    }
+
+    RegressionSums sums = cumulativeSums(ball_detection_buffer.front()) -
+                          ball_detection_buffer[num_detections - 1].sums_before;
+    auto x_vs_y_regression = calculateLinearRegression(sums);
+
+    // Linear regression cannot fit a vertical line. To get around this, we fit two lines,
+    // one with x and y swapped, so any vertical line becomes horizontal. Then we take the
+    // line of the two that fit the best.
+    RegressionSums swapped_sums{sums.n,      sums.sum_y,  sums.sum_x,
+                                sums.sum_yy, sums.sum_xy, sums.sum_xx};
+    auto y_vs_x_regression = calculateLinearRegression(swapped_sums);
+    // Because we swapped the coordinates of the input, we have to swap the coordinates of
+    // the output to get back to our expected coordinate space
+    y_vs_x_regression.regression_line.swapXY();
+
+    // We use the regression from above with the least error
+    if (x_vs_y_regression.regression_error < y_vs_x_regression.regression_error)
+    {
+        return x_vs_y_regression;
+    }
+    else
+    {
+        return y_vs_x_regression;
+    }
+}
+
+StreamingBallFilter::LinearRegressionResults
+StreamingBallFilter::calculateLinearRegression(const RegressionSums &sums)
+{
+    double mean_x = sums.sum_x / sums.n;
+    double mean_y = sums.sum_y / sums.n;
+
+    // The sums of squares and products about the means
+    double centered_xx = sums.sum_xx - sums.sum_x * mean_x;
+    double centered_xy = sums.sum_xy - sums.sum_x * mean_y;
+    double centered_yy = sums.sum_yy - sums.sum_y * mean_y;
+
+    double intercept;
+    double slope;
+    double residual_sum_of_squares;
+    if (centered_xx <= MIN_RELATIVE_X_SPREAD * sums.sum_xx)
+    {
+        // Every line through the mean position fits equally well. The least-squares
+        // solver picks the one with the smallest coefficients, so we do the same
+        intercept               = mean_y / (1 + mean_x * mean_x);
+        slope                   = intercept * mean_x;
+        residual_sum_of_squares = centered_yy;
+    }
+    else
+    {
+        slope                   = centered_xy / centered_xx;
+        intercept               = mean_y - slope * mean_x;
+        residual_sum_of_squares = centered_yy - slope * centered_xy;
+    }
+
+    // The error is the norm of the residuals relative to the norm of the y coordinates,
+    // as in https://eigen.tuxfamily.org/dox/group__TutorialLinearAlgebra.html. If every
+    // y coordinate is 0, the line y = 0 fits perfectly
+    double regression_error = 0;
+    if (sums.sum_yy > 0)
+    {
+        regression_error =
+            std::sqrt(std::max(residual_sum_of_squares, 0.0) / sums.sum_yy);
+    }
+
+    // Find 2 points on the regression line that we solved for, and use this to construct
+    // our own Line class
+    Line regression_line(Point(0, intercept), Point(1, intercept + slope));
+
+    return LinearRegressionResults({regression_line, regression_error});
+}
+
+std::optional<StreamingBallFilter::BallVelocityEstimate>
+StreamingBallFilter::estimateBallVelocity(
+    size_t num_detections, const std::optional<Line> &ball_regression_line) const
+{
+    // Project the detection positions onto the regression line once if it was provided,
+    // rather than once for every pair of detections
+    std::array<Point, BallFilter::MAX_BUFFER_SIZE> positions;
+    for (size_t i = 0; i < num_detections; i++)
+    {
+        const Point &position = ball_detection_buffer[i].detection.position;
+        positions[i]          = ball_regression_line
+                           ? closestPoint(position, ball_regression_line.value())
+                           : position;
+    }
+
+    // Calculate the velocity between every pair of detections. The buffer is sorted from
+    // newest to oldest, so the older detection is the one with the larger index
+    unsigned int num_velocities   = 0;
+    Vector velocity_vector_sum    = Vector(0, 0);
+    double velocity_magnitude_sum = 0;
+    double velocity_magnitude_max = std::numeric_limits<double>::lowest();
+    double velocity_magnitude_min = std::numeric_limits<double>::max();
+    for (size_t older = 1; older < num_detections; older++)
+    {
+        for (size_t newer = 0; newer < older; newer++)
+        {
+            Duration time_diff = ball_detection_buffer[newer].detection.timestamp -
+                                 ball_detection_buffer[older].detection.timestamp;
+            // Avoid division by 0. If we have detections with the same timestamp the
+            // velocity cannot be calculated
+            if (time_diff.toSeconds() == 0)
+            {
+                continue;
+            }
+
+            Vector velocity_vector    = positions[newer] - positions[older];
+            double velocity_magnitude = velocity_vector.length() / time_diff.toSeconds();
+
+            num_velocities++;
+            velocity_vector_sum += velocity_vector.normalize(velocity_magnitude);
+            velocity_magnitude_sum += velocity_magnitude;
+            velocity_magnitude_max = std::max(velocity_magnitude_max, velocity_magnitude);
+            velocity_magnitude_min = std::min(velocity_magnitude_min, velocity_magnitude);
+        }
+    }
+
+    if (num_velocities == 0)
+    {
+        return std::nullopt;
+    }
+
+    double average_velocity_magnitude =
+        velocity_magnitude_sum / static_cast<double>(num_velocities);
+    double min_max_average = (velocity_magnitude_min + velocity_magnitude_max) / 2.0;
+    Vector average_velocity = velocity_vector_sum.normalize(average_velocity_magnitude);
+
+    return BallVelocityEstimate(
+        {average_velocity, average_velocity_magnitude, min_max_average});
+}
+
+StreamingBallFilter::RegressionSums StreamingBallFilter::detectionSums(
+    const BallDetection &detection)
+{
+    double x = detection.position.x();
+    double y = detection.position.y();
+    return RegressionSums{1, x, y, x * x, x * y, y * y};
+}
+
+StreamingBallFilter::RegressionSums StreamingBallFilter::cumulativeSums(
+    const BufferEntry &entry)
+{
+    return entry.sums_before + detectionSums(entry.detection);
+}
@@ -0,0 +1,204 @@
+#pragma once
+
+#include <boost/circular_buffer.hpp>
+#include <optional>
+
+#include "software/geom/line.h"
+#include "software/geom/point.h"
+#include "software/geom/rectangle.h"
+#include "software/sensor_fusion/filter/ball_filter.h"
+#include "software/sensor_fusion/filter/vision_detection.h"
+#include "software/time/timestamp.h"
+#include "software/world/ball.h"
+
+/**
+ * Given ball data from SSL Vision, filters and returns the position/velocity of the
+ * "real" ball.
+ *
+ * This filter produces the same estimates as the BallFilter, using the same parameters,
+ * but is designed to be run on every vision frame. The BallFilter copies and re-sorts
+ * its buffer several times per frame and solves two least-squares systems from scratch.
+ * Instead, this filter keeps its buffer sorted from newest to oldest detection as
+ * detections are added, and stores running sums of the detection positions alongside
+ * the buffer. The line of best fit through any number of the most recent detections can
+ * then be calculated in constant time for both the x vs y and y vs x orientations,
+ * without re-visiting the detections.
+ */
+class StreamingBallFilter
+{
+   public:
+    /**
+     * Creates a new Streaming Ball Filter
+     */
+    explicit StreamingBallFilter();
+
+    /**
+     * Update the filter with the new ball detection data, and returns the new
+     * estimated state of the ball given the new data
+     *
+     * @param new_ball_detections A list of new Ball detections
+     * @param filter_area The area within which the ball filter will work. Any detections
+     * outside of this area will be ignored.
+     *
+     * @return The new ball based on the estimated state of the ball given the new data.
+     * If a filtered result cannot be calculated, returns std::nullopt
+     */
+    std::optional<Ball> estimateBallState(
+        const std::vector<BallDetection>& new_ball_detections,
+        const Rectangle& filter_area);
+
+   private:
+    /**
+     * The sums of the detection positions needed to fit a line through them
+     */
+    struct RegressionSums
+    {
+        double n;
+        double sum_x;
+        double sum_y;
+        double sum_xx;
+        double sum_xy;
+        double sum_yy;
+
+        RegressionSums operator+(const RegressionSums& other) const;
+        RegressionSums operator-(const RegressionSums& other) const;
+    };
+
+    /**
+     * A ball detection in the buffer, along with the running sum of all the older
+     * detections, including those that have since been removed from the buffer. The sum
+     * of any range of entries is the difference between the running sums at each end
+     */
+    struct BufferEntry
+    {
+        BallDetection detection;
+        RegressionSums sums_before;
+    };
+
+    /**
+     * A simple struct we use to pass around velocity estimate data
+     */
+    struct BallVelocityEstimate
+    {
+        Vector average_velocity;
+        double average_velocity_magnitude;
+        // The average of the max velocity magnitude and min velocity magnitude
+        double min_max_magnitude_average;
+    };
+
+    /**
+     * A simple struct to pass around linear regression data
+     */
+    struct LinearRegressionResults
+    {
+        Line regression_line;
+        double regression_error;
+    };
+
+    /**
+     * Adds a ball detection to the buffer, if it is inside the filter_area, is newer
+     * than the oldest detection in the buffer, and is not too far away from the oldest
+     * detection to be the real ball. Detections that are too far away are treated as
+     * noise and remove the oldest detection from the buffer instead.
+     *
+     * @param detection The ball detection to try add to the buffer
+     * @param filter_area The area within which the ball filter will work
+     */
+    void addNewDetectionToBuffer(const BallDetection& detection,
+                                 const Rectangle& filter_area);
+
+    /**
+     * Inserts a detection into the buffer, keeping the buffer sorted from newest to
+     * oldest. If the buffer is full, the oldest detection is removed first. This is
+     * constant time unless the detection is older than the newest detection in the buffer
+     *
+     * @param detection The detection to insert
+     */
+    void insertIntoBuffer(const BallDetection& detection);
+
+    /**
+     * Recalculates the sums stored in the buffer entries, starting from the oldest entry.
+     * This is done periodically so that the running sums do not grow without bound and
+     * lose precision
+     */
+    void resetRegressionSums();
+
+    /**
+     * Uses linear regression to filter the detections in the buffer to find the
+     * current "real" state of the ball.
+     *
+     * @return The new ball based on the filtered state. If a filtered result cannot be
+     * calculated, returns std::nullopt
+     */
+    std::optional<Ball> estimateBallStateFromBuffer() const;
+
+    /**
+     * Returns how many of the most recent detections should be used to estimate the
+     * ball state, based on the ball's estimated velocity
+     *
+     * @return The number of detections to use. If an error occurs that prevents the
+     * size from being calculated correctly, returns std::nullopt
+     */
+    std::optional<size_t> getAdjustedBufferSize() const;
+
+    /**
+     * Returns the line of best fit through the positions of the most recent detections
+     * in the buffer, and the error of this regression. Also considers vertical lines.
+     *
+     * @param num_detections The number of most recent detections to fit. Must be at
+     * least 2
+     *
+     * @return The line of best fit through the given ball detection positions
+     */
+    LinearRegressionResults calculateLineOfBestFit(size_t num_detections) const;
+
+    /**
+     * Fits the line y = c0 + c1 * x through the positions described by the given sums,
+     * the same way the least-squares solution to the overdetermined system would be
+     * found, and calculates the error of this regression
+     *
+     * @param sums The sums of the positions to fit
+     *
+     * @return A struct containing the regression line and error of the linear regression
+     */
+    static LinearRegressionResults calculateLinearRegression(const RegressionSums& sums);
+
+    /**
+     * Estimates the ball's velocity based on the most recent detections in the buffer.
+     * If the ball_regression_line is provided, the detection positions are projected onto
+     * the line before the velocities are calculated.
+     *
+     * @param num_detections The number of most recent detections to use
+     * @param ball_regression_line The ball_regression_line to snap detections to before
+     * calculating velocities.
+     *
+     * @return A struct containing various estimates of the ball's velocity based on the
+     * given detections. If no velocity can be estimated, std::nullopt is returned
+     */
+    std::optional<BallVelocityEstimate> estimateBallVelocity(
+        size_t num_detections,
+        const std::optional<Line>& ball_regression_line = std::nullopt) const;
+
+    /**
+     * Returns the sums for a single detection
+     *
+     * @param detection The detection
+     *
+     * @return The sums containing only the given detection
+     */
+    static RegressionSums detectionSums(const BallDetection& detection);
+
+    /**
+     * Returns the sum of all detections in the buffer up to and including the given entry
+     *
+     * @param entry The buffer entry
+     *
+     * @return The sum of all detections up to and including the entry
+     */
+    static RegressionSums cumulativeSums(const BufferEntry& entry);
+
+    // The buffer of detections, sorted from newest to oldest
+    boost::circular_buffer<BufferEntry> ball_detection_buffer;
+    // How many detections have been added since the running sums were last reset
+    unsigned int num_detections_since_sums_reset;
+};
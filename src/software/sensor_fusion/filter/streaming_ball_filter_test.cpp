@@ -0,0 +1,215 @@
+#include "software/sensor_fusion/filter/streaming_ball_filter.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "software/sensor_fusion/filter/ball_filter.h"
+#include "software/test_util/test_util.h"
+#include "software/world/field.h"
+
+class StreamingBallFilterTest : public ::testing::Test
+{
+   protected:
+    StreamingBallFilterTest()
+        : field(Field::createSSLDivisionBField()),
+          start_time(Timestamp::fromSeconds(123)),
+          time_step(Duration::fromSeconds(1.0 / 60.0))
+    {
+    }
+
+    void SetUp() override
+    {
+        // Use a constant seed so results are deterministic
+        random_generator.seed(1);
+    }
+
+    /**
+     * Creates the ball detections that would be seen by vision for a ball that starts
+     * at ball_starting_position, travels with the given velocity, and is stopped and
+     * kicked again with kick_velocity halfway through. Each frame is seen by
+     * num_cameras cameras that capture the frame at slightly different times, and some
+     * frames contain a noisy detection far away from the ball.
+     *
+     * @param ball_starting_position The position the ball starts from
+     * @param ball_velocity The velocity of the ball during the first half
+     * @param kick_velocity The velocity of the ball during the second half
+     * @param ball_position_variance The variance in the noise the ball's position will
+     * be sampled with
+     * @param num_cameras The number of cameras that see the ball
+     * @param num_frames The number of frames to create
+     *
+     * @return A list of the ball detections for each frame
+     */
+    std::vector<std::vector<BallDetection>> createDetectionFrames(
+        const Point& ball_starting_position, const Vector& ball_velocity,
+        const Vector& kick_velocity, double ball_position_variance,
+        unsigned int num_cameras, unsigned int num_frames)
+    {
+        std::normal_distribution<double> position_noise_distribution(
+            0, ball_position_variance);
+        std::uniform_real_distribution<double> camera_delay_distribution(0, 0.002);
+        std::uniform_real_distribution<double> outlier_distribution(0, 1);
+
+        std::vector<std::vector<BallDetection>> detection_frames;
+        Point ball_position = ball_starting_position;
+        for (unsigned int i = 0; i < num_frames; i++)
+        {
+            Vector velocity = i < num_frames / 2 ? ball_velocity : kick_velocity;
+            ball_position   = ball_position + velocity * time_step.toSeconds();
+
+            std::vector<BallDetection> detections;
+            for (unsigned int camera = 0; camera < num_cameras; camera++)
+            {
+                Vector position_noise(position_noise_distribution(random_generator),
+                                      position_noise_distribution(random_generator));
+                Timestamp timestamp =
+                    start_time + Duration::fromSeconds(
+                                     i * time_step.toSeconds() +
+                                     camera_delay_distribution(random_generator));
+                detections.emplace_back(BallDetection{ball_position + position_noise, 0,
+                                                      timestamp, 0.9});
+            }
+            if (outlier_distribution(random_generator) < 0.05)
+            {
+                detections.emplace_back(BallDetection{
+                    Point(-ball_position.x(), -ball_position.y() + 1), 0,
+                    start_time + Duration::fromSeconds(i * time_step.toSeconds()), 0.5});
+            }
+            detection_frames.emplace_back(detections);
+        }
+        return detection_frames;
+    }
+
+    /**
+     * Runs the given detection frames through a BallFilter and a StreamingBallFilter,
+     * and checks that both filters return the same ball after every frame
+     *
+     * @param detection_frames The ball detections for each frame
+     */
+    void checkFiltersMatch(
+        const std::vector<std::vector<BallDetection>>& detection_frames)
+    {
+        BallFilter ball_filter;
+        StreamingBallFilter streaming_ball_filter;
+        for (const auto& detections : detection_frames)
+        {
+            auto ball = ball_filter.estimateBallState(detections, field.fieldBoundary());
+            auto streaming_ball = streaming_ball_filter.estimateBallState(
+                detections, field.fieldBoundary());
+
+            ASSERT_EQ(ball.has_value(), streaming_ball.has_value());
+            if (!ball)
+            {
+                continue;
+            }
+            EXPECT_EQ(ball->timestamp(), streaming_ball->timestamp());
+            // The BallFilter solves the regression with single precision floats, so the
+            // results can differ slightly. Detections from different cameras can be
+            // captured very close together, which results in large velocities, so the
+            // velocity tolerance is relative to the velocity
+            double velocity_tolerance = 1e-3 * std::max(1.0, ball->velocity().length());
+            EXPECT_TRUE(TestUtil::equalWithinTolerance(ball->position(),
+                                                       streaming_ball->position(), 1e-4));
+            EXPECT_TRUE(TestUtil::equalWithinTolerance(
+                ball->velocity(), streaming_ball->velocity(), velocity_tolerance));
+        }
+    }
+
+    Field field;
+    Timestamp start_time;
+    Duration time_step;
+    std::mt19937 random_generator;
+};
+
+TEST_F(StreamingBallFilterTest, no_detections)
+{
+    StreamingBallFilter streaming_ball_filter;
+    EXPECT_FALSE(streaming_ball_filter.estimateBallState({}, field.fieldBoundary()));
+}
+
+TEST_F(StreamingBallFilterTest, single_detection)
+{
+    StreamingBallFilter streaming_ball_filter;
+    auto ball = streaming_ball_filter.estimateBallState(
+        {BallDetection{Point(1, 2), 0.1, start_time, 0.9}}, field.fieldBoundary());
+
+    ASSERT_TRUE(ball);
+    EXPECT_EQ(Point(1, 2), ball->position());
+    EXPECT_EQ(Vector(0, 0), ball->velocity());
+    EXPECT_EQ(start_time, ball->timestamp());
+}
+
+TEST_F(StreamingBallFilterTest, detection_outside_filter_area_is_ignored)
+{
+    StreamingBallFilter streaming_ball_filter;
+    auto ball = streaming_ball_filter.estimateBallState(
+        {BallDetection{Point(100, 0), 0, start_time, 0.9}}, field.fieldBoundary());
+
+    EXPECT_FALSE(ball);
+}
+
+TEST_F(StreamingBallFilterTest, matches_ball_filter_for_stationary_ball)
+{
+    checkFiltersMatch(
+        createDetectionFrames(Point(1, -2), Vector(0, 0), Vector(0, 0), 0.001, 1, 300));
+}
+
+TEST_F(StreamingBallFilterTest, matches_ball_filter_for_stationary_ball_without_noise)
+{
+    checkFiltersMatch(
+        createDetectionFrames(Point(1, -2), Vector(0, 0), Vector(0, 0), 0, 1, 300));
+}
+
+TEST_F(StreamingBallFilterTest, matches_ball_filter_for_ball_moving_along_x_axis)
+{
+    checkFiltersMatch(
+        createDetectionFrames(Point(-4, 0), Vector(3, 0), Vector(1, 0), 0.001, 1, 300));
+}
+
+TEST_F(StreamingBallFilterTest, matches_ball_filter_for_ball_moving_along_y_axis)
+{
+    checkFiltersMatch(createDetectionFrames(Point(0, -2.5), Vector(0, 2), Vector(0, 0.5),
+                                            0.001, 1, 300));
+}
+
+TEST_F(StreamingBallFilterTest, matches_ball_filter_for_ball_that_is_kicked)
+{
+    checkFiltersMatch(createDetectionFrames(Point(2, 1), Vector(0, 0), Vector(-5, -1.5),
+                                            0.002, 1, 200));
+}
+
+TEST_F(StreamingBallFilterTest, matches_ball_filter_with_multiple_cameras)
+{
+    checkFiltersMatch(createDetectionFrames(Point(-3, 2), Vector(2, -1), Vector(-1, 0.2),
+                                            0.002, 4, 300));
+}
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST_F(StreamingBallFilterTest, DISABLED_streaming_ball_filter_speed_test)
+{
+    auto detection_frames = createDetectionFrames(Point(-3, 2), Vector(2, -1),
+                                                  Vector(-1, 0.2), 0.002, 2, 6000);
+
+    BallFilter ball_filter;
+    auto start_time = std::chrono::system_clock::now();
+    for (const auto& detections : detection_frames)
+    {
+        ball_filter.estimateBallState(detections, field.fieldBoundary());
+    }
+    double ball_filter_duration_ms = TestUtil::millisecondsSince(start_time);
+
+    StreamingBallFilter streaming_ball_filter;
+    start_time = std::chrono::system_clock::now();
+    for (const auto& detections : detection_frames)
+    {
+        streaming_ball_filter.estimateBallState(detections, field.fieldBoundary());
+    }
+    double streaming_ball_filter_duration_ms = TestUtil::millisecondsSince(start_time);
+
+    std::cout << "Took " << ball_filter_duration_ms / detection_frames.size()
+              << "ms per frame with the BallFilter, and "
+              << streaming_ball_filter_duration_ms / detection_frames.size()
+              << "ms per frame with the StreamingBallFilter" << std::endl;
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "software/geom/angle.h"
 #include "software/geom/point.h"
 #include "software/time/timestamp.h"
@@ -46,3 +48,18 @@ struct BallDetection
         return timestamp < b.timestamp;
     }
 };
+
+/**
+ * A lightweight datatype containing all the detections of a single camera frame. This
+ * is used to input detections that are created in the same process (ex. by the
+ * simulator) without going through SSLProto::SSL_DetectionFrame
+ */
+struct VisionDetectionFrame
+{
+    unsigned int camera_id;
+    // The timestamp for when the camera frame was captured
+    Timestamp t_capture;
+    std::vector<BallDetection> ball_detections;
+    std::vector<RobotDetection> yellow_robot_detections;
+    std::vector<RobotDetection> blue_robot_detections;
+};
@@ -13,6 +13,12 @@ SensorFusion::SensorFusion(TbotsProto::SensorFusionConfig sensor_fusion_config)
       ball_filter(),
       friendly_team_filter(),
       enemy_team_filter(),
+      enemy_open_circle_finder(),
+      camera_frame_merger(
+          Duration::fromSeconds(sensor_fusion_config.camera_frame_merge_window_seconds()),
+          Duration::fromSeconds(
+              sensor_fusion_config.max_camera_frame_merge_delay_seconds())),
+      num_filtered_detection_frames(0),
       possession(TeamPossession::FRIENDLY_TEAM),
       possession_tracker(std::make_shared<PossessionTracker>(
           sensor_fusion_config.possession_tracker_config())),
@@ -26,10 +32,34 @@ SensorFusion::SensorFusion(TbotsProto::SensorFusionConfig sensor_fusion_config)
 }
 
 std::optional<World> SensorFusion::getWorld() const
+{
+    return createWorld(friendly_team, enemy_team);
+}
+
+std::optional<World> SensorFusion::getPredictedWorld(const Timestamp &timestamp) const
+{
+    return createWorld(friendly_team_filter.getPredictedTeam(friendly_team, timestamp),
+                       enemy_team_filter.getPredictedTeam(enemy_team, timestamp));
+}
+
+unsigned int SensorFusion::getNumFilteredDetectionFrames() const
+{
+    return num_filtered_detection_frames;
+}
+
+const VisionDetectionFrameMerger::Statistics &
+SensorFusion::getCameraFrameMergeStatistics() const
+{
+    return camera_frame_merger.getStatistics();
+}
+
+std::optional<World> SensorFusion::createWorld(const Team &friendly_team_state,
+                                               const Team &enemy_team_state) const
 {
     if (field && ball)
     {
-        World new_world(*field, *ball, friendly_team, enemy_team);
+        World new_world(*field, *ball, friendly_team_state, enemy_team_state);
+        new_world.setEnemyOpenCircleFinder(enemy_open_circle_finder);
         new_world.updateGameState(game_state);
         new_world.setTeamWithPossession(possession);
         if (referee_stage)
@@ -59,6 +89,28 @@ void SensorFusion::processSensorProto(const SensorProto &sensor_msg)
 
     updateWorld(sensor_msg.robot_status_msgs());
 
+    assignGoalies();
+}
+
+void SensorFusion::processVisionDetectionFrame(
+    const VisionDetectionFrame &detection_frame)
+{
+    if (checkForVisionReset(detection_frame.t_capture.toSeconds()))
+    {
+        LOG(WARNING) << "Vision reset detected... Resetting SensorFusion!";
+        // The field geometry can't be processed again like it is for SSL Wrapper
+        // Packets, so the last field is kept
+        std::optional<Field> last_field = field;
+        resetWorldComponents();
+        field = last_field;
+    }
+    updateWorld(detection_frame);
+
+    assignGoalies();
+}
+
+void SensorFusion::assignGoalies()
+{
     friendly_team.assignGoalie(friendly_goalie_id);
     enemy_team.assignGoalie(enemy_goalie_id);
 
@@ -182,47 +234,89 @@ void SensorFusion::updateWorld(
 
 void SensorFusion::updateWorld(const SSLProto::SSL_DetectionFrame &ssl_detection_frame)
 {
+    VisionDetectionFrame detection_frame{
+        .camera_id       = ssl_detection_frame.camera_id(),
+        .t_capture       = Timestamp::fromSeconds(ssl_detection_frame.t_capture()),
+        .ball_detections = createBallDetections({ssl_detection_frame}),
+        .yellow_robot_detections =
+            createTeamDetection({ssl_detection_frame}, TeamColour::YELLOW),
+        .blue_robot_detections =
+            createTeamDetection({ssl_detection_frame}, TeamColour::BLUE)};
+    updateWorld(detection_frame);
+}
+
+void SensorFusion::updateWorld(const VisionDetectionFrame &detection_frame)
+{
+    if (!sensor_fusion_config.merge_camera_frames())
+    {
+        filterDetectionFrame(detection_frame);
+        return;
+    }
+
+    camera_frame_merger.addDetectionFrame(detection_frame);
+    for (const VisionDetectionFrame &merged_frame : camera_frame_merger.popMergedFrames())
+    {
+        filterDetectionFrame(merged_frame);
+    }
+}
+
+void SensorFusion::filterDetectionFrame(const VisionDetectionFrame &detection_frame)
+{
+    num_filtered_detection_frames++;
+
     double min_valid_x              = sensor_fusion_config.min_valid_x();
     double max_valid_x              = sensor_fusion_config.max_valid_x();
     bool ignore_invalid_camera_data = sensor_fusion_config.ignore_invalid_camera_data();
     bool friendly_team_is_yellow    = sensor_fusion_config.friendly_color_yellow();
 
-    std::optional<Ball> new_ball;
-    auto ball_detections = createBallDetections({ssl_detection_frame}, min_valid_x,
-                                                max_valid_x, ignore_invalid_camera_data);
-    auto yellow_team =
-        createTeamDetection({ssl_detection_frame}, TeamColour::YELLOW, min_valid_x,
-                            max_valid_x, ignore_invalid_camera_data);
-    auto blue_team =
-        createTeamDetection({ssl_detection_frame}, TeamColour::BLUE, min_valid_x,
-                            max_valid_x, ignore_invalid_camera_data);
+    auto is_valid = [&](const Point &position) {
+        return !ignore_invalid_camera_data ||
+               (min_valid_x <= position.x() && max_valid_x >= position.x());
+    };
 
-    if (defending_positive_side)
+    std::vector<BallDetection> ball_detections;
+    for (const auto &detection : detection_frame.ball_detections)
     {
-        for (auto &detection : ball_detections)
-        {
-            detection = invert(detection);
-        }
-        for (auto &detection : yellow_team)
-        {
-            detection = invert(detection);
-        }
-        for (auto &detection : blue_team)
+        if (is_valid(detection.position))
         {
-            detection = invert(detection);
+            ball_detections.push_back(defending_positive_side ? invert(detection)
+                                                              : detection);
         }
     }
 
+    auto filter_team_detections =
+        [&](const std::vector<RobotDetection> &robot_detections) {
+            std::vector<RobotDetection> team_detections;
+            for (const auto &detection : robot_detections)
+            {
+                if (is_valid(detection.position))
+                {
+                    team_detections.push_back(
+                        defending_positive_side ? invert(detection) : detection);
+                }
+            }
+            return team_detections;
+        };
+    auto yellow_team = filter_team_detections(detection_frame.yellow_robot_detections);
+    auto blue_team   = filter_team_detections(detection_frame.blue_robot_detections);
+
     if (friendly_team_is_yellow)
     {
-        friendly_team = createFriendlyTeam(yellow_team);
-        enemy_team    = createEnemyTeam(blue_team);
+        friendly_team_filter.updateTeam(friendly_team, yellow_team);
+        enemy_team_filter.updateTeam(enemy_team, blue_team);
     }
     else
     {
-        friendly_team = createFriendlyTeam(blue_team);
-        enemy_team    = createEnemyTeam(yellow_team);
+        friendly_team_filter.updateTeam(friendly_team, blue_team);
+        enemy_team_filter.updateTeam(enemy_team, yellow_team);
+    }
+
+    std::vector<Point> enemy_locations;
+    for (const Robot &robot : enemy_team.getAllRobots())
+    {
+        enemy_locations.emplace_back(robot.position());
     }
+    enemy_open_circle_finder.update(enemy_locations);
 
     ball_in_dribbler_timeout--;
     if (ball_in_dribbler_timeout <= 0)
@@ -247,7 +341,7 @@ void SensorFusion::updateWorld(const SSLProto::SSL_DetectionFrame &ssl_detection
                         .normalize(DIST_TO_FRONT_OF_ROBOT_METERS +
                                    BALL_TO_FRONT_OF_ROBOT_DISTANCE_WHEN_DRIBBLING),
                 .distance_from_ground = 0,
-                .timestamp  = Timestamp::fromSeconds(ssl_detection_frame.t_capture()),
+                .timestamp  = detection_frame.t_capture,
                 .confidence = 1}};
 
             std::optional<Ball> new_ball = createBall(dribbler_in_ball_detection);
@@ -307,19 +401,6 @@ std::optional<Ball> SensorFusion::createBall(
     return std::nullopt;
 }
 
-Team SensorFusion::createFriendlyTeam(const std::vector<RobotDetection> &robot_detections)
-{
-    Team new_friendly_team =
-        friendly_team_filter.getFilteredData(friendly_team, robot_detections);
-    return new_friendly_team;
-}
-
-Team SensorFusion::createEnemyTeam(const std::vector<RobotDetection> &robot_detections)
-{
-    Team new_enemy_team = enemy_team_filter.getFilteredData(enemy_team, robot_detections);
-    return new_enemy_team;
-}
-
 std::optional<Point> SensorFusion::getBallPlacementPoint(const SSLProto::Referee &packet)
 {
     std::optional<Point> point_opt = ::getBallPlacementPoint(packet);
@@ -390,14 +471,16 @@ bool SensorFusion::checkForVisionReset(double t_capture)
 
 void SensorFusion::resetWorldComponents()
 {
-    field                = std::nullopt;
-    ball                 = std::nullopt;
-    friendly_team        = Team();
-    enemy_team           = Team();
-    game_state           = GameState();
-    referee_stage        = std::nullopt;
-    ball_filter          = BallFilter();
-    friendly_team_filter = RobotTeamFilter();
-    enemy_team_filter    = RobotTeamFilter();
-    possession           = TeamPossession::FRIENDLY_TEAM;
+    field                    = std::nullopt;
+    ball                     = std::nullopt;
+    friendly_team            = Team();
+    enemy_team               = Team();
+    game_state               = GameState();
+    referee_stage            = std::nullopt;
+    ball_filter              = StreamingBallFilter();
+    friendly_team_filter     = RobotTeamFilter();
+    enemy_team_filter        = RobotTeamFilter();
+    enemy_open_circle_finder = OpenCircleFinder();
+    possession               = TeamPossession::FRIENDLY_TEAM;
+    camera_frame_merger.reset();
 }
@@ -7,10 +7,11 @@
 #include "proto/message_translation/ssl_referee.h"
 #include "proto/parameters.pb.h"
 #include "proto/sensor_msg.pb.h"
-#include "software/sensor_fusion/filter/ball_filter.h"
 #include "software/sensor_fusion/filter/robot_team_filter.h"
+#include "software/sensor_fusion/filter/streaming_ball_filter.h"
 #include "software/sensor_fusion/filter/vision_detection.h"
 #include "software/sensor_fusion/possession/possession_tracker.h"
+#include "software/sensor_fusion/vision_detection_frame_merger.h"
 #include "software/world/ball.h"
 #include "software/world/team.h"
 #include "software/world/world.h"
@@ -39,6 +40,19 @@ class SensorFusion
      */
     void processSensorProto(const SensorProto &sensor_msg);
 
+    /**
+     * Processes a new camera frame whose detections were created in the same process,
+     * which may update the latest representation of the World. This updates the World
+     * the same way a SensorProto containing the same detections would, but skips
+     * converting the detections to and from protobuf.
+     *
+     * Detection frames don't contain the field geometry, so a World is only created
+     * once a SensorProto with the field geometry has been processed
+     *
+     * @param detection_frame The detections of a single camera frame
+     */
+    void processVisionDetectionFrame(const VisionDetectionFrame &detection_frame);
+
     /**
      * Returns the most up-to-date world if enough data has been received
      * to create one.
@@ -48,6 +62,34 @@ class SensorFusion
      */
     std::optional<World> getWorld() const;
 
+    /**
+     * Returns the most up-to-date world, with every robot predicted forward to the given
+     * timestamp. The filtered world is as of the most recent camera frame, so this is
+     * used to get the state of the robots at the time the world is acted on (ex. when
+     * the AI ticks)
+     *
+     * @param timestamp The timestamp to predict the robots at
+     *
+     * @return the predicted world if enough data has been received to create one
+     */
+    std::optional<World> getPredictedWorld(const Timestamp &timestamp) const;
+
+    /**
+     * Returns the number of detection frames that have been run through the filters.
+     * When camera frames are merged, this is the number of merged frames, so it changes
+     * at most once per capture instead of once per camera frame
+     *
+     * @return the number of detection frames that have been run through the filters
+     */
+    unsigned int getNumFilteredDetectionFrames() const;
+
+    /**
+     * Returns statistics about merging camera frames, including the merge latency
+     *
+     * @return statistics about merging camera frames
+     */
+    const VisionDetectionFrameMerger::Statistics &getCameraFrameMergeStatistics() const;
+
     // Number of vision packets to indicate that the vision client most likely reset,
     // determined experimentally with the simulator
     static constexpr unsigned int VISION_PACKET_RESET_COUNT_THRESHOLD = 5;
@@ -67,6 +109,33 @@ class SensorFusion
                          &robot_status_msgs);
     void updateWorld(const SSLProto::SSL_GeometryData &geometry_packet);
     void updateWorld(const SSLProto::SSL_DetectionFrame &ssl_detection_frame);
+    void updateWorld(const VisionDetectionFrame &detection_frame);
+
+    /**
+     * Runs the ball and robot filters on the detections of a camera frame, or a merged
+     * frame from multiple cameras
+     *
+     * @param detection_frame The detections to filter
+     */
+    void filterDetectionFrame(const VisionDetectionFrame &detection_frame);
+
+    /**
+     * Creates a world from the current state of the field, ball and game, and the given
+     * teams
+     *
+     * @param friendly_team_state The friendly team
+     * @param enemy_team_state The enemy team
+     *
+     * @return the world if enough data has been received to create one
+     */
+    std::optional<World> createWorld(const Team &friendly_team_state,
+                                     const Team &enemy_team_state) const;
+
+    /**
+     * Assigns the goalies of both teams, taking the goalie id overrides in the config
+     * into account
+     */
+    void assignGoalies();
 
     /**
      * Updates relevant components with a new ball
@@ -84,16 +153,6 @@ class SensorFusion
      */
     std::optional<Ball> createBall(const std::vector<BallDetection> &ball_detections);
 
-    /**
-     * Create team from a list of robot detections
-     *
-     * @param robot_detections The robot detections to filter
-     *
-     * @return team
-     */
-    Team createFriendlyTeam(const std::vector<RobotDetection> &robot_detections);
-    Team createEnemyTeam(const std::vector<RobotDetection> &robot_detections);
-
 
     /**
      * Get the ball placement point in our reference frame.
@@ -146,10 +205,17 @@ class SensorFusion
     GameState game_state;
     std::optional<RefereeStage> referee_stage;
 
-    BallFilter ball_filter;
+    StreamingBallFilter ball_filter;
     RobotTeamFilter friendly_team_filter;
     RobotTeamFilter enemy_team_filter;
 
+    // Kept across frames so that the triangulation of the enemy robots only has to be
+    // rebuilt when they move past each other. Every World gets a copy of it
+    OpenCircleFinder enemy_open_circle_finder;
+
+    VisionDetectionFrameMerger camera_frame_merger;
+    unsigned int num_filtered_detection_frames;
+
     TeamPossession possession;
     std::shared_ptr<PossessionTracker> possession_tracker;
 
@@ -496,6 +496,200 @@ TEST_F(SensorFusionTest, test_complete_wrapper_packet)
     EXPECT_EQ(initWorld(), result);
 }
 
+TEST_F(SensorFusionTest, test_predicted_world)
+{
+    EXPECT_EQ(std::nullopt, sensor_fusion.getPredictedWorld(current_time));
+
+    SensorProto sensor_msg;
+    auto ssl_wrapper_packet =
+        createSSLWrapperPacket(std::move(geom_data), initDetectionFrame());
+    *(sensor_msg.mutable_ssl_vision_msg()) = *ssl_wrapper_packet;
+    sensor_fusion.processSensorProto(sensor_msg);
+
+    World world = *sensor_fusion.getWorld();
+    Timestamp prediction_timestamp =
+        world.getMostRecentTimestamp() + Duration::fromSeconds(0.05);
+    std::optional<World> predicted_world =
+        sensor_fusion.getPredictedWorld(prediction_timestamp);
+    ASSERT_TRUE(predicted_world);
+
+    // The robots have only been seen once so they are stationary, and only their
+    // timestamps are moved forward
+    EXPECT_EQ(world.friendlyTeam().numRobots(),
+              predicted_world->friendlyTeam().numRobots());
+    for (const Robot &robot : world.friendlyTeam().getAllRobots())
+    {
+        std::optional<Robot> predicted_robot =
+            predicted_world->friendlyTeam().getRobotById(robot.id());
+        ASSERT_TRUE(predicted_robot);
+        EXPECT_EQ(robot.position(), predicted_robot->position());
+        EXPECT_EQ(prediction_timestamp, predicted_robot->timestamp());
+    }
+    EXPECT_EQ(world.enemyTeam().numRobots(), predicted_world->enemyTeam().numRobots());
+    EXPECT_EQ(world.ball(), predicted_world->ball());
+}
+
+TEST_F(SensorFusionTest, enemy_open_circle_finder_is_kept_across_frames)
+{
+    SensorProto sensor_msg;
+    auto ssl_wrapper_packet = createSSLWrapperPacket(
+        std::move(geom_data), std::unique_ptr<SSLProto::SSL_DetectionFrame>());
+    *(sensor_msg.mutable_ssl_vision_msg()) = *ssl_wrapper_packet;
+    sensor_fusion.processSensorProto(sensor_msg);
+
+    const unsigned int num_frames = 5;
+    for (unsigned int frame = 0; frame < num_frames; frame++)
+    {
+        Timestamp t_capture = current_time + Duration::fromMilliseconds(16 * frame);
+
+        // The enemy robots drift a little every frame without moving past each other
+        std::vector<RobotDetection> enemy_detections;
+        for (const RobotStateWithId &state : blue_robot_states)
+        {
+            enemy_detections.push_back(RobotDetection{
+                .id          = state.id,
+                .position    = state.robot_state.position() + Vector(0.01 * frame, 0),
+                .orientation = state.robot_state.orientation(),
+                .confidence  = 1.0,
+                .timestamp   = t_capture});
+        }
+
+        BallDetection ball_detection{.position             = Point(-0.2, 0.3),
+                                     .distance_from_ground = 0.0,
+                                     .timestamp            = t_capture,
+                                     .confidence           = 1.0};
+
+        sensor_fusion.processVisionDetectionFrame(VisionDetectionFrame{
+            .camera_id               = 0,
+            .t_capture               = t_capture,
+            .ball_detections         = {ball_detection},
+            .yellow_robot_detections = {},
+            .blue_robot_detections   = enemy_detections});
+    }
+
+    std::optional<World> world = sensor_fusion.getWorld();
+    ASSERT_TRUE(world);
+    ASSERT_TRUE(world->enemyOpenCircleFinder());
+
+    // The finder was updated with every frame (and once more by the World), but only
+    // had to triangulate the enemy robots once
+    EXPECT_EQ(num_frames + 1, world->enemyOpenCircleFinder()->getNumUpdates());
+    EXPECT_EQ(1, world->enemyOpenCircleFinder()->getNumRebuilds());
+
+    // The results must match a triangulation of the filtered enemy robots built from
+    // scratch
+    std::vector<Point> enemy_positions;
+    for (const Robot &robot : world->enemyTeam().getAllRobots())
+    {
+        enemy_positions.push_back(robot.position());
+    }
+    OpenCircleFinder expected_open_circle_finder;
+    expected_open_circle_finder.update(enemy_positions);
+    Rectangle field_lines = world->field().fieldLines();
+    std::vector<Circle> expected_open_circles =
+        expected_open_circle_finder.findOpenCircles(field_lines);
+    std::vector<Circle> open_circles =
+        world->enemyOpenCircleFinder()->findOpenCircles(field_lines);
+    ASSERT_EQ(expected_open_circles.size(), open_circles.size());
+    for (std::size_t i = 0; i < expected_open_circles.size(); i++)
+    {
+        EXPECT_NEAR(expected_open_circles[i].radius(), open_circles[i].radius(), 1e-6);
+    }
+}
+
+TEST_F(SensorFusionTest, test_vision_detection_frame_without_geometry)
+{
+    auto detection_frame = initDetectionFrame();
+    VisionDetectionFrame vision_detection_frame{
+        .camera_id       = detection_frame->camera_id(),
+        .t_capture       = current_time,
+        .ball_detections = createBallDetections({*detection_frame}),
+        .yellow_robot_detections =
+            createTeamDetection({*detection_frame}, TeamColour::YELLOW),
+        .blue_robot_detections =
+            createTeamDetection({*detection_frame}, TeamColour::BLUE)};
+
+    sensor_fusion.processVisionDetectionFrame(vision_detection_frame);
+    EXPECT_EQ(std::nullopt, sensor_fusion.getWorld());
+}
+
+TEST_F(SensorFusionTest, test_vision_detection_frame_after_geom_wrapper_packet)
+{
+    SensorProto sensor_msg;
+    auto ssl_wrapper_packet = createSSLWrapperPacket(
+        std::move(geom_data), std::unique_ptr<SSLProto::SSL_DetectionFrame>());
+    *(sensor_msg.mutable_ssl_vision_msg()) = *ssl_wrapper_packet;
+    sensor_fusion.processSensorProto(sensor_msg);
+
+    auto detection_frame = initDetectionFrame();
+    VisionDetectionFrame vision_detection_frame{
+        .camera_id       = detection_frame->camera_id(),
+        .t_capture       = current_time,
+        .ball_detections = createBallDetections({*detection_frame}),
+        .yellow_robot_detections =
+            createTeamDetection({*detection_frame}, TeamColour::YELLOW),
+        .blue_robot_detections =
+            createTeamDetection({*detection_frame}, TeamColour::BLUE)};
+
+    sensor_fusion.processVisionDetectionFrame(vision_detection_frame);
+    ASSERT_TRUE(sensor_fusion.getWorld());
+    World result = *sensor_fusion.getWorld();
+    EXPECT_EQ(initWorld(), result);
+}
+
+TEST_F(SensorFusionTest, test_merging_camera_frames)
+{
+    config.set_merge_camera_frames(true);
+    sensor_fusion = SensorFusion(config);
+
+    SensorProto sensor_msg;
+    auto ssl_wrapper_packet = createSSLWrapperPacket(
+        std::move(geom_data), std::unique_ptr<SSLProto::SSL_DetectionFrame>());
+    *(sensor_msg.mutable_ssl_vision_msg()) = *ssl_wrapper_packet;
+    sensor_fusion.processSensorProto(sensor_msg);
+
+    auto create_vision_detection_frame = [&](unsigned int camera_id,
+                                             const Timestamp &t_capture) {
+        auto detection_frame =
+            createSSLDetectionFrame(camera_id, t_capture, 0, {ball_state},
+                                    yellow_robot_states, blue_robot_states);
+        return VisionDetectionFrame{
+            .camera_id       = camera_id,
+            .t_capture       = t_capture,
+            .ball_detections = createBallDetections({*detection_frame}),
+            .yellow_robot_detections =
+                createTeamDetection({*detection_frame}, TeamColour::YELLOW),
+            .blue_robot_detections =
+                createTeamDetection({*detection_frame}, TeamColour::BLUE)};
+    };
+
+    // Only camera 0 has been seen, so its first frame isn't held back
+    sensor_fusion.processVisionDetectionFrame(
+        create_vision_detection_frame(0, current_time));
+    EXPECT_EQ(1, sensor_fusion.getNumFilteredDetectionFrames());
+    ASSERT_TRUE(sensor_fusion.getWorld());
+
+    // Camera 1's frame is held back until camera 0 moves past it
+    sensor_fusion.processVisionDetectionFrame(
+        create_vision_detection_frame(1, current_time + Duration::fromMilliseconds(1)));
+    EXPECT_EQ(1, sensor_fusion.getNumFilteredDetectionFrames());
+    sensor_fusion.processVisionDetectionFrame(
+        create_vision_detection_frame(0, current_time + Duration::fromMilliseconds(17)));
+    EXPECT_EQ(2, sensor_fusion.getNumFilteredDetectionFrames());
+
+    // Both cameras have now contributed to the frame, so it is filtered
+    sensor_fusion.processVisionDetectionFrame(
+        create_vision_detection_frame(1, current_time + Duration::fromMilliseconds(18)));
+    EXPECT_EQ(3, sensor_fusion.getNumFilteredDetectionFrames());
+    EXPECT_EQ(2, sensor_fusion.getCameraFrameMergeStatistics().last_num_cameras_merged);
+
+    World world = *sensor_fusion.getWorld();
+    EXPECT_EQ(current_time + Duration::fromMilliseconds(18),
+              world.getMostRecentTimestamp());
+    EXPECT_EQ(yellow_robot_states.size(), world.friendlyTeam().numRobots());
+    EXPECT_EQ(blue_robot_states.size(), world.enemyTeam().numRobots());
+}
+
 TEST_F(SensorFusionTest, test_robot_status_msg_packet)
 {
     SensorProto sensor_msg;
@@ -2,10 +2,15 @@
 
 #include <google/protobuf/util/message_differencer.h>
 
+#include "proto/message_translation/tbots_protobuf.h"
+#include "software/logger/logger.h"
+
 ThreadedSensorFusion::ThreadedSensorFusion(
     TbotsProto::SensorFusionConfig sensor_fusion_config)
     : FirstInFirstOutThreadedObserver<SensorProto>(DIFFERENT_GRSIM_FRAMES_RECEIVED),
-      sensor_fusion(sensor_fusion_config)
+      sensor_fusion(sensor_fusion_config),
+      sensor_fusion_config(sensor_fusion_config),
+      last_num_filtered_detection_frames(0)
 {
 }
 
@@ -18,7 +23,9 @@ void ThreadedSensorFusion::onValueReceived(TbotsProto::ThunderbotsConfig config)
     if (!google::protobuf::util::MessageDifferencer::Equivalent(
             config.sensor_fusion_config(), sensor_fusion_config))
     {
-        sensor_fusion = SensorFusion(config.sensor_fusion_config());
+        sensor_fusion_config               = config.sensor_fusion_config();
+        sensor_fusion                      = SensorFusion(sensor_fusion_config);
+        last_num_filtered_detection_frames = 0;
     }
 }
 
@@ -27,15 +34,47 @@ void ThreadedSensorFusion::onValueReceived(SensorProto sensor_msg)
     std::scoped_lock lock(sensor_fusion_mutex);
     sensor_fusion.processSensorProto(sensor_msg);
 
-    // Limit sensor fusion to only send out worlds on ssl wrapper packets
-    // to prevent spamming worlds every time a referee msg or robot status
-    // msg comes through.
-    if (sensor_msg.has_ssl_vision_msg())
+    // Limit sensor fusion to only send out worlds when new detections have been
+    // filtered, to prevent spamming worlds every time a referee msg or robot status msg
+    // comes through, or every time a camera frame is held back to be merged with the
+    // frames of other cameras
+    unsigned int num_filtered_detection_frames =
+        sensor_fusion.getNumFilteredDetectionFrames();
+    if (sensor_msg.has_ssl_vision_msg() &&
+        num_filtered_detection_frames != last_num_filtered_detection_frames)
     {
+        last_num_filtered_detection_frames = num_filtered_detection_frames;
+
         std::optional<World> world = sensor_fusion.getWorld();
+        double vision_latency_seconds =
+            sensor_fusion_config.vision_latency_compensation_seconds();
+        if (world && vision_latency_seconds > 0)
+        {
+            // The AI acts on the World one vision latency after the camera frame was
+            // captured, so the robots are predicted forward to when that happens.
+            // NOTE: The latency is the fixed, configured value and is not measured, so
+            // it has to be tuned for the vision setup, and does not follow changes in
+            // the latency while running
+            world = sensor_fusion.getPredictedWorld(
+                world->getMostRecentTimestamp() +
+                Duration::fromSeconds(vision_latency_seconds));
+        }
         if (world)
         {
             Subject<World>::sendValueToObservers(world.value());
         }
+
+        if (sensor_fusion_config.merge_camera_frames())
+        {
+            const VisionDetectionFrameMerger::Statistics& merge_statistics =
+                sensor_fusion.getCameraFrameMergeStatistics();
+            LOG(PLOTJUGGLER) << *createPlotJugglerValue({
+                {"camera_frame_merge_latency_ms",
+                 merge_statistics.last_merge_latency.toMilliseconds()},
+                {"num_cameras_merged", merge_statistics.last_num_cameras_merged},
+                {"num_reordered_camera_frames", merge_statistics.num_reordered_frames},
+                {"num_dropped_camera_frames", merge_statistics.num_dropped_frames},
+            });
+        }
     }
 }
@@ -22,6 +22,8 @@ class ThreadedSensorFusion
 
     SensorFusion sensor_fusion;
     TbotsProto::SensorFusionConfig sensor_fusion_config;
+    // The number of filtered detection frames when the last World was sent out
+    unsigned int last_num_filtered_detection_frames;
     static constexpr size_t DIFFERENT_GRSIM_FRAMES_RECEIVED = 4;
     std::mutex sensor_fusion_mutex;
 };
@@ -0,0 +1,143 @@
+#include "software/sensor_fusion/vision_detection_frame_merger.h"
+
+#include <algorithm>
+#include <cmath>
+
+VisionDetectionFrameMerger::VisionDetectionFrameMerger(const Duration& merge_window,
+                                                       const Duration& max_merge_delay)
+    : merge_window(merge_window), max_merge_delay(max_merge_delay)
+{
+}
+
+void VisionDetectionFrameMerger::addDetectionFrame(
+    const VisionDetectionFrame& detection_frame)
+{
+    const Timestamp& t_capture = detection_frame.t_capture;
+    if (last_released_t_capture && t_capture <= *last_released_t_capture)
+    {
+        statistics.num_dropped_frames++;
+        return;
+    }
+
+    auto latest_camera_t_capture =
+        latest_t_capture_by_camera.find(detection_frame.camera_id);
+    if (latest_camera_t_capture == latest_t_capture_by_camera.end())
+    {
+        latest_t_capture_by_camera.emplace(detection_frame.camera_id, t_capture);
+    }
+    else
+    {
+        latest_camera_t_capture->second =
+            std::max(latest_camera_t_capture->second, t_capture);
+    }
+
+    if (latest_t_capture && t_capture < *latest_t_capture)
+    {
+        statistics.num_reordered_frames++;
+    }
+    latest_t_capture = latest_t_capture ? std::max(*latest_t_capture, t_capture)
+                                        : t_capture;
+
+    // Add the frame to the first group it fits in. A camera can only contribute one
+    // frame to a group, so a merge window longer than the camera frame period doesn't
+    // merge consecutive frames from the same camera
+    auto group = std::find_if(
+        pending_groups.begin(), pending_groups.end(), [&](const FrameGroup& group) {
+            return std::abs((t_capture - group.first_t_capture).toSeconds()) <=
+                       merge_window.toSeconds() &&
+                   group.camera_ids.count(detection_frame.camera_id) == 0;
+        });
+
+    if (group == pending_groups.end())
+    {
+        // Keep the groups sorted by creating the new group before the first group that
+        // starts after the frame
+        auto later_group = std::find_if(
+            pending_groups.begin(), pending_groups.end(),
+            [&](const FrameGroup& group) { return group.first_t_capture > t_capture; });
+        pending_groups.insert(later_group,
+                              FrameGroup{.first_t_capture = t_capture,
+                                         .camera_ids      = {detection_frame.camera_id},
+                                         .merged_frame    = detection_frame});
+        return;
+    }
+
+    VisionDetectionFrame& merged_frame = group->merged_frame;
+    group->camera_ids.insert(detection_frame.camera_id);
+    merged_frame.camera_id = std::min(merged_frame.camera_id, detection_frame.camera_id);
+    merged_frame.t_capture = std::max(merged_frame.t_capture, t_capture);
+    merged_frame.ball_detections.insert(merged_frame.ball_detections.end(),
+                                        detection_frame.ball_detections.begin(),
+                                        detection_frame.ball_detections.end());
+    merged_frame.yellow_robot_detections.insert(
+        merged_frame.yellow_robot_detections.end(),
+        detection_frame.yellow_robot_detections.begin(),
+        detection_frame.yellow_robot_detections.end());
+    merged_frame.blue_robot_detections.insert(
+        merged_frame.blue_robot_detections.end(),
+        detection_frame.blue_robot_detections.begin(),
+        detection_frame.blue_robot_detections.end());
+}
+
+std::vector<VisionDetectionFrame> VisionDetectionFrameMerger::popMergedFrames()
+{
+    std::vector<VisionDetectionFrame> merged_frames;
+
+    // Groups are only released from the front so the merged frames stay in order, even
+    // if a later group is already complete
+    while (!pending_groups.empty() && isReadyToRelease(pending_groups.front()))
+    {
+        FrameGroup& group = pending_groups.front();
+
+        statistics.num_merged_frames++;
+        statistics.last_num_cameras_merged =
+            static_cast<unsigned int>(group.camera_ids.size());
+        statistics.last_merge_latency = *latest_t_capture - group.merged_frame.t_capture;
+
+        last_released_t_capture = group.merged_frame.t_capture;
+        merged_frames.emplace_back(std::move(group.merged_frame));
+        pending_groups.pop_front();
+    }
+
+    return merged_frames;
+}
+
+void VisionDetectionFrameMerger::reset()
+{
+    pending_groups.clear();
+    latest_t_capture_by_camera.clear();
+    latest_t_capture        = std::nullopt;
+    last_released_t_capture = std::nullopt;
+}
+
+const VisionDetectionFrameMerger::Statistics& VisionDetectionFrameMerger::getStatistics()
+    const
+{
+    return statistics;
+}
+
+bool VisionDetectionFrameMerger::isReadyToRelease(const FrameGroup& group) const
+{
+    if (group.first_t_capture + max_merge_delay <= *latest_t_capture)
+    {
+        return true;
+    }
+
+    Timestamp window_end = group.first_t_capture + merge_window;
+    for (const auto& [camera_id, camera_t_capture] : latest_t_capture_by_camera)
+    {
+        bool camera_in_group = group.camera_ids.count(camera_id) != 0;
+        // Frames from each camera arrive in order, so once a camera has sent a frame
+        // past the window it won't send any more frames for the group
+        bool camera_past_window = camera_t_capture > window_end;
+        // Cameras that haven't sent a frame in a while have most likely stopped, so
+        // they shouldn't hold back every group for the max merge delay
+        bool camera_stopped = camera_t_capture + max_merge_delay <= *latest_t_capture;
+        if (!camera_in_group && !camera_past_window && !camera_stopped)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <deque>
+#include <map>
+#include <optional>
+#include <set>
+#include <vector>
+
+#include "software/sensor_fusion/filter/vision_detection.h"
+#include "software/time/duration.h"
+#include "software/time/timestamp.h"
+
+/**
+ * Merges the detection frames of multiple cameras into a single frame per capture.
+ *
+ * Every camera sends its own detection frame, and frames captured at about the same time
+ * by different cameras can arrive in any order. The merger groups frames whose t_capture
+ * are within the merge window of the first frame of a group, and releases each group as
+ * one merged frame in order of t_capture. A group is released once every camera has
+ * either contributed to it or sent a frame captured after it, so no more frames are
+ * expected for it. Cameras that stop sending frames hold back groups for at most the max
+ * merge delay.
+ *
+ * Frames that arrive after their group has been released are dropped, since the filters
+ * have already moved past them.
+ */
+class VisionDetectionFrameMerger
+{
+   public:
+    // Statistics about the frames released by the merger
+    struct Statistics
+    {
+        // The number of merged frames released
+        unsigned int num_merged_frames = 0;
+        // The number of frames that arrived out of order and were reordered
+        unsigned int num_reordered_frames = 0;
+        // The number of frames dropped because their group had already been released
+        unsigned int num_dropped_frames = 0;
+        // The number of cameras that contributed to the last merged frame
+        unsigned int last_num_cameras_merged = 0;
+        // How long the last merged frame was held back, measured as the time between its
+        // t_capture and the t_capture of the newest frame received when it was released
+        Duration last_merge_latency;
+    };
+
+    /**
+     * Creates a new VisionDetectionFrameMerger
+     *
+     * @param merge_window Frames whose t_capture are within this duration (before or
+     * after) of the first frame in a group are merged into the group
+     * @param max_merge_delay The maximum time a group waits for frames from other
+     * cameras, measured against the t_capture of the newest frame received
+     */
+    explicit VisionDetectionFrameMerger(const Duration& merge_window,
+                                        const Duration& max_merge_delay);
+
+    /**
+     * Adds a new detection frame to be merged
+     *
+     * @param detection_frame The detection frame of a single camera
+     */
+    void addDetectionFrame(const VisionDetectionFrame& detection_frame);
+
+    /**
+     * Removes and returns all the merged frames that are ready to be released, in order
+     * of t_capture. The camera_id of a merged frame is the lowest camera id in the group,
+     * and its t_capture is the latest t_capture in the group. The detections keep their
+     * own timestamps
+     *
+     * @return The merged frames that are ready to be released
+     */
+    std::vector<VisionDetectionFrame> popMergedFrames();
+
+    /**
+     * Discards all the pending frames and forgets the cameras that have been seen. The
+     * statistics are kept
+     */
+    void reset();
+
+    /**
+     * Returns statistics about the frames released by the merger
+     *
+     * @return statistics about the frames released by the merger
+     */
+    const Statistics& getStatistics() const;
+
+   private:
+    // A group of frames that were captured at about the same time by different cameras
+    struct FrameGroup
+    {
+        // The t_capture of the first frame added to the group, which the merge window is
+        // measured from
+        Timestamp first_t_capture;
+        std::set<unsigned int> camera_ids;
+        VisionDetectionFrame merged_frame;
+    };
+
+    /**
+     * Returns whether the given group is ready to be released
+     *
+     * @param group The group to check
+     *
+     * @return whether the group is ready to be released
+     */
+    bool isReadyToRelease(const FrameGroup& group) const;
+
+    Duration merge_window;
+    Duration max_merge_delay;
+
+    // The pending groups, sorted by first_t_capture
+    std::deque<FrameGroup> pending_groups;
+    // The t_capture of the newest frame received from each camera
+    std::map<unsigned int, Timestamp> latest_t_capture_by_camera;
+    // The t_capture of the newest frame received from any camera
+    std::optional<Timestamp> latest_t_capture;
+    // The latest t_capture of the most recently released group
+    std::optional<Timestamp> last_released_t_capture;
+
+    Statistics statistics;
+};
@@ -0,0 +1,170 @@
+#include "software/sensor_fusion/vision_detection_frame_merger.h"
+
+#include <gtest/gtest.h>
+
+class VisionDetectionFrameMergerTest : public ::testing::Test
+{
+   protected:
+    VisionDetectionFrameMergerTest()
+        : merger(Duration::fromMilliseconds(5), Duration::fromMilliseconds(50))
+    {
+    }
+
+    /**
+     * Creates a detection frame with a single ball and yellow robot detection. The robot
+     * id is the camera id, so the cameras that contributed to a merged frame can be
+     * checked
+     */
+    static VisionDetectionFrame createFrame(unsigned int camera_id, double t_capture)
+    {
+        Timestamp timestamp = Timestamp::fromSeconds(t_capture);
+        BallDetection ball_detection{.position             = Point(0, 0),
+                                     .distance_from_ground = 0,
+                                     .timestamp            = timestamp,
+                                     .confidence           = 1};
+        RobotDetection robot_detection{.id          = camera_id,
+                                       .position    = Point(0, 0),
+                                       .orientation = Angle::zero(),
+                                       .confidence  = 1,
+                                       .timestamp   = timestamp};
+        return VisionDetectionFrame{.camera_id               = camera_id,
+                                    .t_capture               = timestamp,
+                                    .ball_detections         = {ball_detection},
+                                    .yellow_robot_detections = {robot_detection},
+                                    .blue_robot_detections   = {}};
+    }
+
+    /**
+     * Adds a frame from each camera so the merger knows about both cameras
+     */
+    void addFramesFromBothCameras()
+    {
+        merger.addDetectionFrame(createFrame(0, 1.0));
+        merger.addDetectionFrame(createFrame(1, 1.001));
+        merger.addDetectionFrame(createFrame(0, 1.02));
+        merger.addDetectionFrame(createFrame(1, 1.021));
+        merger.popMergedFrames();
+    }
+
+    VisionDetectionFrameMerger merger;
+};
+
+TEST_F(VisionDetectionFrameMergerTest, single_camera_frames_are_released_immediately)
+{
+    for (unsigned int i = 0; i < 3; i++)
+    {
+        merger.addDetectionFrame(createFrame(0, 1.0 + i / 60.0));
+        std::vector<VisionDetectionFrame> merged_frames = merger.popMergedFrames();
+
+        ASSERT_EQ(1, merged_frames.size());
+        EXPECT_EQ(Timestamp::fromSeconds(1.0 + i / 60.0), merged_frames[0].t_capture);
+        EXPECT_EQ(1, merged_frames[0].yellow_robot_detections.size());
+    }
+    EXPECT_EQ(3, merger.getStatistics().num_merged_frames);
+}
+
+TEST_F(VisionDetectionFrameMergerTest, frames_from_different_cameras_are_merged)
+{
+    addFramesFromBothCameras();
+
+    merger.addDetectionFrame(createFrame(1, 1.042));
+    EXPECT_TRUE(merger.popMergedFrames().empty());
+
+    merger.addDetectionFrame(createFrame(0, 1.04));
+    std::vector<VisionDetectionFrame> merged_frames = merger.popMergedFrames();
+
+    ASSERT_EQ(1, merged_frames.size());
+    EXPECT_EQ(0, merged_frames[0].camera_id);
+    EXPECT_EQ(Timestamp::fromSeconds(1.042), merged_frames[0].t_capture);
+    EXPECT_EQ(2, merged_frames[0].ball_detections.size());
+    ASSERT_EQ(2, merged_frames[0].yellow_robot_detections.size());
+    EXPECT_EQ(1, merged_frames[0].yellow_robot_detections[0].id);
+    EXPECT_EQ(0, merged_frames[0].yellow_robot_detections[1].id);
+    EXPECT_EQ(2, merger.getStatistics().last_num_cameras_merged);
+}
+
+TEST_F(VisionDetectionFrameMergerTest, frames_outside_merge_window_are_not_merged)
+{
+    addFramesFromBothCameras();
+
+    merger.addDetectionFrame(createFrame(0, 1.04));
+    EXPECT_TRUE(merger.popMergedFrames().empty());
+
+    // Camera 1 is now past the first frame, so it won't send any more frames for it
+    merger.addDetectionFrame(createFrame(1, 1.048));
+    std::vector<VisionDetectionFrame> merged_frames = merger.popMergedFrames();
+
+    ASSERT_EQ(1, merged_frames.size());
+    EXPECT_EQ(Timestamp::fromSeconds(1.04), merged_frames[0].t_capture);
+    EXPECT_EQ(1, merged_frames[0].yellow_robot_detections.size());
+    EXPECT_EQ(1, merger.getStatistics().last_num_cameras_merged);
+}
+
+TEST_F(VisionDetectionFrameMergerTest, late_frames_are_reordered)
+{
+    addFramesFromBothCameras();
+
+    merger.addDetectionFrame(createFrame(1, 1.05));
+    EXPECT_TRUE(merger.popMergedFrames().empty());
+
+    // Camera 0 captured a frame before camera 1 did, but it arrived after
+    merger.addDetectionFrame(createFrame(0, 1.04));
+    std::vector<VisionDetectionFrame> merged_frames = merger.popMergedFrames();
+
+    ASSERT_EQ(1, merged_frames.size());
+    EXPECT_EQ(Timestamp::fromSeconds(1.04), merged_frames[0].t_capture);
+    EXPECT_EQ(1, merger.getStatistics().num_reordered_frames);
+    EXPECT_NEAR(10, merger.getStatistics().last_merge_latency.toMilliseconds(), 1e-6);
+
+    merger.addDetectionFrame(createFrame(0, 1.06));
+    merged_frames = merger.popMergedFrames();
+
+    ASSERT_EQ(1, merged_frames.size());
+    EXPECT_EQ(Timestamp::fromSeconds(1.05), merged_frames[0].t_capture);
+}
+
+TEST_F(VisionDetectionFrameMergerTest, frames_after_their_group_was_released_are_dropped)
+{
+    addFramesFromBothCameras();
+
+    merger.addDetectionFrame(createFrame(1, 1.0));
+    EXPECT_TRUE(merger.popMergedFrames().empty());
+    EXPECT_EQ(1, merger.getStatistics().num_dropped_frames);
+}
+
+TEST_F(VisionDetectionFrameMergerTest, stopped_camera_holds_back_frames_for_max_delay)
+{
+    addFramesFromBothCameras();
+
+    // Only camera 0 keeps sending frames
+    merger.addDetectionFrame(createFrame(0, 1.04));
+    EXPECT_TRUE(merger.popMergedFrames().empty());
+    merger.addDetectionFrame(createFrame(0, 1.06));
+    EXPECT_TRUE(merger.popMergedFrames().empty());
+
+    merger.addDetectionFrame(createFrame(0, 1.08));
+    std::vector<VisionDetectionFrame> merged_frames = merger.popMergedFrames();
+
+    // Once camera 1 has been silent for the max delay, it no longer holds back frames
+    ASSERT_EQ(3, merged_frames.size());
+    EXPECT_EQ(Timestamp::fromSeconds(1.04), merged_frames[0].t_capture);
+    EXPECT_EQ(Timestamp::fromSeconds(1.06), merged_frames[1].t_capture);
+    EXPECT_EQ(Timestamp::fromSeconds(1.08), merged_frames[2].t_capture);
+
+    merger.addDetectionFrame(createFrame(0, 1.1));
+    EXPECT_EQ(1, merger.popMergedFrames().size());
+}
+
+TEST_F(VisionDetectionFrameMergerTest, reset_forgets_cameras_and_pending_frames)
+{
+    addFramesFromBothCameras();
+    merger.addDetectionFrame(createFrame(0, 1.04));
+    merger.reset();
+
+    // Frames from before the reset are no longer dropped, and camera 1 is forgotten
+    merger.addDetectionFrame(createFrame(0, 0.5));
+    std::vector<VisionDetectionFrame> merged_frames = merger.popMergedFrames();
+
+    ASSERT_EQ(1, merged_frames.size());
+    EXPECT_EQ(Timestamp::fromSeconds(0.5), merged_frames[0].t_capture);
+}
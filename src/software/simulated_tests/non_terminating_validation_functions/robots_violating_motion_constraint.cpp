@@ -1,5 +1,6 @@
 #include "software/simulated_tests/non_terminating_validation_functions/robots_violating_motion_constraint.h"
 
+#include "software/ai/navigator/obstacle/flat_obstacle_set.h"
 #include "software/logger/logger.h"
 
 void robotsViolatingMotionConstraint(
@@ -7,18 +8,23 @@ void robotsViolatingMotionConstraint(
     std::shared_ptr<RobotNavigationObstacleFactory> obstacle_factory,
     TbotsProto::MotionConstraint constraint)
 {
-    std::vector<ObstaclePtr> obstacles =
-        obstacle_factory->createStaticObstaclesFromMotionConstraint(constraint,
-                                                                    world_ptr->field());
-    for (const auto& robot : world_ptr->friendlyTeam().getAllRobots())
+    FlatObstacleSet obstacles(obstacle_factory->createStaticObstaclesFromMotionConstraint(
+        constraint, world_ptr->field()));
+
+    std::vector<Robot> robots = world_ptr->friendlyTeam().getAllRobots();
+    std::vector<Point> robot_positions;
+    for (const auto& robot : robots)
+    {
+        robot_positions.push_back(robot.position());
+    }
+
+    std::vector<bool> robots_in_obstacles = obstacles.contains(robot_positions);
+    for (std::size_t i = 0; i < robots.size(); i++)
     {
-        for (auto obstacle_ptr : obstacles)
+        if (robots_in_obstacles[i])
         {
-            if (obstacle_ptr.get()->contains(robot.position()))
-            {
-                yield("Robot " + std::to_string(robot.id()) +
-                      " violated the motion constraint");
-            }
+            yield("Robot " + std::to_string(robots[i].id()) +
+                  " violated the motion constraint");
         }
     }
 }
@@ -0,0 +1,288 @@
+#include "software/simulated_tests/simulated_er_force_sim_batch_runner.h"
+
+// TODO (#2419): remove this
+#include <fenv.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "proto/message_translation/tbots_protobuf.h"
+#include "shared/2021_robot_constants.h"
+#include "software/logger/logger.h"
+#include "software/sensor_fusion/sensor_fusion.h"
+#include "software/simulated_tests/simulated_er_force_sim_test_fixture.h"
+#include "software/simulated_tests/validation/non_terminating_function_validator.h"
+#include "software/simulated_tests/validation/terminating_function_validator.h"
+#include "software/simulation/er_force_simulator.h"
+
+void TickTimeStatistics::registerTickTime(double tick_time_ms)
+{
+    total_ms += tick_time_ms;
+    max_ms = std::max(max_ms, tick_time_ms);
+    min_ms = std::min(min_ms, tick_time_ms);
+    num_ticks++;
+}
+
+void TickTimeStatistics::merge(const TickTimeStatistics& other)
+{
+    total_ms += other.total_ms;
+    max_ms = std::max(max_ms, other.max_ms);
+    min_ms = std::min(min_ms, other.min_ms);
+    num_ticks += other.num_ticks;
+}
+
+double TickTimeStatistics::average() const
+{
+    return num_ticks == 0 ? 0.0 : total_ms / num_ticks;
+}
+
+SimulatedErForceSimBatchRunner::SimulatedErForceSimBatchRunner(unsigned int num_threads)
+    : num_threads(num_threads)
+{
+    if (this->num_threads == 0)
+    {
+        // hardware_concurrency may return 0 if it can't be determined
+        this->num_threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+}
+
+unsigned int SimulatedErForceSimBatchRunner::getNumThreads() const
+{
+    return num_threads;
+}
+
+std::vector<SimulatedTestResult> SimulatedErForceSimBatchRunner::run(
+    const std::vector<SimulatedTestScenario>& scenarios) const
+{
+    std::vector<SimulatedTestResult> results(scenarios.size());
+
+    // Workers claim the next unstarted scenario until none are left. Each worker
+    // only ever writes to the result slot of the scenario it claimed, so no further
+    // synchronization is needed
+    std::atomic<size_t> next_scenario_index(0);
+    auto worker = [&]() {
+        size_t i;
+        while ((i = next_scenario_index++) < scenarios.size())
+        {
+            results[i] = runScenario(scenarios[i]);
+        }
+    };
+
+    unsigned int num_workers =
+        static_cast<unsigned int>(std::min<size_t>(num_threads, scenarios.size()));
+    std::vector<std::thread> workers;
+    workers.reserve(num_workers);
+    for (unsigned int i = 0; i < num_workers; i++)
+    {
+        workers.emplace_back(worker);
+    }
+    for (auto& thread : workers)
+    {
+        thread.join();
+    }
+
+    return results;
+}
+
+SimulatedTestBatchSummary SimulatedErForceSimBatchRunner::summarize(
+    const std::vector<SimulatedTestResult>& results, double wall_time_ms)
+{
+    SimulatedTestBatchSummary summary;
+    summary.wall_time_ms = wall_time_ms;
+
+    for (const auto& result : results)
+    {
+        if (result.passed)
+        {
+            summary.num_passed++;
+        }
+        else
+        {
+            summary.num_failed++;
+            for (const auto& message : result.failure_messages)
+            {
+                LOG(WARNING) << result.name << ": " << message << std::endl;
+            }
+        }
+        summary.total_simulated_time += result.simulated_time;
+        summary.friendly_tick_time_stats.merge(result.friendly_tick_time_stats);
+    }
+
+    LOG(INFO) << "Ran " << results.size() << " scenarios: " << summary.num_passed
+              << " passed, " << summary.num_failed << " failed" << std::endl;
+    LOG(INFO) << "simulated " << summary.total_simulated_time.toSeconds() << "s in "
+              << summary.wall_time_ms << "ms of wall time" << std::endl;
+    if (summary.friendly_tick_time_stats.num_ticks > 0)
+    {
+        LOG(INFO) << "max friendly tick duration: "
+                  << summary.friendly_tick_time_stats.max_ms << "ms" << std::endl;
+        LOG(INFO) << "min friendly tick duration: "
+                  << summary.friendly_tick_time_stats.min_ms << "ms" << std::endl;
+        LOG(INFO) << "avg friendly tick duration: "
+                  << summary.friendly_tick_time_stats.average() << "ms" << std::endl;
+    }
+
+    return summary;
+}
+
+SimulatedTestResult SimulatedErForceSimBatchRunner::runScenario(
+    const SimulatedTestScenario& scenario)
+{
+    SimulatedTestResult result;
+    result.name = scenario.name;
+
+    auto wall_start_time = std::chrono::steady_clock::now();
+    const Duration simulation_time_step =
+        Duration::fromSeconds(1.0 / SIMULATED_CAMERA_FPS);
+
+    // The friendly team defends the negative side of the field and controls the
+    // yellow robots. The AI is ticked directly instead of through run_ai, since
+    // scenarios are never paused
+    TbotsProto::ThunderbotsConfig friendly_config = scenario.friendly_thunderbots_config;
+    SimulatedErForceSimTestFixture::setCommonConfigs(friendly_config);
+    friendly_config.mutable_sensor_fusion_config()->set_friendly_color_yellow(true);
+
+    SensorFusion sensor_fusion(friendly_config.sensor_fusion_config());
+    Ai ai(friendly_config.ai_config());
+    if (scenario.play_factory)
+    {
+        ai.overridePlay(scenario.play_factory(friendly_config.ai_config()));
+    }
+
+    auto realism_config = ErForceSimulator::createDefaultRealismConfig();
+    ErForceSimulator simulator(scenario.field_type, create2021RobotConstants(),
+                               realism_config, scenario.ramping);
+
+    // The floating point environment is per thread, so this only affects this worker
+    // TODO (#2419): remove this to re-enable sigfpe checks
+    fedisableexcept(FE_INVALID | FE_OVERFLOW);
+
+    auto update_sensor_fusion = [&]() {
+        SensorProto sensor_msg;
+        for (const auto& msg : simulator.getYellowRobotStatuses())
+        {
+            *(sensor_msg.add_robot_status_msgs()) = msg;
+        }
+
+        // The field geometry is only sent in the SSL Wrapper Packets, so they are used
+        // until SensorFusion has a World
+        if (sensor_fusion.getWorld().has_value())
+        {
+            for (const auto& detection_frame : simulator.getVisionDetectionFrames())
+            {
+                sensor_fusion.processVisionDetectionFrame(detection_frame);
+                sensor_fusion.processSensorProto(sensor_msg);
+            }
+            return;
+        }
+
+        for (const auto& packet : simulator.getSSLWrapperPackets())
+        {
+            *(sensor_msg.mutable_ssl_vision_msg()) = packet;
+            sensor_fusion.processSensorProto(sensor_msg);
+        }
+    };
+
+    simulator.setBallState(scenario.ball);
+    // step the simulator to make sure the robots and the ball are in position
+    simulator.stepSimulation(simulation_time_step);
+    simulator.setYellowRobots(scenario.friendly_robots);
+    simulator.setBlueRobots(scenario.enemy_robots);
+    update_sensor_fusion();
+
+    if (!sensor_fusion.getWorld().has_value())
+    {
+        result.failure_messages.emplace_back("SensorFusion did not output a valid World");
+        feenableexcept(FE_INVALID | FE_OVERFLOW);
+        return result;
+    }
+    auto world = std::make_shared<World>(sensor_fusion.getWorld().value());
+
+    std::vector<TerminatingFunctionValidator> terminating_function_validators;
+    for (const auto& validation_function : scenario.terminating_validation_functions)
+    {
+        terminating_function_validators.emplace_back(
+            TerminatingFunctionValidator(validation_function, world));
+    }
+    std::vector<NonTerminatingFunctionValidator> non_terminating_function_validators;
+    for (const auto& validation_function : scenario.non_terminating_validation_functions)
+    {
+        non_terminating_function_validators.emplace_back(
+            NonTerminatingFunctionValidator(validation_function, world));
+    }
+
+    const Timestamp start_time     = simulator.getTimestamp();
+    const Timestamp timeout_time   = start_time + scenario.timeout;
+    bool validation_functions_done = false;
+
+    while (simulator.getTimestamp() < timeout_time && !validation_functions_done)
+    {
+        simulator.stepSimulation(simulation_time_step);
+        update_sensor_fusion();
+
+        if (!sensor_fusion.getWorld().has_value())
+        {
+            continue;
+        }
+        *world = sensor_fusion.getWorld().value();
+
+        for (auto& function_validator : non_terminating_function_validators)
+        {
+            auto error_message = function_validator.executeAndCheckForFailures();
+            if (error_message)
+            {
+                result.failure_messages.emplace_back(error_message.value());
+            }
+        }
+        validation_functions_done =
+            !terminating_function_validators.empty() &&
+            std::all_of(terminating_function_validators.begin(),
+                        terminating_function_validators.end(),
+                        [](TerminatingFunctionValidator& fv) {
+                            return fv.executeAndCheckForSuccess();
+                        });
+        if (validation_functions_done)
+        {
+            break;
+        }
+
+        auto world_with_updated_game_state = *world;
+        world_with_updated_game_state.updateGameState(scenario.game_state);
+
+        auto start_tick_time = std::chrono::steady_clock::now();
+        auto primitive_set_msg =
+            ai.getPrimitives(std::make_shared<World>(world_with_updated_game_state));
+        result.friendly_tick_time_stats.registerTickTime(
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() -
+                                                      start_tick_time)
+                .count());
+
+        simulator.setYellowRobotPrimitiveSet(
+            *primitive_set_msg, createWorld(world_with_updated_game_state));
+    }
+
+    // TODO (#2419): remove this to re-enable sigfpe checks
+    feenableexcept(FE_INVALID | FE_OVERFLOW);
+
+    if (!validation_functions_done && !terminating_function_validators.empty())
+    {
+        std::string failure_message =
+            "Not all validation functions passed within the timeout duration:\n";
+        for (const auto& fun : terminating_function_validators)
+        {
+            if (fun.currentErrorMessage() != "")
+            {
+                failure_message += fun.currentErrorMessage() + std::string("\n");
+            }
+        }
+        result.failure_messages.emplace_back(failure_message);
+    }
+
+    result.passed         = result.failure_messages.empty();
+    result.simulated_time = simulator.getTimestamp() - start_time;
+    result.wall_time_ms   = std::chrono::duration<double, std::milli>(
+                              std::chrono::steady_clock::now() - wall_start_time)
+                              .count();
+    return result;
+}
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <functional>
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "proto/parameters.pb.h"
+#include "software/ai/ai.h"
+#include "software/simulated_tests/validation/validation_function.h"
+#include "software/time/duration.h"
+#include "software/world/game_state.h"
+#include "software/world/robot_state.h"
+
+/**
+ * A single independent simulated test scenario. Each scenario is run on its own
+ * ErForceSimulator, SensorFusion and Ai instances so that scenarios can be run
+ * concurrently without sharing any state.
+ */
+struct SimulatedTestScenario
+{
+    // A human readable name for the scenario, used in the results and logs
+    std::string name;
+
+    TbotsProto::FieldType field_type = TbotsProto::FieldType::DIV_B;
+    BallState ball                   = BallState(Point(0, 0), Vector(0, 0));
+    std::vector<RobotStateWithId> friendly_robots;
+    std::vector<RobotStateWithId> enemy_robots;
+
+    std::vector<ValidationFunction> terminating_validation_functions;
+    std::vector<ValidationFunction> non_terminating_validation_functions;
+
+    // The maximum duration of simulated time to run the scenario for
+    Duration timeout = Duration::fromSeconds(10);
+    bool ramping     = false;
+
+    // The config for the friendly team (yellow). The runner applies the same common
+    // configs as the SimulatedErForceSimTestFixture, and sets the friendly color
+    TbotsProto::ThunderbotsConfig friendly_thunderbots_config;
+    GameState game_state;
+
+    // Optionally overrides the play the friendly AI runs. Plays and tactics are not
+    // thread safe, so a factory is used to build a fresh play on the worker thread
+    std::function<std::unique_ptr<Play>(const TbotsProto::AiConfig&)> play_factory;
+};
+
+/**
+ * Tick time statistics, in milliseconds
+ */
+struct TickTimeStatistics
+{
+    /**
+     * Registers a new tick time
+     *
+     * @param tick_time_ms The tick time in milliseconds
+     */
+    void registerTickTime(double tick_time_ms);
+
+    /**
+     * Merges the given statistics into this one
+     *
+     * @param other The statistics to merge
+     */
+    void merge(const TickTimeStatistics& other);
+
+    /**
+     * Gets the average tick time
+     *
+     * @return the average tick time in milliseconds, or 0 if no ticks were registered
+     */
+    double average() const;
+
+    double total_ms        = 0.0;
+    double max_ms          = 0.0;
+    double min_ms          = std::numeric_limits<double>::max();
+    unsigned int num_ticks = 0;
+};
+
+/**
+ * The outcome of running a single SimulatedTestScenario
+ */
+struct SimulatedTestResult
+{
+    std::string name;
+    bool passed = false;
+    // All the validation failure messages collected while running the scenario
+    std::vector<std::string> failure_messages;
+    Duration simulated_time = Duration::fromSeconds(0);
+    double wall_time_ms     = 0.0;
+    TickTimeStatistics friendly_tick_time_stats;
+};
+
+/**
+ * Aggregate results of a batch of scenarios
+ */
+struct SimulatedTestBatchSummary
+{
+    unsigned int num_passed       = 0;
+    unsigned int num_failed       = 0;
+    Duration total_simulated_time = Duration::fromSeconds(0);
+    double wall_time_ms           = 0.0;
+    TickTimeStatistics friendly_tick_time_stats;
+};
+
+/**
+ * Runs many independent simulated test scenarios in parallel on a pool of worker
+ * threads. Unlike the SimulatedErForceSimTestFixture, scenarios are never paced to
+ * wall-clock time and run as fast as the simulator and AI allow.
+ *
+ * Scenarios are handed out to workers dynamically, so a batch of test
+ * parameterizations is sharded across all available cores even when scenarios
+ * take very different amounts of time to complete.
+ */
+class SimulatedErForceSimBatchRunner
+{
+   public:
+    /**
+     * Creates a new batch runner
+     *
+     * @param num_threads The number of worker threads to run scenarios on. If 0, the
+     * number of hardware threads is used
+     */
+    explicit SimulatedErForceSimBatchRunner(unsigned int num_threads = 0);
+
+    /**
+     * Runs all the given scenarios and blocks until they have all completed
+     *
+     * @param scenarios The scenarios to run
+     *
+     * @return the results of each scenario, in the same order as the given scenarios
+     */
+    std::vector<SimulatedTestResult> run(
+        const std::vector<SimulatedTestScenario>& scenarios) const;
+
+    /**
+     * Aggregates the results of a batch and logs a summary
+     *
+     * @param results The results to aggregate
+     * @param wall_time_ms The wall time it took to run the whole batch
+     *
+     * @return the aggregated summary
+     */
+    static SimulatedTestBatchSummary summarize(
+        const std::vector<SimulatedTestResult>& results, double wall_time_ms);
+
+    /**
+     * Gets the number of worker threads this runner uses
+     *
+     * @return the number of worker threads
+     */
+    unsigned int getNumThreads() const;
+
+   private:
+    /**
+     * Runs a single scenario to completion on the calling thread
+     *
+     * @param scenario The scenario to run
+     *
+     * @return the result of the scenario
+     */
+    static SimulatedTestResult runScenario(const SimulatedTestScenario& scenario);
+
+    unsigned int num_threads;
+
+    // The rate at which camera data will be simulated and given to SensorFusion.
+    // This matches the SimulatedErForceSimTestFixture
+    static constexpr unsigned int SIMULATED_CAMERA_FPS = 60;
+};
@@ -0,0 +1,110 @@
+#include "software/simulated_tests/simulated_er_force_sim_batch_runner.h"
+
+#include <gtest/gtest.h>
+
+#include "software/simulated_tests/terminating_validation_functions/robot_halt_validation.h"
+#include "software/test_util/test_util.h"
+
+class SimulatedErForceSimBatchRunnerTest : public ::testing::Test
+{
+   protected:
+    /**
+     * Creates a scenario where the friendly robots start moving and must come to a
+     * halt under the HaltPlay
+     *
+     * @param name The name of the scenario
+     * @param initial_velocity The initial velocity of every friendly robot
+     *
+     * @return the scenario
+     */
+    static SimulatedTestScenario createHaltScenario(const std::string& name,
+                                                    const Vector& initial_velocity)
+    {
+        SimulatedTestScenario scenario;
+        scenario.name            = name;
+        scenario.ball            = BallState(Point(0, 0.5), Vector(0, 0));
+        scenario.friendly_robots = TestUtil::createMovingRobotStatesWithId(
+            {Point(-3, 2.5), Point(-3, 1.5), Point(-3, 0.5)},
+            {initial_velocity, initial_velocity, initial_velocity});
+        scenario.enemy_robots = TestUtil::createStationaryRobotStatesWithId(
+            {Point(1, 0), Point(1, 2.5), Point(1, -2.5)});
+        scenario.friendly_thunderbots_config.mutable_ai_config()
+            ->mutable_ai_control_config()
+            ->set_override_ai_play(TbotsProto::PlayName::HaltPlay);
+        scenario.game_state.updateRefereeCommand(RefereeCommand::HALT);
+        scenario.terminating_validation_functions = {
+            [](std::shared_ptr<World> world_ptr, ValidationCoroutine::push_type& yield) {
+                robotHalt(world_ptr, yield);
+            }};
+        scenario.timeout = Duration::fromSeconds(5);
+        return scenario;
+    }
+};
+
+TEST_F(SimulatedErForceSimBatchRunnerTest, test_batch_of_passing_scenarios)
+{
+    std::vector<SimulatedTestScenario> scenarios;
+    for (unsigned int i = 0; i < 8; i++)
+    {
+        scenarios.emplace_back(
+            createHaltScenario("halt_" + std::to_string(i), Vector(0.25 * i, 0.25)));
+    }
+
+    SimulatedErForceSimBatchRunner runner(4);
+    auto start_time = std::chrono::system_clock::now();
+    auto results    = runner.run(scenarios);
+    auto summary    = SimulatedErForceSimBatchRunner::summarize(
+        results, TestUtil::millisecondsSince(start_time));
+
+    ASSERT_EQ(scenarios.size(), results.size());
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        EXPECT_EQ(scenarios[i].name, results[i].name);
+        EXPECT_TRUE(results[i].passed) << results[i].name;
+        EXPECT_GT(results[i].friendly_tick_time_stats.num_ticks, 0u);
+        EXPECT_LE(results[i].simulated_time, scenarios[i].timeout);
+    }
+    EXPECT_EQ(scenarios.size(), summary.num_passed);
+    EXPECT_EQ(0u, summary.num_failed);
+}
+
+TEST_F(SimulatedErForceSimBatchRunnerTest, test_failing_scenario_is_reported)
+{
+    auto failing_scenario = createHaltScenario("never_passes", Vector(0, 0));
+    failing_scenario.terminating_validation_functions = {
+        [](std::shared_ptr<World>, ValidationCoroutine::push_type& yield) {
+            while (true)
+            {
+                yield("This validation function never passes");
+            }
+        }};
+    failing_scenario.timeout = Duration::fromSeconds(0.5);
+
+    SimulatedErForceSimBatchRunner runner(2);
+    auto results =
+        runner.run({createHaltScenario("passes", Vector(0, 0)), failing_scenario});
+
+    ASSERT_EQ(2u, results.size());
+    EXPECT_TRUE(results[0].passed);
+    EXPECT_FALSE(results[1].passed);
+    ASSERT_FALSE(results[1].failure_messages.empty());
+    EXPECT_NE(std::string::npos, results[1].failure_messages.front().find(
+                                     "This validation function never passes"));
+    // The scenario must run for the whole timeout, without any real-time pacing
+    EXPECT_GE(results[1].simulated_time, failing_scenario.timeout);
+}
+
+TEST_F(SimulatedErForceSimBatchRunnerTest, test_more_threads_than_scenarios)
+{
+    SimulatedErForceSimBatchRunner runner(16);
+    auto results = runner.run({createHaltScenario("only_scenario", Vector(0, 0))});
+
+    ASSERT_EQ(1u, results.size());
+    EXPECT_TRUE(results[0].passed);
+}
+
+TEST_F(SimulatedErForceSimBatchRunnerTest, test_default_number_of_threads)
+{
+    SimulatedErForceSimBatchRunner runner;
+    EXPECT_GE(runner.getNumThreads(), 1u);
+}
@@ -107,30 +107,21 @@ bool SimulatedErForceSimTestFixture::validateAndCheckCompletion(
 void SimulatedErForceSimTestFixture::updateSensorFusion(
     std::shared_ptr<ErForceSimulator> simulator)
 {
-    // TODO (#2419): remove this to re-enable sigfpe checks
-    fedisableexcept(FE_INVALID | FE_OVERFLOW);
-    auto ssl_wrapper_packets = simulator->getSSLWrapperPackets();
-    // TODO (#2419): remove this to re-enable sigfpe checks
-    feenableexcept(FE_INVALID | FE_OVERFLOW);
-
     auto blue_robot_statuses   = simulator->getBlueRobotStatuses();
     auto yellow_robot_statuses = simulator->getYellowRobotStatuses();
 
-    for (const auto &packet : ssl_wrapper_packets)
+    auto blue_sensor_msg   = SensorProto();
+    auto yellow_sensor_msg = SensorProto();
+    for (const auto &msg : blue_robot_statuses)
     {
-        auto blue_sensor_msg                          = SensorProto();
-        auto yellow_sensor_msg                        = SensorProto();
-        *(blue_sensor_msg.mutable_ssl_vision_msg())   = packet;
-        *(yellow_sensor_msg.mutable_ssl_vision_msg()) = packet;
-        for (const auto &msg : blue_robot_statuses)
-        {
-            *(blue_sensor_msg.add_robot_status_msgs()) = msg;
-        }
-        for (const auto &msg : yellow_robot_statuses)
-        {
-            *(yellow_sensor_msg.add_robot_status_msgs()) = msg;
-        }
+        *(blue_sensor_msg.add_robot_status_msgs()) = msg;
+    }
+    for (const auto &msg : yellow_robot_statuses)
+    {
+        *(yellow_sensor_msg.add_robot_status_msgs()) = msg;
+    }
 
+    auto process_sensor_msgs = [&]() {
         if (friendly_thunderbots_config.sensor_fusion_config().friendly_color_yellow())
         {
             friendly_sensor_fusion.processSensorProto(yellow_sensor_msg);
@@ -148,6 +139,40 @@ void SimulatedErForceSimTestFixture::updateSensorFusion(
         {
             enemy_sensor_fusion.processSensorProto(blue_sensor_msg);
         }
+    };
+
+    // The field geometry is only sent in the SSL Wrapper Packets, so they are used until
+    // both SensorFusions have a World. Nothing outside of this process needs the
+    // packets, so after that the detections are handed to SensorFusion directly
+    if (friendly_sensor_fusion.getWorld().has_value() &&
+        enemy_sensor_fusion.getWorld().has_value())
+    {
+        // TODO (#2419): remove this to re-enable sigfpe checks
+        fedisableexcept(FE_INVALID | FE_OVERFLOW);
+        auto detection_frames = simulator->getVisionDetectionFrames();
+        // TODO (#2419): remove this to re-enable sigfpe checks
+        feenableexcept(FE_INVALID | FE_OVERFLOW);
+
+        for (const auto &detection_frame : detection_frames)
+        {
+            friendly_sensor_fusion.processVisionDetectionFrame(detection_frame);
+            enemy_sensor_fusion.processVisionDetectionFrame(detection_frame);
+            process_sensor_msgs();
+        }
+        return;
+    }
+
+    // TODO (#2419): remove this to re-enable sigfpe checks
+    fedisableexcept(FE_INVALID | FE_OVERFLOW);
+    auto ssl_wrapper_packets = simulator->getSSLWrapperPackets();
+    // TODO (#2419): remove this to re-enable sigfpe checks
+    feenableexcept(FE_INVALID | FE_OVERFLOW);
+
+    for (const auto &packet : ssl_wrapper_packets)
+    {
+        *(blue_sensor_msg.mutable_ssl_vision_msg())   = packet;
+        *(yellow_sensor_msg.mutable_ssl_vision_msg()) = packet;
+        process_sensor_msgs();
     }
 }
 
@@ -19,6 +19,16 @@ class SimulatedErForceSimTestFixture : public ::testing::Test
    public:
     explicit SimulatedErForceSimTestFixture();
 
+    /**
+     * Sets configs that are common to the friendly and enemy teams. This is also used
+     * by the SimulatedErForceSimBatchRunner, so that its scenarios are configured like
+     * the tests run with this fixture
+     *
+     * @param mutable_thunderbots_config A mutable thunderbots config
+     */
+    static void setCommonConfigs(
+        TbotsProto::ThunderbotsConfig &mutable_thunderbots_config);
+
    protected:
     void SetUp() override;
 
@@ -104,14 +114,6 @@ class SimulatedErForceSimTestFixture : public ::testing::Test
                   double &ball_velocity_diff, std::vector<double> &robots_displacement,
                   std::vector<double> &robots_velocity_diff);
 
-    /**
-     * Sets configs that are common to the friendly and enemy teams
-     *
-     * @param mutable_thunderbots_config A mutable thunderbots config
-     */
-    static void setCommonConfigs(
-        TbotsProto::ThunderbotsConfig &mutable_thunderbots_config);
-
     /**
      * A helper function that updates SensorFusion with the latest data from the
      * ErForceSimulator
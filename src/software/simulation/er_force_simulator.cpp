@@ -22,7 +22,8 @@ ErForceSimulator::ErForceSimulator(const TbotsProto::FieldType& field_type,
                                    const RobotConstants_t& robot_constants,
                                    std::unique_ptr<RealismConfigErForce>& realism_config,
                                    const bool ramping,
-                                   double primitive_executor_time_step)
+                                   double primitive_executor_time_step,
+                                   unsigned int num_robot_step_threads)
     : yellow_team_world_msg(std::make_unique<TbotsProto::World>()),
       blue_team_world_msg(std::make_unique<TbotsProto::World>()),
       primitive_executor_time_step_s(primitive_executor_time_step),
@@ -32,8 +33,16 @@ ErForceSimulator::ErForceSimulator(const TbotsProto::FieldType& field_type,
       field(Field::createField(field_type)),
       blue_robot_with_ball(std::nullopt),
       yellow_robot_with_ball(std::nullopt),
-      ramping(ramping)
+      ramping(ramping),
+      step_arena_block(std::make_unique<char[]>(STEP_ARENA_BLOCK_SIZE_BYTES)),
+      robot_step_tasks(),
+      robot_step_thread_pool(std::make_unique<ThreadPool>(num_robot_step_threads))
 {
+    google::protobuf::ArenaOptions step_arena_options;
+    step_arena_options.initial_block      = step_arena_block.get();
+    step_arena_options.initial_block_size = STEP_ARENA_BLOCK_SIZE_BYTES;
+    step_arena = std::make_unique<google::protobuf::Arena>(step_arena_options);
+
     QString full_filename = CONFIG_DIRECTORY;
 
     if (field_type == TbotsProto::FieldType::DIV_A)
@@ -100,6 +109,7 @@ std::unique_ptr<RealismConfigErForce> ErForceSimulator::createDefaultRealismConf
     realism_config->set_vision_processing_time(0);
     realism_config->set_missing_ball_detections(0);
     realism_config->set_simulate_dribbling(false);
+    realism_config->set_adaptive_stepping(false);
     return realism_config;
 }
 
@@ -125,6 +135,7 @@ std::unique_ptr<RealismConfigErForce> ErForceSimulator::createRealisticRealismCo
     realism_config->set_vision_processing_time(10000000);
     realism_config->set_missing_ball_detections(0.02f);
     realism_config->set_simulate_dribbling(false);
+    realism_config->set_adaptive_stepping(false);
     return realism_config;
 }
 
@@ -305,8 +316,8 @@ void ErForceSimulator::setYellowRobotPrimitiveSet(
     const auto& sim_robots           = sim_state.yellow_robots();
     const auto robot_to_vel_pair_map = getRobotIdToLocalVelocityMap(sim_robots);
 
-    yellow_team_world_msg               = std::move(world_msg);
-    const TbotsProto::World world_proto = *yellow_team_world_msg;
+    yellow_team_world_msg                = std::move(world_msg);
+    const TbotsProto::World& world_proto = *yellow_team_world_msg;
     for (auto& [robot_id, primitive] : primitive_set_msg.robot_primitives())
     {
         if (robot_to_vel_pair_map.contains(robot_id))
@@ -326,8 +337,8 @@ void ErForceSimulator::setBlueRobotPrimitiveSet(
     const auto& sim_robots           = sim_state.blue_robots();
     const auto robot_to_vel_pair_map = getRobotIdToLocalVelocityMap(sim_robots);
 
-    blue_team_world_msg                 = std::move(world_msg);
-    const TbotsProto::World world_proto = *blue_team_world_msg;
+    blue_team_world_msg                  = std::move(world_msg);
+    const TbotsProto::World& world_proto = *blue_team_world_msg;
 
     for (auto& [robot_id, primitive] : primitive_set_msg.robot_primitives())
     {
@@ -364,61 +375,76 @@ void ErForceSimulator::setRobotPrimitive(
     }
 }
 
-SSLSimulationProto::RobotControl ErForceSimulator::updateSimulatorRobots(
-    std::unordered_map<unsigned int, std::shared_ptr<PrimitiveExecutor>>&
-        robot_primitive_executor_map,
-    const TbotsProto::World& world_msg, gameController::Team side)
+SSLSimulationProto::RobotCommand* ErForceSimulator::stepRobotPrimitiveExecutor(
+    RobotId robot_id, PrimitiveExecutor& primitive_executor,
+    const std::map<RobotId, std::pair<Vector, AngularVelocity>>& current_velocity_map)
 {
-    SSLSimulationProto::RobotControl robot_control;
+    // The arena is thread safe, so the robots can be stepped in parallel
+    auto* direct_control =
+        google::protobuf::Arena::CreateMessage<TbotsProto::DirectControlPrimitive>(
+            step_arena.get());
+
+    TbotsProto::PrimitiveExecutorStatus status;  // Added for compilation
+    primitive_executor.stepPrimitive(status, *direct_control);
+    if (ramping)
+    {
+        rampVelocityPrimitive(current_velocity_map.at(robot_id).first,
+                              current_velocity_map.at(robot_id).second, *direct_control,
+                              primitive_executor_time_step_s);
+    }
 
-    auto sim_state = getSimulatorState();
-    std::map<RobotId, std::pair<Vector, Angle>> current_velocity_map;
-    if (side == gameController::Team::BLUE)
+    return createRobotCommandFromDirectControl(robot_id, *direct_control,
+                                               step_arena.get());
+}
+
+void ErForceSimulator::updateSimulatorRobots(
+    const world::SimulatorState& sim_state,
+    SSLSimulationProto::RobotControl& yellow_robot_control,
+    SSLSimulationProto::RobotControl& blue_robot_control)
+{
+    const auto yellow_velocity_map =
+        getRobotIdToLocalVelocityMap(sim_state.yellow_robots());
+    const auto blue_velocity_map = getRobotIdToLocalVelocityMap(sim_state.blue_robots());
+
+    // Yellow robots come first, then blue robots, each in primitive executor map
+    // iteration order. This is the order the commands are merged in below
+    robot_step_tasks.clear();
+    for (auto& [robot_id, primitive_executor] : yellow_primitive_executor_map)
     {
-        const auto& sim_robots = sim_state.blue_robots();
-        current_velocity_map   = getRobotIdToLocalVelocityMap(sim_robots);
+        robot_step_tasks.push_back(RobotStepTask{robot_id, primitive_executor.get(),
+                                                 &yellow_velocity_map, nullptr});
     }
-    else
+    for (auto& [robot_id, primitive_executor] : blue_primitive_executor_map)
     {
-        const auto& sim_robots = sim_state.yellow_robots();
-        current_velocity_map   = getRobotIdToLocalVelocityMap(sim_robots);
+        robot_step_tasks.push_back(RobotStepTask{robot_id, primitive_executor.get(),
+                                                 &blue_velocity_map, nullptr});
     }
 
-    for (auto& primitive_executor_with_id : robot_primitive_executor_map)
-    {
-        unsigned int robot_id    = primitive_executor_with_id.first;
-        auto& primitive_executor = primitive_executor_with_id.second;
-        std::unique_ptr<TbotsProto::DirectControlPrimitive> direct_control;
+    // Each task only touches its own primitive executor and output command
+    robot_step_thread_pool->parallelFor(robot_step_tasks.size(), [this](std::size_t i) {
+        auto& task         = robot_step_tasks[i];
+        task.robot_command = stepRobotPrimitiveExecutor(
+            task.robot_id, *task.primitive_executor, *task.current_velocity_map);
+    });
 
-        TbotsProto::PrimitiveExecutorStatus status;  // Added for compilation
-        if (ramping)
-        {
-            auto direct_control_no_ramp = primitive_executor->stepPrimitive(status);
-            direct_control              = getRampedVelocityPrimitive(
-                current_velocity_map.at(robot_id).first,
-                current_velocity_map.at(robot_id).second, *direct_control_no_ramp,
-                primitive_executor_time_step_s);
-        }
-        else
-        {
-            direct_control = primitive_executor->stepPrimitive(status);
-        }
-
-        auto command = *getRobotCommandFromDirectControl(
-            robot_id, std::move(direct_control), robot_constants);
-        *(robot_control.mutable_robot_commands()->Add()) = command;
+    const std::size_t num_yellow_robots = yellow_primitive_executor_map.size();
+    for (std::size_t i = 0; i < robot_step_tasks.size(); i++)
+    {
+        auto& robot_control =
+            i < num_yellow_robots ? yellow_robot_control : blue_robot_control;
+        // The command is in the same arena as the control, so this does not copy it
+        robot_control.mutable_robot_commands()->AddAllocated(
+            robot_step_tasks[i].robot_command);
     }
-    return robot_control;
 }
 
-std::unique_ptr<TbotsProto::DirectControlPrimitive>
-ErForceSimulator::getRampedVelocityPrimitive(
+void ErForceSimulator::rampVelocityPrimitive(
     const Vector current_local_velocity,
     const AngularVelocity current_local_angular_velocity,
     TbotsProto::DirectControlPrimitive& target_velocity_primitive,
     const double& time_to_ramp)
 {
-    TbotsProto::MotorControl_DirectVelocityControl direct_velocity =
+    const TbotsProto::MotorControl_DirectVelocityControl& direct_velocity =
         target_velocity_primitive.motor_control().direct_velocity_control();
 
     // getting the target wheel velocity
@@ -446,30 +472,37 @@ ErForceSimulator::getRampedVelocityPrimitive(
 
     auto mutable_direct_velocity = target_velocity_primitive.mutable_motor_control()
                                        ->mutable_direct_velocity_control();
-    *(mutable_direct_velocity->mutable_velocity()) =
-        *createVectorProto({ramped_euclidean[1], -ramped_euclidean[0]});
-    *(mutable_direct_velocity->mutable_angular_velocity()) =
-        *createAngularVelocityProto(AngularVelocity::fromRadians(ramped_euclidean[2]));
-
-    return std::make_unique<TbotsProto::DirectControlPrimitive>(
-        target_velocity_primitive);
+    mutable_direct_velocity->mutable_velocity()->set_x_component_meters(
+        ramped_euclidean[1]);
+    mutable_direct_velocity->mutable_velocity()->set_y_component_meters(
+        -ramped_euclidean[0]);
+    mutable_direct_velocity->mutable_angular_velocity()->set_radians_per_second(
+        ramped_euclidean[2]);
 }
 
 void ErForceSimulator::stepSimulation(const Duration& time_step)
 {
     current_time = current_time + time_step;
 
-    SSLSimulationProto::RobotControl yellow_robot_control =
-        updateSimulatorRobots(yellow_primitive_executor_map, *yellow_team_world_msg,
-                              gameController::Team::YELLOW);
+    // Nothing allocated in the arena during the previous step is still referenced
+    step_arena->Reset();
+
+    auto* yellow_robot_control =
+        google::protobuf::Arena::CreateMessage<SSLSimulationProto::RobotControl>(
+            step_arena.get());
+    auto* blue_robot_control =
+        google::protobuf::Arena::CreateMessage<SSLSimulationProto::RobotControl>(
+            step_arena.get());
+
+    // The simulator state is the same for both teams, so only build it once per step
+    const world::SimulatorState sim_state = getSimulatorState();
 
-    SSLSimulationProto::RobotControl blue_robot_control = updateSimulatorRobots(
-        blue_primitive_executor_map, *blue_team_world_msg, gameController::Team::BLUE);
+    updateSimulatorRobots(sim_state, *yellow_robot_control, *blue_robot_control);
 
     auto yellow_radio_responses =
-        er_force_sim->acceptYellowRobotControlCommand(yellow_robot_control);
+        er_force_sim->acceptYellowRobotControlCommand(*yellow_robot_control);
     auto blue_radio_responses =
-        er_force_sim->acceptBlueRobotControlCommand(blue_robot_control);
+        er_force_sim->acceptBlueRobotControlCommand(*blue_robot_control);
 
     blue_robot_with_ball.reset();
     yellow_robot_with_ball.reset();
@@ -497,48 +530,30 @@ void ErForceSimulator::stepSimulation(const Duration& time_step)
 
 std::vector<TbotsProto::RobotStatus> ErForceSimulator::getBlueRobotStatuses() const
 {
-    std::vector<TbotsProto::RobotStatus> robot_statuses;
-    auto robot_status = TbotsProto::RobotStatus();
-    auto power_status = TbotsProto::PowerStatus();
-
-    if (blue_robot_with_ball.has_value())
-    {
-        robot_status.set_robot_id(blue_robot_with_ball.value());
-        power_status.set_breakbeam_tripped(true);
-    }
-    else
-    {
-        robot_status.clear_robot_id();
-        power_status.set_breakbeam_tripped(false);
-    }
-
-    *(robot_status.mutable_power_status()) = power_status;
-    robot_statuses.push_back(robot_status);
-
-    return robot_statuses;
+    return {createRobotStatus(blue_robot_with_ball)};
 }
 
 std::vector<TbotsProto::RobotStatus> ErForceSimulator::getYellowRobotStatuses() const
 {
-    std::vector<TbotsProto::RobotStatus> robot_statuses;
-    auto robot_status = TbotsProto::RobotStatus();
-    auto power_status = TbotsProto::PowerStatus();
+    return {createRobotStatus(yellow_robot_with_ball)};
+}
+
+TbotsProto::RobotStatus ErForceSimulator::createRobotStatus(
+    const std::optional<RobotId>& robot_with_ball)
+{
+    TbotsProto::RobotStatus robot_status;
 
-    if (yellow_robot_with_ball.has_value())
+    if (robot_with_ball.has_value())
     {
-        robot_status.set_robot_id(yellow_robot_with_ball.value());
-        power_status.set_breakbeam_tripped(true);
+        robot_status.set_robot_id(robot_with_ball.value());
+        robot_status.mutable_power_status()->set_breakbeam_tripped(true);
     }
     else
     {
-        robot_status.clear_robot_id();
-        power_status.set_breakbeam_tripped(false);
+        robot_status.mutable_power_status()->set_breakbeam_tripped(false);
     }
 
-    *(robot_status.mutable_power_status()) = power_status;
-    robot_statuses.push_back(robot_status);
-
-    return robot_statuses;
+    return robot_status;
 }
 
 std::vector<SSLProto::SSL_WrapperPacket> ErForceSimulator::getSSLWrapperPackets() const
@@ -546,6 +561,56 @@ std::vector<SSLProto::SSL_WrapperPacket> ErForceSimulator::getSSLWrapperPackets(
     return er_force_sim->getWrapperPackets();
 }
 
+std::vector<VisionDetectionFrame> ErForceSimulator::getVisionDetectionFrames() const
+{
+    const auto sim_detection_frames = er_force_sim->getDetectionFrames();
+
+    std::vector<VisionDetectionFrame> detection_frames;
+    detection_frames.reserve(sim_detection_frames.size());
+    auto create_robot_detections =
+        [](const std::vector<camun::simulator::DetectionRobot>& sim_robots,
+           const Timestamp& t_capture) {
+            std::vector<RobotDetection> robot_detections;
+            robot_detections.reserve(sim_robots.size());
+            for (const auto& robot : sim_robots)
+            {
+                robot_detections.push_back(RobotDetection{
+                    .id          = robot.id,
+                    .position    = Point(robot.x * METERS_PER_MILLIMETER,
+                                      robot.y * METERS_PER_MILLIMETER),
+                    .orientation = Angle::fromRadians(robot.orientation),
+                    .confidence  = robot.confidence,
+                    .timestamp   = t_capture});
+            }
+            return robot_detections;
+        };
+
+    for (const auto& frame : sim_detection_frames)
+    {
+        const Timestamp t_capture = Timestamp::fromSeconds(frame.tCapture);
+        VisionDetectionFrame detection_frame{
+            .camera_id       = frame.cameraId,
+            .t_capture       = t_capture,
+            .ball_detections = {},
+            .yellow_robot_detections =
+                create_robot_detections(frame.robotsYellow, t_capture),
+            .blue_robot_detections =
+                create_robot_detections(frame.robotsBlue, t_capture)};
+        detection_frame.ball_detections.reserve(frame.balls.size());
+        for (const auto& ball : frame.balls)
+        {
+            detection_frame.ball_detections.push_back(BallDetection{
+                .position             = Point(ball.x * METERS_PER_MILLIMETER,
+                                  ball.y * METERS_PER_MILLIMETER),
+                .distance_from_ground = ball.z * METERS_PER_MILLIMETER,
+                .timestamp            = t_capture,
+                .confidence           = ball.confidence});
+        }
+        detection_frames.push_back(std::move(detection_frame));
+    }
+    return detection_frames;
+}
+
 world::SimulatorState ErForceSimulator::getSimulatorState() const
 {
     return er_force_sim->getSimulatorState();
@@ -561,6 +626,16 @@ Timestamp ErForceSimulator::getTimestamp() const
     return current_time;
 }
 
+Duration ErForceSimulator::getLastSubStep() const
+{
+    return Duration::fromSeconds(er_force_sim->lastSubTimestep());
+}
+
+unsigned int ErForceSimulator::getNumSleepingRobots() const
+{
+    return static_cast<unsigned int>(er_force_sim->numSleepingRobots());
+}
+
 void ErForceSimulator::resetCurrentTime()
 {
     current_time = Timestamp::fromSeconds(0);
@@ -1,11 +1,15 @@
 #pragma once
 
+#include <google/protobuf/arena.h>
+
 #include "extlibs/er_force_sim/src/amun/simulator/simulator.h"
 #include "proto/robot_status_msg.pb.h"
 #include "proto/ssl_vision_wrapper.pb.h"
 #include "proto/tbots_software_msgs.pb.h"
 #include "software/jetson_nano/primitive_executor.h"
+#include "software/multithreading/thread_pool.h"
 #include "software/physics/euclidean_to_wheel.h"
+#include "software/sensor_fusion/filter/vision_detection.h"
 #include "software/world/field.h"
 #include "software/world/team_types.h"
 #include "software/world/world.h"
@@ -26,13 +30,19 @@ class ErForceSimulator
      * @param field_type The field type
      * @param robot_constants The robot constants
      * @param realism_config realism configuration
+     * @param ramping whether to ramp the robots' velocities
+     * @param primitive_executor_time_step_s The time step of the primitive executors
+     * @param num_robot_step_threads The number of extra threads used to step the
+     * robots' primitive executors in parallel. If 0, robots are stepped serially.
+     * The simulation results are the same regardless of the number of threads
      */
     explicit ErForceSimulator(const TbotsProto::FieldType& field_type,
                               const RobotConstants_t& robot_constants,
                               std::unique_ptr<RealismConfigErForce>& realism_config,
                               const bool ramping = false,
                               double primitive_executor_time_step_s =
-                                  DEFAULT_SIMULATOR_TICK_RATE_SECONDS_PER_TICK);
+                                  DEFAULT_SIMULATOR_TICK_RATE_SECONDS_PER_TICK,
+                              unsigned int num_robot_step_threads = 0);
     ErForceSimulator()  = delete;
     ~ErForceSimulator() = default;
 
@@ -106,6 +116,17 @@ class ErForceSimulator
      */
     std::vector<SSLProto::SSL_WrapperPacket> getSSLWrapperPackets() const;
 
+    /**
+     * Returns the detections of the most recent camera frames. This uses the same
+     * noise, latency and camera model as getSSLWrapperPackets, but skips building the
+     * SSL Wrapper Packets, so it should be used instead of getSSLWrapperPackets when
+     * the detections are consumed in the same process (ex. by SensorFusion in
+     * simulated tests). Only one of them should be called per simulation step
+     *
+     * @return one VisionDetectionFrame per camera, in meters and radians
+     */
+    std::vector<VisionDetectionFrame> getVisionDetectionFrames() const;
+
     /**
      * Returns the current Simulator State
      */
@@ -130,6 +151,22 @@ class ErForceSimulator
      */
     void resetCurrentTime();
 
+    /**
+     * Returns the sub-step bullet used for the last simulation step, which is only
+     * larger than the default one in adaptive stepping mode
+     *
+     * @return the sub-step of the last simulation step
+     */
+    Duration getLastSubStep() const;
+
+    /**
+     * Returns the number of robots that are asleep, which only happens in adaptive
+     * stepping mode
+     *
+     * @return the number of sleeping robots on both teams
+     */
+    unsigned int getNumSleepingRobots() const;
+
     /**
      * Creates the default realism config using erforce simulator's default config
      * @return a pointer to default realism config
@@ -173,32 +210,57 @@ class ErForceSimulator
         const google::protobuf::RepeatedPtrField<world::SimRobot>& sim_robots);
 
     /**
-     * Update Simulator Robot and get the latest robot control
+     * Steps a single robot's primitive executor and gets the robot's latest command
      *
-     * @param robot_primitive_executor_map Map of robot IDs to the robot's primitive
-     * executor
-     * @param world_msg The world msg for this team of robots
+     * @param robot_id The id of the robot
+     * @param primitive_executor The robot's primitive executor
+     * @param current_velocity_map Map of robot IDs to the current local and angular
+     * velocity of the robots on this robot's team
      *
-     * @return robot control
+     * @return the robot command, owned by step_arena
      */
-    SSLSimulationProto::RobotControl updateSimulatorRobots(
-        std::unordered_map<unsigned int, std::shared_ptr<PrimitiveExecutor>>&
-            robot_primitive_executor_map,
-        const TbotsProto::World& world_msg, gameController::Team side);
+    SSLSimulationProto::RobotCommand* stepRobotPrimitiveExecutor(
+        RobotId robot_id, PrimitiveExecutor& primitive_executor,
+        const std::map<RobotId, std::pair<Vector, AngularVelocity>>&
+            current_velocity_map);
+
+    /**
+     * Update the Simulator Robots of both teams and write their latest robot controls.
+     *
+     * The robots' primitive executors are independent of each other, so they are
+     * stepped in parallel when there are robot step threads. The commands are always
+     * merged in the same order as when stepping serially.
+     *
+     * @param sim_state The current simulator state
+     * @param yellow_robot_control The robot control to add yellow robot commands to
+     * @param blue_robot_control The robot control to add blue robot commands to
+     */
+    void updateSimulatorRobots(const world::SimulatorState& sim_state,
+                               SSLSimulationProto::RobotControl& yellow_robot_control,
+                               SSLSimulationProto::RobotControl& blue_robot_control);
+
+    /**
+     * Creates the status of a team's robots, which only reports which robot has the
+     * ball
+     *
+     * @param robot_with_ball The robot on the team that has the ball, if any
+     *
+     * @return the robot status
+     */
+    static TbotsProto::RobotStatus createRobotStatus(
+        const std::optional<RobotId>& robot_with_ball);
 
     /**
      * Takes in current velocity and angular velocity and a target Direct Control
-     * primitive converts current and target velocities to Wheel velocities ramps the
-     * target primitive based on the current velocities and returns a pointer to a new
-     * Direct Control primitive
+     * primitive converts current and target velocities to Wheel velocities and ramps the
+     * target primitive in place based on the current velocities
      *
      * @param current_local_velocity the current velocity of a robot
      * @param current_local_angular_velocity the current angular velocity of a robot
      * @param target_velocity_primitive the target primitive that should be ramped
      * @param time_to_ramp time it should be ramped over
-     * @return
      */
-    std::unique_ptr<TbotsProto::DirectControlPrimitive> getRampedVelocityPrimitive(
+    void rampVelocityPrimitive(
         const Vector current_local_velocity,
         const AngularVelocity current_local_angular_velocity,
         TbotsProto::DirectControlPrimitive& target_velocity_primitive,
@@ -230,6 +292,29 @@ class ErForceSimulator
 
     bool ramping;
 
+    // Messages that only live for a single simulation step are allocated in
+    // step_arena, which is reset at the start of every step. These are never returned
+    // to callers, since they would dangle after the next step. The arena starts out
+    // with a fixed-size block that is reused across steps, so steady-state stepping
+    // does not allocate on the heap for these messages. The block must be declared
+    // before the arena so that it outlives it
+    static constexpr size_t STEP_ARENA_BLOCK_SIZE_BYTES = 64 * 1024;
+    std::unique_ptr<char[]> step_arena_block;
+    std::unique_ptr<google::protobuf::Arena> step_arena;
+
+    // A robot whose primitive executor is stepped during updateSimulatorRobots
+    struct RobotStepTask
+    {
+        RobotId robot_id;
+        PrimitiveExecutor* primitive_executor;
+        const std::map<RobotId, std::pair<Vector, AngularVelocity>>*
+            current_velocity_map;
+        SSLSimulationProto::RobotCommand* robot_command;
+    };
+    // Reused between steps to avoid reallocating it every step
+    std::vector<RobotStepTask> robot_step_tasks;
+    std::unique_ptr<ThreadPool> robot_step_thread_pool;
+
     const QString CONFIG_FILE      = "simulator/2020";
     const QString CONFIG_DIRECTORY = "extlibs/er_force_sim/config/";
 };
@@ -5,6 +5,7 @@
 #include <fenv.h>
 
 #include "proto/message_translation/er_force_world.h"
+#include "proto/message_translation/ssl_detection.h"
 #include "proto/message_translation/tbots_protobuf.h"
 #include "proto/primitive/primitive_msg_factory.h"
 #include "shared/2021_robot_constants.h"
@@ -306,6 +307,338 @@ TEST_F(ErForceSimulatorTest, yellow_robot_add_robots_and_change_position)
     EXPECT_EQ(new_states.size(), yellow_robots.size());
 }
 
+TEST(ErForceSimulatorVisionTest, vision_detection_frames_match_ssl_wrapper_packets)
+{
+    // TODO (#2419): remove this to re-enable sigfpe checks
+    fedisableexcept(FE_INVALID | FE_OVERFLOW);
+    RobotConstants_t robot_constants = create2021RobotConstants();
+
+    // Both simulators are stepped identically, so one can be asked for the SSL Wrapper
+    // Packets and the other for the VisionDetectionFrames of the same step
+    auto packet_realism_config = ErForceSimulator::createDefaultRealismConfig();
+    auto frame_realism_config  = ErForceSimulator::createDefaultRealismConfig();
+    ErForceSimulator packet_simulator(TbotsProto::FieldType::DIV_B, robot_constants,
+                                      packet_realism_config);
+    ErForceSimulator frame_simulator(TbotsProto::FieldType::DIV_B, robot_constants,
+                                     frame_realism_config);
+    for (ErForceSimulator* simulator : {&packet_simulator, &frame_simulator})
+    {
+        simulator->setBallState(BallState(Point(0.5, 0.5), Vector(1, 0)));
+        simulator->setYellowRobots(TestUtil::createStationaryRobotStatesWithId(
+            {Point(-2, 1), Point(1, -2), Point(-0.2, 0)}));
+        simulator->setBlueRobots(TestUtil::createStationaryRobotStatesWithId(
+            {Point(2, 2), Point(-3, -1), Point(0.2, 0)}));
+        simulator->stepSimulation(Duration::fromSeconds(1.0 / 60.0));
+    }
+
+    auto packets = packet_simulator.getSSLWrapperPackets();
+    auto frames  = frame_simulator.getVisionDetectionFrames();
+
+    ASSERT_EQ(packets.size(), frames.size());
+    for (size_t i = 0; i < packets.size(); i++)
+    {
+        ASSERT_TRUE(packets[i].has_detection());
+        const auto& detection = packets[i].detection();
+        EXPECT_EQ(detection.camera_id(), frames[i].camera_id);
+        EXPECT_EQ(Timestamp::fromSeconds(detection.t_capture()), frames[i].t_capture);
+
+        auto ball_detections = createBallDetections({detection});
+        ASSERT_EQ(ball_detections.size(), frames[i].ball_detections.size());
+        for (size_t j = 0; j < ball_detections.size(); j++)
+        {
+            EXPECT_EQ(ball_detections[j].position, frames[i].ball_detections[j].position);
+            EXPECT_DOUBLE_EQ(ball_detections[j].distance_from_ground,
+                             frames[i].ball_detections[j].distance_from_ground);
+        }
+
+        for (TeamColour team_colour : {TeamColour::YELLOW, TeamColour::BLUE})
+        {
+            auto robot_detections = createTeamDetection({detection}, team_colour);
+            const auto& frame_robot_detections =
+                team_colour == TeamColour::YELLOW ? frames[i].yellow_robot_detections
+                                                  : frames[i].blue_robot_detections;
+            ASSERT_EQ(robot_detections.size(), frame_robot_detections.size());
+            for (size_t j = 0; j < robot_detections.size(); j++)
+            {
+                EXPECT_EQ(robot_detections[j].id, frame_robot_detections[j].id);
+                EXPECT_EQ(robot_detections[j].position,
+                          frame_robot_detections[j].position);
+                EXPECT_EQ(robot_detections[j].orientation,
+                          frame_robot_detections[j].orientation);
+            }
+        }
+    }
+}
+
+/**
+ * Creates a move primitive from the given start position to the given destination
+ *
+ * @param start_position The position the robot starts at
+ * @param destination The destination of the move primitive
+ * @param final_angle The orientation the robot should end up at
+ *
+ * @return The move primitive
+ */
+static TbotsProto::Primitive createMovePrimitive(const Point& start_position,
+                                                 const Point& destination,
+                                                 const Angle& final_angle)
+{
+    TbotsProto::Primitive primitive;
+    TbotsProto::TrajectoryPathParams2D* xy_traj_params =
+        primitive.mutable_move()->mutable_xy_traj_params();
+    *(xy_traj_params->mutable_start_position()) = *createPointProto(start_position);
+    *(xy_traj_params->mutable_destination())    = *createPointProto(destination);
+    xy_traj_params->set_max_speed_mode(TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT);
+
+    TbotsProto::TrajectoryParamsAngular1D* w_traj_params =
+        primitive.mutable_move()->mutable_w_traj_params();
+    *(w_traj_params->mutable_start_angle()) = *createAngleProto(Angle::zero());
+    *(w_traj_params->mutable_final_angle()) = *createAngleProto(final_angle);
+    return primitive;
+}
+
+TEST(ErForceSimulatorParallelTest, parallel_robot_stepping_matches_serial_stepping)
+{
+    // TODO (#2419): remove this to re-enable sigfpe checks
+    fedisableexcept(FE_INVALID | FE_OVERFLOW);
+    RobotConstants_t robot_constants = create2021RobotConstants();
+
+    // Direct control primitives only exercise the physics, while move primitives also
+    // generate and follow trajectories in the primitive executors of each robot
+    for (bool move_primitives : {false, true})
+    {
+        for (bool ramping : {false, true})
+        {
+            auto serial_realism_config   = ErForceSimulator::createDefaultRealismConfig();
+            auto parallel_realism_config = ErForceSimulator::createDefaultRealismConfig();
+            ErForceSimulator serial_simulator(TbotsProto::FieldType::DIV_A,
+                                              robot_constants, serial_realism_config,
+                                              ramping);
+            ErForceSimulator parallel_simulator(
+                TbotsProto::FieldType::DIV_A, robot_constants, parallel_realism_config,
+                ramping, DEFAULT_SIMULATOR_TICK_RATE_SECONDS_PER_TICK, 4);
+
+            std::vector<RobotStateWithId> yellow_robots;
+            std::vector<RobotStateWithId> blue_robots;
+            TbotsProto::PrimitiveSet yellow_primitive_set;
+            TbotsProto::PrimitiveSet blue_primitive_set;
+            for (unsigned int id = 0; id < 11; id++)
+            {
+                double y = -4.0 + 0.7 * id;
+                yellow_robots.push_back(RobotStateWithId{
+                    .id          = id,
+                    .robot_state = RobotState(Point(-2, y), Vector(0, 0), Angle::zero(),
+                                              AngularVelocity::zero())});
+                blue_robots.push_back(RobotStateWithId{
+                    .id          = id,
+                    .robot_state = RobotState(Point(2, y), Vector(0, 0), Angle::half(),
+                                              AngularVelocity::zero())});
+                if (move_primitives)
+                {
+                    (*yellow_primitive_set.mutable_robot_primitives())[id] =
+                        createMovePrimitive(Point(-2, y), Point(1, y + 0.3 * id),
+                                            Angle::fromRadians(0.3 * id));
+                    (*blue_primitive_set.mutable_robot_primitives())[id] =
+                        createMovePrimitive(Point(2, y), Point(-1.5, -y),
+                                            Angle::fromRadians(-0.2 * id));
+                }
+                else
+                {
+                    (*yellow_primitive_set.mutable_robot_primitives())[id] =
+                        *createDirectControlPrimitive(
+                            Vector(0.2 * id, 1 - 0.1 * id),
+                            AngularVelocity::fromRadians(0.3 * id), 0,
+                            TbotsProto::AutoChipOrKick());
+                    (*blue_primitive_set.mutable_robot_primitives())[id] =
+                        *createDirectControlPrimitive(
+                            Vector(-0.1 * id, 0.5),
+                            AngularVelocity::fromRadians(-0.2 * id), 0,
+                            TbotsProto::AutoChipOrKick());
+                }
+            }
+
+            for (ErForceSimulator* simulator : {&serial_simulator, &parallel_simulator})
+            {
+                simulator->setBallState(BallState(Point(0, 0), Vector(1, 0.5)));
+                simulator->setYellowRobots(yellow_robots);
+                simulator->setBlueRobots(blue_robots);
+                simulator->setYellowRobotPrimitiveSet(
+                    yellow_primitive_set, std::make_unique<TbotsProto::World>());
+                simulator->setBlueRobotPrimitiveSet(
+                    blue_primitive_set, std::make_unique<TbotsProto::World>());
+            }
+
+            for (unsigned int i = 0; i < 500; i++)
+            {
+                serial_simulator.stepSimulation(Duration::fromMilliseconds(1));
+                parallel_simulator.stepSimulation(Duration::fromMilliseconds(1));
+            }
+
+            // The states must be bit-identical, not just within tolerance
+            EXPECT_EQ(serial_simulator.getSimulatorState().SerializeAsString(),
+                      parallel_simulator.getSimulatorState().SerializeAsString())
+                << "move primitives: " << move_primitives << ", ramping: " << ramping;
+        }
+    }
+}
+
+TEST(ErForceSimulatorAdaptiveSteppingTest, adaptive_stepping_matches_fixed_stepping)
+{
+    // TODO (#2419): remove this to re-enable sigfpe checks
+    fedisableexcept(FE_INVALID | FE_OVERFLOW);
+    RobotConstants_t robot_constants = create2021RobotConstants();
+
+    // The first scenario has all robots stopped like during HALT, the second one has
+    // the robots driving around
+    for (bool robots_moving : {false, true})
+    {
+        auto fixed_realism_config    = ErForceSimulator::createDefaultRealismConfig();
+        auto adaptive_realism_config = ErForceSimulator::createDefaultRealismConfig();
+        adaptive_realism_config->set_adaptive_stepping(true);
+        ErForceSimulator fixed_simulator(TbotsProto::FieldType::DIV_A, robot_constants,
+                                         fixed_realism_config);
+        ErForceSimulator adaptive_simulator(TbotsProto::FieldType::DIV_A,
+                                            robot_constants, adaptive_realism_config);
+
+        std::vector<RobotStateWithId> yellow_robots;
+        std::vector<RobotStateWithId> blue_robots;
+        TbotsProto::PrimitiveSet primitive_set;
+        for (unsigned int id = 0; id < 6; id++)
+        {
+            double y = -3.0 + 1.2 * id;
+            yellow_robots.push_back(RobotStateWithId{
+                .id          = id,
+                .robot_state = RobotState(Point(-3, y), Vector(0, 0), Angle::zero(),
+                                          AngularVelocity::zero())});
+            blue_robots.push_back(RobotStateWithId{
+                .id          = id,
+                .robot_state = RobotState(Point(3, y), Vector(0, 0), Angle::half(),
+                                          AngularVelocity::zero())});
+            if (robots_moving)
+            {
+                (*primitive_set.mutable_robot_primitives())[id] =
+                    *createDirectControlPrimitive(Vector(0.5, 0.1 * id),
+                                                  AngularVelocity::fromRadians(0.5), 0,
+                                                  TbotsProto::AutoChipOrKick());
+            }
+            else
+            {
+                (*primitive_set.mutable_robot_primitives())[id] =
+                    *createStopPrimitiveProto();
+            }
+        }
+
+        for (ErForceSimulator* simulator : {&fixed_simulator, &adaptive_simulator})
+        {
+            simulator->setBallState(BallState(Point(0, 0), Vector(0, 0)));
+            simulator->setYellowRobots(yellow_robots);
+            simulator->setBlueRobots(blue_robots);
+        }
+
+        // step at the camera frame rate, so that the adaptive simulator can take
+        // larger sub-steps
+        unsigned int num_adaptive_sub_steps = 0;
+        for (unsigned int i = 0; i < 120; i++)
+        {
+            for (ErForceSimulator* simulator : {&fixed_simulator, &adaptive_simulator})
+            {
+                simulator->setYellowRobotPrimitiveSet(
+                    primitive_set, std::make_unique<TbotsProto::World>());
+                simulator->setBlueRobotPrimitiveSet(
+                    primitive_set, std::make_unique<TbotsProto::World>());
+                simulator->stepSimulation(Duration::fromSeconds(1.0 / 60.0));
+            }
+            EXPECT_EQ(0u, fixed_simulator.getNumSleepingRobots());
+            EXPECT_DOUBLE_EQ(SUB_TIMESTEP, fixed_simulator.getLastSubStep().toSeconds());
+            if (adaptive_simulator.getLastSubStep().toSeconds() > SUB_TIMESTEP)
+            {
+                num_adaptive_sub_steps++;
+            }
+        }
+
+        // the robots and the ball are far apart in both scenarios, so the larger
+        // sub-step should be used, and only stopped robots should fall asleep
+        EXPECT_GT(num_adaptive_sub_steps, 0u);
+        EXPECT_EQ(robots_moving ? 0u : 12u, adaptive_simulator.getNumSleepingRobots());
+
+        const double tolerance    = robots_moving ? 0.05 : 0.01;
+        const auto fixed_state    = fixed_simulator.getSimulatorState();
+        const auto adaptive_state = adaptive_simulator.getSimulatorState();
+        ASSERT_EQ(fixed_state.yellow_robots_size(), adaptive_state.yellow_robots_size());
+        ASSERT_EQ(fixed_state.blue_robots_size(), adaptive_state.blue_robots_size());
+        for (int i = 0; i < fixed_state.yellow_robots_size(); i++)
+        {
+            EXPECT_NEAR(fixed_state.yellow_robots(i).p_x(),
+                        adaptive_state.yellow_robots(i).p_x(), tolerance);
+            EXPECT_NEAR(fixed_state.yellow_robots(i).p_y(),
+                        adaptive_state.yellow_robots(i).p_y(), tolerance);
+        }
+        for (int i = 0; i < fixed_state.blue_robots_size(); i++)
+        {
+            EXPECT_NEAR(fixed_state.blue_robots(i).p_x(),
+                        adaptive_state.blue_robots(i).p_x(), tolerance);
+            EXPECT_NEAR(fixed_state.blue_robots(i).p_y(),
+                        adaptive_state.blue_robots(i).p_y(), tolerance);
+        }
+        EXPECT_NEAR(fixed_state.ball().p_x(), adaptive_state.ball().p_x(), tolerance);
+        EXPECT_NEAR(fixed_state.ball().p_y(), adaptive_state.ball().p_y(), tolerance);
+    }
+}
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST_F(ErForceSimulatorTest, DISABLED_step_simulation_speed_test)
+{
+    // This test does not assert anything. Rather, it can be used to gauge how many
+    // steps per second the simulator can run with full teams of robots, and can be
+    // profiled in order to find areas of improvement for stepSimulation. Like the
+    // simulator tick, every step also gets the SSL Wrapper Packets and robot statuses
+    const unsigned int num_robots_per_team = 11;
+    const unsigned int num_steps           = 5000;
+
+    std::vector<RobotStateWithId> yellow_robots;
+    std::vector<RobotStateWithId> blue_robots;
+    for (unsigned int id = 0; id < num_robots_per_team; id++)
+    {
+        double y = -4.0 + 0.7 * id;
+        yellow_robots.push_back(RobotStateWithId{
+            .id          = id,
+            .robot_state = RobotState(Point(-2, y), Vector(0, 0), Angle::zero(),
+                                      AngularVelocity::zero())});
+        blue_robots.push_back(RobotStateWithId{
+            .id          = id,
+            .robot_state = RobotState(Point(2, y), Vector(0, 0), Angle::half(),
+                                      AngularVelocity::zero())});
+    }
+    simulator->setBallState(BallState(Point(0, 0), Vector(1, 0)));
+    simulator->setYellowRobots(yellow_robots);
+    simulator->setBlueRobots(blue_robots);
+
+    TbotsProto::PrimitiveSet primitive_set;
+    for (unsigned int id = 0; id < num_robots_per_team; id++)
+    {
+        (*primitive_set.mutable_robot_primitives())[id] = *createDirectControlPrimitive(
+            Vector(1, 0), AngularVelocity::quarter(), 0, TbotsProto::AutoChipOrKick());
+    }
+    simulator->setYellowRobotPrimitiveSet(primitive_set,
+                                          std::make_unique<TbotsProto::World>());
+    simulator->setBlueRobotPrimitiveSet(primitive_set,
+                                        std::make_unique<TbotsProto::World>());
+
+    auto start_time = std::chrono::system_clock::now();
+    for (unsigned int i = 0; i < num_steps; i++)
+    {
+        simulator->stepSimulation(Duration::fromMilliseconds(1));
+        simulator->getSSLWrapperPackets();
+        simulator->getBlueRobotStatuses();
+        simulator->getYellowRobotStatuses();
+    }
+    double duration_ms = ::TestUtil::millisecondsSince(start_time);
+
+    std::cout << "Took " << duration_ms << "ms to run " << num_steps << " steps, "
+              << num_steps / (duration_ms / 1000.0) << " steps per second" << std::endl;
+}
+
 
 TEST(ErForceSimulatorFieldTest, check_field_A_configuration)
 {
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "spi_communication.h"
+
+
+/*
+ * A mock of SpiCommunication class used for testing purposes
+ */
+
+class MockSpi : public SpiCommunication
+{
+   public:
+    MockSpi(){};
+    ~MockSpi(){};
+    MOCK_METHOD3(transfer, bool(int fd, struct spi_ioc_transfer *transfers,
+                                unsigned num_transfers));
+};
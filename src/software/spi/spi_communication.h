@@ -0,0 +1,31 @@
+#pragma once
+
+#include <linux/spi/spidev.h>
+
+/*
+ * Interface for SPI Communication
+ */
+class SpiCommunication
+{
+   public:
+    SpiCommunication() = default;
+
+    virtual ~SpiCommunication() = default;
+
+    SpiCommunication(const SpiCommunication &) = delete;
+
+    SpiCommunication &operator=(const SpiCommunication &) = delete;
+
+    /**
+     * Performs the given transfers as a single SPI message to the device open on the
+     * given file descriptor. The chip select stays active between the transfers,
+     * unless a transfer sets cs_change to toggle it before the next transfer.
+     *
+     * @param fd the file descriptor of the SPI device
+     * @param transfers the transfers to perform, in order
+     * @param num_transfers the number of transfers
+     * @return true upon success, false otherwise
+     */
+    virtual bool transfer(int fd, struct spi_ioc_transfer *transfers,
+                          unsigned num_transfers) = 0;
+};
@@ -0,0 +1,13 @@
+#include "spidev_communication.h"
+
+#include <sys/ioctl.h>
+
+bool SpidevCommunication::transfer(int fd, struct spi_ioc_transfer *transfers,
+                                   unsigned num_transfers)
+{
+    // SPI_IOC_MESSAGE only takes a constant number of transfers, so the request is
+    // built the same way from the number of transfers in this message
+    unsigned long request =
+        _IOC(_IOC_WRITE, SPI_IOC_MAGIC, 0, SPI_MSGSIZE(num_transfers));
+    return ioctl(fd, request, transfers) >= 1;
+}
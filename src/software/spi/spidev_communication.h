@@ -0,0 +1,18 @@
+#pragma once
+
+#include "spi_communication.h"
+
+/*
+ * Communicates with SPI devices through the Linux spidev driver, sending each message
+ * with a single ioctl
+ */
+class SpidevCommunication : public SpiCommunication
+{
+   public:
+    SpidevCommunication() = default;
+
+    ~SpidevCommunication() override = default;
+
+    bool transfer(int fd, struct spi_ioc_transfer *transfers,
+                  unsigned num_transfers) override;
+};
@@ -0,0 +1,70 @@
+#include "software/test_util/allocation_counter.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+// The number of heap allocations made by each thread since it started
+thread_local std::size_t num_allocations = 0;
+
+/**
+ * Allocates memory and counts the allocation, like the default operator new
+ *
+ * @param size The number of bytes to allocate
+ *
+ * @throws std::bad_alloc if the memory could not be allocated
+ *
+ * @return the allocated memory
+ */
+void* countedAllocate(std::size_t size)
+{
+    num_allocations++;
+    // malloc(0) may return a null pointer, but operator new must not
+    if (void* memory = std::malloc(size == 0 ? 1 : size))
+    {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+}  // namespace
+
+void* operator new(std::size_t size)
+{
+    return countedAllocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return countedAllocate(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+namespace TestUtil
+{
+    AllocationCounter::AllocationCounter() : start_num_allocations(num_allocations) {}
+
+    std::size_t AllocationCounter::getNumAllocations() const
+    {
+        return num_allocations - start_num_allocations;
+    }
+}  // namespace TestUtil
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+
+namespace TestUtil
+{
+    /**
+     * Counts the heap allocations made by the current thread while it is alive, so
+     * tests can check that some code does not allocate memory (ex. once it has warmed
+     * up).
+     *
+     * Allocations are counted by replacing the global operator new, so this only works
+     * in binaries that link in the allocation_counter library
+     */
+    class AllocationCounter
+    {
+       public:
+        /**
+         * Creates a new AllocationCounter that starts counting allocations now
+         */
+        explicit AllocationCounter();
+
+        /**
+         * Gets the number of heap allocations the current thread made since this
+         * AllocationCounter was created
+         *
+         * @return the number of heap allocations made
+         */
+        std::size_t getNumAllocations() const;
+
+       private:
+        std::size_t start_num_allocations;
+    };
+}  // namespace TestUtil
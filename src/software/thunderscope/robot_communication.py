@@ -27,6 +27,7 @@ class RobotCommunication(object):
         estop_path: os.PathLike = None,
         estop_baudrate: int = 115200,
         enable_radio: bool = False,
+        enable_compact_primitives: bool = False,
     ):
         """Initialize the communication with the robots
 
@@ -37,6 +38,8 @@ class RobotCommunication(object):
         :param estop_path: The path to the estop
         :param estop_baudrate: The baudrate of the estop
         :param enable_radio: Whether to use radio to send primitives to robots
+        :param enable_compact_primitives: Whether to send primitives over Wi-Fi in the
+            compact wire format instead of as protobufs
 
         """
         self.receive_ssl_referee_proto = None
@@ -52,6 +55,7 @@ class RobotCommunication(object):
         self.estop_buadrate = estop_baudrate
 
         self.enable_radio = enable_radio
+        self.enable_compact_primitives = enable_compact_primitives
 
         self.running = False
 
@@ -319,6 +323,12 @@ class RobotCommunication(object):
         # Create multicast senders
         if self.enable_radio:
             self.send_primitive_set = tbots_cpp.PrimitiveSetProtoRadioSender()
+        elif self.enable_compact_primitives:
+            self.send_primitive_set = tbots_cpp.CompactPrimitiveSetUdpSender(
+                self.multicast_channel + "%" + self.interface,
+                COMPACT_PRIMITIVE_PORT,
+                True,
+            )
         else:
             self.send_primitive_set = tbots_cpp.PrimitiveSetProtoUdpSender(
                 self.multicast_channel + "%" + self.interface, PRIMITIVE_PORT, True
@@ -155,6 +155,12 @@ if __name__ == "__main__":
         default=False,
         help="Whether to use radio (True) or Wi-Fi (False) for sending primitives to robots",
     )
+    parser.add_argument(
+        "--enable_compact_primitives",
+        action="store_true",
+        default=False,
+        help="Whether to send primitives over Wi-Fi in the compact wire format",
+    )
     parser.add_argument(
         "--visualization_buffer_size",
         action="store",
@@ -317,6 +323,7 @@ if __name__ == "__main__":
             estop_mode=estop_mode,
             estop_path=estop_path,
             enable_radio=args.enable_radio,
+            enable_compact_primitives=args.enable_compact_primitives,
         ) as robot_communication:
 
             if estop_mode == EstopMode.KEYBOARD_ESTOP:
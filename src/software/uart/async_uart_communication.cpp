@@ -0,0 +1,98 @@
+#include "software/uart/async_uart_communication.h"
+
+#include "software/logger/logger.h"
+
+AsyncUartCommunication::AsyncUartCommunication(
+    int baud_rate, const std::string& device_serial_port,
+    std::function<void(uint8_t*, std::size_t)> on_frame)
+    : device_serial_port(device_serial_port),
+      on_frame(std::move(on_frame)),
+      io_service(),
+      serial_port(io_service, device_serial_port),
+      receive_buffer(),
+      write_buffer(),
+      is_writing(false)
+{
+    int uart_character_size_bits = 8;
+    serial_port.set_option(boost::asio::serial_port_base::baud_rate(baud_rate));
+    serial_port.set_option(boost::asio::serial_port::flow_control(
+        boost::asio::serial_port::flow_control::none));
+    serial_port.set_option(
+        boost::asio::serial_port::parity(boost::asio::serial_port::parity::none));
+    serial_port.set_option(
+        boost::asio::serial_port::stop_bits(boost::asio::serial_port::stop_bits::one));
+    serial_port.set_option(boost::asio::serial_port::character_size(
+        boost::asio::serial_port::character_size(uart_character_size_bits)));
+
+    startRead();
+    io_thread = std::thread([this]() { io_service.run(); });
+}
+
+AsyncUartCommunication::~AsyncUartCommunication()
+{
+    io_service.stop();
+    io_thread.join();
+    serial_port.close();
+}
+
+uint8_t* AsyncUartCommunication::getWriteBuffer()
+{
+    if (is_writing)
+    {
+        return nullptr;
+    }
+    return write_buffer.data();
+}
+
+void AsyncUartCommunication::startWrite(std::size_t num_bytes)
+{
+    CHECK(num_bytes <= WRITE_BUFFER_SIZE) << "Write of " << num_bytes
+                                          << " bytes does not fit in the write buffer";
+
+    is_writing = true;
+    boost::asio::async_write(
+        serial_port, boost::asio::buffer(write_buffer.data(), num_bytes),
+        [this](const boost::system::error_code& error, std::size_t) {
+            is_writing = false;
+            if (error && error != boost::asio::error::operation_aborted)
+            {
+                LOG(FATAL) << "Writing to " << device_serial_port
+                           << " failed: " << error.message();
+            }
+        });
+}
+
+void AsyncUartCommunication::startRead()
+{
+    uint8_t* free_space = receive_buffer.getFreeSpace();
+    serial_port.async_read_some(
+        boost::asio::buffer(free_space, receive_buffer.getFreeSpaceSize()),
+        [this](const boost::system::error_code& error, std::size_t num_bytes) {
+            handleRead(error, num_bytes);
+        });
+}
+
+void AsyncUartCommunication::handleRead(const boost::system::error_code& error,
+                                        std::size_t num_bytes)
+{
+    if (error)
+    {
+        if (error != boost::asio::error::operation_aborted)
+        {
+            LOG(FATAL) << "Reading from " << device_serial_port
+                       << " failed: " << error.message();
+        }
+        return;
+    }
+
+    receive_buffer.commit(num_bytes);
+
+    uint8_t* frame;
+    std::size_t length;
+    while (receive_buffer.nextFrame(frame, length))
+    {
+        on_frame(frame, length);
+    }
+
+    startRead();
+}
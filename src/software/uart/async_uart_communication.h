@@ -0,0 +1,95 @@
+#pragma once
+
+#include <array>
+#include <boost/asio.hpp>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <thread>
+
+#include "software/uart/cobs_frame_buffer.h"
+
+/**
+ * Communicates with a device over a serial port without blocking the threads that use
+ * it. Bytes are read as they arrive by a thread that runs the io_service, and the
+ * complete COBS frames they contain are passed to a callback on that thread.
+ *
+ * Bytes are received into and sent from fixed buffers, so no memory is allocated
+ * while communicating.
+ */
+class AsyncUartCommunication
+{
+   public:
+    static constexpr std::size_t RECEIVE_BUFFER_SIZE = 1024;
+    static constexpr std::size_t WRITE_BUFFER_SIZE   = 256;
+
+    /**
+     * Opens the serial port and starts reading from it.
+     * setting used: No flow control, No parity, 1 stop bit
+     *
+     * @param baud_rate the desired baud rate of the connection
+     * @param device_serial_port the serial port that we want to communicate with
+     * @param on_frame called with each complete frame received, from its start flag to
+     * its end flag. The frame may be modified (ex. decoded in place), but is only valid
+     * during the call
+     *
+     * @throws boost::system::system_error if the serial port could not be opened
+     */
+    AsyncUartCommunication(int baud_rate, const std::string& device_serial_port,
+                           std::function<void(uint8_t*, std::size_t)> on_frame);
+
+    AsyncUartCommunication(const AsyncUartCommunication&) = delete;
+
+    AsyncUartCommunication& operator=(const AsyncUartCommunication&) = delete;
+
+    /**
+     * Stops reading and writing, and closes the serial port
+     */
+    ~AsyncUartCommunication();
+
+    /**
+     * Gets the buffer that the bytes of the next write should be written to.
+     * Must only be called from the frame callback.
+     *
+     * @return the buffer of WRITE_BUFFER_SIZE bytes, or nullptr if the last write is
+     * still in progress
+     */
+    uint8_t* getWriteBuffer();
+
+    /**
+     * Starts writing bytes from the write buffer to the serial port.
+     * Must only be called from the frame callback, after getWriteBuffer.
+     *
+     * @param num_bytes the number of bytes at the start of the write buffer to write
+     */
+    void startWrite(std::size_t num_bytes);
+
+   private:
+    /**
+     * Starts reading bytes into the free space of the receive buffer
+     */
+    void startRead();
+
+    /**
+     * Handles bytes that were read into the receive buffer, passing any complete
+     * frames to the frame callback, and starts the next read
+     *
+     * @param error the error of the read, if any
+     * @param num_bytes the number of bytes read
+     */
+    void handleRead(const boost::system::error_code& error, std::size_t num_bytes);
+
+    std::string device_serial_port;
+    std::function<void(uint8_t*, std::size_t)> on_frame;
+
+    boost::asio::io_service io_service;
+    boost::asio::serial_port serial_port;
+
+    CobsFrameBuffer<RECEIVE_BUFFER_SIZE> receive_buffer;
+    std::array<uint8_t, WRITE_BUFFER_SIZE> write_buffer;
+
+    // Only used by the io thread
+    bool is_writing;
+
+    std::thread io_thread;
+};
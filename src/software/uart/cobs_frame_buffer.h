@@ -0,0 +1,159 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#include "shared/uart_framing/uart_framing.hpp"
+
+/**
+ * A fixed size buffer that bytes received over UART are read into directly, and that
+ * complete COBS frames (from a start flag to an end flag) are found in. The frames are
+ * not copied out of the buffer, so they can be decoded in place.
+ *
+ * Bytes are appended to the buffer until its end, at which point the buffer wraps
+ * around by moving the bytes that haven't been consumed yet, which are at most a
+ * partial frame, to its start. This keeps every frame contiguous.
+ *
+ * @tparam CAPACITY the number of bytes the buffer can hold, which should be several
+ * times the size of a frame so that the buffer rarely has to wrap
+ */
+template <std::size_t CAPACITY>
+class CobsFrameBuffer
+{
+   public:
+    CobsFrameBuffer() : buffer(), start(0), end(0), num_dropped_bytes(0) {}
+
+    CobsFrameBuffer(const CobsFrameBuffer&) = delete;
+
+    CobsFrameBuffer& operator=(const CobsFrameBuffer&) = delete;
+
+    /**
+     * Gets the free space at the end of the buffer that received bytes can be
+     * written to, wrapping the buffer around first if it is full
+     *
+     * @return a pointer to the free space
+     */
+    uint8_t* getFreeSpace()
+    {
+        if (start == end)
+        {
+            start = 0;
+            end   = 0;
+        }
+        else if (end == CAPACITY)
+        {
+            if (start == 0)
+            {
+                // The whole buffer is a single partial frame, which must be garbage
+                num_dropped_bytes += end;
+                end = 0;
+            }
+            else
+            {
+                std::memmove(buffer.data(), buffer.data() + start, end - start);
+                end -= start;
+                start = 0;
+            }
+        }
+        return buffer.data() + end;
+    }
+
+    /**
+     * Gets the number of bytes that can be written to the free space returned by the
+     * last call to getFreeSpace
+     *
+     * @return the number of bytes of free space
+     */
+    std::size_t getFreeSpaceSize() const
+    {
+        return CAPACITY - end;
+    }
+
+    /**
+     * Marks bytes written to the free space as received
+     *
+     * @param num_bytes the number of bytes that were written
+     */
+    void commit(std::size_t num_bytes)
+    {
+        end += num_bytes;
+    }
+
+    /**
+     * Finds the next complete frame in the received bytes. Any bytes before the
+     * first start flag, for example the end of a frame that was being sent when
+     * the port was opened, are dropped.
+     *
+     * The frame stays valid until the next call to getFreeSpace, and may be
+     * modified by the caller (ex. decoded in place)
+     *
+     * @param frame set to the start flag of the frame
+     * @param length set to the number of bytes from the start flag to the end flag
+     *
+     * @return true if a complete frame was found, false otherwise
+     */
+    bool nextFrame(uint8_t*& frame, std::size_t& length)
+    {
+        while (start < end && buffer[start] != START_END_FLAG_BYTE)
+        {
+            start++;
+            num_dropped_bytes++;
+        }
+
+        // The end flag of one frame may be followed by the start flag of the next,
+        // so the last flag in a run of flags is the start flag
+        while (start + 1 < end && buffer[start + 1] == START_END_FLAG_BYTE)
+        {
+            start++;
+        }
+        if (start + 1 >= end)
+        {
+            return false;
+        }
+
+        auto end_flag = static_cast<uint8_t*>(std::memchr(
+            buffer.data() + start + 1, START_END_FLAG_BYTE, end - start - 1));
+        if (end_flag == nullptr)
+        {
+            return false;
+        }
+
+        frame  = buffer.data() + start;
+        length = static_cast<std::size_t>(end_flag - frame) + 1;
+
+        // The end flag isn't consumed, so that it can also be the start flag of the
+        // next frame
+        start += length - 1;
+        return true;
+    }
+
+    /**
+     * Gets the number of received bytes that haven't been consumed as frames
+     *
+     * @return the number of bytes
+     */
+    std::size_t size() const
+    {
+        return end - start;
+    }
+
+    /**
+     * Gets the number of received bytes that were dropped because they weren't in a
+     * frame
+     *
+     * @return the number of dropped bytes
+     */
+    std::size_t getNumDroppedBytes() const
+    {
+        return num_dropped_bytes;
+    }
+
+   private:
+    std::array<uint8_t, CAPACITY> buffer;
+
+    // The received bytes that haven't been consumed are in [start, end)
+    std::size_t start;
+    std::size_t end;
+    std::size_t num_dropped_bytes;
+};
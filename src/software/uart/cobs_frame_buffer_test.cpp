@@ -0,0 +1,107 @@
+#include "software/uart/cobs_frame_buffer.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+class CobsFrameBufferTest : public ::testing::Test
+{
+   protected:
+    static constexpr std::size_t CAPACITY = 16;
+
+    /**
+     * Receives the given bytes into the buffer, like a read from a serial port
+     *
+     * @param bytes the bytes to receive, which must fit in the free space
+     */
+    void receive(const std::vector<uint8_t>& bytes)
+    {
+        uint8_t* free_space = buffer.getFreeSpace();
+        ASSERT_LE(bytes.size(), buffer.getFreeSpaceSize());
+        std::copy(bytes.begin(), bytes.end(), free_space);
+        buffer.commit(bytes.size());
+    }
+
+    /**
+     * Gets all the complete frames in the buffer
+     *
+     * @return the bytes of each frame
+     */
+    std::vector<std::vector<uint8_t>> getFrames()
+    {
+        std::vector<std::vector<uint8_t>> frames;
+        uint8_t* frame;
+        std::size_t length;
+        while (buffer.nextFrame(frame, length))
+        {
+            frames.emplace_back(frame, frame + length);
+        }
+        return frames;
+    }
+
+    CobsFrameBuffer<CAPACITY> buffer;
+};
+
+TEST_F(CobsFrameBufferTest, frame_in_one_read)
+{
+    receive({0x00, 0x03, 0x01, 0x02, 0x00});
+    EXPECT_EQ(getFrames(), std::vector<std::vector<uint8_t>>(
+                               {{0x00, 0x03, 0x01, 0x02, 0x00}}));
+    EXPECT_EQ(0, buffer.getNumDroppedBytes());
+}
+
+TEST_F(CobsFrameBufferTest, frame_split_across_reads)
+{
+    receive({0x00, 0x03});
+    EXPECT_TRUE(getFrames().empty());
+    receive({0x01, 0x02});
+    EXPECT_TRUE(getFrames().empty());
+    receive({0x00});
+    EXPECT_EQ(getFrames(), std::vector<std::vector<uint8_t>>(
+                               {{0x00, 0x03, 0x01, 0x02, 0x00}}));
+}
+
+TEST_F(CobsFrameBufferTest, back_to_back_frames)
+{
+    // Frames with separate end and start flags, and frames that share a flag
+    receive({0x00, 0x02, 0x01, 0x00, 0x00, 0x02, 0x02, 0x00, 0x02, 0x03, 0x00});
+    EXPECT_EQ(getFrames(), std::vector<std::vector<uint8_t>>({{0x00, 0x02, 0x01, 0x00},
+                                                              {0x00, 0x02, 0x02, 0x00},
+                                                              {0x00, 0x02, 0x03, 0x00}}));
+    EXPECT_EQ(0, buffer.getNumDroppedBytes());
+}
+
+TEST_F(CobsFrameBufferTest, drops_bytes_before_first_flag)
+{
+    // The end of a frame that was being sent before the port was opened
+    receive({0x05, 0x06, 0x00, 0x02, 0x01, 0x00});
+    EXPECT_EQ(getFrames(),
+              std::vector<std::vector<uint8_t>>({{0x00, 0x02, 0x01, 0x00}}));
+    EXPECT_EQ(2, buffer.getNumDroppedBytes());
+}
+
+TEST_F(CobsFrameBufferTest, wraps_partial_frame_to_start)
+{
+    receive({0x00, 0x02, 0x01, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x02, 0x03, 0x00});
+    EXPECT_EQ(3, getFrames().size());
+
+    // The start of the next frame fills the buffer, so it is moved to the start of the
+    // buffer when more bytes are received
+    receive({0x00, 0x04, 0x04, 0x05});
+    EXPECT_TRUE(getFrames().empty());
+    EXPECT_EQ(0, buffer.getFreeSpaceSize());
+    receive({0x06, 0x00});
+    EXPECT_EQ(getFrames(), std::vector<std::vector<uint8_t>>(
+                               {{0x00, 0x04, 0x04, 0x05, 0x06, 0x00}}));
+    EXPECT_EQ(0, buffer.getNumDroppedBytes());
+}
+
+TEST_F(CobsFrameBufferTest, drops_frame_bigger_than_buffer)
+{
+    receive(std::vector<uint8_t>(CAPACITY, 0x01));
+    EXPECT_TRUE(getFrames().empty());
+    receive({0x00, 0x02, 0x01, 0x00});
+    EXPECT_EQ(getFrames(),
+              std::vector<std::vector<uint8_t>>({{0x00, 0x02, 0x01, 0x00}}));
+    EXPECT_EQ(CAPACITY, buffer.getNumDroppedBytes());
+}
@@ -1,8 +1,13 @@
 #pragma once
 
+#include <array>
+#include <deque>
 #include <functional>
 #include <include/boost/sml.hpp>
-#include <queue>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
 
 #include "software/util/typename/typename.h"
 
@@ -12,9 +17,116 @@
  * for an example of how to implement a tactic using this framework
  */
 
+/**
+ * The queue of events that an FSM processes after the current event, such as the
+ * updates that an FSM sends to its sub FSMs.
+ *
+ * The first few events are stored inside the queue itself, so creating an FSM and
+ * processing events does not allocate memory unless many events are queued at once,
+ * unlike std::queue which allocates as soon as it is created. Like std::queue, queued
+ * events are never moved, since the FSM processes the front event while new events
+ * are pushed
+ *
+ * @tparam T The type of the queued events
+ */
+template <class T>
+class FSMEventQueue
+{
+   public:
+    FSMEventQueue() = default;
+
+    /**
+     * Checks if there are no queued events
+     *
+     * @return whether there are no queued events
+     */
+    bool empty() const
+    {
+        return num_inline_events == 0 && (!overflow_events || overflow_events->empty());
+    }
+
+    /**
+     * Gets the number of queued events
+     *
+     * @return the number of queued events
+     */
+    std::size_t size() const
+    {
+        return num_inline_events + (overflow_events ? overflow_events->size() : 0);
+    }
+
+    /**
+     * Gets the event that was queued first
+     *
+     * @return the event that was queued first
+     */
+    T &front()
+    {
+        if (num_inline_events > 0)
+        {
+            return *inline_events[first_inline_event];
+        }
+        return overflow_events->front();
+    }
+
+    /**
+     * Queues an event
+     *
+     * @param event The event to queue
+     */
+    void push(const T &event)
+    {
+        push(T(event));
+    }
+
+    void push(T &&event)
+    {
+        // Events only go inline if no events are waiting in the overflow, so that they
+        // are still processed in the order they were queued
+        bool overflowing = overflow_events && !overflow_events->empty();
+        if (!overflowing && num_inline_events < INLINE_CAPACITY)
+        {
+            inline_events[(first_inline_event + num_inline_events) % INLINE_CAPACITY]
+                .emplace(std::move(event));
+            num_inline_events++;
+            return;
+        }
+
+        if (!overflow_events)
+        {
+            overflow_events = std::make_unique<std::deque<T>>();
+        }
+        overflow_events->push_back(std::move(event));
+    }
+
+    /**
+     * Removes the event that was queued first
+     */
+    void pop()
+    {
+        if (num_inline_events > 0)
+        {
+            inline_events[first_inline_event].reset();
+            first_inline_event = (first_inline_event + 1) % INLINE_CAPACITY;
+            num_inline_events--;
+            return;
+        }
+        overflow_events->pop_front();
+    }
+
+   private:
+    static constexpr std::size_t INLINE_CAPACITY = 4;
+
+    std::array<std::optional<T>, INLINE_CAPACITY> inline_events;
+    std::size_t first_inline_event = 0;
+    std::size_t num_inline_events  = 0;
+    // Only created if more than INLINE_CAPACITY events are queued at once
+    std::unique_ptr<std::deque<T>> overflow_events;
+};
+
 // An alias for an FSM
 template <class T>
-using FSM = boost::sml::sm<T, boost::sml::process_queue<std::queue>>;
+using FSM = boost::sml::sm<T, boost::sml::process_queue<FSMEventQueue>>;
 
 /**
  * Defines an SML state wrapper around a class/struct
@@ -67,7 +179,42 @@ using FSM = boost::sml::sm<T, boost::sml::process_queue<std::queue>>;
  *
  * @return the string without the extraneous information
  */
-std::string stripFSMState(std::string s);
+constexpr std::string_view stripFSMState(std::string_view s)
+{
+    auto pos = s.find_last_of(":<");
+    if (pos != std::string_view::npos)
+    {
+        s = s.substr(pos + 1);
+    }
+
+    return s.substr(0, s.find_first_of('>'));
+}
+
+/**
+ * Gets the name of a state of an FSM at compile time, from the signature of this
+ * function that the compiler generates, so that naming the state does not need to
+ * demangle its typeid name
+ *
+ * Note: This is only meant for naming FSM states, which are plain classes. Compilers
+ * write types in their signatures differently from typeid (ex. default template
+ * arguments are left out, and array types contain a ']'), so this is not a general
+ * replacement for TYPENAME
+ *
+ * @tparam State The type sml names the state with
+ *
+ * @return the human-friendly name of the state
+ */
+template <class State>
+constexpr std::string_view getFSMStateName()
+{
+    // GCC and clang end the signature with the template arguments, as
+    // "[with State = ns::StateA; ...]" and "[State = ns::StateA]" respectively
+    std::string_view signature = __PRETTY_FUNCTION__;
+    std::string_view prefix    = "State = ";
+    std::size_t start          = signature.find(prefix) + prefix.size();
+    std::size_t end            = signature.find_first_of(";]", start);
+    return stripFSMState(signature.substr(start, end - start));
+}
 
 /**
  * Gets the current state name of the FSM
@@ -82,8 +229,9 @@ std::string getCurrentStateName(const SM& state_machine)
 {
     std::string name;
     state_machine.visit_current_states([&name](const auto& state) {
-        name = stripFSMState(TYPENAME(
-            boost::sml::back::policies::get_state_name_t<std::decay_t<decltype(state)>>));
+        using state_name_t = boost::sml::back::policies::get_state_name_t<
+            std::decay_t<decltype(state)>>;
+        name = getFSMStateName<state_name_t>();
     });
     return name;
 }
@@ -124,10 +272,10 @@ std::string getCurrentSubStateName(const SM& state_machine)
     std::string name;
     state_machine.template visit_current_states<SSM>([&name,
                                                       &state_machine](const auto& state) {
-        name               = stripFSMState(TYPENAME(
-            boost::sml::back::policies::get_state_name_t<std::decay_t<decltype(state)>>));
         using state_repr_t = std::decay_t<decltype(state)>;
         using state_t      = typename state_repr_t::type;
+        using state_name_t = boost::sml::back::policies::get_state_name_t<state_repr_t>;
+        name               = getFSMStateName<state_name_t>();
         if constexpr (is_sub_state_machine<state_t>::value)
         {
             using state_machine_t = typename state_machine_impl<state_t>::type;
@@ -0,0 +1,190 @@
+#include "software/util/sml_fsm/sml_fsm.h"
+
+#include <gtest/gtest.h>
+
+#include "software/test_util/allocation_counter.h"
+
+namespace TestNamespace
+{
+    struct IdleState
+    {
+    };
+
+    struct TestFSM
+    {
+        class MoveState;
+    };
+}  // namespace TestNamespace
+
+TEST(SmlFsmTest, test_get_fsm_state_name)
+{
+    static_assert(getFSMStateName<TestNamespace::IdleState>() == "IdleState");
+    EXPECT_EQ("MoveState", getFSMStateName<TestNamespace::TestFSM::MoveState>());
+
+    // Sub FSMs are named by the class that defines them
+    using SubFSM =
+        boost::sml::back::sm<boost::sml::back::sm_policy<TestNamespace::TestFSM>>;
+    EXPECT_EQ("TestFSM", getFSMStateName<SubFSM>());
+}
+
+/**
+ * Checks whether the front event of the queue is stored inside the queue itself rather
+ * than in its overflow storage
+ *
+ * @param queue The queue to check
+ *
+ * @return whether the front event is stored inline
+ */
+static bool isFrontInline(FSMEventQueue<int>& queue)
+{
+    const char* queue_begin = reinterpret_cast<const char*>(&queue);
+    const char* front       = reinterpret_cast<const char*>(&queue.front());
+    return front >= queue_begin && front < queue_begin + sizeof(queue);
+}
+
+TEST(FSMEventQueueTest, events_are_processed_in_order_across_inline_and_overflow)
+{
+    FSMEventQueue<int> queue;
+    EXPECT_TRUE(queue.empty());
+
+    for (int i = 0; i < 10; i++)
+    {
+        queue.push(i);
+    }
+    EXPECT_EQ(10, queue.size());
+
+    for (int i = 0; i < 10; i++)
+    {
+        ASSERT_FALSE(queue.empty());
+        EXPECT_EQ(i, queue.front());
+        EXPECT_EQ(i < 4, isFrontInline(queue));
+        queue.pop();
+    }
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(0, queue.size());
+}
+
+TEST(FSMEventQueueTest, inline_events_wrap_around_without_allocating)
+{
+    FSMEventQueue<int> queue;
+
+    // Keep two to three events queued so the front of the ring buffer moves through
+    // every slot many times
+    TestUtil::AllocationCounter allocation_counter;
+    int next_event_to_push = 0;
+    int next_event_to_pop  = 0;
+    for (int i = 0; i < 20; i++)
+    {
+        queue.push(next_event_to_push++);
+        queue.push(next_event_to_push++);
+        queue.push(next_event_to_push++);
+        for (int j = 0; j < 3 && queue.size() > 1; j++)
+        {
+            EXPECT_EQ(next_event_to_pop++, queue.front());
+            EXPECT_TRUE(isFrontInline(queue));
+            queue.pop();
+        }
+    }
+    EXPECT_EQ(0, allocation_counter.getNumAllocations());
+
+    while (!queue.empty())
+    {
+        EXPECT_EQ(next_event_to_pop++, queue.front());
+        queue.pop();
+    }
+    EXPECT_EQ(next_event_to_push, next_event_to_pop);
+}
+
+TEST(FSMEventQueueTest, queue_uses_inline_storage_again_after_overflow_drains)
+{
+    FSMEventQueue<int> queue;
+    for (int i = 0; i < 6; i++)
+    {
+        queue.push(i);
+    }
+
+    // Pop the inline events. Events pushed while the overflow is not empty have to
+    // wait behind it
+    for (int i = 0; i < 4; i++)
+    {
+        EXPECT_EQ(i, queue.front());
+        queue.pop();
+    }
+    queue.push(6);
+    for (int i = 4; i < 7; i++)
+    {
+        EXPECT_EQ(i, queue.front());
+        EXPECT_FALSE(isFrontInline(queue));
+        queue.pop();
+    }
+    EXPECT_TRUE(queue.empty());
+
+    // Once the overflow is drained, new events are stored inline again
+    for (int i = 7; i < 11; i++)
+    {
+        queue.push(i);
+    }
+    for (int i = 7; i < 11; i++)
+    {
+        EXPECT_EQ(i, queue.front());
+        EXPECT_TRUE(isFrontInline(queue));
+        queue.pop();
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+/**
+ * A move only event, like the events that boost::sml queues with process_queue. They
+ * are implicitly created from the event that is processed and can not be copied
+ */
+class MoveOnlyEvent
+{
+   public:
+    MoveOnlyEvent(int id) : id(std::make_unique<int>(id)) {}
+    MoveOnlyEvent(MoveOnlyEvent&& other)                 = default;
+    MoveOnlyEvent& operator=(MoveOnlyEvent&& other)      = default;
+    MoveOnlyEvent(const MoveOnlyEvent& other)            = delete;
+    MoveOnlyEvent& operator=(const MoveOnlyEvent& other) = delete;
+
+    std::unique_ptr<int> id;
+};
+
+TEST(FSMEventQueueTest, move_only_events_are_queued_in_order)
+{
+    FSMEventQueue<MoveOnlyEvent> queue;
+    for (int i = 0; i < 6; i++)
+    {
+        queue.push(i);
+    }
+    queue.push(MoveOnlyEvent(6));
+
+    for (int i = 0; i < 7; i++)
+    {
+        ASSERT_TRUE(queue.front().id);
+        EXPECT_EQ(i, *queue.front().id);
+        queue.pop();
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(FSMEventQueueTest, events_pushed_while_processing_the_front_do_not_move_it)
+{
+    // Like an FSM processing its queue, handle the front event while more events are
+    // queued, and only pop it once it has been handled
+    FSMEventQueue<int> queue;
+    queue.push(0);
+    int num_processed_events = 0;
+    while (!queue.empty())
+    {
+        const int& event = queue.front();
+        if (event < 20)
+        {
+            queue.push(event + 1);
+            queue.push(event + 100);
+        }
+        EXPECT_EQ(&event, &queue.front());
+        queue.pop();
+        num_processed_events++;
+    }
+    EXPECT_EQ(41, num_processed_events);
+}
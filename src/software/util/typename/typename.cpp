@@ -1,5 +1,8 @@
 #include "software/util/typename/typename.h"
 
+#include <typeindex>
+#include <unordered_map>
+
 std::string demangleTypeId(const char* mangled_name)
 {
     auto demangled_name_char_ptr = abi::__cxa_demangle(mangled_name, NULL, NULL, NULL);
@@ -7,3 +10,17 @@ std::string demangleTypeId(const char* mangled_name)
     free(demangled_name_char_ptr);
     return demangled_name;
 }
+
+const std::string& internedTypeName(const std::type_info& type_info)
+{
+    // Each thread keeps its own names so that no locking is needed. References to the
+    // names stay valid as more names are added
+    thread_local std::unordered_map<std::type_index, std::string> type_names;
+
+    auto iter = type_names.find(type_info);
+    if (iter == type_names.end())
+    {
+        iter = type_names.emplace(type_info, demangleTypeId(type_info.name())).first;
+    }
+    return iter->second;
+}
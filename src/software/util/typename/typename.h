@@ -3,6 +3,8 @@
 #include <cxxabi.h>
 
 #include <memory>
+#include <string>
+#include <typeinfo>
 
 /**
  * Demangles typeid name
@@ -13,6 +15,17 @@
  */
 std::string demangleTypeId(const char* mangled_name);
 
+/**
+ * Gets the demangled name of the type with the given type info. Each type is only
+ * demangled the first time its name is requested on each thread, after which the same
+ * name is returned
+ *
+ * @param type_info The type info of the type, from typeid
+ *
+ * @return the demangled string representation
+ */
+const std::string& internedTypeName(const std::type_info& type_info);
+
 /**
  * Gets the demangled typeid name of an object reference
  *
@@ -27,9 +40,9 @@ std::string demangleTypeId(const char* mangled_name);
  * @return the demangled string representation
  */
 template <typename T>
-std::string objectTypeName(const T& obj_ref)
+const std::string& objectTypeName(const T& obj_ref)
 {
-    return demangleTypeId(typeid(obj_ref).name());
+    return internedTypeName(typeid(obj_ref));
 }
 
 /**
@@ -43,4 +56,4 @@ std::string objectTypeName(const T& obj_ref)
  *
  * @return the string representation of the object
  */
-#define TYPENAME(object) (demangleTypeId(typeid(object).name()))
+#define TYPENAME(object) (internedTypeName(typeid(object)))
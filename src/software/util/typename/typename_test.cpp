@@ -26,3 +26,11 @@ TEST(TypeNameTest, test_class_type_name)
     EXPECT_EQ("TestType", TYPENAME(TestType));
     EXPECT_EQ("TestTypeA", TYPENAME(TestTypeA));
 }
+
+TEST(TypeNameTest, test_type_names_are_interned)
+{
+    TestTypeA object_a;
+    const TestType& object_ref = object_a;
+    EXPECT_EQ(&objectTypeName(object_ref), &TYPENAME(TestTypeA));
+    EXPECT_EQ(&objectTypeName(object_a), &objectTypeName(TestTypeA()));
+}
@@ -1,5 +1,7 @@
 #include "software/world/team.h"
 
+#include <algorithm>
+#include <limits>
 #include <set>
 
 #include "shared/constants.h"
@@ -39,25 +41,30 @@ Team::Team(const TbotsProto::Team& team_proto,
     {
         team_robots_.emplace_back(Robot(team_proto.team_robots(i)));
     }
+    updateRobotPositions();
 }
 
 void Team::updateRobots(const std::vector<Robot>& new_robots)
 {
-    // Update the robots, checking that there are no duplicate IDs in the given data
-    std::set<unsigned int> robot_ids;
-    for (const auto& robot : new_robots)
+    // Check that there are no duplicate IDs in the given data before any robot is
+    // changed, so that the team is left as it was if the data is rejected. Teams are
+    // small, so the robots before each robot are checked directly instead of
+    // allocating a set of ids
+    for (auto robot_it = new_robots.begin(); robot_it != new_robots.end(); robot_it++)
     {
-        // The second value of the pair that is returned indicates whether or not the
-        // value was already present in the set. We use this to detect duplicate robots
-        auto duplicate_id = robot_ids.insert(robot.id());
-        if (!duplicate_id.second)
+        const Robot& robot = *robot_it;
+        if (std::any_of(new_robots.begin(), robot_it,
+                        [&robot](const Robot& r) { return r.id() == robot.id(); }))
         {
             throw std::invalid_argument(
                 "Error: Multiple robots on the same team with the same id");
         }
+    }
 
+    for (const Robot& robot : new_robots)
+    {
         auto it = std::find_if(team_robots_.begin(), team_robots_.end(),
-                               [robot](const Robot& r) { return r.id() == robot.id(); });
+                               [&robot](const Robot& r) { return r.id() == robot.id(); });
         if (it != team_robots_.end())
         {
             // The robot already exists on the team. Find and update the robot
@@ -69,6 +76,7 @@ void Team::updateRobots(const std::vector<Robot>& new_robots)
             team_robots_.emplace_back(robot);
         }
     }
+    updateRobotPositions();
 
     updateTimestamp(getMostRecentTimestampFromRobots());
 }
@@ -102,6 +110,7 @@ void Team::removeExpiredRobots(const Timestamp& timestamp)
             it++;
         }
     }
+    updateRobotPositions();
 }
 
 void Team::removeRobotWithId(unsigned int robot_id)
@@ -112,6 +121,7 @@ void Team::removeRobotWithId(unsigned int robot_id)
     if (it != team_robots_.end())
     {
         team_robots_.erase(it);
+        updateRobotPositions();
     }
 }
 
@@ -204,7 +214,26 @@ std::vector<Robot> Team::getAllRobotsExceptGoalie() const
 
 std::optional<Robot> Team::getNearestRobot(const Point& ref_point) const
 {
-    return getNearestRobot(this->getAllRobots(), ref_point);
+    if (team_robots_.empty())
+    {
+        return std::nullopt;
+    }
+
+    std::size_t nearest_index       = 0;
+    double nearest_distance_squared = std::numeric_limits<double>::max();
+    for (std::size_t i = 0; i < robot_xs_.size(); i++)
+    {
+        double x_diff           = robot_xs_[i] - ref_point.x();
+        double y_diff           = robot_ys_[i] - ref_point.y();
+        double distance_squared = x_diff * x_diff + y_diff * y_diff;
+        if (distance_squared < nearest_distance_squared)
+        {
+            nearest_index            = i;
+            nearest_distance_squared = distance_squared;
+        }
+    }
+
+    return team_robots_[nearest_index];
 }
 
 std::optional<Robot> Team::getNearestRobot(const std::vector<Robot>& robots,
@@ -215,22 +244,99 @@ std::optional<Robot> Team::getNearestRobot(const std::vector<Robot>& robots,
         return std::nullopt;
     }
 
-    Robot nearest_robot = robots.at(0);
+    const Robot* nearest_robot = &robots.at(0);
     for (const Robot& curRobot : robots)
     {
-        double curDistance = (ref_point - curRobot.position()).length();
-        if (curDistance < (nearest_robot.position() - ref_point).length())
+        double curDistance = (ref_point - curRobot.position()).lengthSquared();
+        if (curDistance < (nearest_robot->position() - ref_point).lengthSquared())
+        {
+            nearest_robot = &curRobot;
+        }
+    }
+
+    return *nearest_robot;
+}
+
+std::vector<Robot> Team::getNearestRobots(const Point& ref_point,
+                                          std::size_t num_robots) const
+{
+    std::vector<std::pair<double, std::size_t>> distances_squared;
+    distances_squared.reserve(robot_xs_.size());
+    for (std::size_t i = 0; i < robot_xs_.size(); i++)
+    {
+        double x_diff = robot_xs_[i] - ref_point.x();
+        double y_diff = robot_ys_[i] - ref_point.y();
+        distances_squared.emplace_back(x_diff * x_diff + y_diff * y_diff, i);
+    }
+
+    num_robots = std::min(num_robots, distances_squared.size());
+    std::partial_sort(distances_squared.begin(),
+                      distances_squared.begin() + static_cast<long>(num_robots),
+                      distances_squared.end());
+
+    std::vector<Robot> nearest_robots;
+    nearest_robots.reserve(num_robots);
+    for (std::size_t i = 0; i < num_robots; i++)
+    {
+        nearest_robots.emplace_back(team_robots_[distances_squared[i].second]);
+    }
+    return nearest_robots;
+}
+
+std::vector<Robot> Team::getRobotsWithinDistance(const Point& point,
+                                                 double max_distance) const
+{
+    double max_distance_squared = max_distance * max_distance;
+    std::vector<Robot> robots;
+    for (std::size_t i = 0; i < robot_xs_.size(); i++)
+    {
+        double x_diff = robot_xs_[i] - point.x();
+        double y_diff = robot_ys_[i] - point.y();
+        if (x_diff * x_diff + y_diff * y_diff <= max_distance_squared)
         {
-            nearest_robot = curRobot;
+            robots.emplace_back(team_robots_[i]);
         }
     }
+    return robots;
+}
+
+std::vector<Robot> Team::getRobotsNearSegment(const Segment& segment,
+                                              double max_distance) const
+{
+    double max_distance_squared = max_distance * max_distance;
+    Point start                 = segment.getStart();
+    Vector direction            = segment.toVector();
+    double length_squared       = direction.lengthSquared();
+
+    std::vector<Robot> robots;
+    for (std::size_t i = 0; i < robot_xs_.size(); i++)
+    {
+        double x_diff = robot_xs_[i] - start.x();
+        double y_diff = robot_ys_[i] - start.y();
 
-    return nearest_robot;
+        // Move to the closest point on the segment to the robot
+        double fraction = 0;
+        if (length_squared > 0)
+        {
+            fraction = std::clamp(
+                (x_diff * direction.x() + y_diff * direction.y()) / length_squared, 0.0,
+                1.0);
+        }
+        x_diff -= fraction * direction.x();
+        y_diff -= fraction * direction.y();
+
+        if (x_diff * x_diff + y_diff * y_diff <= max_distance_squared)
+        {
+            robots.emplace_back(team_robots_[i]);
+        }
+    }
+    return robots;
 }
 
 void Team::clearAllRobots()
 {
     team_robots_.clear();
+    updateRobotPositions();
 }
 
 Timestamp Team::getMostRecentTimestamp() const
@@ -282,6 +388,17 @@ std::optional<Timestamp> Team::timestamp() const
     return most_recent_timestamp;
 }
 
+void Team::updateRobotPositions()
+{
+    robot_xs_.resize(team_robots_.size());
+    robot_ys_.resize(team_robots_.size());
+    for (std::size_t i = 0; i < team_robots_.size(); i++)
+    {
+        robot_xs_[i] = team_robots_[i].position().x();
+        robot_ys_[i] = team_robots_[i].position().y();
+    }
+}
+
 bool Team::operator==(const Team& other) const
 {
     return this->getAllRobots() == other.getAllRobots() &&
@@ -5,6 +5,7 @@
 #include <optional>
 #include <vector>
 
+#include "software/geom/segment.h"
 #include "software/time/timestamp.h"
 #include "software/world/robot.h"
 
@@ -46,7 +47,8 @@ class Team
     /**
      * Updates this team with new robots.
      *
-     * @throws std::invalid_argument if multiple robots have the same id
+     * @throws std::invalid_argument if multiple robots have the same id, in which case
+     * the team is left unchanged
      * @param team_robots the new robots for this team
      */
     void updateRobots(const std::vector<Robot>& team_robots);
@@ -199,6 +201,45 @@ class Team
     static std::optional<Robot> getNearestRobot(const std::vector<Robot>& robots,
                                                 const Point& ref_point);
 
+    /**
+     * Finds the robots on this team that are closest to a reference point
+     *
+     * @param ref_point The point where the distance to each robot will be measured
+     * @param num_robots The number of robots to find
+     *
+     * @return The num_robots robots closest to the reference point, sorted from the
+     * closest to the furthest. If the team has fewer robots, all of them are returned
+     */
+    std::vector<Robot> getNearestRobots(const Point& ref_point,
+                                        std::size_t num_robots) const;
+
+    /**
+     * Finds the robots on this team within a distance of a point. Robots exactly at
+     * the distance are included
+     *
+     * @param point The point to measure the distance to each robot from
+     * @param max_distance The maximum distance from the point
+     *
+     * @return The robots within the distance of the point, in the same order as
+     * getAllRobots
+     */
+    std::vector<Robot> getRobotsWithinDistance(const Point& point,
+                                               double max_distance) const;
+
+    /**
+     * Finds the robots on this team within a distance of a segment, ie. the robots in a
+     * corridor along the segment (ex. the robots that could block a pass). Robots
+     * exactly at the distance are included
+     *
+     * @param segment The segment to measure the distance to each robot from
+     * @param max_distance The maximum distance from the segment
+     *
+     * @return The robots within the distance of the segment, in the same order as
+     * getAllRobots
+     */
+    std::vector<Robot> getRobotsNearSegment(const Segment& segment,
+                                            double max_distance) const;
+
     /**
      * Removes all Robots from this team. Does not affect the goalie id.
      */
@@ -255,9 +296,20 @@ class Team
      */
     Timestamp getMostRecentTimestampFromRobots();
 
+    /**
+     * Copies the positions of the robots into robot_xs_ and robot_ys_. This must be
+     * done whenever the robots on this team change
+     */
+    void updateRobotPositions();
+
     // The robots on this team
     std::vector<Robot> team_robots_;
 
+    // The positions of the robots, in the same order as team_robots_. The nearest robot
+    // and distance queries scan these compact arrays instead of the much larger robots
+    std::vector<double> robot_xs_;
+    std::vector<double> robot_ys_;
+
     // The robot id of the goalie for this team
     std::optional<unsigned int> goalie_id_;
 
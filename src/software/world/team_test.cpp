@@ -550,6 +550,127 @@ TEST_F(TeamTest, nearest_friendy_one_robot_on_ball)
     EXPECT_EQ(robot_0, team.getNearestRobot(Point(0, 0)));
 }
 
+TEST_F(TeamTest, nearest_robot_after_removing_robots)
+{
+    Team team = Team(Duration::fromMilliseconds(1000));
+
+    Robot robot_0 = Robot(0, Point(1, 0), Vector(), Angle::zero(),
+                          AngularVelocity::zero(), current_time);
+    Robot robot_1 = Robot(1, Point(2, 0), Vector(), Angle::zero(),
+                          AngularVelocity::zero(), current_time);
+
+    team.updateRobots({robot_0, robot_1});
+    team.removeRobotWithId(0);
+
+    EXPECT_EQ(robot_1, team.getNearestRobot(Point(0, 0)));
+
+    team.clearAllRobots();
+
+    EXPECT_EQ(std::nullopt, team.getNearestRobot(Point(0, 0)));
+}
+
+TEST_F(TeamTest, nearest_robot_follows_robot_updates)
+{
+    Team team = Team(Duration::fromMilliseconds(1000));
+
+    team.updateRobots({Robot(0, Point(1, 0), Vector(), Angle::zero(),
+                             AngularVelocity::zero(), current_time),
+                       Robot(1, Point(2, 0), Vector(), Angle::zero(),
+                             AngularVelocity::zero(), current_time)});
+
+    Robot moved_robot_1 = Robot(1, Point(0.5, 0), Vector(), Angle::zero(),
+                                AngularVelocity::zero(), one_second_future);
+    team.updateRobots({moved_robot_1});
+
+    EXPECT_EQ(moved_robot_1, team.getNearestRobot(Point(0, 0)));
+}
+
+TEST_F(TeamTest, update_with_duplicate_ids_leaves_team_unchanged)
+{
+    Team team = Team(Duration::fromMilliseconds(1000));
+
+    Robot robot_0 = Robot(0, Point(1, 0), Vector(), Angle::zero(),
+                          AngularVelocity::zero(), current_time);
+    Robot robot_1 = Robot(1, Point(2, 0), Vector(), Angle::zero(),
+                          AngularVelocity::zero(), current_time);
+    team.updateRobots({robot_0, robot_1});
+
+    // The first robot in the update is valid, and the duplicate id is only found after it
+    Robot moved_robot_1 = Robot(1, Point(0.5, 0), Vector(), Angle::zero(),
+                                AngularVelocity::zero(), one_second_future);
+    Robot new_robot_2   = Robot(2, Point(0.1, 0), Vector(), Angle::zero(),
+                                AngularVelocity::zero(), one_second_future);
+    EXPECT_THROW(team.updateRobots({moved_robot_1, new_robot_2, moved_robot_1}),
+                 std::invalid_argument);
+
+    EXPECT_EQ(std::vector<Robot>({robot_0, robot_1}), team.getAllRobots());
+    EXPECT_EQ(robot_0, team.getNearestRobot(Point(0, 0)));
+    EXPECT_EQ(std::vector<Robot>({robot_0, robot_1}),
+              team.getNearestRobots(Point(0, 0), 3));
+    EXPECT_EQ(current_time, team.timestamp());
+}
+
+TEST_F(TeamTest, get_nearest_robots)
+{
+    Team team = Team(Duration::fromMilliseconds(1000));
+
+    Robot robot_0 = Robot(0, Point(3, -1), Vector(), Angle::zero(),
+                          AngularVelocity::zero(), current_time);
+    Robot robot_1 = Robot(1, Point(1, 0), Vector(), Angle::zero(),
+                          AngularVelocity::zero(), current_time);
+    Robot robot_2 = Robot(2, Point(4, 6), Vector(), Angle::zero(),
+                          AngularVelocity::zero(), current_time);
+
+    team.updateRobots({robot_0, robot_1, robot_2});
+
+    EXPECT_EQ(std::vector<Robot>({robot_1, robot_0}),
+              team.getNearestRobots(Point(0, 0), 2));
+    EXPECT_EQ(std::vector<Robot>({robot_1, robot_0, robot_2}),
+              team.getNearestRobots(Point(0, 0), 5));
+    EXPECT_TRUE(team.getNearestRobots(Point(0, 0), 0).empty());
+}
+
+TEST_F(TeamTest, get_robots_within_distance)
+{
+    Team team = Team(Duration::fromMilliseconds(1000));
+
+    Robot robot_0 = Robot(0, Point(3, -1), Vector(), Angle::zero(),
+                          AngularVelocity::zero(), current_time);
+    Robot robot_1 = Robot(1, Point(1, 0), Vector(), Angle::zero(),
+                          AngularVelocity::zero(), current_time);
+    Robot robot_2 = Robot(2, Point(0, -2), Vector(), Angle::zero(),
+                          AngularVelocity::zero(), current_time);
+
+    team.updateRobots({robot_0, robot_1, robot_2});
+
+    // Robots exactly at the distance are included
+    EXPECT_EQ(std::vector<Robot>({robot_1, robot_2}),
+              team.getRobotsWithinDistance(Point(0, 0), 2));
+    EXPECT_TRUE(team.getRobotsWithinDistance(Point(-2, 2), 1).empty());
+}
+
+TEST_F(TeamTest, get_robots_near_segment)
+{
+    Team team = Team(Duration::fromMilliseconds(1000));
+
+    Robot robot_0 = Robot(0, Point(1, 0.2), Vector(), Angle::zero(),
+                          AngularVelocity::zero(), current_time);
+    Robot robot_1 = Robot(1, Point(1, 0.5), Vector(), Angle::zero(),
+                          AngularVelocity::zero(), current_time);
+    Robot robot_2 = Robot(2, Point(2.1, 0), Vector(), Angle::zero(),
+                          AngularVelocity::zero(), current_time);
+    Robot robot_3 = Robot(3, Point(3, 0), Vector(), Angle::zero(),
+                          AngularVelocity::zero(), current_time);
+
+    team.updateRobots({robot_0, robot_1, robot_2, robot_3});
+
+    // Robots past the end of the segment are measured from the end
+    EXPECT_EQ(std::vector<Robot>({robot_0, robot_2}),
+              team.getRobotsNearSegment(Segment(Point(0, 0), Point(2, 0)), 0.25));
+    EXPECT_EQ(std::vector<Robot>({robot_0, robot_1}),
+              team.getRobotsNearSegment(Segment(Point(1, 0), Point(1, 0)), 0.5));
+}
+
 TEST_F(TeamTest, nearest_robot_zero_robots)
 {
     Team team = Team(Duration::fromMilliseconds(1000));
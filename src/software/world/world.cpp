@@ -8,6 +8,7 @@ World::World(const Field &field, const Ball &ball, const Team &friendly_team,
       ball_(ball),
       friendly_team_(friendly_team),
       enemy_team_(enemy_team),
+      enemy_open_circle_finder_(std::nullopt),
       current_game_state_(),
       current_referee_stage_(),
       last_update_timestamp_(),
@@ -41,6 +42,7 @@ void World::updateFriendlyTeamState(const Team &new_friendly_team_data)
 void World::updateEnemyTeamState(const Team &new_enemy_team_data)
 {
     enemy_team_.updateState(new_enemy_team_data);
+    updateEnemyOpenCircleFinder();
     updateTimestamp(getMostRecentTimestampFromMembers());
 }
 
@@ -77,6 +79,17 @@ const Team &World::enemyTeam() const
     return enemy_team_;
 }
 
+const std::optional<OpenCircleFinder> &World::enemyOpenCircleFinder() const
+{
+    return enemy_open_circle_finder_;
+}
+
+void World::setEnemyOpenCircleFinder(const OpenCircleFinder &enemy_open_circle_finder)
+{
+    enemy_open_circle_finder_ = enemy_open_circle_finder;
+    updateEnemyOpenCircleFinder();
+}
+
 void World::updateRefereeCommand(const RefereeCommand &command)
 {
     referee_command_history_.push_back(command);
@@ -125,6 +138,21 @@ Timestamp World::getMostRecentTimestampFromMembers()
     return std::max(member_timestamps);
 }
 
+void World::updateEnemyOpenCircleFinder()
+{
+    if (!enemy_open_circle_finder_)
+    {
+        return;
+    }
+
+    std::vector<Point> enemy_locations;
+    for (const Robot &robot : enemy_team_.getAllRobots())
+    {
+        enemy_locations.emplace_back(robot.position());
+    }
+    enemy_open_circle_finder_->update(enemy_locations);
+}
+
 const Timestamp World::getMostRecentTimestamp() const
 {
     return last_update_timestamp_;
@@ -3,6 +3,7 @@
 
 #include <boost/circular_buffer.hpp>
 
+#include "software/geom/algorithms/open_circle_finder.h"
 #include "software/world/ball.h"
 #include "software/world/field.h"
 #include "software/world/game_state.h"
@@ -114,6 +115,27 @@ class World final
      */
     const Team& enemyTeam() const;
 
+    /**
+     * Returns the OpenCircleFinder for the positions of the enemy robots, if this World
+     * was given one with setEnemyOpenCircleFinder. It is kept up to date with the Enemy
+     * Team, and is shared by everything that looks for open areas around the enemy
+     * robots (ex. chip targets)
+     *
+     * @return the OpenCircleFinder for the enemy robots, or std::nullopt if this World
+     * was not given one
+     */
+    const std::optional<OpenCircleFinder>& enemyOpenCircleFinder() const;
+
+    /**
+     * Sets the OpenCircleFinder for the positions of the enemy robots and updates it
+     * with the current Enemy Team. The finder is meant to come from whatever creates a
+     * World every frame (ex. SensorFusion), so that its triangulation is kept between
+     * frames instead of being built from scratch for every World
+     *
+     * @param enemy_open_circle_finder The OpenCircleFinder to take a copy of
+     */
+    void setEnemyOpenCircleFinder(const OpenCircleFinder& enemy_open_circle_finder);
+
     /**
      * Returns a const reference to the Game State
      *
@@ -203,10 +225,17 @@ class World final
      */
     Timestamp getMostRecentTimestampFromMembers();
 
+    /**
+     * Updates the OpenCircleFinder for the enemy robots with their current positions,
+     * if this World has one
+     */
+    void updateEnemyOpenCircleFinder();
+
     Field field_;
     Ball ball_;
     Team friendly_team_;
     Team enemy_team_;
+    std::optional<OpenCircleFinder> enemy_open_circle_finder_;
     GameState current_game_state_;
     RefereeStage current_referee_stage_;
     Timestamp last_update_timestamp_;
@@ -214,3 +214,29 @@ TEST_F(WorldTest, set_team_with_possession)
     world.setTeamWithPossession(TeamPossession::ENEMY_TEAM);
     EXPECT_EQ(world.getTeamWithPossession(), TeamPossession::ENEMY_TEAM);
 }
+
+TEST_F(WorldTest, enemy_open_circle_finder_is_not_built_by_default)
+{
+    EXPECT_FALSE(world.enemyOpenCircleFinder().has_value());
+}
+
+TEST_F(WorldTest, enemy_open_circle_finder_follows_enemy_team)
+{
+    Rectangle rectangle(Point(-2, -3), Point(3, 2));
+    world.setEnemyOpenCircleFinder(OpenCircleFinder());
+
+    OpenCircleFinder expected_open_circle_finder;
+    expected_open_circle_finder.update({Point(0.5, -2.5), Point()});
+    ASSERT_TRUE(world.enemyOpenCircleFinder().has_value());
+    EXPECT_EQ(expected_open_circle_finder.findOpenCircles(rectangle),
+              world.enemyOpenCircleFinder()->findOpenCircles(rectangle));
+
+    Team new_enemy_team(Duration::fromMilliseconds(1000));
+    new_enemy_team.updateRobots({Robot(1, Point(1, 1), Vector(), Angle::zero(),
+                                       AngularVelocity::zero(), current_time)});
+    world.updateEnemyTeamState(new_enemy_team);
+
+    expected_open_circle_finder.update({Point(0.5, -2.5), Point(1, 1)});
+    EXPECT_EQ(expected_open_circle_finder.findOpenCircles(rectangle),
+              world.enemyOpenCircleFinder()->findOpenCircles(rectangle));
+}